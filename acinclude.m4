@@ -1,6 +1,6 @@
 dnl Checks for required headers and functions
 dnl
-dnl Version: 20260610
+dnl Version: 20261018
 
 dnl Function to detect if libcthreads dependencies are available
 AC_DEFUN([AX_LIBCTHREADS_CHECK_LOCAL],
@@ -10,6 +10,75 @@ AC_DEFUN([AX_LIBCTHREADS_CHECK_LOCAL],
     AX_PTHREAD_CHECK_ENABLE
       ac_cv_libcthreads_multi_threading=$ac_cv_pthread],
     [ac_cv_libcthreads_multi_threading="winapi"])
+
+  dnl Check for futex support, used by the light mutex
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_HEADERS([linux/futex.h sched.h sys/syscall.h])
+
+    AC_CHECK_FUNCS([sched_yield])
+    ])
+
+  dnl Check for clock support, used by the futex fallback and the timed waits
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_FUNCS([clock_gettime pthread_condattr_setclock])
+    ])
+
+  dnl Check for processor support, used by the sharded read/write lock
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_FUNCS([sched_getcpu sysconf])
+    ])
+
+  dnl Check for timed lock and sleep support, used by the timed grab of the read/write lock
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_FUNCS([nanosleep pthread_rwlock_timedrdlock pthread_rwlock_timedwrlock])
+    ])
+  ])
+
+dnl Function to detect if lock profiling should be enabled
+AC_DEFUN([AX_LIBCTHREADS_CHECK_ENABLE_LOCK_PROFILING],
+  [AX_COMMON_ARG_ENABLE(
+    [lock-profiling],
+    [lock_profiling],
+    [enable lock contention profiling],
+    [no])
+
+  AS_IF(
+    [test "x$ac_cv_enable_lock_profiling" != xno],
+    [AC_DEFINE(
+      [HAVE_LOCK_PROFILING],
+      [1],
+      [Define to 1 if lock contention profiling should be used.])
+
+    ac_cv_enable_lock_profiling=yes])
+  ])
+
+dnl Function to detect if the lock order validator should be enabled
+AC_DEFUN([AX_LIBCTHREADS_CHECK_ENABLE_LOCK_VALIDATOR],
+  [AX_COMMON_ARG_ENABLE(
+    [lock-validator],
+    [lock_validator],
+    [enable the lock order validator],
+    [no])
+
+  AS_IF(
+    [test "x$ac_cv_enable_lock_validator" != xno],
+    [AC_DEFINE(
+      [HAVE_LOCK_VALIDATOR],
+      [1],
+      [Define to 1 if the lock order validator should be used.])
+
+    AS_IF(
+      [test "x$ac_cv_enable_winapi" = xno],
+      [AC_CHECK_HEADERS([execinfo.h])
+
+      AC_CHECK_FUNCS([backtrace backtrace_symbols])
+      ])
+
+    ac_cv_enable_lock_validator=yes])
   ])
 
 dnl Function to check if DLL support is needed
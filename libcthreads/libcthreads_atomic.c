@@ -0,0 +1,1564 @@
+/*
+ * Atomic functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libcthreads_atomic.h"
+#include "libcthreads_definitions.h"
+#include "libcthreads_libcerror.h"
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Retrieves a 32-bit integer value that is modified by other threads
+ * The memory order must be relaxed, acquire or sequentially consistent
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_atomic_int32_load(
+     int32_t *value,
+     int memory_order,
+     int32_t *loaded_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libcthreads_atomic_int32_load";
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_order != LIBCTHREADS_MEMORY_ORDER_RELAXED )
+	 && ( memory_order != LIBCTHREADS_MEMORY_ORDER_ACQUIRE )
+	 && ( memory_order != LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory order: %d.",
+		 function,
+		 memory_order );
+
+		return( -1 );
+	}
+	if( loaded_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid loaded value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+	switch( memory_order )
+	{
+		case LIBCTHREADS_MEMORY_ORDER_RELAXED:
+			*loaded_value = __atomic_load_n(
+			                 value,
+			                 __ATOMIC_RELAXED );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE:
+			*loaded_value = __atomic_load_n(
+			                 value,
+			                 __ATOMIC_ACQUIRE );
+			break;
+
+		default:
+			*loaded_value = __atomic_load_n(
+			                 value,
+			                 __ATOMIC_SEQ_CST );
+			break;
+	}
+
+#else
+	*loaded_value = libcthreads_atomic_compare_exchange_int32(
+	                 value,
+	                 0,
+	                 0 );
+
+#endif
+	return( 1 );
+}
+
+/* Sets a 32-bit integer value that is read by other threads
+ * The memory order must be relaxed, release or sequentially consistent
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_atomic_int32_store(
+     int32_t *value,
+     int32_t new_value,
+     int memory_order,
+     libcerror_error_t **error )
+{
+	static char *function       = "libcthreads_atomic_int32_store";
+
+#if !defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+	int32_t expected_value      = 0;
+	int32_t safe_previous_value = 0;
+#endif
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_order != LIBCTHREADS_MEMORY_ORDER_RELAXED )
+	 && ( memory_order != LIBCTHREADS_MEMORY_ORDER_RELEASE )
+	 && ( memory_order != LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory order: %d.",
+		 function,
+		 memory_order );
+
+		return( -1 );
+	}
+#if defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+	switch( memory_order )
+	{
+		case LIBCTHREADS_MEMORY_ORDER_RELAXED:
+			__atomic_store_n(
+			 value,
+			 new_value,
+			 __ATOMIC_RELAXED );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_RELEASE:
+			__atomic_store_n(
+			 value,
+			 new_value,
+			 __ATOMIC_RELEASE );
+			break;
+
+		default:
+			__atomic_store_n(
+			 value,
+			 new_value,
+			 __ATOMIC_SEQ_CST );
+			break;
+	}
+
+#else
+	expected_value = *value;
+
+	do
+	{
+		safe_previous_value = expected_value;
+
+		expected_value = libcthreads_atomic_compare_exchange_int32(
+		                  value,
+		                  safe_previous_value,
+		                  new_value );
+	}
+	while( expected_value != safe_previous_value );
+
+#endif
+	return( 1 );
+}
+
+/* Exchanges a 32-bit integer value that is modified by other threads
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_atomic_int32_exchange(
+     int32_t *value,
+     int32_t new_value,
+     int memory_order,
+     int32_t *previous_value,
+     libcerror_error_t **error )
+{
+	static char *function       = "libcthreads_atomic_int32_exchange";
+	int32_t safe_previous_value = 0;
+
+#if !defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+	int32_t expected_value      = 0;
+#endif
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_order < LIBCTHREADS_MEMORY_ORDER_RELAXED )
+	 || ( memory_order > LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory order: %d.",
+		 function,
+		 memory_order );
+
+		return( -1 );
+	}
+	if( previous_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid previous value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+	switch( memory_order )
+	{
+		case LIBCTHREADS_MEMORY_ORDER_RELAXED:
+			safe_previous_value = __atomic_exchange_n(
+			                       value,
+			                       new_value,
+			                       __ATOMIC_RELAXED );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE:
+			safe_previous_value = __atomic_exchange_n(
+			                       value,
+			                       new_value,
+			                       __ATOMIC_ACQUIRE );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_RELEASE:
+			safe_previous_value = __atomic_exchange_n(
+			                       value,
+			                       new_value,
+			                       __ATOMIC_RELEASE );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE:
+			safe_previous_value = __atomic_exchange_n(
+			                       value,
+			                       new_value,
+			                       __ATOMIC_ACQ_REL );
+			break;
+
+		default:
+			safe_previous_value = __atomic_exchange_n(
+			                       value,
+			                       new_value,
+			                       __ATOMIC_SEQ_CST );
+			break;
+	}
+
+#else
+	expected_value = *value;
+
+	do
+	{
+		safe_previous_value = expected_value;
+
+		expected_value = libcthreads_atomic_compare_exchange_int32(
+		                  value,
+		                  safe_previous_value,
+		                  new_value );
+	}
+	while( expected_value != safe_previous_value );
+
+#endif
+	*previous_value = safe_previous_value;
+
+	return( 1 );
+}
+
+/* Compares and exchanges a 32-bit integer value that is modified by other threads
+ * The value is only set to new_value if it equals expected_value, otherwise
+ * expected_value is set to the current value
+ * Returns 1 if exchanged, 0 if not or -1 on error
+ */
+int libcthreads_atomic_int32_compare_exchange(
+     int32_t *value,
+     int32_t *expected_value,
+     int32_t new_value,
+     int memory_order,
+     libcerror_error_t **error )
+{
+	static char *function  = "libcthreads_atomic_int32_compare_exchange";
+	int result             = 1;
+
+#if !defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+	int32_t previous_value = 0;
+#endif
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( expected_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid expected value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_order < LIBCTHREADS_MEMORY_ORDER_RELAXED )
+	 || ( memory_order > LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory order: %d.",
+		 function,
+		 memory_order );
+
+		return( -1 );
+	}
+#if defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+	switch( memory_order )
+	{
+		case LIBCTHREADS_MEMORY_ORDER_RELAXED:
+			result = __atomic_compare_exchange_n(
+			          value,
+			          expected_value,
+			          new_value,
+			          0,
+			          __ATOMIC_RELAXED,
+			          __ATOMIC_RELAXED );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE:
+			result = __atomic_compare_exchange_n(
+			          value,
+			          expected_value,
+			          new_value,
+			          0,
+			          __ATOMIC_ACQUIRE,
+			          __ATOMIC_ACQUIRE );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_RELEASE:
+			result = __atomic_compare_exchange_n(
+			          value,
+			          expected_value,
+			          new_value,
+			          0,
+			          __ATOMIC_RELEASE,
+			          __ATOMIC_RELAXED );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE:
+			result = __atomic_compare_exchange_n(
+			          value,
+			          expected_value,
+			          new_value,
+			          0,
+			          __ATOMIC_ACQ_REL,
+			          __ATOMIC_ACQUIRE );
+			break;
+
+		default:
+			result = __atomic_compare_exchange_n(
+			          value,
+			          expected_value,
+			          new_value,
+			          0,
+			          __ATOMIC_SEQ_CST,
+			          __ATOMIC_SEQ_CST );
+			break;
+	}
+
+#else
+	previous_value = libcthreads_atomic_compare_exchange_int32(
+	                  value,
+	                  *expected_value,
+	                  new_value );
+
+	if( previous_value != *expected_value )
+	{
+		*expected_value = previous_value;
+
+		result = 0;
+	}
+#endif
+	return( result );
+}
+
+/* Adds a value to a 32-bit integer value that is modified by other threads
+ * previous_value is set to the value before the addition
+ * previous_value is optional and can be NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_atomic_int32_fetch_add(
+     int32_t *value,
+     int32_t addend,
+     int memory_order,
+     int32_t *previous_value,
+     libcerror_error_t **error )
+{
+	static char *function       = "libcthreads_atomic_int32_fetch_add";
+	int32_t safe_previous_value = 0;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_order < LIBCTHREADS_MEMORY_ORDER_RELAXED )
+	 || ( memory_order > LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory order: %d.",
+		 function,
+		 memory_order );
+
+		return( -1 );
+	}
+	switch( memory_order )
+	{
+		case LIBCTHREADS_MEMORY_ORDER_RELAXED:
+			safe_previous_value = libcthreads_atomic_fetch_add_int32(
+			                       value,
+			                       addend,
+			                       LIBCTHREADS_MEMORY_ORDER_RELAXED );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE:
+			safe_previous_value = libcthreads_atomic_fetch_add_int32(
+			                       value,
+			                       addend,
+			                       LIBCTHREADS_MEMORY_ORDER_ACQUIRE );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_RELEASE:
+			safe_previous_value = libcthreads_atomic_fetch_add_int32(
+			                       value,
+			                       addend,
+			                       LIBCTHREADS_MEMORY_ORDER_RELEASE );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE:
+			safe_previous_value = libcthreads_atomic_fetch_add_int32(
+			                       value,
+			                       addend,
+			                       LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE );
+			break;
+
+		default:
+			safe_previous_value = libcthreads_atomic_fetch_add_int32(
+			                       value,
+			                       addend,
+			                       LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT );
+			break;
+	}
+	if( previous_value != NULL )
+	{
+		*previous_value = safe_previous_value;
+	}
+	return( 1 );
+}
+
+/* Sets bits in a 32-bit integer value that is modified by other threads
+ * previous_value is set to the value before the bits were set
+ * previous_value is optional and can be NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_atomic_int32_fetch_or(
+     int32_t *value,
+     int32_t bits,
+     int memory_order,
+     int32_t *previous_value,
+     libcerror_error_t **error )
+{
+	static char *function       = "libcthreads_atomic_int32_fetch_or";
+	int32_t safe_previous_value = 0;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_order < LIBCTHREADS_MEMORY_ORDER_RELAXED )
+	 || ( memory_order > LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory order: %d.",
+		 function,
+		 memory_order );
+
+		return( -1 );
+	}
+	switch( memory_order )
+	{
+		case LIBCTHREADS_MEMORY_ORDER_RELAXED:
+			safe_previous_value = libcthreads_atomic_fetch_or_int32(
+			                       value,
+			                       bits,
+			                       LIBCTHREADS_MEMORY_ORDER_RELAXED );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE:
+			safe_previous_value = libcthreads_atomic_fetch_or_int32(
+			                       value,
+			                       bits,
+			                       LIBCTHREADS_MEMORY_ORDER_ACQUIRE );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_RELEASE:
+			safe_previous_value = libcthreads_atomic_fetch_or_int32(
+			                       value,
+			                       bits,
+			                       LIBCTHREADS_MEMORY_ORDER_RELEASE );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE:
+			safe_previous_value = libcthreads_atomic_fetch_or_int32(
+			                       value,
+			                       bits,
+			                       LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE );
+			break;
+
+		default:
+			safe_previous_value = libcthreads_atomic_fetch_or_int32(
+			                       value,
+			                       bits,
+			                       LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT );
+			break;
+	}
+	if( previous_value != NULL )
+	{
+		*previous_value = safe_previous_value;
+	}
+	return( 1 );
+}
+
+/* Retrieves a 64-bit integer value that is modified by other threads
+ * The memory order must be relaxed, acquire or sequentially consistent
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_atomic_int64_load(
+     int64_t *value,
+     int memory_order,
+     int64_t *loaded_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libcthreads_atomic_int64_load";
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_order != LIBCTHREADS_MEMORY_ORDER_RELAXED )
+	 && ( memory_order != LIBCTHREADS_MEMORY_ORDER_ACQUIRE )
+	 && ( memory_order != LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory order: %d.",
+		 function,
+		 memory_order );
+
+		return( -1 );
+	}
+	if( loaded_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid loaded value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+	switch( memory_order )
+	{
+		case LIBCTHREADS_MEMORY_ORDER_RELAXED:
+			*loaded_value = __atomic_load_n(
+			                 value,
+			                 __ATOMIC_RELAXED );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE:
+			*loaded_value = __atomic_load_n(
+			                 value,
+			                 __ATOMIC_ACQUIRE );
+			break;
+
+		default:
+			*loaded_value = __atomic_load_n(
+			                 value,
+			                 __ATOMIC_SEQ_CST );
+			break;
+	}
+
+#else
+	*loaded_value = libcthreads_atomic_compare_exchange_int64(
+	                 value,
+	                 0,
+	                 0 );
+
+#endif
+	return( 1 );
+}
+
+/* Sets a 64-bit integer value that is read by other threads
+ * The memory order must be relaxed, release or sequentially consistent
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_atomic_int64_store(
+     int64_t *value,
+     int64_t new_value,
+     int memory_order,
+     libcerror_error_t **error )
+{
+	static char *function       = "libcthreads_atomic_int64_store";
+
+#if !defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+	int64_t expected_value      = 0;
+	int64_t safe_previous_value = 0;
+#endif
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_order != LIBCTHREADS_MEMORY_ORDER_RELAXED )
+	 && ( memory_order != LIBCTHREADS_MEMORY_ORDER_RELEASE )
+	 && ( memory_order != LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory order: %d.",
+		 function,
+		 memory_order );
+
+		return( -1 );
+	}
+#if defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+	switch( memory_order )
+	{
+		case LIBCTHREADS_MEMORY_ORDER_RELAXED:
+			__atomic_store_n(
+			 value,
+			 new_value,
+			 __ATOMIC_RELAXED );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_RELEASE:
+			__atomic_store_n(
+			 value,
+			 new_value,
+			 __ATOMIC_RELEASE );
+			break;
+
+		default:
+			__atomic_store_n(
+			 value,
+			 new_value,
+			 __ATOMIC_SEQ_CST );
+			break;
+	}
+
+#else
+	expected_value = *value;
+
+	do
+	{
+		safe_previous_value = expected_value;
+
+		expected_value = libcthreads_atomic_compare_exchange_int64(
+		                  value,
+		                  safe_previous_value,
+		                  new_value );
+	}
+	while( expected_value != safe_previous_value );
+
+#endif
+	return( 1 );
+}
+
+/* Exchanges a 64-bit integer value that is modified by other threads
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_atomic_int64_exchange(
+     int64_t *value,
+     int64_t new_value,
+     int memory_order,
+     int64_t *previous_value,
+     libcerror_error_t **error )
+{
+	static char *function       = "libcthreads_atomic_int64_exchange";
+	int64_t safe_previous_value = 0;
+
+#if !defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+	int64_t expected_value      = 0;
+#endif
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_order < LIBCTHREADS_MEMORY_ORDER_RELAXED )
+	 || ( memory_order > LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory order: %d.",
+		 function,
+		 memory_order );
+
+		return( -1 );
+	}
+	if( previous_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid previous value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+	switch( memory_order )
+	{
+		case LIBCTHREADS_MEMORY_ORDER_RELAXED:
+			safe_previous_value = __atomic_exchange_n(
+			                       value,
+			                       new_value,
+			                       __ATOMIC_RELAXED );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE:
+			safe_previous_value = __atomic_exchange_n(
+			                       value,
+			                       new_value,
+			                       __ATOMIC_ACQUIRE );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_RELEASE:
+			safe_previous_value = __atomic_exchange_n(
+			                       value,
+			                       new_value,
+			                       __ATOMIC_RELEASE );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE:
+			safe_previous_value = __atomic_exchange_n(
+			                       value,
+			                       new_value,
+			                       __ATOMIC_ACQ_REL );
+			break;
+
+		default:
+			safe_previous_value = __atomic_exchange_n(
+			                       value,
+			                       new_value,
+			                       __ATOMIC_SEQ_CST );
+			break;
+	}
+
+#else
+	expected_value = *value;
+
+	do
+	{
+		safe_previous_value = expected_value;
+
+		expected_value = libcthreads_atomic_compare_exchange_int64(
+		                  value,
+		                  safe_previous_value,
+		                  new_value );
+	}
+	while( expected_value != safe_previous_value );
+
+#endif
+	*previous_value = safe_previous_value;
+
+	return( 1 );
+}
+
+/* Compares and exchanges a 64-bit integer value that is modified by other threads
+ * The value is only set to new_value if it equals expected_value, otherwise
+ * expected_value is set to the current value
+ * Returns 1 if exchanged, 0 if not or -1 on error
+ */
+int libcthreads_atomic_int64_compare_exchange(
+     int64_t *value,
+     int64_t *expected_value,
+     int64_t new_value,
+     int memory_order,
+     libcerror_error_t **error )
+{
+	static char *function  = "libcthreads_atomic_int64_compare_exchange";
+	int result             = 1;
+
+#if !defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+	int64_t previous_value = 0;
+#endif
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( expected_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid expected value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_order < LIBCTHREADS_MEMORY_ORDER_RELAXED )
+	 || ( memory_order > LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory order: %d.",
+		 function,
+		 memory_order );
+
+		return( -1 );
+	}
+#if defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+	switch( memory_order )
+	{
+		case LIBCTHREADS_MEMORY_ORDER_RELAXED:
+			result = __atomic_compare_exchange_n(
+			          value,
+			          expected_value,
+			          new_value,
+			          0,
+			          __ATOMIC_RELAXED,
+			          __ATOMIC_RELAXED );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE:
+			result = __atomic_compare_exchange_n(
+			          value,
+			          expected_value,
+			          new_value,
+			          0,
+			          __ATOMIC_ACQUIRE,
+			          __ATOMIC_ACQUIRE );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_RELEASE:
+			result = __atomic_compare_exchange_n(
+			          value,
+			          expected_value,
+			          new_value,
+			          0,
+			          __ATOMIC_RELEASE,
+			          __ATOMIC_RELAXED );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE:
+			result = __atomic_compare_exchange_n(
+			          value,
+			          expected_value,
+			          new_value,
+			          0,
+			          __ATOMIC_ACQ_REL,
+			          __ATOMIC_ACQUIRE );
+			break;
+
+		default:
+			result = __atomic_compare_exchange_n(
+			          value,
+			          expected_value,
+			          new_value,
+			          0,
+			          __ATOMIC_SEQ_CST,
+			          __ATOMIC_SEQ_CST );
+			break;
+	}
+
+#else
+	previous_value = libcthreads_atomic_compare_exchange_int64(
+	                  value,
+	                  *expected_value,
+	                  new_value );
+
+	if( previous_value != *expected_value )
+	{
+		*expected_value = previous_value;
+
+		result = 0;
+	}
+#endif
+	return( result );
+}
+
+/* Adds a value to a 64-bit integer value that is modified by other threads
+ * previous_value is set to the value before the addition
+ * previous_value is optional and can be NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_atomic_int64_fetch_add(
+     int64_t *value,
+     int64_t addend,
+     int memory_order,
+     int64_t *previous_value,
+     libcerror_error_t **error )
+{
+	static char *function       = "libcthreads_atomic_int64_fetch_add";
+	int64_t safe_previous_value = 0;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_order < LIBCTHREADS_MEMORY_ORDER_RELAXED )
+	 || ( memory_order > LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory order: %d.",
+		 function,
+		 memory_order );
+
+		return( -1 );
+	}
+	switch( memory_order )
+	{
+		case LIBCTHREADS_MEMORY_ORDER_RELAXED:
+			safe_previous_value = libcthreads_atomic_fetch_add_int64(
+			                       value,
+			                       addend,
+			                       LIBCTHREADS_MEMORY_ORDER_RELAXED );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE:
+			safe_previous_value = libcthreads_atomic_fetch_add_int64(
+			                       value,
+			                       addend,
+			                       LIBCTHREADS_MEMORY_ORDER_ACQUIRE );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_RELEASE:
+			safe_previous_value = libcthreads_atomic_fetch_add_int64(
+			                       value,
+			                       addend,
+			                       LIBCTHREADS_MEMORY_ORDER_RELEASE );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE:
+			safe_previous_value = libcthreads_atomic_fetch_add_int64(
+			                       value,
+			                       addend,
+			                       LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE );
+			break;
+
+		default:
+			safe_previous_value = libcthreads_atomic_fetch_add_int64(
+			                       value,
+			                       addend,
+			                       LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT );
+			break;
+	}
+	if( previous_value != NULL )
+	{
+		*previous_value = safe_previous_value;
+	}
+	return( 1 );
+}
+
+/* Sets bits in a 64-bit integer value that is modified by other threads
+ * previous_value is set to the value before the bits were set
+ * previous_value is optional and can be NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_atomic_int64_fetch_or(
+     int64_t *value,
+     int64_t bits,
+     int memory_order,
+     int64_t *previous_value,
+     libcerror_error_t **error )
+{
+	static char *function       = "libcthreads_atomic_int64_fetch_or";
+	int64_t safe_previous_value = 0;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_order < LIBCTHREADS_MEMORY_ORDER_RELAXED )
+	 || ( memory_order > LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory order: %d.",
+		 function,
+		 memory_order );
+
+		return( -1 );
+	}
+	switch( memory_order )
+	{
+		case LIBCTHREADS_MEMORY_ORDER_RELAXED:
+			safe_previous_value = libcthreads_atomic_fetch_or_int64(
+			                       value,
+			                       bits,
+			                       LIBCTHREADS_MEMORY_ORDER_RELAXED );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE:
+			safe_previous_value = libcthreads_atomic_fetch_or_int64(
+			                       value,
+			                       bits,
+			                       LIBCTHREADS_MEMORY_ORDER_ACQUIRE );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_RELEASE:
+			safe_previous_value = libcthreads_atomic_fetch_or_int64(
+			                       value,
+			                       bits,
+			                       LIBCTHREADS_MEMORY_ORDER_RELEASE );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE:
+			safe_previous_value = libcthreads_atomic_fetch_or_int64(
+			                       value,
+			                       bits,
+			                       LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE );
+			break;
+
+		default:
+			safe_previous_value = libcthreads_atomic_fetch_or_int64(
+			                       value,
+			                       bits,
+			                       LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT );
+			break;
+	}
+	if( previous_value != NULL )
+	{
+		*previous_value = safe_previous_value;
+	}
+	return( 1 );
+}
+
+/* Retrieves a pointer value that is modified by other threads
+ * The memory order must be relaxed, acquire or sequentially consistent
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_atomic_pointer_load(
+     intptr_t **value,
+     int memory_order,
+     intptr_t **loaded_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libcthreads_atomic_pointer_load";
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_order != LIBCTHREADS_MEMORY_ORDER_RELAXED )
+	 && ( memory_order != LIBCTHREADS_MEMORY_ORDER_ACQUIRE )
+	 && ( memory_order != LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory order: %d.",
+		 function,
+		 memory_order );
+
+		return( -1 );
+	}
+	if( loaded_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid loaded value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+	switch( memory_order )
+	{
+		case LIBCTHREADS_MEMORY_ORDER_RELAXED:
+			*loaded_value = __atomic_load_n(
+			                 value,
+			                 __ATOMIC_RELAXED );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE:
+			*loaded_value = __atomic_load_n(
+			                 value,
+			                 __ATOMIC_ACQUIRE );
+			break;
+
+		default:
+			*loaded_value = __atomic_load_n(
+			                 value,
+			                 __ATOMIC_SEQ_CST );
+			break;
+	}
+
+#else
+	*loaded_value = (intptr_t *) libcthreads_atomic_compare_exchange_pointer(
+	                              value,
+	                              NULL,
+	                              NULL );
+
+#endif
+	return( 1 );
+}
+
+/* Sets a pointer value that is read by other threads
+ * The memory order must be relaxed, release or sequentially consistent
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_atomic_pointer_store(
+     intptr_t **value,
+     intptr_t *new_value,
+     int memory_order,
+     libcerror_error_t **error )
+{
+	static char *function         = "libcthreads_atomic_pointer_store";
+
+#if !defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+	intptr_t *expected_value      = NULL;
+	intptr_t *safe_previous_value = NULL;
+#endif
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_order != LIBCTHREADS_MEMORY_ORDER_RELAXED )
+	 && ( memory_order != LIBCTHREADS_MEMORY_ORDER_RELEASE )
+	 && ( memory_order != LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory order: %d.",
+		 function,
+		 memory_order );
+
+		return( -1 );
+	}
+#if defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+	switch( memory_order )
+	{
+		case LIBCTHREADS_MEMORY_ORDER_RELAXED:
+			__atomic_store_n(
+			 value,
+			 new_value,
+			 __ATOMIC_RELAXED );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_RELEASE:
+			__atomic_store_n(
+			 value,
+			 new_value,
+			 __ATOMIC_RELEASE );
+			break;
+
+		default:
+			__atomic_store_n(
+			 value,
+			 new_value,
+			 __ATOMIC_SEQ_CST );
+			break;
+	}
+
+#else
+	expected_value = *value;
+
+	do
+	{
+		safe_previous_value = expected_value;
+
+		expected_value = (intptr_t *) libcthreads_atomic_compare_exchange_pointer(
+		                               value,
+		                               safe_previous_value,
+		                               new_value );
+	}
+	while( expected_value != safe_previous_value );
+
+#endif
+	return( 1 );
+}
+
+/* Exchanges a pointer value that is modified by other threads
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_atomic_pointer_exchange(
+     intptr_t **value,
+     intptr_t *new_value,
+     int memory_order,
+     intptr_t **previous_value,
+     libcerror_error_t **error )
+{
+	static char *function         = "libcthreads_atomic_pointer_exchange";
+	intptr_t *safe_previous_value = NULL;
+
+#if !defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+	intptr_t *expected_value      = NULL;
+#endif
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_order < LIBCTHREADS_MEMORY_ORDER_RELAXED )
+	 || ( memory_order > LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory order: %d.",
+		 function,
+		 memory_order );
+
+		return( -1 );
+	}
+	if( previous_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid previous value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+	switch( memory_order )
+	{
+		case LIBCTHREADS_MEMORY_ORDER_RELAXED:
+			safe_previous_value = __atomic_exchange_n(
+			                       value,
+			                       new_value,
+			                       __ATOMIC_RELAXED );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE:
+			safe_previous_value = __atomic_exchange_n(
+			                       value,
+			                       new_value,
+			                       __ATOMIC_ACQUIRE );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_RELEASE:
+			safe_previous_value = __atomic_exchange_n(
+			                       value,
+			                       new_value,
+			                       __ATOMIC_RELEASE );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE:
+			safe_previous_value = __atomic_exchange_n(
+			                       value,
+			                       new_value,
+			                       __ATOMIC_ACQ_REL );
+			break;
+
+		default:
+			safe_previous_value = __atomic_exchange_n(
+			                       value,
+			                       new_value,
+			                       __ATOMIC_SEQ_CST );
+			break;
+	}
+
+#else
+	expected_value = *value;
+
+	do
+	{
+		safe_previous_value = expected_value;
+
+		expected_value = (intptr_t *) libcthreads_atomic_compare_exchange_pointer(
+		                               value,
+		                               safe_previous_value,
+		                               new_value );
+	}
+	while( expected_value != safe_previous_value );
+
+#endif
+	*previous_value = safe_previous_value;
+
+	return( 1 );
+}
+
+/* Compares and exchanges a pointer value that is modified by other threads
+ * The value is only set to new_value if it equals expected_value, otherwise
+ * expected_value is set to the current value
+ * Returns 1 if exchanged, 0 if not or -1 on error
+ */
+int libcthreads_atomic_pointer_compare_exchange(
+     intptr_t **value,
+     intptr_t **expected_value,
+     intptr_t *new_value,
+     int memory_order,
+     libcerror_error_t **error )
+{
+	static char *function    = "libcthreads_atomic_pointer_compare_exchange";
+	int result               = 1;
+
+#if !defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+	intptr_t *previous_value = NULL;
+#endif
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( expected_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid expected value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( memory_order < LIBCTHREADS_MEMORY_ORDER_RELAXED )
+	 || ( memory_order > LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory order: %d.",
+		 function,
+		 memory_order );
+
+		return( -1 );
+	}
+#if defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+	switch( memory_order )
+	{
+		case LIBCTHREADS_MEMORY_ORDER_RELAXED:
+			result = __atomic_compare_exchange_n(
+			          value,
+			          expected_value,
+			          new_value,
+			          0,
+			          __ATOMIC_RELAXED,
+			          __ATOMIC_RELAXED );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE:
+			result = __atomic_compare_exchange_n(
+			          value,
+			          expected_value,
+			          new_value,
+			          0,
+			          __ATOMIC_ACQUIRE,
+			          __ATOMIC_ACQUIRE );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_RELEASE:
+			result = __atomic_compare_exchange_n(
+			          value,
+			          expected_value,
+			          new_value,
+			          0,
+			          __ATOMIC_RELEASE,
+			          __ATOMIC_RELAXED );
+			break;
+
+		case LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE:
+			result = __atomic_compare_exchange_n(
+			          value,
+			          expected_value,
+			          new_value,
+			          0,
+			          __ATOMIC_ACQ_REL,
+			          __ATOMIC_ACQUIRE );
+			break;
+
+		default:
+			result = __atomic_compare_exchange_n(
+			          value,
+			          expected_value,
+			          new_value,
+			          0,
+			          __ATOMIC_SEQ_CST,
+			          __ATOMIC_SEQ_CST );
+			break;
+	}
+
+#else
+	previous_value = (intptr_t *) libcthreads_atomic_compare_exchange_pointer(
+	                               value,
+	                               *expected_value,
+	                               new_value );
+
+	if( previous_value != *expected_value )
+	{
+		*expected_value = previous_value;
+
+		result = 0;
+	}
+#endif
+	return( result );
+}
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,555 @@
+/*
+ * Atomic functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_ATOMIC_H )
+#define _LIBCTHREADS_INTERNAL_ATOMIC_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcthreads_definitions.h"
+#include "libcthreads_extern.h"
+#include "libcthreads_libcerror.h"
+
+#if defined( _MSC_VER )
+#include <intrin.h>
+#endif
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The __atomic built-in functions support explicit memory orders
+ */
+#if defined( __clang__ ) || ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 7 ) ) ) )
+#define LIBCTHREADS_HAVE_ATOMIC_BUILTINS
+
+/* Maps a LIBCTHREADS_MEMORY_ORDER onto the memory order of the __atomic built-in functions
+ * The memory order should be a constant so the mapping is resolved at compile time
+ */
+#define libcthreads_atomic_get_builtin_memory_order( memory_order ) \
+	( ( ( memory_order ) == LIBCTHREADS_MEMORY_ORDER_RELAXED ) ? __ATOMIC_RELAXED : \
+	  ( ( memory_order ) == LIBCTHREADS_MEMORY_ORDER_ACQUIRE ) ? __ATOMIC_ACQUIRE : \
+	  ( ( memory_order ) == LIBCTHREADS_MEMORY_ORDER_RELEASE ) ? __ATOMIC_RELEASE : \
+	  ( ( memory_order ) == LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE ) ? __ATOMIC_ACQ_REL : __ATOMIC_SEQ_CST )
+
+#endif
+
+/* The macros below are used inside the library, they do not check their arguments
+ * The exported libcthreads_atomic_ functions wrap them for the public API
+ */
+
+/* Reads an integer value that is modified by other threads, with acquire semantics
+ */
+#if defined( __clang__ ) || ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 7 ) ) ) )
+#define libcthreads_atomic_load_int( value ) \
+	__atomic_load_n( value, __ATOMIC_ACQUIRE )
+
+#else
+#define libcthreads_atomic_load_int( value ) \
+	*( (volatile int *) ( value ) )
+
+#endif
+
+/* Writes an integer value that is read by other threads, with release semantics
+ */
+#if defined( __clang__ ) || ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 7 ) ) ) )
+#define libcthreads_atomic_store_int( value, new_value ) \
+	__atomic_store_n( value, new_value, __ATOMIC_RELEASE )
+
+#else
+#define libcthreads_atomic_store_int( value, new_value ) \
+	*( (volatile int *) ( value ) ) = ( new_value )
+
+#endif
+
+/* Reads a 32-bit integer value that is modified by other threads, with sequentially consistent semantics
+ * Use this instead of libcthreads_atomic_load_int when the order of the read and a preceding
+ * libcthreads_atomic_add_int32 on another value matters to other threads
+ */
+#if defined( __clang__ ) || ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 7 ) ) ) )
+#define libcthreads_atomic_load_sequential_int32( value ) \
+	__atomic_load_n( value, __ATOMIC_SEQ_CST )
+
+#elif defined( __GNUC__ )
+#define libcthreads_atomic_load_sequential_int32( value ) \
+	( __sync_synchronize(), *( (volatile int32_t *) ( value ) ) )
+
+#elif defined( _MSC_VER )
+#define libcthreads_atomic_load_sequential_int32( value ) \
+	( MemoryBarrier(), *( (volatile int32_t *) ( value ) ) )
+
+#else
+#error Missing atomic sequential load function
+#endif
+
+/* Adds a value to a 32-bit integer value that is modified by other threads, with sequentially consistent semantics
+ * Returns the new value
+ */
+#if defined( __clang__ ) || ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 7 ) ) ) )
+#define libcthreads_atomic_add_int32( value, addend ) \
+	__atomic_add_fetch( value, addend, __ATOMIC_SEQ_CST )
+
+#elif defined( __GNUC__ )
+#define libcthreads_atomic_add_int32( value, addend ) \
+	__sync_add_and_fetch( value, addend )
+
+#elif defined( _MSC_VER )
+#define libcthreads_atomic_add_int32( value, addend ) \
+	( (int32_t) InterlockedExchangeAdd( (volatile LONG *) ( value ), (LONG) ( addend ) ) + ( addend ) )
+
+#else
+#error Missing atomic add function
+#endif
+
+/* Exchanges a 32-bit integer value that is modified by other threads, with acquire and release semantics
+ * Returns the previous value
+ */
+#if defined( __clang__ ) || ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 7 ) ) ) )
+#define libcthreads_atomic_exchange_int32( value, new_value ) \
+	__atomic_exchange_n( value, new_value, __ATOMIC_ACQ_REL )
+
+#elif defined( __GNUC__ )
+#define libcthreads_atomic_exchange_int32( value, new_value ) \
+	( __sync_synchronize(), __sync_lock_test_and_set( value, new_value ) )
+
+#elif defined( _MSC_VER )
+#define libcthreads_atomic_exchange_int32( value, new_value ) \
+	(int32_t) InterlockedExchange( (volatile LONG *) ( value ), (LONG) ( new_value ) )
+
+#else
+#error Missing atomic exchange function
+#endif
+
+/* Compares and exchanges a 32-bit integer value that is modified by other threads, with acquire and release semantics
+ * The value is only set to new_value if it equals expected_value
+ * Returns the previous value
+ */
+#if defined( __clang__ ) || defined( __GNUC__ )
+#define libcthreads_atomic_compare_exchange_int32( value, expected_value, new_value ) \
+	__sync_val_compare_and_swap( value, expected_value, new_value )
+
+#elif defined( _MSC_VER )
+#define libcthreads_atomic_compare_exchange_int32( value, expected_value, new_value ) \
+	(int32_t) InterlockedCompareExchange( (volatile LONG *) ( value ), (LONG) ( new_value ), (LONG) ( expected_value ) )
+
+#else
+#error Missing atomic compare exchange function
+#endif
+
+/* Reads a 64-bit integer value that is modified by other threads, with relaxed semantics
+ */
+#if defined( __clang__ ) || ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 7 ) ) ) )
+#define libcthreads_atomic_load_int64( value ) \
+	__atomic_load_n( value, __ATOMIC_RELAXED )
+
+#elif defined( __GNUC__ )
+#define libcthreads_atomic_load_int64( value ) \
+	__sync_add_and_fetch( value, 0 )
+
+#elif defined( _MSC_VER )
+#define libcthreads_atomic_load_int64( value ) \
+	(int64_t) InterlockedCompareExchange64( (volatile LONGLONG *) ( value ), 0, 0 )
+
+#else
+#error Missing atomic 64-bit load function
+#endif
+
+/* Writes a 64-bit integer value that is read by other threads, with relaxed semantics
+ */
+#if defined( __clang__ ) || ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 7 ) ) ) )
+#define libcthreads_atomic_store_int64( value, new_value ) \
+	__atomic_store_n( value, new_value, __ATOMIC_RELAXED )
+
+#elif defined( __GNUC__ )
+#define libcthreads_atomic_store_int64( value, new_value ) \
+	__sync_lock_test_and_set( value, new_value )
+
+#elif defined( _MSC_VER )
+#define libcthreads_atomic_store_int64( value, new_value ) \
+	InterlockedExchange64( (volatile LONGLONG *) ( value ), (LONGLONG) ( new_value ) )
+
+#else
+#error Missing atomic 64-bit store function
+#endif
+
+/* Adds a value to a 64-bit integer value that is modified by other threads, with relaxed semantics
+ * Use this for statistics, not to synchronize other values
+ */
+#if defined( __clang__ ) || ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 7 ) ) ) )
+#define libcthreads_atomic_add_int64( value, addend ) \
+	__atomic_add_fetch( value, addend, __ATOMIC_RELAXED )
+
+#elif defined( __GNUC__ )
+#define libcthreads_atomic_add_int64( value, addend ) \
+	__sync_add_and_fetch( value, addend )
+
+#elif defined( _MSC_VER )
+#define libcthreads_atomic_add_int64( value, addend ) \
+	InterlockedExchangeAdd64( (volatile LONGLONG *) ( value ), (LONGLONG) ( addend ) )
+
+#else
+#error Missing atomic 64-bit add function
+#endif
+
+/* Compares and exchanges a 64-bit integer value that is modified by other threads, with acquire and release semantics
+ * The value is only set to new_value if it equals expected_value
+ * Returns the previous value
+ */
+#if defined( __clang__ ) || defined( __GNUC__ )
+#define libcthreads_atomic_compare_exchange_int64( value, expected_value, new_value ) \
+	__sync_val_compare_and_swap( value, expected_value, new_value )
+
+#elif defined( _MSC_VER )
+#define libcthreads_atomic_compare_exchange_int64( value, expected_value, new_value ) \
+	InterlockedCompareExchange64( (volatile LONGLONG *) ( value ), (LONGLONG) ( new_value ), (LONGLONG) ( expected_value ) )
+
+#else
+#error Missing atomic 64-bit compare exchange function
+#endif
+
+/* Adds a value to a 32-bit integer value that is modified by other threads, with an explicit memory order
+ * Without the __atomic built-in functions the memory order is sequentially consistent
+ * Returns the previous value
+ */
+#if defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+#define libcthreads_atomic_fetch_add_int32( value, addend, memory_order ) \
+	__atomic_fetch_add( value, addend, libcthreads_atomic_get_builtin_memory_order( memory_order ) )
+
+#elif defined( __GNUC__ )
+#define libcthreads_atomic_fetch_add_int32( value, addend, memory_order ) \
+	__sync_fetch_and_add( value, addend )
+
+#elif defined( _MSC_VER )
+#define libcthreads_atomic_fetch_add_int32( value, addend, memory_order ) \
+	(int32_t) InterlockedExchangeAdd( (volatile LONG *) ( value ), (LONG) ( addend ) )
+
+#else
+#error Missing atomic fetch add function
+#endif
+
+/* Sets bits in a 32-bit integer value that is modified by other threads, with an explicit memory order
+ * Without the __atomic built-in functions the memory order is sequentially consistent
+ * Returns the previous value
+ */
+#if defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+#define libcthreads_atomic_fetch_or_int32( value, bits, memory_order ) \
+	__atomic_fetch_or( value, bits, libcthreads_atomic_get_builtin_memory_order( memory_order ) )
+
+#elif defined( __GNUC__ )
+#define libcthreads_atomic_fetch_or_int32( value, bits, memory_order ) \
+	__sync_fetch_and_or( value, bits )
+
+#elif defined( _MSC_VER )
+#define libcthreads_atomic_fetch_or_int32( value, bits, memory_order ) \
+	(int32_t) _InterlockedOr( (volatile long *) ( value ), (long) ( bits ) )
+
+#else
+#error Missing atomic fetch or function
+#endif
+
+/* Adds a value to a 64-bit integer value that is modified by other threads, with an explicit memory order
+ * Without the __atomic built-in functions the memory order is sequentially consistent
+ * Returns the previous value
+ */
+#if defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+#define libcthreads_atomic_fetch_add_int64( value, addend, memory_order ) \
+	__atomic_fetch_add( value, addend, libcthreads_atomic_get_builtin_memory_order( memory_order ) )
+
+#elif defined( __GNUC__ )
+#define libcthreads_atomic_fetch_add_int64( value, addend, memory_order ) \
+	__sync_fetch_and_add( value, addend )
+
+#elif defined( _MSC_VER )
+#define libcthreads_atomic_fetch_add_int64( value, addend, memory_order ) \
+	(int64_t) InterlockedExchangeAdd64( (volatile LONGLONG *) ( value ), (LONGLONG) ( addend ) )
+
+#else
+#error Missing atomic 64-bit fetch add function
+#endif
+
+/* Sets bits in a 64-bit integer value that is modified by other threads, with an explicit memory order
+ * Without the __atomic built-in functions the memory order is sequentially consistent
+ * Returns the previous value
+ */
+#if defined( LIBCTHREADS_HAVE_ATOMIC_BUILTINS )
+#define libcthreads_atomic_fetch_or_int64( value, bits, memory_order ) \
+	__atomic_fetch_or( value, bits, libcthreads_atomic_get_builtin_memory_order( memory_order ) )
+
+#elif defined( __GNUC__ )
+#define libcthreads_atomic_fetch_or_int64( value, bits, memory_order ) \
+	__sync_fetch_and_or( value, bits )
+
+#elif defined( _MSC_VER )
+#define libcthreads_atomic_fetch_or_int64( value, bits, memory_order ) \
+	(int64_t) InterlockedOr64( (volatile LONGLONG *) ( value ), (LONGLONG) ( bits ) )
+
+#else
+#error Missing atomic 64-bit fetch or function
+#endif
+
+/* Reads a pointer value that is modified by other threads, with acquire semantics
+ */
+#if defined( __clang__ ) || ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 7 ) ) ) )
+#define libcthreads_atomic_load_pointer( value ) \
+	__atomic_load_n( value, __ATOMIC_ACQUIRE )
+
+#else
+#define libcthreads_atomic_load_pointer( value ) \
+	*( (void * volatile *) ( value ) )
+
+#endif
+
+/* Writes a pointer value that is read by other threads, with release semantics
+ */
+#if defined( __clang__ ) || ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 7 ) ) ) )
+#define libcthreads_atomic_store_pointer( value, new_value ) \
+	__atomic_store_n( value, new_value, __ATOMIC_RELEASE )
+
+#else
+#define libcthreads_atomic_store_pointer( value, new_value ) \
+	*( (void * volatile *) ( value ) ) = ( new_value )
+
+#endif
+
+/* Exchanges a pointer value that is modified by other threads, with acquire and release semantics
+ * Returns the previous value
+ */
+#if defined( __clang__ ) || ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 7 ) ) ) )
+#define libcthreads_atomic_exchange_pointer( value, new_value ) \
+	__atomic_exchange_n( value, new_value, __ATOMIC_ACQ_REL )
+
+#elif defined( __GNUC__ )
+#define libcthreads_atomic_exchange_pointer( value, new_value ) \
+	( __sync_synchronize(), __sync_lock_test_and_set( value, new_value ) )
+
+#elif defined( _MSC_VER )
+#define libcthreads_atomic_exchange_pointer( value, new_value ) \
+	InterlockedExchangePointer( (PVOID volatile *) ( value ), (PVOID) ( new_value ) )
+
+#else
+#error Missing atomic exchange pointer function
+#endif
+
+/* Compares and exchanges a pointer value that is modified by other threads, with acquire and release semantics
+ * The value is only set to new_value if it equals expected_value
+ * Returns the previous value
+ */
+#if defined( __clang__ ) || defined( __GNUC__ )
+#define libcthreads_atomic_compare_exchange_pointer( value, expected_value, new_value ) \
+	__sync_val_compare_and_swap( value, expected_value, new_value )
+
+#elif defined( _MSC_VER )
+#define libcthreads_atomic_compare_exchange_pointer( value, expected_value, new_value ) \
+	InterlockedCompareExchangePointer( (PVOID volatile *) ( value ), (PVOID) ( new_value ), (PVOID) ( expected_value ) )
+
+#else
+#error Missing atomic compare exchange pointer function
+#endif
+
+/* Orders the reads before the fence before the reads after the fence
+ */
+#if defined( __clang__ ) || ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 7 ) ) ) )
+#define libcthreads_atomic_acquire_fence() \
+	__atomic_thread_fence( __ATOMIC_ACQUIRE )
+
+#elif defined( __GNUC__ )
+#define libcthreads_atomic_acquire_fence() \
+	__sync_synchronize()
+
+#elif defined( _MSC_VER )
+#define libcthreads_atomic_acquire_fence() \
+	MemoryBarrier()
+
+#else
+#error Missing atomic acquire fence function
+#endif
+
+/* Orders the reads and writes before the fence before the reads and writes after the fence
+ */
+#if defined( __clang__ ) || ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 7 ) ) ) )
+#define libcthreads_atomic_full_fence() \
+	__atomic_thread_fence( __ATOMIC_SEQ_CST )
+
+#elif defined( __GNUC__ )
+#define libcthreads_atomic_full_fence() \
+	__sync_synchronize()
+
+#elif defined( _MSC_VER )
+#define libcthreads_atomic_full_fence() \
+	MemoryBarrier()
+
+#else
+#error Missing atomic full fence function
+#endif
+
+/* Hints the processor that the thread is spinning
+ */
+#if defined( _MSC_VER ) && defined( WINAPI )
+#define libcthreads_atomic_pause() \
+	YieldProcessor()
+
+#elif defined( __GNUC__ ) && ( defined( __i386__ ) || defined( __x86_64__ ) )
+#define libcthreads_atomic_pause() \
+	__asm__ __volatile__( "pause" ::: "memory" )
+
+#elif defined( __GNUC__ ) && ( defined( __aarch64__ ) || ( defined( __arm__ ) && defined( __ARM_ARCH ) && ( __ARM_ARCH >= 7 ) ) )
+#define libcthreads_atomic_pause() \
+	__asm__ __volatile__( "yield" ::: "memory" )
+
+#else
+#define libcthreads_atomic_pause() \
+	/* empty */
+
+#endif
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+LIBCTHREADS_EXTERN \
+int libcthreads_atomic_int32_load(
+     int32_t *value,
+     int memory_order,
+     int32_t *loaded_value,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_atomic_int32_store(
+     int32_t *value,
+     int32_t new_value,
+     int memory_order,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_atomic_int32_exchange(
+     int32_t *value,
+     int32_t new_value,
+     int memory_order,
+     int32_t *previous_value,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_atomic_int32_compare_exchange(
+     int32_t *value,
+     int32_t *expected_value,
+     int32_t new_value,
+     int memory_order,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_atomic_int32_fetch_add(
+     int32_t *value,
+     int32_t addend,
+     int memory_order,
+     int32_t *previous_value,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_atomic_int32_fetch_or(
+     int32_t *value,
+     int32_t bits,
+     int memory_order,
+     int32_t *previous_value,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_atomic_int64_load(
+     int64_t *value,
+     int memory_order,
+     int64_t *loaded_value,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_atomic_int64_store(
+     int64_t *value,
+     int64_t new_value,
+     int memory_order,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_atomic_int64_exchange(
+     int64_t *value,
+     int64_t new_value,
+     int memory_order,
+     int64_t *previous_value,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_atomic_int64_compare_exchange(
+     int64_t *value,
+     int64_t *expected_value,
+     int64_t new_value,
+     int memory_order,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_atomic_int64_fetch_add(
+     int64_t *value,
+     int64_t addend,
+     int memory_order,
+     int64_t *previous_value,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_atomic_int64_fetch_or(
+     int64_t *value,
+     int64_t bits,
+     int memory_order,
+     int64_t *previous_value,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_atomic_pointer_load(
+     intptr_t **value,
+     int memory_order,
+     intptr_t **loaded_value,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_atomic_pointer_store(
+     intptr_t **value,
+     intptr_t *new_value,
+     int memory_order,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_atomic_pointer_exchange(
+     intptr_t **value,
+     intptr_t *new_value,
+     int memory_order,
+     intptr_t **previous_value,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_atomic_pointer_compare_exchange(
+     intptr_t **value,
+     intptr_t **expected_value,
+     intptr_t *new_value,
+     int memory_order,
+     libcerror_error_t **error );
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCTHREADS_INTERNAL_ATOMIC_H ) */
+
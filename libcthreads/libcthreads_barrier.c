@@ -0,0 +1,250 @@
+/*
+ * Barrier functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcthreads_atomic.h"
+#include "libcthreads_barrier.h"
+#include "libcthreads_definitions.h"
+#include "libcthreads_futex.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_types.h"
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates a barrier
+ * Make sure the value barrier is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_barrier_initialize(
+     libcthreads_barrier_t **barrier,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_barrier_t *internal_barrier = NULL;
+	static char *function                            = "libcthreads_barrier_initialize";
+
+	if( barrier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid barrier.",
+		 function );
+
+		return( -1 );
+	}
+	if( *barrier != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid barrier value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+#if SIZEOF_INT > 4
+	if( number_of_threads > (int) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of threads value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* SIZEOF_INT > 4 */
+
+	internal_barrier = memory_allocate_structure(
+	                    libcthreads_internal_barrier_t );
+
+	if( internal_barrier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create barrier.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_barrier,
+	     0,
+	     sizeof( libcthreads_internal_barrier_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear barrier.",
+		 function );
+
+		memory_free(
+		 internal_barrier );
+
+		return( -1 );
+	}
+	internal_barrier->number_of_threads           = (int32_t) number_of_threads;
+	internal_barrier->number_of_remaining_threads = (int32_t) number_of_threads;
+
+	*barrier = (libcthreads_barrier_t *) internal_barrier;
+
+	return( 1 );
+}
+
+/* Frees a barrier
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_barrier_free(
+     libcthreads_barrier_t **barrier,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_barrier_t *internal_barrier = NULL;
+	static char *function                            = "libcthreads_barrier_free";
+	int result                                       = 1;
+
+	if( barrier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid barrier.",
+		 function );
+
+		return( -1 );
+	}
+	if( *barrier != NULL )
+	{
+		internal_barrier = (libcthreads_internal_barrier_t *) *barrier;
+		*barrier         = NULL;
+
+		if( libcthreads_atomic_load_sequential_int32(
+		     &( internal_barrier->number_of_remaining_threads ) ) != internal_barrier->number_of_threads )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to destroy barrier with error: Resource busy.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_barrier );
+	}
+	return( result );
+}
+
+/* Waits until all the threads have arrived at a barrier
+ * The barrier can be reused, the last thread to arrive resets the barrier for the next phase,
+ * before it advances the phase the other threads wait on. Hence a thread that arrives for the
+ * next phase cannot be confused with a thread that still has to leave the current phase
+ * A waiting thread spins for a short while before it waits in the kernel
+ * Returns 1 if successful for the serial thread, 0 if successful for the other threads or -1 on error
+ */
+int libcthreads_barrier_wait(
+     libcthreads_barrier_t *barrier,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_barrier_t *internal_barrier = NULL;
+	static char *function                            = "libcthreads_barrier_wait";
+	int32_t phase                                    = 0;
+	int spin_count                                   = 0;
+
+	if( barrier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid barrier.",
+		 function );
+
+		return( -1 );
+	}
+	internal_barrier = (libcthreads_internal_barrier_t *) barrier;
+
+	phase = libcthreads_atomic_load_sequential_int32(
+	         &( internal_barrier->phase ) );
+
+	if( libcthreads_atomic_add_int32(
+	     &( internal_barrier->number_of_remaining_threads ),
+	     -1 ) == 0 )
+	{
+		/* The last thread to arrive is the serial thread
+		 */
+		libcthreads_atomic_add_int32(
+		 &( internal_barrier->number_of_remaining_threads ),
+		 internal_barrier->number_of_threads );
+
+		libcthreads_atomic_add_int32(
+		 &( internal_barrier->phase ),
+		 1 );
+
+		libcthreads_futex_wake_all(
+		 &( internal_barrier->phase ) );
+
+		return( 1 );
+	}
+	for( spin_count = 0;
+	     spin_count < LIBCTHREADS_RENDEZVOUS_SPIN_COUNT;
+	     spin_count++ )
+	{
+		if( libcthreads_atomic_load_sequential_int32(
+		     &( internal_barrier->phase ) ) != phase )
+		{
+			return( 0 );
+		}
+		libcthreads_atomic_pause();
+	}
+	while( libcthreads_atomic_load_sequential_int32(
+	        &( internal_barrier->phase ) ) == phase )
+	{
+		libcthreads_futex_wait(
+		 &( internal_barrier->phase ),
+		 phase );
+	}
+	return( 0 );
+}
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
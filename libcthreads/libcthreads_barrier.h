@@ -0,0 +1,83 @@
+/*
+ * Barrier functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_BARRIER_H )
+#define _LIBCTHREADS_INTERNAL_BARRIER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcthreads_definitions.h"
+#include "libcthreads_extern.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct libcthreads_internal_barrier libcthreads_internal_barrier_t;
+
+struct libcthreads_internal_barrier
+{
+	/* The number of threads that rendezvous at the barrier
+	 */
+	int32_t number_of_threads;
+
+	/* The number of threads that still have to arrive at the barrier in the current phase
+	 */
+	int32_t number_of_remaining_threads;
+
+	/* Padding so that the phase does not share a cache line with the arrivals
+	 */
+	uint8_t padding[ LIBCTHREADS_CACHE_LINE_SIZE - ( 2 * sizeof( int32_t ) ) ];
+
+	/* The phase, which is incremented by the last thread to arrive and is the address the waiting threads wait on
+	 */
+	int32_t phase;
+};
+
+LIBCTHREADS_EXTERN \
+int libcthreads_barrier_initialize(
+     libcthreads_barrier_t **barrier,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_barrier_free(
+     libcthreads_barrier_t **barrier,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_barrier_wait(
+     libcthreads_barrier_t *barrier,
+     libcerror_error_t **error );
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCTHREADS_INTERNAL_BARRIER_H ) */
+
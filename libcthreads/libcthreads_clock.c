@@ -0,0 +1,100 @@
+/*
+ * Clock functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if !defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "libcthreads_clock.h"
+
+/* Retrieves the current time of a monotonic clock, which is not affected by changes of the system time
+ * Platforms without a monotonic clock fall back to the system time with a precision of seconds
+ * Returns the time in nano seconds
+ */
+uint64_t libcthreads_clock_get_monotonic_time(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+#endif
+
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( frequency.QuadPart == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 ) )
+	{
+		return( (uint64_t) GetTickCount() * 1000000UL );
+	}
+	/* Split the conversion to prevent the multiplication from overflowing
+	 */
+	return( ( (uint64_t) ( counter.QuadPart / frequency.QuadPart ) * 1000000000UL )
+	      + ( (uint64_t) ( counter.QuadPart % frequency.QuadPart ) * 1000000000UL / (uint64_t) frequency.QuadPart ) );
+
+#else
+#if defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) == 0 )
+	{
+		return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+	}
+#endif
+	return( (uint64_t) time( NULL ) * 1000000000UL );
+
+#endif
+}
+
+/* Determines the deadline of a timeout
+ * The timeout is in milliseconds
+ * Returns the deadline in nano seconds of the monotonic clock
+ */
+uint64_t libcthreads_clock_get_deadline(
+          uint32_t timeout )
+{
+	return( libcthreads_clock_get_monotonic_time() + ( (uint64_t) timeout * 1000000UL ) );
+}
+
+/* Determines the time remaining until a deadline
+ * Returns the remaining time in milliseconds, rounded up, or 0 if the deadline has passed
+ */
+uint32_t libcthreads_clock_get_remaining_time(
+          uint64_t deadline )
+{
+	uint64_t current_time = 0;
+
+	current_time = libcthreads_clock_get_monotonic_time();
+
+	if( current_time >= deadline )
+	{
+		return( 0 );
+	}
+	return( (uint32_t) ( ( deadline - current_time + 999999UL ) / 1000000UL ) );
+}
+
@@ -0,0 +1,46 @@
+/*
+ * Clock functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_CLOCK_H )
+#define _LIBCTHREADS_INTERNAL_CLOCK_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+uint64_t libcthreads_clock_get_monotonic_time(
+          void );
+
+uint64_t libcthreads_clock_get_deadline(
+          uint32_t timeout );
+
+uint32_t libcthreads_clock_get_remaining_time(
+          uint64_t deadline );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCTHREADS_INTERNAL_CLOCK_H ) */
+
@@ -0,0 +1,810 @@
+/*
+ * Epoch-based memory reclamation functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcthreads_atomic.h"
+#include "libcthreads_definitions.h"
+#include "libcthreads_epoch.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_light_mutex.h"
+#include "libcthreads_memory.h"
+#include "libcthreads_types.h"
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The epoch is stored in the participant state shifted left by 1, hence it is restricted to 30 bits
+ */
+#define LIBCTHREADS_EPOCH_MASK				0x3fffffffUL
+
+/* The number of values deferred by a participant after which a collect is attempted
+ */
+#define LIBCTHREADS_EPOCH_COLLECT_INTERVAL		64
+
+/* Frees the deferred values that are no longer reachable by any participant
+ * A value deferred in epoch E can be freed once the global epoch is at least E + 2,
+ * since every participant in a critical section has then observed epoch E + 1 or later
+ * If free_all is set, all deferred values are freed
+ * Returns 1 if successful or -1 on error
+ */
+static int libcthreads_internal_epoch_free_deferred_values(
+            libcthreads_internal_epoch_deferred_value_t **first_deferred_value,
+            libcthreads_internal_epoch_deferred_value_t **last_deferred_value,
+            uint32_t global_epoch,
+            uint8_t free_all,
+            libcerror_error_t **error )
+{
+	libcthreads_internal_epoch_deferred_value_t *deferred_value          = NULL;
+	libcthreads_internal_epoch_deferred_value_t *previous_deferred_value = NULL;
+	libcthreads_internal_epoch_deferred_value_t *next_deferred_value     = NULL;
+	static char *function                                                = "libcthreads_internal_epoch_free_deferred_values";
+	int result                                                           = 1;
+
+	deferred_value = *first_deferred_value;
+
+	while( deferred_value != NULL )
+	{
+		next_deferred_value = deferred_value->next;
+
+		if( ( free_all == 0 )
+		 && ( ( ( global_epoch - deferred_value->epoch ) & LIBCTHREADS_EPOCH_MASK ) < 2 ) )
+		{
+			previous_deferred_value = deferred_value;
+		}
+		else
+		{
+			if( previous_deferred_value == NULL )
+			{
+				*first_deferred_value = next_deferred_value;
+			}
+			else
+			{
+				previous_deferred_value->next = next_deferred_value;
+			}
+			if( *last_deferred_value == deferred_value )
+			{
+				*last_deferred_value = previous_deferred_value;
+			}
+			if( deferred_value->value_free_function(
+			     &( deferred_value->value ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free deferred value.",
+				 function );
+
+				result = -1;
+			}
+			memory_free(
+			 deferred_value );
+		}
+		deferred_value = next_deferred_value;
+	}
+	return( result );
+}
+
+/* Creates an epoch
+ * Make sure the value epoch is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_epoch_initialize(
+     libcthreads_epoch_t **epoch,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_epoch_t *internal_epoch = NULL;
+	static char *function                        = "libcthreads_epoch_initialize";
+
+	if( epoch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid epoch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *epoch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid epoch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The global epoch is aligned to a cache line so that it does not share
+	 * a cache line with other data
+	 */
+	internal_epoch = (libcthreads_internal_epoch_t *) libcthreads_memory_allocate_aligned(
+	                                                 sizeof( libcthreads_internal_epoch_t ),
+	                                                 LIBCTHREADS_CACHE_LINE_SIZE );
+
+	if( internal_epoch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create epoch.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_epoch,
+	     0,
+	     sizeof( libcthreads_internal_epoch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear epoch.",
+		 function );
+
+		libcthreads_memory_free_aligned(
+		 internal_epoch );
+
+		return( -1 );
+	}
+	internal_epoch->participants_mutex = LIBCTHREADS_LIGHT_MUTEX_INIT;
+
+	*epoch = (libcthreads_epoch_t *) internal_epoch;
+
+	return( 1 );
+}
+
+/* Frees an epoch
+ * All deferred values are freed, hence no participant can be in a critical section
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_epoch_free(
+     libcthreads_epoch_t **epoch,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_epoch_t *internal_epoch                   = NULL;
+	libcthreads_internal_epoch_participant_t *internal_participant = NULL;
+	static char *function                                          = "libcthreads_epoch_free";
+	int result                                                     = 1;
+
+	if( epoch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid epoch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *epoch != NULL )
+	{
+		internal_epoch = (libcthreads_internal_epoch_t *) *epoch;
+		*epoch         = NULL;
+
+		if( internal_epoch->first_participant != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to destroy epoch with error: Resource busy.",
+			 function );
+
+			result = -1;
+		}
+		while( internal_epoch->first_participant != NULL )
+		{
+			internal_participant              = internal_epoch->first_participant;
+			internal_epoch->first_participant = internal_participant->next_participant;
+
+			if( libcthreads_internal_epoch_free_deferred_values(
+			     &( internal_participant->first_deferred_value ),
+			     &( internal_participant->last_deferred_value ),
+			     0,
+			     1,
+			     error ) != 1 )
+			{
+				result = -1;
+			}
+			libcthreads_memory_free_aligned(
+			 internal_participant );
+		}
+		if( libcthreads_internal_epoch_free_deferred_values(
+		     &( internal_epoch->first_orphaned_deferred_value ),
+		     &( internal_epoch->last_orphaned_deferred_value ),
+		     0,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free orphaned deferred values.",
+			 function );
+
+			result = -1;
+		}
+		libcthreads_memory_free_aligned(
+		 internal_epoch );
+	}
+	return( result );
+}
+
+/* Registers the calling thread as a participant of an epoch
+ * The participant must only be used by the thread that registered it
+ * Make sure the value participant is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_epoch_register_thread(
+     libcthreads_epoch_t *epoch,
+     libcthreads_epoch_participant_t **participant,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_epoch_t *internal_epoch                   = NULL;
+	libcthreads_internal_epoch_participant_t *internal_participant = NULL;
+	static char *function                                          = "libcthreads_epoch_register_thread";
+
+	if( epoch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid epoch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_epoch = (libcthreads_internal_epoch_t *) epoch;
+
+	if( participant == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid participant.",
+		 function );
+
+		return( -1 );
+	}
+	if( *participant != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid participant value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The participant is aligned to a cache line so that the state of different
+	 * participants does not share a cache line
+	 */
+	internal_participant = (libcthreads_internal_epoch_participant_t *) libcthreads_memory_allocate_aligned(
+	                                                       sizeof( libcthreads_internal_epoch_participant_t ),
+	                                                       LIBCTHREADS_CACHE_LINE_SIZE );
+
+	if( internal_participant == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create participant.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_participant,
+	     0,
+	     sizeof( libcthreads_internal_epoch_participant_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear participant.",
+		 function );
+
+		libcthreads_memory_free_aligned(
+		 internal_participant );
+
+		return( -1 );
+	}
+	internal_participant->epoch = internal_epoch;
+
+	if( libcthreads_light_mutex_grab(
+	     &( internal_epoch->participants_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab participants mutex.",
+		 function );
+
+		libcthreads_memory_free_aligned(
+		 internal_participant );
+
+		return( -1 );
+	}
+	internal_participant->next_participant = internal_epoch->first_participant;
+
+	if( internal_epoch->first_participant != NULL )
+	{
+		internal_epoch->first_participant->previous_participant = internal_participant;
+	}
+	internal_epoch->first_participant = internal_participant;
+
+	if( libcthreads_light_mutex_release(
+	     &( internal_epoch->participants_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release participants mutex.",
+		 function );
+
+		return( -1 );
+	}
+	*participant = (libcthreads_epoch_participant_t *) internal_participant;
+
+	return( 1 );
+}
+
+/* Unregisters a participant of an epoch
+ * The values deferred by the participant that cannot be freed yet are handed over to the epoch
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_epoch_unregister_thread(
+     libcthreads_epoch_participant_t **participant,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_epoch_t *internal_epoch                   = NULL;
+	libcthreads_internal_epoch_participant_t *internal_participant = NULL;
+	static char *function                                          = "libcthreads_epoch_unregister_thread";
+
+	if( participant == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid participant.",
+		 function );
+
+		return( -1 );
+	}
+	if( *participant == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid participant.",
+		 function );
+
+		return( -1 );
+	}
+	internal_participant = (libcthreads_internal_epoch_participant_t *) *participant;
+	internal_epoch       = internal_participant->epoch;
+
+	if( internal_participant->nesting_level != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid participant - in critical section.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_light_mutex_grab(
+	     &( internal_epoch->participants_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab participants mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_participant->previous_participant == NULL )
+	{
+		internal_epoch->first_participant = internal_participant->next_participant;
+	}
+	else
+	{
+		internal_participant->previous_participant->next_participant = internal_participant->next_participant;
+	}
+	if( internal_participant->next_participant != NULL )
+	{
+		internal_participant->next_participant->previous_participant = internal_participant->previous_participant;
+	}
+	if( internal_participant->first_deferred_value != NULL )
+	{
+		if( internal_epoch->last_orphaned_deferred_value == NULL )
+		{
+			internal_epoch->first_orphaned_deferred_value = internal_participant->first_deferred_value;
+		}
+		else
+		{
+			internal_epoch->last_orphaned_deferred_value->next = internal_participant->first_deferred_value;
+		}
+		internal_epoch->last_orphaned_deferred_value = internal_participant->last_deferred_value;
+	}
+	if( libcthreads_light_mutex_release(
+	     &( internal_epoch->participants_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release participants mutex.",
+		 function );
+
+		return( -1 );
+	}
+	*participant = NULL;
+
+	libcthreads_memory_free_aligned(
+	 internal_participant );
+
+	return( 1 );
+}
+
+/* Enters a critical section
+ * Values that are reachable from shared data read in the critical section are not freed
+ * until the critical section is exited, even if they were deferred in the meantime
+ * Critical sections can be nested
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_epoch_enter(
+     libcthreads_epoch_participant_t *participant,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_epoch_participant_t *internal_participant = NULL;
+	static char *function                                          = "libcthreads_epoch_enter";
+	int32_t global_epoch                                           = 0;
+
+	if( participant == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid participant.",
+		 function );
+
+		return( -1 );
+	}
+	internal_participant = (libcthreads_internal_epoch_participant_t *) participant;
+
+	if( internal_participant->nesting_level == 0 )
+	{
+		global_epoch = libcthreads_atomic_load_sequential_int32(
+		                &( internal_participant->epoch->global_epoch ) );
+
+		/* The compare and exchange acts as a full barrier so that the state is visible
+		 * to a collector before shared data is read in the critical section
+		 * Only the thread of the participant modifies the state, hence it is 0 here
+		 */
+		libcthreads_atomic_compare_exchange_int32(
+		 &( internal_participant->state ),
+		 0,
+		 ( global_epoch << 1 ) | 1 );
+	}
+	internal_participant->nesting_level += 1;
+
+	return( 1 );
+}
+
+/* Exits a critical section
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_epoch_exit(
+     libcthreads_epoch_participant_t *participant,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_epoch_participant_t *internal_participant = NULL;
+	static char *function                                          = "libcthreads_epoch_exit";
+
+	if( participant == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid participant.",
+		 function );
+
+		return( -1 );
+	}
+	internal_participant = (libcthreads_internal_epoch_participant_t *) participant;
+
+	if( internal_participant->nesting_level <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid participant - not in critical section.",
+		 function );
+
+		return( -1 );
+	}
+	internal_participant->nesting_level -= 1;
+
+	if( internal_participant->nesting_level == 0 )
+	{
+		libcthreads_atomic_store_int(
+		 &( internal_participant->state ),
+		 0 );
+	}
+	return( 1 );
+}
+
+/* Defers freeing a value until no participant can reach it anymore
+ * The value must have been made unreachable from shared data before it is deferred
+ * Uses the value_free_function to free the value
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_epoch_defer_free(
+     libcthreads_epoch_participant_t *participant,
+     intptr_t *value,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libcthreads_internal_epoch_deferred_value_t *deferred_value    = NULL;
+	libcthreads_internal_epoch_participant_t *internal_participant = NULL;
+	static char *function                                          = "libcthreads_epoch_defer_free";
+
+	if( participant == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid participant.",
+		 function );
+
+		return( -1 );
+	}
+	internal_participant = (libcthreads_internal_epoch_participant_t *) participant;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_free_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value free function.",
+		 function );
+
+		return( -1 );
+	}
+	deferred_value = memory_allocate_structure(
+	                  libcthreads_internal_epoch_deferred_value_t );
+
+	if( deferred_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create deferred value.",
+		 function );
+
+		return( -1 );
+	}
+	deferred_value->next                = NULL;
+	deferred_value->value               = value;
+	deferred_value->value_free_function = value_free_function;
+	deferred_value->epoch               = (uint32_t) libcthreads_atomic_load_sequential_int32(
+	                                                  &( internal_participant->epoch->global_epoch ) );
+
+	if( internal_participant->last_deferred_value == NULL )
+	{
+		internal_participant->first_deferred_value = deferred_value;
+	}
+	else
+	{
+		internal_participant->last_deferred_value->next = deferred_value;
+	}
+	internal_participant->last_deferred_value = deferred_value;
+
+	internal_participant->number_of_deferred_values += 1;
+
+	if( internal_participant->number_of_deferred_values >= LIBCTHREADS_EPOCH_COLLECT_INTERVAL )
+	{
+		if( libcthreads_epoch_collect(
+		     participant,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to collect deferred values.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Advances the global epoch if every participant in a critical section has observed it
+ * and frees the deferred values that are no longer reachable
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_epoch_collect(
+     libcthreads_epoch_participant_t *participant,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_epoch_t *internal_epoch                   = NULL;
+	libcthreads_internal_epoch_participant_t *internal_participant = NULL;
+	libcthreads_internal_epoch_participant_t *other_participant    = NULL;
+	static char *function                                          = "libcthreads_epoch_collect";
+	uint32_t global_epoch                                          = 0;
+	int32_t state                                                  = 0;
+	int result                                                     = 1;
+
+	if( participant == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid participant.",
+		 function );
+
+		return( -1 );
+	}
+	internal_participant = (libcthreads_internal_epoch_participant_t *) participant;
+	internal_epoch       = internal_participant->epoch;
+
+	if( libcthreads_light_mutex_grab(
+	     &( internal_epoch->participants_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab participants mutex.",
+		 function );
+
+		return( -1 );
+	}
+	global_epoch = (uint32_t) libcthreads_atomic_load_sequential_int32(
+	                           &( internal_epoch->global_epoch ) );
+
+	other_participant = internal_epoch->first_participant;
+
+	while( other_participant != NULL )
+	{
+		state = libcthreads_atomic_load_sequential_int32(
+		         &( other_participant->state ) );
+
+		if( ( ( state & 1 ) != 0 )
+		 && ( ( (uint32_t) state >> 1 ) != global_epoch ) )
+		{
+			break;
+		}
+		other_participant = other_participant->next_participant;
+	}
+	if( other_participant == NULL )
+	{
+		global_epoch = ( global_epoch + 1 ) & LIBCTHREADS_EPOCH_MASK;
+
+		libcthreads_atomic_exchange_int32(
+		 &( internal_epoch->global_epoch ),
+		 (int32_t) global_epoch );
+	}
+	if( libcthreads_internal_epoch_free_deferred_values(
+	     &( internal_epoch->first_orphaned_deferred_value ),
+	     &( internal_epoch->last_orphaned_deferred_value ),
+	     global_epoch,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free orphaned deferred values.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_light_mutex_release(
+	     &( internal_epoch->participants_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release participants mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_internal_epoch_free_deferred_values(
+	     &( internal_participant->first_deferred_value ),
+	     &( internal_participant->last_deferred_value ),
+	     global_epoch,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free deferred values.",
+		 function );
+
+		result = -1;
+	}
+	internal_participant->number_of_deferred_values = 0;
+
+	return( result );
+}
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,181 @@
+/*
+ * Epoch-based memory reclamation functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_EPOCH_H )
+#define _LIBCTHREADS_INTERNAL_EPOCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcthreads_definitions.h"
+#include "libcthreads_extern.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct libcthreads_internal_epoch_deferred_value libcthreads_internal_epoch_deferred_value_t;
+
+struct libcthreads_internal_epoch_deferred_value
+{
+	/* The next deferred value
+	 */
+	libcthreads_internal_epoch_deferred_value_t *next;
+
+	/* The value
+	 */
+	intptr_t *value;
+
+	/* The value free function
+	 */
+	int (*value_free_function)(
+	       intptr_t **value,
+	       libcerror_error_t **error );
+
+	/* The global epoch at the time the value was deferred
+	 */
+	uint32_t epoch;
+};
+
+typedef struct libcthreads_internal_epoch libcthreads_internal_epoch_t;
+
+typedef struct libcthreads_internal_epoch_participant libcthreads_internal_epoch_participant_t;
+
+struct libcthreads_internal_epoch_participant
+{
+	/* The state, which contains the observed global epoch shifted left by 1
+	 * and bit 0 set while the participant is in a critical section
+	 */
+	int32_t state;
+
+	/* The critical section nesting level
+	 */
+	int nesting_level;
+
+	/* The epoch
+	 */
+	libcthreads_internal_epoch_t *epoch;
+
+	/* The first deferred value
+	 */
+	libcthreads_internal_epoch_deferred_value_t *first_deferred_value;
+
+	/* The last deferred value
+	 */
+	libcthreads_internal_epoch_deferred_value_t *last_deferred_value;
+
+	/* The number of values deferred since the last collect
+	 */
+	int number_of_deferred_values;
+
+	/* The previous participant
+	 */
+	libcthreads_internal_epoch_participant_t *previous_participant;
+
+	/* The next participant
+	 */
+	libcthreads_internal_epoch_participant_t *next_participant;
+};
+
+struct libcthreads_internal_epoch
+{
+	/* The global epoch
+	 */
+	int32_t global_epoch;
+
+	/* Padding so that the global epoch does not share a cache line with other data
+	 */
+	uint8_t padding[ LIBCTHREADS_CACHE_LINE_SIZE - sizeof( int32_t ) ];
+
+	/* The light mutex that protects the participants and the orphaned deferred values
+	 */
+	libcthreads_light_mutex_t participants_mutex;
+
+	/* The first participant
+	 */
+	libcthreads_internal_epoch_participant_t *first_participant;
+
+	/* The first deferred value of unregistered participants
+	 */
+	libcthreads_internal_epoch_deferred_value_t *first_orphaned_deferred_value;
+
+	/* The last deferred value of unregistered participants
+	 */
+	libcthreads_internal_epoch_deferred_value_t *last_orphaned_deferred_value;
+};
+
+LIBCTHREADS_EXTERN \
+int libcthreads_epoch_initialize(
+     libcthreads_epoch_t **epoch,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_epoch_free(
+     libcthreads_epoch_t **epoch,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_epoch_register_thread(
+     libcthreads_epoch_t *epoch,
+     libcthreads_epoch_participant_t **participant,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_epoch_unregister_thread(
+     libcthreads_epoch_participant_t **participant,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_epoch_enter(
+     libcthreads_epoch_participant_t *participant,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_epoch_exit(
+     libcthreads_epoch_participant_t *participant,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_epoch_defer_free(
+     libcthreads_epoch_participant_t *participant,
+     intptr_t *value,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_epoch_collect(
+     libcthreads_epoch_participant_t *participant,
+     libcerror_error_t **error );
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCTHREADS_INTERNAL_EPOCH_H ) */
+
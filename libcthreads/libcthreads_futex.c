@@ -0,0 +1,798 @@
+/*
+ * Futex functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( WINAPI ) && ( WINVER >= 0x0602 )
+#if defined( _MSC_VER )
+#include <Synchapi.h>
+
+#pragma comment( lib, "Synchronization.lib" )
+#endif
+
+#elif defined( HAVE_LINUX_FUTEX_H ) && defined( HAVE_SYS_SYSCALL_H )
+#include <errno.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#elif !defined( WINAPI ) && defined( HAVE_PTHREAD_H )
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+
+#elif !defined( WINAPI )
+#if defined( HAVE_NANOSLEEP )
+#include <time.h>
+#endif
+
+#if defined( HAVE_SCHED_H )
+#include <sched.h>
+#endif
+
+#endif
+
+#include "libcthreads_atomic.h"
+#include "libcthreads_futex.h"
+#include "libcthreads_unused.h"
+
+#if defined( HAVE_LINUX_FUTEX_H ) && defined( HAVE_SYS_SYSCALL_H ) && !defined( WINAPI )
+
+/* The futex is only used by the threads of the process
+ */
+#if defined( FUTEX_WAIT_PRIVATE )
+#define LIBCTHREADS_FUTEX_WAIT	FUTEX_WAIT_PRIVATE
+#define LIBCTHREADS_FUTEX_WAKE	FUTEX_WAKE_PRIVATE
+#else
+#define LIBCTHREADS_FUTEX_WAIT	FUTEX_WAIT
+#define LIBCTHREADS_FUTEX_WAKE	FUTEX_WAKE
+#endif
+
+#elif ( defined( WINAPI ) && ( WINVER < 0x0602 ) ) || ( !defined( WINAPI ) && defined( HAVE_PTHREAD_H ) )
+
+/* Without a futex-like function the waiting threads block on a condition of a bucket
+ * in a fixed table, that is selected by hashing the address. Different addresses
+ * can share a bucket, hence waking up a single thread wakes up all the threads of
+ * the bucket, the waiting threads that were not meant to be woken up wait again
+ * Before Windows Vista the condition is emulated with a manual reset event
+ */
+#define LIBCTHREADS_FUTEX_NUMBER_OF_BUCKETS_BITS	6
+#define LIBCTHREADS_FUTEX_NUMBER_OF_BUCKETS		( 1 << LIBCTHREADS_FUTEX_NUMBER_OF_BUCKETS_BITS )
+
+#define LIBCTHREADS_HAVE_FUTEX_BUCKETS
+
+typedef struct libcthreads_futex_bucket libcthreads_futex_bucket_t;
+
+struct libcthreads_futex_bucket
+{
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	/* The lock
+	 */
+	SRWLOCK lock;
+
+	/* The condition variable
+	 */
+	CONDITION_VARIABLE condition_variable;
+
+#elif defined( WINAPI )
+	/* The critical section
+	 */
+	CRITICAL_SECTION critical_section;
+
+	/* The manual reset event that is set when the waiting threads are woken up
+	 */
+	HANDLE event_handle;
+
+	/* The number of waiting threads
+	 */
+	int number_of_waiters;
+
+	/* The number of waiting threads that have not yet observed the last wake up
+	 */
+	int number_of_pending_wake_ups;
+
+	/* The wake up generation, which changes every time the waiting threads are woken up
+	 */
+	uint32_t generation;
+
+#else
+	/* The mutex
+	 */
+	pthread_mutex_t mutex;
+
+	/* The condition
+	 */
+	pthread_cond_t condition;
+#endif
+};
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+
+/* A zero initialized SRWLOCK and CONDITION_VARIABLE are equivalent to SRWLOCK_INIT
+ * and CONDITION_VARIABLE_INIT, hence the buckets do not require initialization
+ */
+static libcthreads_futex_bucket_t libcthreads_futex_buckets[ LIBCTHREADS_FUTEX_NUMBER_OF_BUCKETS ];
+
+#elif defined( WINAPI )
+
+/* The buckets are initialized once and used for the lifetime of the process
+ */
+static libcthreads_futex_bucket_t libcthreads_futex_buckets[ LIBCTHREADS_FUTEX_NUMBER_OF_BUCKETS ];
+
+/* The initialization state of the buckets, 0 if not initialized, 1 while
+ * being initialized or 2 if initialized
+ */
+static int32_t libcthreads_futex_buckets_state = 0;
+
+/* Initializes the buckets
+ */
+static void libcthreads_futex_buckets_initialize(
+             void )
+{
+	int bucket_index = 0;
+
+	if( libcthreads_atomic_compare_exchange_int32(
+	     &libcthreads_futex_buckets_state,
+	     0,
+	     1 ) != 0 )
+	{
+		/* Another thread is initializing the buckets
+		 */
+		while( libcthreads_atomic_load_sequential_int32(
+		        &libcthreads_futex_buckets_state ) != 2 )
+		{
+			SwitchToThread();
+		}
+		return;
+	}
+	for( bucket_index = 0;
+	     bucket_index < LIBCTHREADS_FUTEX_NUMBER_OF_BUCKETS;
+	     bucket_index++ )
+	{
+		InitializeCriticalSection(
+		 &( libcthreads_futex_buckets[ bucket_index ].critical_section ) );
+
+		/* If the event cannot be created the threads waiting on the bucket yield instead
+		 */
+		libcthreads_futex_buckets[ bucket_index ].event_handle = CreateEvent(
+		                                                          NULL,
+		                                                          TRUE,
+		                                                          FALSE,
+		                                                          NULL );
+	}
+	libcthreads_atomic_exchange_int32(
+	 &libcthreads_futex_buckets_state,
+	 2 );
+}
+
+#else
+
+/* The buckets are initialized once and used for the lifetime of the process
+ */
+static libcthreads_futex_bucket_t libcthreads_futex_buckets[ LIBCTHREADS_FUTEX_NUMBER_OF_BUCKETS ];
+
+static pthread_once_t libcthreads_futex_buckets_once = PTHREAD_ONCE_INIT;
+
+/* The clock used for the timed wait, a monotonic clock is not affected by changes of the system time
+ */
+#if defined( HAVE_PTHREAD_CONDATTR_SETCLOCK ) && defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+#define LIBCTHREADS_FUTEX_CLOCK		CLOCK_MONOTONIC
+#elif defined( HAVE_CLOCK_GETTIME )
+#define LIBCTHREADS_FUTEX_CLOCK		CLOCK_REALTIME
+#endif
+
+/* Initializes the buckets
+ */
+static void libcthreads_futex_buckets_initialize(
+             void )
+{
+#if defined( HAVE_PTHREAD_CONDATTR_SETCLOCK ) && defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	pthread_condattr_t condition_attributes;
+#endif
+
+	int bucket_index = 0;
+
+#if defined( HAVE_PTHREAD_CONDATTR_SETCLOCK ) && defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	pthread_condattr_init(
+	 &condition_attributes );
+
+	pthread_condattr_setclock(
+	 &condition_attributes,
+	 LIBCTHREADS_FUTEX_CLOCK );
+#endif
+	for( bucket_index = 0;
+	     bucket_index < LIBCTHREADS_FUTEX_NUMBER_OF_BUCKETS;
+	     bucket_index++ )
+	{
+		pthread_mutex_init(
+		 &( libcthreads_futex_buckets[ bucket_index ].mutex ),
+		 NULL );
+
+#if defined( HAVE_PTHREAD_CONDATTR_SETCLOCK ) && defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+		pthread_cond_init(
+		 &( libcthreads_futex_buckets[ bucket_index ].condition ),
+		 &condition_attributes );
+#else
+		pthread_cond_init(
+		 &( libcthreads_futex_buckets[ bucket_index ].condition ),
+		 NULL );
+#endif
+	}
+#if defined( HAVE_PTHREAD_CONDATTR_SETCLOCK ) && defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	pthread_condattr_destroy(
+	 &condition_attributes );
+#endif
+}
+
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0600 ) */
+
+/* Retrieves the bucket of an address
+ * Returns a pointer to the bucket
+ */
+static libcthreads_futex_bucket_t *libcthreads_futex_get_bucket(
+                                    int32_t *address )
+{
+	uint32_t hash = 0;
+
+#if defined( WINAPI ) && ( WINVER < 0x0600 )
+	if( libcthreads_atomic_load_sequential_int32(
+	     &libcthreads_futex_buckets_state ) != 2 )
+	{
+		libcthreads_futex_buckets_initialize();
+	}
+#elif !defined( WINAPI )
+	pthread_once(
+	 &libcthreads_futex_buckets_once,
+	 &libcthreads_futex_buckets_initialize );
+#endif
+	/* Use Fibonacci hashing to spread neighbouring addresses over the buckets
+	 */
+	hash  = (uint32_t) ( (uintptr_t) address >> 2 );
+	hash *= (uint32_t) 0x9e3779b9UL;
+
+	return( &( libcthreads_futex_buckets[ hash >> ( 32 - LIBCTHREADS_FUTEX_NUMBER_OF_BUCKETS_BITS ) ] ) );
+}
+
+/* Wakes up all the threads that wait on the bucket of the address
+ */
+static void libcthreads_futex_wake_bucket(
+             int32_t *address )
+{
+	libcthreads_futex_bucket_t *bucket = NULL;
+
+	bucket = libcthreads_futex_get_bucket(
+	          address );
+
+	/* The lock is grabbed so that a thread that has checked the value
+	 * but is not yet waiting on the condition is not missed
+	 */
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	AcquireSRWLockExclusive(
+	 &( bucket->lock ) );
+
+	WakeAllConditionVariable(
+	 &( bucket->condition_variable ) );
+
+	ReleaseSRWLockExclusive(
+	 &( bucket->lock ) );
+
+#elif defined( WINAPI )
+	EnterCriticalSection(
+	 &( bucket->critical_section ) );
+
+	if( bucket->number_of_waiters > 0 )
+	{
+		/* The event remains set until every thread that waited at this point
+		 * has observed the new generation
+		 */
+		bucket->generation                += 1;
+		bucket->number_of_pending_wake_ups = bucket->number_of_waiters;
+
+		if( bucket->event_handle != NULL )
+		{
+			SetEvent(
+			 bucket->event_handle );
+		}
+	}
+	LeaveCriticalSection(
+	 &( bucket->critical_section ) );
+
+#else
+	if( pthread_mutex_lock(
+	     &( bucket->mutex ) ) != 0 )
+	{
+		return;
+	}
+	pthread_cond_broadcast(
+	 &( bucket->condition ) );
+
+	pthread_mutex_unlock(
+	 &( bucket->mutex ) );
+#endif
+}
+
+#if defined( WINAPI ) && ( WINVER < 0x0600 )
+
+/* Waits on the event of the bucket until the address is woken up or the timeout expires,
+ * if it still contains the expected value
+ * The timeout is in milliseconds, INFINITE to wait without a timeout
+ * Returns 1 if the wait ended before the timeout expired or 0 if the timeout expired
+ */
+static int libcthreads_futex_wait_bucket(
+            int32_t *address,
+            int32_t expected_value,
+            DWORD timeout )
+{
+	libcthreads_futex_bucket_t *bucket = NULL;
+	DWORD elapsed_time                 = 0;
+	DWORD start_time                   = 0;
+	DWORD wait_status                  = 0;
+	DWORD wait_time                    = 0;
+	uint32_t generation                = 0;
+	int result                         = 1;
+
+	bucket = libcthreads_futex_get_bucket(
+	          address );
+
+	if( bucket->event_handle == NULL )
+	{
+		SwitchToThread();
+
+		return( 1 );
+	}
+	EnterCriticalSection(
+	 &( bucket->critical_section ) );
+
+	if( libcthreads_atomic_load_sequential_int32(
+	     address ) != expected_value )
+	{
+		LeaveCriticalSection(
+		 &( bucket->critical_section ) );
+
+		return( 1 );
+	}
+	generation  = bucket->generation;
+	start_time  = GetTickCount();
+	wait_status = WAIT_TIMEOUT;
+	wait_time   = timeout;
+
+	bucket->number_of_waiters += 1;
+
+	do
+	{
+		LeaveCriticalSection(
+		 &( bucket->critical_section ) );
+
+		if( wait_status == WAIT_OBJECT_0 )
+		{
+			/* The event is still set for threads that started waiting before
+			 * the last wake up, hence give them the opportunity to observe it
+			 */
+			SwitchToThread();
+		}
+		wait_status = WaitForSingleObject(
+		               bucket->event_handle,
+		               wait_time );
+
+		EnterCriticalSection(
+		 &( bucket->critical_section ) );
+
+		if( bucket->generation != generation )
+		{
+			/* The last thread to observe the wake up resets the event
+			 */
+			bucket->number_of_pending_wake_ups -= 1;
+
+			if( bucket->number_of_pending_wake_ups == 0 )
+			{
+				ResetEvent(
+				 bucket->event_handle );
+			}
+			break;
+		}
+		if( wait_status == WAIT_FAILED )
+		{
+			break;
+		}
+		if( timeout != INFINITE )
+		{
+			elapsed_time = GetTickCount() - start_time;
+
+			if( elapsed_time >= timeout )
+			{
+				result = 0;
+			}
+			else
+			{
+				wait_time = timeout - elapsed_time;
+			}
+		}
+	}
+	while( result == 1 );
+
+	bucket->number_of_waiters -= 1;
+
+	LeaveCriticalSection(
+	 &( bucket->critical_section ) );
+
+	return( result );
+}
+
+#endif /* defined( WINAPI ) && ( WINVER < 0x0600 ) */
+
+#endif
+
+/* Waits until the address is woken up, if it still contains the expected value
+ * The wait can return spuriously, hence the caller must check the value again
+ * On platforms without a futex-like function or condition the thread yields instead
+ */
+void libcthreads_futex_wait(
+      int32_t *address,
+      int32_t expected_value )
+{
+#if defined( LIBCTHREADS_HAVE_FUTEX_BUCKETS ) && ( !defined( WINAPI ) || ( WINVER >= 0x0600 ) )
+	libcthreads_futex_bucket_t *bucket = NULL;
+#endif
+
+#if defined( WINAPI ) && ( WINVER >= 0x0602 )
+	WaitOnAddress(
+	 (volatile VOID *) address,
+	 (PVOID) &expected_value,
+	 sizeof( int32_t ),
+	 INFINITE );
+
+#elif defined( HAVE_LINUX_FUTEX_H ) && defined( HAVE_SYS_SYSCALL_H )
+	/* EAGAIN and EINTR are handled by the caller checking the value again
+	 */
+	syscall(
+	 SYS_futex,
+	 address,
+	 LIBCTHREADS_FUTEX_WAIT,
+	 expected_value,
+	 NULL,
+	 NULL,
+	 0 );
+
+#elif defined( LIBCTHREADS_HAVE_FUTEX_BUCKETS ) && defined( WINAPI ) && ( WINVER < 0x0600 )
+	libcthreads_futex_wait_bucket(
+	 address,
+	 expected_value,
+	 INFINITE );
+
+#elif defined( LIBCTHREADS_HAVE_FUTEX_BUCKETS ) && defined( WINAPI )
+	bucket = libcthreads_futex_get_bucket(
+	          address );
+
+	AcquireSRWLockExclusive(
+	 &( bucket->lock ) );
+
+	if( libcthreads_atomic_load_sequential_int32(
+	     address ) == expected_value )
+	{
+		SleepConditionVariableSRW(
+		 &( bucket->condition_variable ),
+		 &( bucket->lock ),
+		 INFINITE,
+		 0 );
+	}
+	ReleaseSRWLockExclusive(
+	 &( bucket->lock ) );
+
+#elif defined( LIBCTHREADS_HAVE_FUTEX_BUCKETS )
+	bucket = libcthreads_futex_get_bucket(
+	          address );
+
+	if( pthread_mutex_lock(
+	     &( bucket->mutex ) ) != 0 )
+	{
+		return;
+	}
+	if( libcthreads_atomic_load_sequential_int32(
+	     address ) == expected_value )
+	{
+		pthread_cond_wait(
+		 &( bucket->condition ),
+		 &( bucket->mutex ) );
+	}
+	pthread_mutex_unlock(
+	 &( bucket->mutex ) );
+
+#else
+	LIBCTHREADS_UNREFERENCED_PARAMETER( address )
+	LIBCTHREADS_UNREFERENCED_PARAMETER( expected_value )
+
+#if defined( HAVE_SCHED_YIELD )
+	sched_yield();
+#endif
+
+#endif
+}
+
+/* Waits until the address is woken up or the timeout expires, if it still contains the expected value
+ * The timeout is in milliseconds
+ * The wait can return spuriously, hence the caller must check the value again
+ * On platforms without a futex-like function or condition the thread sleeps for the timeout instead
+ * Returns 1 if the wait ended before the timeout expired or 0 if the timeout expired
+ */
+int libcthreads_futex_timed_wait(
+     int32_t *address,
+     int32_t expected_value,
+     uint32_t timeout )
+{
+#if defined( WINAPI ) && ( WINVER >= 0x0602 )
+	if( WaitOnAddress(
+	     (volatile VOID *) address,
+	     (PVOID) &expected_value,
+	     sizeof( int32_t ),
+	     (DWORD) timeout ) == FALSE )
+	{
+		if( GetLastError() == ERROR_TIMEOUT )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+
+#elif defined( HAVE_LINUX_FUTEX_H ) && defined( HAVE_SYS_SYSCALL_H )
+	struct timespec wait_time;
+
+	wait_time.tv_sec  = (time_t) ( timeout / 1000 );
+	wait_time.tv_nsec = (long) ( timeout % 1000 ) * 1000000;
+
+	/* EAGAIN and EINTR are handled by the caller checking the value again
+	 */
+	if( syscall(
+	     SYS_futex,
+	     address,
+	     LIBCTHREADS_FUTEX_WAIT,
+	     expected_value,
+	     &wait_time,
+	     NULL,
+	     0 ) == -1 )
+	{
+		if( errno == ETIMEDOUT )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+
+#elif defined( LIBCTHREADS_HAVE_FUTEX_BUCKETS ) && defined( WINAPI ) && ( WINVER < 0x0600 )
+	return( libcthreads_futex_wait_bucket(
+	         address,
+	         expected_value,
+	         (DWORD) timeout ) );
+
+#elif defined( LIBCTHREADS_HAVE_FUTEX_BUCKETS ) && defined( WINAPI )
+	libcthreads_futex_bucket_t *bucket = NULL;
+	int result                         = 1;
+
+	bucket = libcthreads_futex_get_bucket(
+	          address );
+
+	AcquireSRWLockExclusive(
+	 &( bucket->lock ) );
+
+	if( libcthreads_atomic_load_sequential_int32(
+	     address ) == expected_value )
+	{
+		if( SleepConditionVariableSRW(
+		     &( bucket->condition_variable ),
+		     &( bucket->lock ),
+		     (DWORD) timeout,
+		     0 ) == FALSE )
+		{
+			if( GetLastError() == ERROR_TIMEOUT )
+			{
+				result = 0;
+			}
+		}
+	}
+	ReleaseSRWLockExclusive(
+	 &( bucket->lock ) );
+
+	return( result );
+
+#elif defined( LIBCTHREADS_HAVE_FUTEX_BUCKETS )
+	struct timespec deadline;
+
+	libcthreads_futex_bucket_t *bucket = NULL;
+	int result                         = 1;
+
+	/* The timed wait of a condition requires an absolute time
+	 */
+#if defined( LIBCTHREADS_FUTEX_CLOCK )
+	if( clock_gettime(
+	     LIBCTHREADS_FUTEX_CLOCK,
+	     &deadline ) != 0 )
+	{
+		return( 1 );
+	}
+#else
+	deadline.tv_sec  = time(
+	                    NULL );
+	deadline.tv_nsec = 0;
+#endif
+	deadline.tv_sec  += (time_t) ( timeout / 1000 );
+	deadline.tv_nsec += (long) ( timeout % 1000 ) * 1000000;
+
+	if( deadline.tv_nsec >= 1000000000L )
+	{
+		deadline.tv_sec  += 1;
+		deadline.tv_nsec -= 1000000000L;
+	}
+	bucket = libcthreads_futex_get_bucket(
+	          address );
+
+	if( pthread_mutex_lock(
+	     &( bucket->mutex ) ) != 0 )
+	{
+		return( 1 );
+	}
+	if( libcthreads_atomic_load_sequential_int32(
+	     address ) == expected_value )
+	{
+		if( pthread_cond_timedwait(
+		     &( bucket->condition ),
+		     &( bucket->mutex ),
+		     &deadline ) == ETIMEDOUT )
+		{
+			result = 0;
+		}
+	}
+	pthread_mutex_unlock(
+	 &( bucket->mutex ) );
+
+	return( result );
+
+#else
+#if defined( HAVE_NANOSLEEP )
+	struct timespec sleep_time;
+#endif
+
+	LIBCTHREADS_UNREFERENCED_PARAMETER( address )
+	LIBCTHREADS_UNREFERENCED_PARAMETER( expected_value )
+
+#if defined( HAVE_NANOSLEEP )
+	sleep_time.tv_sec  = (time_t) ( timeout / 1000 );
+	sleep_time.tv_nsec = (long) ( timeout % 1000 ) * 1000000;
+
+	nanosleep(
+	 &sleep_time,
+	 NULL );
+
+#elif defined( HAVE_SCHED_YIELD )
+	LIBCTHREADS_UNREFERENCED_PARAMETER( timeout )
+
+	sched_yield();
+
+#else
+	LIBCTHREADS_UNREFERENCED_PARAMETER( timeout )
+
+#endif
+	return( 0 );
+
+#endif
+}
+
+/* Wakes up a single thread that waits on the address
+ */
+void libcthreads_futex_wake_single(
+      int32_t *address )
+{
+#if defined( WINAPI ) && ( WINVER >= 0x0602 )
+	WakeByAddressSingle(
+	 (PVOID) address );
+
+#elif defined( HAVE_LINUX_FUTEX_H ) && defined( HAVE_SYS_SYSCALL_H )
+	syscall(
+	 SYS_futex,
+	 address,
+	 LIBCTHREADS_FUTEX_WAKE,
+	 1,
+	 NULL,
+	 NULL,
+	 0 );
+
+#elif defined( LIBCTHREADS_HAVE_FUTEX_BUCKETS )
+	libcthreads_futex_wake_bucket(
+	 address );
+
+#else
+	LIBCTHREADS_UNREFERENCED_PARAMETER( address )
+
+#endif
+}
+
+/* Wakes up at most a specific number of threads that wait on the address
+ */
+void libcthreads_futex_wake_multiple(
+      int32_t *address,
+      int number_of_threads )
+{
+#if defined( WINAPI ) && ( WINVER >= 0x0602 )
+	while( number_of_threads > 0 )
+	{
+		WakeByAddressSingle(
+		 (PVOID) address );
+
+		number_of_threads--;
+	}
+
+#elif defined( HAVE_LINUX_FUTEX_H ) && defined( HAVE_SYS_SYSCALL_H )
+	if( number_of_threads > 0 )
+	{
+		syscall(
+		 SYS_futex,
+		 address,
+		 LIBCTHREADS_FUTEX_WAKE,
+		 number_of_threads,
+		 NULL,
+		 NULL,
+		 0 );
+	}
+
+#elif defined( LIBCTHREADS_HAVE_FUTEX_BUCKETS )
+	LIBCTHREADS_UNREFERENCED_PARAMETER( number_of_threads )
+
+	libcthreads_futex_wake_bucket(
+	 address );
+
+#else
+	LIBCTHREADS_UNREFERENCED_PARAMETER( address )
+	LIBCTHREADS_UNREFERENCED_PARAMETER( number_of_threads )
+
+#endif
+}
+
+/* Wakes up all the threads that wait on the address
+ */
+void libcthreads_futex_wake_all(
+      int32_t *address )
+{
+#if defined( WINAPI ) && ( WINVER >= 0x0602 )
+	WakeByAddressAll(
+	 (PVOID) address );
+
+#elif defined( HAVE_LINUX_FUTEX_H ) && defined( HAVE_SYS_SYSCALL_H )
+	syscall(
+	 SYS_futex,
+	 address,
+	 LIBCTHREADS_FUTEX_WAKE,
+	 INT_MAX,
+	 NULL,
+	 NULL,
+	 0 );
+
+#elif defined( LIBCTHREADS_HAVE_FUTEX_BUCKETS )
+	libcthreads_futex_wake_bucket(
+	 address );
+
+#else
+	LIBCTHREADS_UNREFERENCED_PARAMETER( address )
+
+#endif
+}
@@ -0,0 +1,56 @@
+/*
+ * Futex functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_FUTEX_H )
+#define _LIBCTHREADS_INTERNAL_FUTEX_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+void libcthreads_futex_wait(
+      int32_t *address,
+      int32_t expected_value );
+
+int libcthreads_futex_timed_wait(
+     int32_t *address,
+     int32_t expected_value,
+     uint32_t timeout );
+
+void libcthreads_futex_wake_single(
+      int32_t *address );
+
+void libcthreads_futex_wake_multiple(
+      int32_t *address,
+      int number_of_threads );
+
+void libcthreads_futex_wake_all(
+      int32_t *address );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCTHREADS_INTERNAL_FUTEX_H ) */
+
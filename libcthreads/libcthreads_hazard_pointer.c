@@ -0,0 +1,856 @@
+/*
+ * Hazard pointer functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcthreads_atomic.h"
+#include "libcthreads_definitions.h"
+#include "libcthreads_hazard_pointer.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_light_mutex.h"
+#include "libcthreads_memory.h"
+#include "libcthreads_types.h"
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The number of retired values, in addition to twice the number of hazard pointers,
+ * after which the retired values are reclaimed
+ */
+#define LIBCTHREADS_HAZARD_POINTER_DOMAIN_RECLAIM_THRESHOLD	64
+
+/* Creates a hazard pointer domain
+ * Make sure the value hazard_pointer_domain is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_hazard_pointer_domain_initialize(
+     libcthreads_hazard_pointer_domain_t **hazard_pointer_domain,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_hazard_pointer_domain_t *internal_hazard_pointer_domain = NULL;
+	static char *function                                                        = "libcthreads_hazard_pointer_domain_initialize";
+
+	if( hazard_pointer_domain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hazard pointer domain.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hazard_pointer_domain != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hazard pointer domain value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_hazard_pointer_domain = memory_allocate_structure(
+	                                 libcthreads_internal_hazard_pointer_domain_t );
+
+	if( internal_hazard_pointer_domain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hazard pointer domain.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_hazard_pointer_domain,
+	     0,
+	     sizeof( libcthreads_internal_hazard_pointer_domain_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hazard pointer domain.",
+		 function );
+
+		memory_free(
+		 internal_hazard_pointer_domain );
+
+		return( -1 );
+	}
+	internal_hazard_pointer_domain->retired_values_mutex = LIBCTHREADS_LIGHT_MUTEX_INIT;
+
+	*hazard_pointer_domain = (libcthreads_hazard_pointer_domain_t *) internal_hazard_pointer_domain;
+
+	return( 1 );
+}
+
+/* Frees a hazard pointer domain
+ * All retired values are freed, hence no hazard pointer can be in use
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_hazard_pointer_domain_free(
+     libcthreads_hazard_pointer_domain_t **hazard_pointer_domain,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_hazard_pointer_domain_t *internal_hazard_pointer_domain = NULL;
+	libcthreads_internal_hazard_pointer_t *internal_hazard_pointer               = NULL;
+	libcthreads_internal_hazard_pointer_retired_value_t *retired_value           = NULL;
+	static char *function                                                        = "libcthreads_hazard_pointer_domain_free";
+	int result                                                                   = 1;
+
+	if( hazard_pointer_domain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hazard pointer domain.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hazard_pointer_domain != NULL )
+	{
+		internal_hazard_pointer_domain = (libcthreads_internal_hazard_pointer_domain_t *) *hazard_pointer_domain;
+		*hazard_pointer_domain         = NULL;
+
+		while( internal_hazard_pointer_domain->first_hazard_pointer != NULL )
+		{
+			internal_hazard_pointer                              = internal_hazard_pointer_domain->first_hazard_pointer;
+			internal_hazard_pointer_domain->first_hazard_pointer = internal_hazard_pointer->next;
+
+			if( libcthreads_atomic_load_int(
+			     &( internal_hazard_pointer->in_use ) ) != 0 )
+			{
+				result = 0;
+			}
+			libcthreads_memory_free_aligned(
+			 internal_hazard_pointer );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to destroy hazard pointer domain with error: Resource busy.",
+			 function );
+
+			result = -1;
+		}
+		while( internal_hazard_pointer_domain->first_retired_value != NULL )
+		{
+			retired_value                                = internal_hazard_pointer_domain->first_retired_value;
+			internal_hazard_pointer_domain->first_retired_value = retired_value->next;
+
+			if( retired_value->value_free_function(
+			     &( retired_value->value ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free retired value.",
+				 function );
+
+				result = -1;
+			}
+			memory_free(
+			 retired_value );
+		}
+		memory_free(
+		 internal_hazard_pointer_domain );
+	}
+	return( result );
+}
+
+/* Retires a value
+ * The value must have been made unreachable from shared data before it is retired
+ * The value is freed by a reclaim once no hazard pointer protects it
+ * Uses the value_free_function to free the value
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_hazard_pointer_domain_retire(
+     libcthreads_hazard_pointer_domain_t *hazard_pointer_domain,
+     intptr_t *value,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libcthreads_internal_hazard_pointer_domain_t *internal_hazard_pointer_domain = NULL;
+	libcthreads_internal_hazard_pointer_retired_value_t *retired_value           = NULL;
+	static char *function                                                        = "libcthreads_hazard_pointer_domain_retire";
+	int reclaim_threshold                                                        = 0;
+	int reclaim                                                                  = 0;
+
+	if( hazard_pointer_domain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hazard pointer domain.",
+		 function );
+
+		return( -1 );
+	}
+	internal_hazard_pointer_domain = (libcthreads_internal_hazard_pointer_domain_t *) hazard_pointer_domain;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_free_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value free function.",
+		 function );
+
+		return( -1 );
+	}
+	retired_value = memory_allocate_structure(
+	                 libcthreads_internal_hazard_pointer_retired_value_t );
+
+	if( retired_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create retired value.",
+		 function );
+
+		return( -1 );
+	}
+	retired_value->value               = value;
+	retired_value->value_free_function = value_free_function;
+
+	if( libcthreads_light_mutex_grab(
+	     &( internal_hazard_pointer_domain->retired_values_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab retired values mutex.",
+		 function );
+
+		memory_free(
+		 retired_value );
+
+		return( -1 );
+	}
+	retired_value->next                                 = internal_hazard_pointer_domain->first_retired_value;
+	internal_hazard_pointer_domain->first_retired_value = retired_value;
+
+	internal_hazard_pointer_domain->number_of_retired_values += 1;
+
+	/* Reclaiming in batches bounds the number of unreclaimed values to a multiple
+	 * of the number of hazard pointers and amortizes the cost of scanning them
+	 */
+	reclaim_threshold = ( 2 * (int) libcthreads_atomic_load_int(
+	                                 &( internal_hazard_pointer_domain->number_of_hazard_pointers ) ) )
+	                  + LIBCTHREADS_HAZARD_POINTER_DOMAIN_RECLAIM_THRESHOLD;
+
+	if( internal_hazard_pointer_domain->number_of_retired_values >= reclaim_threshold )
+	{
+		reclaim = 1;
+	}
+	if( libcthreads_light_mutex_release(
+	     &( internal_hazard_pointer_domain->retired_values_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release retired values mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( reclaim != 0 )
+	{
+		if( libcthreads_hazard_pointer_domain_reclaim(
+		     hazard_pointer_domain,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reclaim retired values.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Compares two protected values
+ * Returns -1 if the first value is less than the second, 0 if equal or 1 if greater
+ */
+static int libcthreads_hazard_pointer_compare_values(
+            const void *first_value,
+            const void *second_value )
+{
+	intptr_t first_address  = 0;
+	intptr_t second_address = 0;
+
+	first_address  = (intptr_t) *( (intptr_t * const *) first_value );
+	second_address = (intptr_t) *( (intptr_t * const *) second_value );
+
+	if( first_address < second_address )
+	{
+		return( -1 );
+	}
+	else if( first_address > second_address )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Frees the retired values that are not protected by a hazard pointer
+ * The protected values are sorted once per reclaim, hence the retired values
+ * are looked up in O(R log H) instead of compared against every hazard pointer
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_hazard_pointer_domain_reclaim(
+     libcthreads_hazard_pointer_domain_t *hazard_pointer_domain,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_hazard_pointer_domain_t *internal_hazard_pointer_domain = NULL;
+	libcthreads_internal_hazard_pointer_t *first_hazard_pointer                  = NULL;
+	libcthreads_internal_hazard_pointer_t *internal_hazard_pointer               = NULL;
+	libcthreads_internal_hazard_pointer_retired_value_t *last_protected_value    = NULL;
+	libcthreads_internal_hazard_pointer_retired_value_t *next_retired_value      = NULL;
+	libcthreads_internal_hazard_pointer_retired_value_t *protected_values        = NULL;
+	libcthreads_internal_hazard_pointer_retired_value_t *retired_value           = NULL;
+	intptr_t **hazard_values                                                     = NULL;
+	static char *function                                                        = "libcthreads_hazard_pointer_domain_reclaim";
+	int hazard_value_index                                                       = 0;
+	int number_of_hazard_values                                                  = 0;
+	int number_of_protected_values                                               = 0;
+	int result                                                                   = 1;
+
+	if( hazard_pointer_domain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hazard pointer domain.",
+		 function );
+
+		return( -1 );
+	}
+	internal_hazard_pointer_domain = (libcthreads_internal_hazard_pointer_domain_t *) hazard_pointer_domain;
+
+	/* Hazard pointers are only added to the front of the list, hence the hazard pointers
+	 * from the current first hazard pointer onwards remain stable. A hazard pointer that
+	 * is added later can only protect a value that was not yet retired.
+	 */
+	first_hazard_pointer = (libcthreads_internal_hazard_pointer_t *) libcthreads_atomic_load_pointer(
+	                                                &( internal_hazard_pointer_domain->first_hazard_pointer ) );
+
+	for( internal_hazard_pointer = first_hazard_pointer;
+	     internal_hazard_pointer != NULL;
+	     internal_hazard_pointer = internal_hazard_pointer->next )
+	{
+		number_of_hazard_values++;
+	}
+	if( number_of_hazard_values > 0 )
+	{
+		hazard_values = (intptr_t **) memory_allocate(
+		                               sizeof( intptr_t * ) * number_of_hazard_values );
+
+		if( hazard_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create hazard values.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Take the retired values so that the hazard pointers are scanned without holding the mutex
+	 */
+	if( libcthreads_light_mutex_grab(
+	     &( internal_hazard_pointer_domain->retired_values_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab retired values mutex.",
+		 function );
+
+		goto on_error;
+	}
+	retired_value = internal_hazard_pointer_domain->first_retired_value;
+
+	internal_hazard_pointer_domain->first_retired_value      = NULL;
+	internal_hazard_pointer_domain->number_of_retired_values = 0;
+
+	if( libcthreads_light_mutex_release(
+	     &( internal_hazard_pointer_domain->retired_values_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release retired values mutex.",
+		 function );
+
+		goto on_error;
+	}
+	/* Make sure the hazard pointers are read after the retired values were unlinked from shared data
+	 */
+	libcthreads_atomic_full_fence();
+
+	internal_hazard_pointer = first_hazard_pointer;
+
+	for( hazard_value_index = 0;
+	     hazard_value_index < number_of_hazard_values;
+	     hazard_value_index++ )
+	{
+		hazard_values[ hazard_value_index ] = (intptr_t *) libcthreads_atomic_load_pointer(
+		                                                    &( internal_hazard_pointer->value ) );
+
+		internal_hazard_pointer = internal_hazard_pointer->next;
+	}
+	if( number_of_hazard_values > 1 )
+	{
+		qsort(
+		 hazard_values,
+		 (size_t) number_of_hazard_values,
+		 sizeof( intptr_t * ),
+		 &libcthreads_hazard_pointer_compare_values );
+	}
+	while( retired_value != NULL )
+	{
+		next_retired_value = retired_value->next;
+
+		if( ( number_of_hazard_values > 0 )
+		 && ( bsearch(
+		       &( retired_value->value ),
+		       hazard_values,
+		       (size_t) number_of_hazard_values,
+		       sizeof( intptr_t * ),
+		       &libcthreads_hazard_pointer_compare_values ) != NULL ) )
+		{
+			retired_value->next = protected_values;
+			protected_values    = retired_value;
+
+			if( last_protected_value == NULL )
+			{
+				last_protected_value = retired_value;
+			}
+			number_of_protected_values++;
+		}
+		else
+		{
+			if( retired_value->value_free_function(
+			     &( retired_value->value ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free retired value.",
+				 function );
+
+				result = -1;
+			}
+			memory_free(
+			 retired_value );
+		}
+		retired_value = next_retired_value;
+	}
+	if( hazard_values != NULL )
+	{
+		memory_free(
+		 hazard_values );
+
+		hazard_values = NULL;
+	}
+	/* Hand the values that are still protected back to the domain
+	 */
+	if( protected_values != NULL )
+	{
+		if( libcthreads_light_mutex_grab(
+		     &( internal_hazard_pointer_domain->retired_values_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab retired values mutex.",
+			 function );
+
+			return( -1 );
+		}
+		last_protected_value->next                          = internal_hazard_pointer_domain->first_retired_value;
+		internal_hazard_pointer_domain->first_retired_value = protected_values;
+
+		internal_hazard_pointer_domain->number_of_retired_values += number_of_protected_values;
+
+		if( libcthreads_light_mutex_release(
+		     &( internal_hazard_pointer_domain->retired_values_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release retired values mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+
+on_error:
+	if( hazard_values != NULL )
+	{
+		memory_free(
+		 hazard_values );
+	}
+	return( -1 );
+}
+
+/* Acquires a hazard pointer of a hazard pointer domain
+ * The hazard pointer must only be used by the thread that acquired it
+ * A released hazard pointer is reused by a subsequent acquire
+ * Make sure the value hazard_pointer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_hazard_pointer_acquire(
+     libcthreads_hazard_pointer_domain_t *hazard_pointer_domain,
+     libcthreads_hazard_pointer_t **hazard_pointer,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_hazard_pointer_domain_t *internal_hazard_pointer_domain = NULL;
+	libcthreads_internal_hazard_pointer_t *first_hazard_pointer                  = NULL;
+	libcthreads_internal_hazard_pointer_t *internal_hazard_pointer               = NULL;
+	static char *function                                                        = "libcthreads_hazard_pointer_acquire";
+
+	if( hazard_pointer_domain == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hazard pointer domain.",
+		 function );
+
+		return( -1 );
+	}
+	internal_hazard_pointer_domain = (libcthreads_internal_hazard_pointer_domain_t *) hazard_pointer_domain;
+
+	if( hazard_pointer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hazard pointer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hazard_pointer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hazard pointer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* Reuse a hazard pointer that was released
+	 */
+	internal_hazard_pointer = (libcthreads_internal_hazard_pointer_t *) libcthreads_atomic_load_pointer(
+	                                                   &( internal_hazard_pointer_domain->first_hazard_pointer ) );
+
+	while( internal_hazard_pointer != NULL )
+	{
+		if( ( libcthreads_atomic_load_int(
+		       &( internal_hazard_pointer->in_use ) ) == 0 )
+		 && ( libcthreads_atomic_compare_exchange_int32(
+		       &( internal_hazard_pointer->in_use ),
+		       0,
+		       1 ) == 0 ) )
+		{
+			*hazard_pointer = (libcthreads_hazard_pointer_t *) internal_hazard_pointer;
+
+			return( 1 );
+		}
+		internal_hazard_pointer = internal_hazard_pointer->next;
+	}
+	/* The hazard pointer is aligned to a cache line so that the protected values
+	 * of different threads do not share a cache line
+	 */
+	internal_hazard_pointer = (libcthreads_internal_hazard_pointer_t *) libcthreads_memory_allocate_aligned(
+	                                                    sizeof( libcthreads_internal_hazard_pointer_t ),
+	                                                    LIBCTHREADS_CACHE_LINE_SIZE );
+
+	if( internal_hazard_pointer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hazard pointer.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_hazard_pointer,
+	     0,
+	     sizeof( libcthreads_internal_hazard_pointer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hazard pointer.",
+		 function );
+
+		libcthreads_memory_free_aligned(
+		 internal_hazard_pointer );
+
+		return( -1 );
+	}
+	internal_hazard_pointer->in_use = 1;
+
+	first_hazard_pointer = (libcthreads_internal_hazard_pointer_t *) libcthreads_atomic_load_pointer(
+	                                                   &( internal_hazard_pointer_domain->first_hazard_pointer ) );
+
+	do
+	{
+		internal_hazard_pointer->next = first_hazard_pointer;
+
+		first_hazard_pointer = (libcthreads_internal_hazard_pointer_t *) libcthreads_atomic_compare_exchange_pointer(
+		                                                   &( internal_hazard_pointer_domain->first_hazard_pointer ),
+		                                                   internal_hazard_pointer->next,
+		                                                   internal_hazard_pointer );
+	}
+	while( first_hazard_pointer != internal_hazard_pointer->next );
+
+	libcthreads_atomic_add_int32(
+	 &( internal_hazard_pointer_domain->number_of_hazard_pointers ),
+	 1 );
+
+	*hazard_pointer = (libcthreads_hazard_pointer_t *) internal_hazard_pointer;
+
+	return( 1 );
+}
+
+/* Releases a hazard pointer
+ * The protected value is cleared and the hazard pointer can be reused by another thread
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_hazard_pointer_release(
+     libcthreads_hazard_pointer_t **hazard_pointer,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_hazard_pointer_t *internal_hazard_pointer = NULL;
+	static char *function                                          = "libcthreads_hazard_pointer_release";
+
+	if( hazard_pointer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hazard pointer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hazard_pointer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hazard pointer.",
+		 function );
+
+		return( -1 );
+	}
+	internal_hazard_pointer = (libcthreads_internal_hazard_pointer_t *) *hazard_pointer;
+	*hazard_pointer         = NULL;
+
+	libcthreads_atomic_store_pointer(
+	 &( internal_hazard_pointer->value ),
+	 NULL );
+
+	libcthreads_atomic_store_int(
+	 &( internal_hazard_pointer->in_use ),
+	 0 );
+
+	return( 1 );
+}
+
+/* Protects the value referenced by source
+ * The value is read from source and published in the hazard pointer, after which source is read
+ * again to validate that the value was not replaced before it became protected
+ * The value remains protected until the hazard pointer is cleared, released or protects another value
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_hazard_pointer_protect(
+     libcthreads_hazard_pointer_t *hazard_pointer,
+     intptr_t **source,
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_hazard_pointer_t *internal_hazard_pointer = NULL;
+	static char *function                                          = "libcthreads_hazard_pointer_protect";
+	intptr_t *protected_value                                      = NULL;
+	intptr_t *source_value                                         = NULL;
+
+	if( hazard_pointer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hazard pointer.",
+		 function );
+
+		return( -1 );
+	}
+	internal_hazard_pointer = (libcthreads_internal_hazard_pointer_t *) hazard_pointer;
+
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	source_value = (intptr_t *) libcthreads_atomic_load_pointer(
+	                             source );
+
+	do
+	{
+		protected_value = source_value;
+
+		libcthreads_atomic_store_pointer(
+		 &( internal_hazard_pointer->value ),
+		 protected_value );
+
+		/* Make sure the hazard pointer is visible to a reclaim before source is validated
+		 */
+		libcthreads_atomic_full_fence();
+
+		source_value = (intptr_t *) libcthreads_atomic_load_pointer(
+		                             source );
+	}
+	while( source_value != protected_value );
+
+	*value = protected_value;
+
+	return( 1 );
+}
+
+/* Clears the value protected by a hazard pointer
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_hazard_pointer_clear(
+     libcthreads_hazard_pointer_t *hazard_pointer,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_hazard_pointer_t *internal_hazard_pointer = NULL;
+	static char *function                                          = "libcthreads_hazard_pointer_clear";
+
+	if( hazard_pointer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hazard pointer.",
+		 function );
+
+		return( -1 );
+	}
+	internal_hazard_pointer = (libcthreads_internal_hazard_pointer_t *) hazard_pointer;
+
+	libcthreads_atomic_store_pointer(
+	 &( internal_hazard_pointer->value ),
+	 NULL );
+
+	return( 1 );
+}
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,154 @@
+/*
+ * Hazard pointer functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_HAZARD_POINTER_H )
+#define _LIBCTHREADS_INTERNAL_HAZARD_POINTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcthreads_definitions.h"
+#include "libcthreads_extern.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct libcthreads_internal_hazard_pointer_retired_value libcthreads_internal_hazard_pointer_retired_value_t;
+
+struct libcthreads_internal_hazard_pointer_retired_value
+{
+	/* The next retired value
+	 */
+	libcthreads_internal_hazard_pointer_retired_value_t *next;
+
+	/* The value
+	 */
+	intptr_t *value;
+
+	/* The value free function
+	 */
+	int (*value_free_function)(
+	       intptr_t **value,
+	       libcerror_error_t **error );
+};
+
+typedef struct libcthreads_internal_hazard_pointer libcthreads_internal_hazard_pointer_t;
+
+struct libcthreads_internal_hazard_pointer
+{
+	/* The protected value
+	 */
+	intptr_t *value;
+
+	/* Value to indicate the hazard pointer was acquired by a thread
+	 */
+	int32_t in_use;
+
+	/* The next hazard pointer of the domain
+	 */
+	libcthreads_internal_hazard_pointer_t *next;
+};
+
+typedef struct libcthreads_internal_hazard_pointer_domain libcthreads_internal_hazard_pointer_domain_t;
+
+struct libcthreads_internal_hazard_pointer_domain
+{
+	/* The first hazard pointer, hazard pointers are only removed when the domain is freed
+	 */
+	libcthreads_internal_hazard_pointer_t *first_hazard_pointer;
+
+	/* The number of hazard pointers
+	 */
+	int32_t number_of_hazard_pointers;
+
+	/* The light mutex that protects the retired values
+	 */
+	libcthreads_light_mutex_t retired_values_mutex;
+
+	/* The first retired value
+	 */
+	libcthreads_internal_hazard_pointer_retired_value_t *first_retired_value;
+
+	/* The number of retired values
+	 */
+	int number_of_retired_values;
+};
+
+LIBCTHREADS_EXTERN \
+int libcthreads_hazard_pointer_domain_initialize(
+     libcthreads_hazard_pointer_domain_t **hazard_pointer_domain,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_hazard_pointer_domain_free(
+     libcthreads_hazard_pointer_domain_t **hazard_pointer_domain,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_hazard_pointer_domain_retire(
+     libcthreads_hazard_pointer_domain_t *hazard_pointer_domain,
+     intptr_t *value,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_hazard_pointer_domain_reclaim(
+     libcthreads_hazard_pointer_domain_t *hazard_pointer_domain,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_hazard_pointer_acquire(
+     libcthreads_hazard_pointer_domain_t *hazard_pointer_domain,
+     libcthreads_hazard_pointer_t **hazard_pointer,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_hazard_pointer_release(
+     libcthreads_hazard_pointer_t **hazard_pointer,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_hazard_pointer_protect(
+     libcthreads_hazard_pointer_t *hazard_pointer,
+     intptr_t **source,
+     intptr_t **value,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_hazard_pointer_clear(
+     libcthreads_hazard_pointer_t *hazard_pointer,
+     libcerror_error_t **error );
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCTHREADS_INTERNAL_HAZARD_POINTER_H ) */
+
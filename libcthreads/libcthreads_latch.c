@@ -0,0 +1,306 @@
+/*
+ * Latch functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcthreads_atomic.h"
+#include "libcthreads_latch.h"
+#include "libcthreads_definitions.h"
+#include "libcthreads_futex.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_types.h"
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates a latch
+ * Make sure the value latch is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_latch_initialize(
+     libcthreads_latch_t **latch,
+     int count,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_latch_t *internal_latch = NULL;
+	static char *function                        = "libcthreads_latch_initialize";
+
+	if( latch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid latch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *latch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid latch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( count <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid count value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+#if SIZEOF_INT > 4
+	if( count > (int) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid count value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* SIZEOF_INT > 4 */
+
+	internal_latch = memory_allocate_structure(
+	                  libcthreads_internal_latch_t );
+
+	if( internal_latch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create latch.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_latch,
+	     0,
+	     sizeof( libcthreads_internal_latch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear latch.",
+		 function );
+
+		memory_free(
+		 internal_latch );
+
+		return( -1 );
+	}
+	internal_latch->count = (int32_t) count;
+
+	*latch = (libcthreads_latch_t *) internal_latch;
+
+	return( 1 );
+}
+
+/* Frees a latch
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_latch_free(
+     libcthreads_latch_t **latch,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_latch_t *internal_latch = NULL;
+	static char *function                        = "libcthreads_latch_free";
+
+	if( latch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid latch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *latch != NULL )
+	{
+		internal_latch = (libcthreads_internal_latch_t *) *latch;
+		*latch         = NULL;
+
+		memory_free(
+		 internal_latch );
+	}
+	return( 1 );
+}
+
+/* Counts down a latch
+ * The thread that counts down the latch to 0 opens the latch and wakes up the waiting threads
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_latch_count_down(
+     libcthreads_latch_t *latch,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_latch_t *internal_latch = NULL;
+	static char *function                        = "libcthreads_latch_count_down";
+	int32_t count                                = 0;
+	int32_t previous_count                       = 0;
+
+	if( latch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid latch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_latch = (libcthreads_internal_latch_t *) latch;
+
+	count = libcthreads_atomic_load_sequential_int32(
+	         &( internal_latch->count ) );
+
+	do
+	{
+		if( count <= 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid latch - already open.",
+			 function );
+
+			return( -1 );
+		}
+		previous_count = count;
+
+		count = libcthreads_atomic_compare_exchange_int32(
+		         &( internal_latch->count ),
+		         previous_count,
+		         previous_count - 1 );
+	}
+	while( count != previous_count );
+
+	if( previous_count == 1 )
+	{
+		libcthreads_futex_wake_all(
+		 &( internal_latch->count ) );
+	}
+	return( 1 );
+}
+
+/* Waits until a latch is open
+ * A waiting thread spins for a short while before it waits in the kernel
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_latch_wait(
+     libcthreads_latch_t *latch,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_latch_t *internal_latch = NULL;
+	static char *function                        = "libcthreads_latch_wait";
+	int32_t count                                = 0;
+	int spin_count                               = 0;
+
+	if( latch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid latch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_latch = (libcthreads_internal_latch_t *) latch;
+
+	for( spin_count = 0;
+	     spin_count < LIBCTHREADS_RENDEZVOUS_SPIN_COUNT;
+	     spin_count++ )
+	{
+		if( libcthreads_atomic_load_sequential_int32(
+		     &( internal_latch->count ) ) == 0 )
+		{
+			return( 1 );
+		}
+		libcthreads_atomic_pause();
+	}
+	count = libcthreads_atomic_load_sequential_int32(
+	         &( internal_latch->count ) );
+
+	while( count != 0 )
+	{
+		libcthreads_futex_wait(
+		 &( internal_latch->count ),
+		 count );
+
+		count = libcthreads_atomic_load_sequential_int32(
+		         &( internal_latch->count ) );
+	}
+	return( 1 );
+}
+
+/* Determines if a latch is open, without waiting
+ * Returns 1 if the latch is open, 0 if not or -1 on error
+ */
+int libcthreads_latch_try_wait(
+     libcthreads_latch_t *latch,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_latch_t *internal_latch = NULL;
+	static char *function                        = "libcthreads_latch_try_wait";
+
+	if( latch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid latch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_latch = (libcthreads_internal_latch_t *) latch;
+
+	if( libcthreads_atomic_load_sequential_int32(
+	     &( internal_latch->count ) ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
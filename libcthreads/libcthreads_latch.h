@@ -0,0 +1,81 @@
+/*
+ * Latch functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_LATCH_H )
+#define _LIBCTHREADS_INTERNAL_LATCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcthreads_definitions.h"
+#include "libcthreads_extern.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct libcthreads_internal_latch libcthreads_internal_latch_t;
+
+struct libcthreads_internal_latch
+{
+	/* The count, which is the address the waiting threads wait on
+	 */
+	int32_t count;
+};
+
+LIBCTHREADS_EXTERN \
+int libcthreads_latch_initialize(
+     libcthreads_latch_t **latch,
+     int count,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_latch_free(
+     libcthreads_latch_t **latch,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_latch_count_down(
+     libcthreads_latch_t *latch,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_latch_wait(
+     libcthreads_latch_t *latch,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_latch_try_wait(
+     libcthreads_latch_t *latch,
+     libcerror_error_t **error );
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCTHREADS_INTERNAL_LATCH_H ) */
+
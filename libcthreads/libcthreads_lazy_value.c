@@ -0,0 +1,265 @@
+/*
+ * Lazy value functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcthreads_atomic.h"
+#include "libcthreads_lazy_value.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_once.h"
+#include "libcthreads_types.h"
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Fails to compile if the lazy value is too small to contain the internal lazy value
+ */
+typedef char libcthreads_lazy_value_size_check[ ( sizeof( libcthreads_internal_lazy_value_t ) <= sizeof( libcthreads_lazy_value_t ) ) ? 1 : -1 ];
+
+/* Initializes a lazy value
+ * The lazy value is stored by the caller, hence no memory is allocated
+ * A lazy value can also be initialized with LIBCTHREADS_LAZY_VALUE_INIT
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_lazy_value_initialize(
+     libcthreads_lazy_value_t *lazy_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libcthreads_lazy_value_initialize";
+
+	if( lazy_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lazy value.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     lazy_value,
+	     0,
+	     sizeof( libcthreads_lazy_value_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lazy value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Initializes the value of a lazy value, called by the once of the lazy value
+ * Returns 1 if successful or -1 on error
+ */
+static int libcthreads_internal_lazy_value_initialize_value(
+            void *arguments,
+            libcerror_error_t **error )
+{
+	libcthreads_lazy_value_initialize_arguments_t *initialize_arguments = NULL;
+	static char *function                                               = "libcthreads_internal_lazy_value_initialize_value";
+	intptr_t *value                                                     = NULL;
+
+	if( arguments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arguments.",
+		 function );
+
+		return( -1 );
+	}
+	initialize_arguments = (libcthreads_lazy_value_initialize_arguments_t *) arguments;
+
+	if( initialize_arguments->value_initialize_function(
+	     &value,
+	     initialize_arguments->arguments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize value.",
+		 function );
+
+		return( -1 );
+	}
+	libcthreads_atomic_store_pointer(
+	 &( initialize_arguments->internal_lazy_value->value ),
+	 value );
+
+	return( 1 );
+}
+
+/* Retrieves the value of a lazy value
+ * The first call initializes the value with the value initialize function, other threads that
+ * retrieve the value at the same time wait until the value is initialized. When the value
+ * initialize function fails the error is returned and the next call initializes the value again
+ * After the value was initialized a call only requires a single atomic load
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_lazy_value_get(
+     libcthreads_lazy_value_t *lazy_value,
+     int (*value_initialize_function)(
+            intptr_t **value,
+            void *arguments,
+            libcerror_error_t **error ),
+     void *arguments,
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	libcthreads_lazy_value_initialize_arguments_t initialize_arguments;
+
+	libcthreads_internal_lazy_value_t *internal_lazy_value = NULL;
+	static char *function                                  = "libcthreads_lazy_value_get";
+	intptr_t *safe_value                                   = NULL;
+
+	if( lazy_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lazy value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_lazy_value = (libcthreads_internal_lazy_value_t *) lazy_value;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	safe_value = (intptr_t *) libcthreads_atomic_load_pointer(
+	                           &( internal_lazy_value->value ) );
+
+	if( safe_value == NULL )
+	{
+		if( value_initialize_function == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid value initialize function.",
+			 function );
+
+			return( -1 );
+		}
+		initialize_arguments.internal_lazy_value       = internal_lazy_value;
+		initialize_arguments.value_initialize_function = value_initialize_function;
+		initialize_arguments.arguments                 = arguments;
+
+		if( libcthreads_once_call(
+		     &( internal_lazy_value->once ),
+		     &libcthreads_internal_lazy_value_initialize_value,
+		     (void *) &initialize_arguments,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize value.",
+			 function );
+
+			return( -1 );
+		}
+		safe_value = (intptr_t *) libcthreads_atomic_load_pointer(
+		                           &( internal_lazy_value->value ) );
+	}
+	*value = safe_value;
+
+	return( 1 );
+}
+
+/* Clears a lazy value
+ * The value is freed with the value free function and the next call to retrieve the value initializes it again
+ * The lazy value should not be in use by other threads when clearing it
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_lazy_value_clear(
+     libcthreads_lazy_value_t *lazy_value,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libcthreads_internal_lazy_value_t *internal_lazy_value = NULL;
+	static char *function                                  = "libcthreads_lazy_value_clear";
+	int result                                             = 1;
+
+	if( lazy_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lazy value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_lazy_value = (libcthreads_internal_lazy_value_t *) lazy_value;
+
+	if( ( internal_lazy_value->value != NULL )
+	 && ( value_free_function != NULL ) )
+	{
+		if( value_free_function(
+		     &( internal_lazy_value->value ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free value.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_lazy_value->value = NULL;
+	internal_lazy_value->once  = LIBCTHREADS_ONCE_STATE_NOT_CALLED;
+
+	return( result );
+}
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,102 @@
+/*
+ * Lazy value functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_LAZY_VALUE_H )
+#define _LIBCTHREADS_INTERNAL_LAZY_VALUE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcthreads_extern.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct libcthreads_internal_lazy_value libcthreads_internal_lazy_value_t;
+
+struct libcthreads_internal_lazy_value
+{
+	/* The value, which is set once the value was initialized
+	 */
+	intptr_t *value;
+
+	/* The once that serializes the initialization of the value
+	 */
+	libcthreads_once_t once;
+};
+
+typedef struct libcthreads_lazy_value_initialize_arguments libcthreads_lazy_value_initialize_arguments_t;
+
+struct libcthreads_lazy_value_initialize_arguments
+{
+	/* The lazy value
+	 */
+	libcthreads_internal_lazy_value_t *internal_lazy_value;
+
+	/* The value initialize function
+	 */
+	int (*value_initialize_function)(
+	       intptr_t **value,
+	       void *arguments,
+	       libcerror_error_t **error );
+
+	/* The arguments of the value initialize function
+	 */
+	void *arguments;
+};
+
+LIBCTHREADS_EXTERN \
+int libcthreads_lazy_value_initialize(
+     libcthreads_lazy_value_t *lazy_value,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_lazy_value_get(
+     libcthreads_lazy_value_t *lazy_value,
+     int (*value_initialize_function)(
+            intptr_t **value,
+            void *arguments,
+            libcerror_error_t **error ),
+     void *arguments,
+     intptr_t **value,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_lazy_value_clear(
+     libcthreads_lazy_value_t *lazy_value,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCTHREADS_INTERNAL_LAZY_VALUE_H ) */
+
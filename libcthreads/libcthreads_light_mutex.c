@@ -0,0 +1,229 @@
+/*
+ * Light mutex functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libcthreads_atomic.h"
+#include "libcthreads_clock.h"
+#include "libcthreads_futex.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_light_mutex.h"
+#include "libcthreads_types.h"
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Initializes a light mutex
+ * The light mutex is stored by the caller, hence no memory is allocated and no free is needed
+ * A light mutex can also be initialized with LIBCTHREADS_LIGHT_MUTEX_INIT
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_light_mutex_initialize(
+     libcthreads_light_mutex_t *light_mutex,
+     libcerror_error_t **error )
+{
+	static char *function = "libcthreads_light_mutex_initialize";
+
+	if( light_mutex == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid light mutex.",
+		 function );
+
+		return( -1 );
+	}
+	*light_mutex = LIBCTHREADS_LIGHT_MUTEX_STATE_RELEASED;
+
+	return( 1 );
+}
+
+/* Grabs a light mutex
+ * An uncontended grab only requires a single atomic exchange, the thread only
+ * waits in the kernel when the light mutex is grabbed by another thread
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_light_mutex_grab(
+     libcthreads_light_mutex_t *light_mutex,
+     libcerror_error_t **error )
+{
+	static char *function = "libcthreads_light_mutex_grab";
+
+	if( light_mutex == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid light mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_atomic_exchange_int32(
+	     light_mutex,
+	     LIBCTHREADS_LIGHT_MUTEX_STATE_GRABBED ) != LIBCTHREADS_LIGHT_MUTEX_STATE_RELEASED )
+	{
+		/* The light mutex is marked as contended before waiting, so that the thread
+		 * that releases it wakes up a waiting thread. The thread that grabs the light
+		 * mutex this way keeps the contended state, since other threads might still wait
+		 */
+		while( libcthreads_atomic_exchange_int32(
+		        light_mutex,
+		        LIBCTHREADS_LIGHT_MUTEX_STATE_CONTENDED ) != LIBCTHREADS_LIGHT_MUTEX_STATE_RELEASED )
+		{
+			libcthreads_futex_wait(
+			 light_mutex,
+			 LIBCTHREADS_LIGHT_MUTEX_STATE_CONTENDED );
+		}
+	}
+	return( 1 );
+}
+
+/* Grabs a light mutex, waiting at most until a deadline
+ * The deadline is in nano seconds of the monotonic clock, refer to libcthreads_clock_get_deadline
+ * Returns 1 if successful, 0 if the deadline passed or -1 on error
+ */
+int libcthreads_light_mutex_grab_with_deadline(
+     libcthreads_light_mutex_t *light_mutex,
+     uint64_t deadline,
+     libcerror_error_t **error )
+{
+	static char *function   = "libcthreads_light_mutex_grab_with_deadline";
+	uint32_t remaining_time = 0;
+
+	if( light_mutex == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid light mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_atomic_exchange_int32(
+	     light_mutex,
+	     LIBCTHREADS_LIGHT_MUTEX_STATE_GRABBED ) != LIBCTHREADS_LIGHT_MUTEX_STATE_RELEASED )
+	{
+		/* The light mutex remains marked as contended when the deadline passes,
+		 * which at most causes a superfluous wake up when it is released
+		 */
+		while( libcthreads_atomic_exchange_int32(
+		        light_mutex,
+		        LIBCTHREADS_LIGHT_MUTEX_STATE_CONTENDED ) != LIBCTHREADS_LIGHT_MUTEX_STATE_RELEASED )
+		{
+			remaining_time = libcthreads_clock_get_remaining_time(
+			                  deadline );
+
+			if( remaining_time == 0 )
+			{
+				return( 0 );
+			}
+			libcthreads_futex_timed_wait(
+			 light_mutex,
+			 LIBCTHREADS_LIGHT_MUTEX_STATE_CONTENDED,
+			 remaining_time );
+		}
+	}
+	return( 1 );
+}
+
+/* Tries to grab a light mutex
+ * Returns 1 if successful, 0 if the light mutex is grabbed by another thread or -1 on error
+ */
+int libcthreads_light_mutex_try_grab(
+     libcthreads_light_mutex_t *light_mutex,
+     libcerror_error_t **error )
+{
+	static char *function = "libcthreads_light_mutex_try_grab";
+
+	if( light_mutex == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid light mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_atomic_compare_exchange_int32(
+	     light_mutex,
+	     LIBCTHREADS_LIGHT_MUTEX_STATE_RELEASED,
+	     LIBCTHREADS_LIGHT_MUTEX_STATE_GRABBED ) != LIBCTHREADS_LIGHT_MUTEX_STATE_RELEASED )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Releases a light mutex
+ * A waiting thread is only woken up when the light mutex is contended
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_light_mutex_release(
+     libcthreads_light_mutex_t *light_mutex,
+     libcerror_error_t **error )
+{
+	static char *function = "libcthreads_light_mutex_release";
+	int32_t state         = 0;
+
+	if( light_mutex == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid light mutex.",
+		 function );
+
+		return( -1 );
+	}
+	state = libcthreads_atomic_exchange_int32(
+	         light_mutex,
+	         LIBCTHREADS_LIGHT_MUTEX_STATE_RELEASED );
+
+	if( state == LIBCTHREADS_LIGHT_MUTEX_STATE_RELEASED )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid light mutex - not grabbed.",
+		 function );
+
+		return( -1 );
+	}
+	if( state == LIBCTHREADS_LIGHT_MUTEX_STATE_CONTENDED )
+	{
+		libcthreads_futex_wake_single(
+		 light_mutex );
+	}
+	return( 1 );
+}
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,87 @@
+/*
+ * Light mutex functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_LIGHT_MUTEX_H )
+#define _LIBCTHREADS_INTERNAL_LIGHT_MUTEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcthreads_extern.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The light mutex states
+ */
+enum LIBCTHREADS_LIGHT_MUTEX_STATES
+{
+	/* The light mutex is not grabbed
+	 */
+	LIBCTHREADS_LIGHT_MUTEX_STATE_RELEASED	= 0,
+
+	/* The light mutex is grabbed and no thread waits for it
+	 */
+	LIBCTHREADS_LIGHT_MUTEX_STATE_GRABBED	= 1,
+
+	/* The light mutex is grabbed and threads might wait for it
+	 */
+	LIBCTHREADS_LIGHT_MUTEX_STATE_CONTENDED	= 2
+};
+
+LIBCTHREADS_EXTERN \
+int libcthreads_light_mutex_initialize(
+     libcthreads_light_mutex_t *light_mutex,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_light_mutex_grab(
+     libcthreads_light_mutex_t *light_mutex,
+     libcerror_error_t **error );
+
+int libcthreads_light_mutex_grab_with_deadline(
+     libcthreads_light_mutex_t *light_mutex,
+     uint64_t deadline,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_light_mutex_try_grab(
+     libcthreads_light_mutex_t *light_mutex,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_light_mutex_release(
+     libcthreads_light_mutex_t *light_mutex,
+     libcerror_error_t **error );
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCTHREADS_INTERNAL_LIGHT_MUTEX_H ) */
+
@@ -29,12 +29,31 @@
 #include <pthread.h>
 #endif
 
+#include "libcthreads_atomic.h"
+#include "libcthreads_definitions.h"
 #include "libcthreads_libcerror.h"
 #include "libcthreads_lock.h"
+#include "libcthreads_profile.h"
 #include "libcthreads_types.h"
+#include "libcthreads_unused.h"
+#include "libcthreads_validator.h"
 
 #if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
 
+/* Fails to compile if the platform mutex is larger than the lock storage is sized for
+ */
+#if defined( WINAPI )
+typedef char libcthreads_lock_platform_size_check[ ( sizeof( CRITICAL_SECTION ) <= LIBCTHREADS_STORAGE_MAXIMUM_PLATFORM_MUTEX_SIZE ) ? 1 : -1 ];
+
+#elif defined( HAVE_PTHREAD_H )
+typedef char libcthreads_lock_platform_size_check[ ( sizeof( pthread_mutex_t ) <= LIBCTHREADS_STORAGE_MAXIMUM_PLATFORM_MUTEX_SIZE ) ? 1 : -1 ];
+
+#endif
+
+/* Fails to compile if the lock storage is too small to contain the internal lock
+ */
+typedef char libcthreads_lock_storage_size_check[ ( sizeof( libcthreads_internal_lock_t ) <= sizeof( libcthreads_lock_storage_t ) ) ? 1 : -1 ];
+
 /* Creates a lock
  * Make sure the value lock is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -152,6 +171,118 @@ on_error:
 	return( -1 );
 }
 
+/* Initializes a lock in storage that is provided by the caller
+ * This allows for locks without memory allocation, for example as a global or in an array
+ * The lock must be freed with libcthreads_lock_free, which does not free the storage
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_lock_initialize_in_place(
+     libcthreads_lock_storage_t *storage,
+     libcthreads_lock_t **lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_lock_t *internal_lock = NULL;
+	static char *function                      = "libcthreads_lock_initialize_in_place";
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	int pthread_result                         = 0;
+#endif
+
+	if( storage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage.",
+		 function );
+
+		return( -1 );
+	}
+	if( lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( *lock != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid lock value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_lock = (libcthreads_internal_lock_t *) storage;
+
+	if( memory_set(
+	     internal_lock,
+	     0,
+	     sizeof( libcthreads_internal_lock_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_lock->flags = LIBCTHREADS_INTERNAL_FLAG_IN_PLACE;
+
+#if defined( WINAPI )
+	InitializeCriticalSection(
+	 &( internal_lock->critical_section ) );
+
+#elif defined( HAVE_PTHREAD_H )
+	pthread_result = pthread_mutex_init(
+	                  &( internal_lock->mutex ),
+	                  NULL );
+
+	switch( pthread_result )
+	{
+		case 0:
+			break;
+
+		case EAGAIN:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to initialize mutex with error: Insufficient resources.",
+			 function );
+
+			goto on_error;
+
+		default:
+			libcerror_system_set_error(
+			 error,
+			 pthread_result,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to initialize mutex.",
+			 function );
+
+			goto on_error;
+	}
+#endif
+	*lock = (libcthreads_lock_t *) internal_lock;
+
+	return( 1 );
+
+on_error:
+	return( -1 );
+}
+
 /* Frees a lock
  * Returns 1 if successful or -1 on error
  */
@@ -231,40 +362,30 @@ int libcthreads_lock_free(
 				break;
 		}
 #endif
-		memory_free(
-		 internal_lock );
+		if( ( internal_lock->flags & LIBCTHREADS_INTERNAL_FLAG_IN_PLACE ) == 0 )
+		{
+			memory_free(
+			 internal_lock );
+		}
 	}
 	return( result );
 }
 
-/* Grabs a lock
+/* Grabs a lock, without profiling
  * Returns 1 if successful or -1 on error
  */
-int libcthreads_lock_grab(
-     const libcthreads_lock_t *lock,
-     libcerror_error_t **error )
+static int libcthreads_internal_lock_grab(
+            libcthreads_internal_lock_t *internal_lock,
+            libcerror_error_t **error )
 {
-	libcthreads_internal_lock_t *internal_lock = NULL;
-	static char *function                      = "libcthreads_lock_grab";
-
 #if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
-	int pthread_result                         = 0;
+	static char *function = "libcthreads_internal_lock_grab";
+	int pthread_result    = 0;
 #endif
 
-	if( lock == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid lock.",
-		 function );
-
-		return( -1 );
-	}
-	internal_lock = (libcthreads_internal_lock_t *) lock;
-
 #if defined( WINAPI )
+	LIBCTHREADS_UNREFERENCED_PARAMETER( error )
+
 	EnterCriticalSection(
 	 &( internal_lock->critical_section ) );
 
@@ -312,6 +433,190 @@ int libcthreads_lock_grab(
 	return( 1 );
 }
 
+#if defined( HAVE_LOCK_PROFILING )
+
+/* Tries to grab a lock, used to determine if a grab is contended
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+static int libcthreads_internal_lock_try_grab(
+            libcthreads_internal_lock_t *internal_lock,
+            libcerror_error_t **error )
+{
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	static char *function = "libcthreads_internal_lock_try_grab";
+	int pthread_result    = 0;
+#endif
+
+#if defined( WINAPI )
+	LIBCTHREADS_UNREFERENCED_PARAMETER( error )
+
+	if( TryEnterCriticalSection(
+	     &( internal_lock->critical_section ) ) == 0 )
+	{
+		return( 0 );
+	}
+#elif defined( HAVE_PTHREAD_H )
+	pthread_result = pthread_mutex_trylock(
+	                  &( internal_lock->mutex ) );
+
+	switch( pthread_result )
+	{
+		case 0:
+			break;
+
+		case EBUSY:
+			return( 0 );
+
+		default:
+			libcerror_system_set_error(
+			 error,
+			 pthread_result,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to try lock mutex.",
+			 function );
+
+			return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LOCK_PROFILING ) */
+
+/* Grabs a lock
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_lock_grab(
+     const libcthreads_lock_t *lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_lock_t *internal_lock = NULL;
+	static char *function                      = "libcthreads_lock_grab";
+
+#if defined( HAVE_LOCK_PROFILING )
+	libcthreads_profile_t *profile             = NULL;
+	uint64_t start_timestamp                   = 0;
+	int result                                 = 0;
+#endif
+
+#if defined( HAVE_LOCK_VALIDATOR )
+	libcthreads_lock_class_t *lock_class       = NULL;
+#endif
+
+	if( lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_lock = (libcthreads_internal_lock_t *) lock;
+
+#if defined( HAVE_LOCK_VALIDATOR )
+	lock_class = (libcthreads_lock_class_t *) libcthreads_atomic_load_pointer(
+	                                           &( internal_lock->lock_class ) );
+
+	if( lock_class != NULL )
+	{
+		if( libcthreads_validator_acquire(
+		     lock_class,
+		     (intptr_t *) lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to validate acquisition of lock.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+#if defined( HAVE_LOCK_PROFILING )
+	profile = (libcthreads_profile_t *) libcthreads_atomic_load_pointer(
+	                                     &( internal_lock->profile ) );
+
+	if( profile != NULL )
+	{
+		start_timestamp = libcthreads_profile_get_timestamp();
+
+		/* Try grab first to determine if the grab is contended
+		 */
+		result = libcthreads_internal_lock_try_grab(
+		          internal_lock,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to try grab lock.",
+			 function );
+
+#if defined( HAVE_LOCK_VALIDATOR )
+			if( lock_class != NULL )
+			{
+				libcthreads_validator_release(
+				 (intptr_t *) lock,
+				 NULL );
+			}
+#endif
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			internal_lock->grab_timestamp = libcthreads_profile_add_acquisition(
+			                                 profile,
+			                                 start_timestamp,
+			                                 0 );
+
+			return( 1 );
+		}
+	}
+#endif /* defined( HAVE_LOCK_PROFILING ) */
+
+	if( libcthreads_internal_lock_grab(
+	     internal_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab lock.",
+		 function );
+
+#if defined( HAVE_LOCK_VALIDATOR )
+		if( lock_class != NULL )
+		{
+			libcthreads_validator_release(
+			 (intptr_t *) lock,
+			 NULL );
+		}
+#endif
+		return( -1 );
+	}
+#if defined( HAVE_LOCK_PROFILING )
+	if( profile != NULL )
+	{
+		internal_lock->grab_timestamp = libcthreads_profile_add_acquisition(
+		                                 profile,
+		                                 start_timestamp,
+		                                 1 );
+	}
+#endif
+	return( 1 );
+}
+
 /* Releases a lock
  * Returns 1 if successful or -1 on error
  */
@@ -326,6 +631,10 @@ int libcthreads_lock_release(
 	int pthread_result                         = 0;
 #endif
 
+#if defined( HAVE_LOCK_PROFILING )
+	libcthreads_profile_t *profile             = NULL;
+#endif
+
 	if( lock == NULL )
 	{
 		libcerror_error_set(
@@ -339,6 +648,39 @@ int libcthreads_lock_release(
 	}
 	internal_lock = (libcthreads_internal_lock_t *) lock;
 
+#if defined( HAVE_LOCK_VALIDATOR )
+	if( libcthreads_atomic_load_pointer(
+	     &( internal_lock->lock_class ) ) != NULL )
+	{
+		if( libcthreads_validator_release(
+		     (intptr_t *) lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to validate release of lock.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+#if defined( HAVE_LOCK_PROFILING )
+	profile = (libcthreads_profile_t *) libcthreads_atomic_load_pointer(
+	                                     &( internal_lock->profile ) );
+
+	if( ( profile != NULL )
+	 && ( internal_lock->grab_timestamp != 0 ) )
+	{
+		libcthreads_profile_add_hold(
+		 profile,
+		 internal_lock->grab_timestamp );
+
+		internal_lock->grab_timestamp = 0;
+	}
+#endif
 #if defined( WINAPI )
 	LeaveCriticalSection(
 	 &( internal_lock->critical_section ) );
@@ -387,5 +729,136 @@ int libcthreads_lock_release(
 	return( 1 );
 }
 
+/* Sets the name under which the lock contention of the lock is profiled
+ * Locks with the same name share their profile
+ * The name is only used when libcthreads was built with lock profiling support
+ * The lock should not be in use by other threads when setting the name
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_lock_set_profile_name(
+     libcthreads_lock_t *lock,
+     const char *name,
+     libcerror_error_t **error )
+{
+	static char *function                      = "libcthreads_lock_set_profile_name";
+
+#if defined( HAVE_LOCK_PROFILING )
+	libcthreads_internal_lock_t *internal_lock = NULL;
+	libcthreads_profile_t *profile             = NULL;
+#endif
+
+	if( lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LOCK_PROFILING )
+	internal_lock = (libcthreads_internal_lock_t *) lock;
+
+	if( libcthreads_profile_get_by_name(
+	     name,
+	     &profile,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve profile.",
+		 function );
+
+		return( -1 );
+	}
+	internal_lock->grab_timestamp = 0;
+
+	libcthreads_atomic_store_pointer(
+	 &( internal_lock->profile ),
+	 profile );
+#endif
+	return( 1 );
+}
+
+/* Sets the name of the lock class of the lock, which is used to validate the lock order
+ * Locks with the same name are of the same lock class
+ * A possible deadlock is reported the first time locks of two lock classes are grabbed in reverse order
+ * The name is only used when libcthreads was built with lock validator support
+ * The lock should not be in use by other threads when setting the name
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_lock_set_class_name(
+     libcthreads_lock_t *lock,
+     const char *name,
+     libcerror_error_t **error )
+{
+	static char *function                      = "libcthreads_lock_set_class_name";
+
+#if defined( HAVE_LOCK_VALIDATOR )
+	libcthreads_internal_lock_t *internal_lock = NULL;
+	libcthreads_lock_class_t *lock_class       = NULL;
+#endif
+
+	if( lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LOCK_VALIDATOR )
+	internal_lock = (libcthreads_internal_lock_t *) lock;
+
+	if( libcthreads_validator_get_class_by_name(
+	     name,
+	     &lock_class,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve lock class.",
+		 function );
+
+		return( -1 );
+	}
+	libcthreads_atomic_store_pointer(
+	 &( internal_lock->lock_class ),
+	 lock_class );
+#endif
+	return( 1 );
+}
+
 #endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
@@ -31,7 +31,9 @@
 
 #include "libcthreads_extern.h"
 #include "libcthreads_libcerror.h"
+#include "libcthreads_profile.h"
 #include "libcthreads_types.h"
+#include "libcthreads_validator.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -56,6 +58,24 @@ struct libcthreads_internal_lock
 #else
 #error Missing lock type
 #endif
+
+	/* The lock class, used to validate the lock order
+	 * The lock class and profile are always present, so that the size
+	 * of the structure does not depend on the configuration
+	 */
+	libcthreads_lock_class_t *lock_class;
+
+	/* The lock contention profile
+	 */
+	libcthreads_profile_t *profile;
+
+	/* The timestamp of the last grab, used to determine the hold time
+	 */
+	uint64_t grab_timestamp;
+
+	/* The flags
+	 */
+	uint8_t flags;
 };
 
 LIBCTHREADS_EXTERN \
@@ -63,6 +83,12 @@ int libcthreads_lock_initialize(
      libcthreads_lock_t **lock,
      libcerror_error_t **error );
 
+LIBCTHREADS_EXTERN \
+int libcthreads_lock_initialize_in_place(
+     libcthreads_lock_storage_t *storage,
+     libcthreads_lock_t **lock,
+     libcerror_error_t **error );
+
 LIBCTHREADS_EXTERN \
 int libcthreads_lock_free(
      libcthreads_lock_t **lock,
@@ -78,6 +104,18 @@ int libcthreads_lock_release(
      const libcthreads_lock_t *lock,
      libcerror_error_t **error );
 
+LIBCTHREADS_EXTERN \
+int libcthreads_lock_set_profile_name(
+     libcthreads_lock_t *lock,
+     const char *name,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_lock_set_class_name(
+     libcthreads_lock_t *lock,
+     const char *name,
+     libcerror_error_t **error );
+
 #endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
 #if defined( __cplusplus )
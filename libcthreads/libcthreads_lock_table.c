@@ -0,0 +1,740 @@
+/*
+ * Lock table functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcthreads_atomic.h"
+#include "libcthreads_definitions.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_light_mutex.h"
+#include "libcthreads_lock_table.h"
+#include "libcthreads_memory.h"
+#include "libcthreads_processor.h"
+#include "libcthreads_types.h"
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The maximum number of locks
+ */
+#define LIBCTHREADS_LOCK_TABLE_MAXIMUM_NUMBER_OF_LOCKS		65536
+
+/* The default number of locks per processor
+ */
+#define LIBCTHREADS_LOCK_TABLE_NUMBER_OF_LOCKS_PER_PROCESSOR	16
+
+/* Creates a lock table
+ * Make sure the value lock_table is referencing, is set to NULL
+ * The number of locks is rounded up to a power of 2
+ * A number of locks of 0 represents 16 locks per processor
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_lock_table_initialize(
+     libcthreads_lock_table_t **lock_table,
+     int number_of_locks,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_lock_table_t *internal_lock_table = NULL;
+	static char *function                                  = "libcthreads_lock_table_initialize";
+	size_t entries_size                                    = 0;
+	int safe_number_of_locks                               = 1;
+
+	if( lock_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *lock_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid lock table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_locks < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of locks value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_locks > LIBCTHREADS_LOCK_TABLE_MAXIMUM_NUMBER_OF_LOCKS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of locks value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_locks == 0 )
+	{
+		number_of_locks = libcthreads_processor_get_number_of_processors();
+
+		if( number_of_locks > ( LIBCTHREADS_LOCK_TABLE_MAXIMUM_NUMBER_OF_LOCKS / LIBCTHREADS_LOCK_TABLE_NUMBER_OF_LOCKS_PER_PROCESSOR ) )
+		{
+			number_of_locks = LIBCTHREADS_LOCK_TABLE_MAXIMUM_NUMBER_OF_LOCKS;
+		}
+		else
+		{
+			number_of_locks *= LIBCTHREADS_LOCK_TABLE_NUMBER_OF_LOCKS_PER_PROCESSOR;
+		}
+	}
+	/* A power of 2 allows to map a hash onto a lock with a mask
+	 */
+	while( safe_number_of_locks < number_of_locks )
+	{
+		safe_number_of_locks <<= 1;
+	}
+	internal_lock_table = memory_allocate_structure(
+	                       libcthreads_internal_lock_table_t );
+
+	if( internal_lock_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create lock table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_lock_table,
+	     0,
+	     sizeof( libcthreads_internal_lock_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lock table.",
+		 function );
+
+		memory_free(
+		 internal_lock_table );
+
+		return( -1 );
+	}
+	entries_size = sizeof( libcthreads_internal_lock_table_entry_t ) * safe_number_of_locks;
+
+	/* Every entry is aligned to a cache line so that threads that grab different locks
+	 * do not share a cache line
+	 */
+	internal_lock_table->entries = (libcthreads_internal_lock_table_entry_t *) libcthreads_memory_allocate_aligned(
+	                                                                            entries_size,
+	                                                                            LIBCTHREADS_CACHE_LINE_SIZE );
+
+	if( internal_lock_table->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	/* Clearing the entries sets every light mutex to LIBCTHREADS_LIGHT_MUTEX_INIT
+	 */
+	if( memory_set(
+	     internal_lock_table->entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		goto on_error;
+	}
+	internal_lock_table->number_of_locks = safe_number_of_locks;
+
+	*lock_table = (libcthreads_lock_table_t *) internal_lock_table;
+
+	return( 1 );
+
+on_error:
+	if( internal_lock_table != NULL )
+	{
+		if( internal_lock_table->entries != NULL )
+		{
+			libcthreads_memory_free_aligned(
+			 internal_lock_table->entries );
+		}
+		memory_free(
+		 internal_lock_table );
+	}
+	return( -1 );
+}
+
+/* Frees a lock table
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_lock_table_free(
+     libcthreads_lock_table_t **lock_table,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_lock_table_t *internal_lock_table = NULL;
+	static char *function                                  = "libcthreads_lock_table_free";
+	int lock_index                                         = 0;
+	int result                                             = 1;
+
+	if( lock_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *lock_table != NULL )
+	{
+		internal_lock_table = (libcthreads_internal_lock_table_t *) *lock_table;
+		*lock_table         = NULL;
+
+		for( lock_index = 0;
+		     lock_index < internal_lock_table->number_of_locks;
+		     lock_index++ )
+		{
+			if( libcthreads_atomic_load_sequential_int32(
+			     &( internal_lock_table->entries[ lock_index ].light_mutex ) ) != LIBCTHREADS_LIGHT_MUTEX_STATE_RELEASED )
+			{
+				result = 0;
+			}
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to destroy lock table with error: Resource busy.",
+			 function );
+
+			result = -1;
+		}
+		libcthreads_memory_free_aligned(
+		 internal_lock_table->entries );
+
+		memory_free(
+		 internal_lock_table );
+	}
+	return( result );
+}
+
+/* Retrieves the number of locks
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_lock_table_get_number_of_locks(
+     libcthreads_lock_table_t *lock_table,
+     int *number_of_locks,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_lock_table_t *internal_lock_table = NULL;
+	static char *function                                  = "libcthreads_lock_table_get_number_of_locks";
+
+	if( lock_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_lock_table = (libcthreads_internal_lock_table_t *) lock_table;
+
+	if( number_of_locks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of locks.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_locks = internal_lock_table->number_of_locks;
+
+	return( 1 );
+}
+
+/* Determines the index of the lock that guards a key
+ * Returns the lock index
+ */
+static int libcthreads_internal_lock_table_get_lock_index(
+            libcthreads_internal_lock_table_t *internal_lock_table,
+            uint64_t key )
+{
+	/* Fibonacci hashing spreads consecutive keys, such as block numbers, over all the locks
+	 */
+	key *= (uint64_t) 0x9e3779b97f4a7c15;
+	key ^= key >> 32;
+
+	return( (int) ( key & (uint64_t) ( internal_lock_table->number_of_locks - 1 ) ) );
+}
+
+/* Determines the smallest index of the locks that guard the keys that is larger than the previous index
+ * Returns the lock index or -1 if not available
+ */
+static int libcthreads_internal_lock_table_get_next_lock_index(
+            libcthreads_internal_lock_table_t *internal_lock_table,
+            const uint64_t *keys,
+            int number_of_keys,
+            int previous_lock_index )
+{
+	int key_index  = 0;
+	int lock_index = -1;
+	int safe_index = 0;
+
+	for( key_index = 0;
+	     key_index < number_of_keys;
+	     key_index++ )
+	{
+		safe_index = libcthreads_internal_lock_table_get_lock_index(
+		              internal_lock_table,
+		              keys[ key_index ] );
+
+		if( ( safe_index > previous_lock_index )
+		 && ( ( lock_index == -1 )
+		  ||  ( safe_index < lock_index ) ) )
+		{
+			lock_index = safe_index;
+		}
+	}
+	return( lock_index );
+}
+
+/* Determines the largest index of the locks that guard the keys that is smaller than the previous index
+ * Returns the lock index or -1 if not available
+ */
+static int libcthreads_internal_lock_table_get_previous_lock_index(
+            libcthreads_internal_lock_table_t *internal_lock_table,
+            const uint64_t *keys,
+            int number_of_keys,
+            int next_lock_index )
+{
+	int key_index  = 0;
+	int lock_index = -1;
+	int safe_index = 0;
+
+	for( key_index = 0;
+	     key_index < number_of_keys;
+	     key_index++ )
+	{
+		safe_index = libcthreads_internal_lock_table_get_lock_index(
+		              internal_lock_table,
+		              keys[ key_index ] );
+
+		if( ( safe_index < next_lock_index )
+		 && ( safe_index > lock_index ) )
+		{
+			lock_index = safe_index;
+		}
+	}
+	return( lock_index );
+}
+
+/* Releases the locks that guard the keys with an index smaller than the next index
+ * Every lock is released once, also when multiple keys map onto the same lock
+ * Returns 1 if successful or -1 on error
+ */
+static int libcthreads_internal_lock_table_release_locks(
+            libcthreads_internal_lock_table_t *internal_lock_table,
+            const uint64_t *keys,
+            int number_of_keys,
+            int next_lock_index,
+            libcerror_error_t **error )
+{
+	static char *function = "libcthreads_internal_lock_table_release_locks";
+	int lock_index        = 0;
+	int result            = 1;
+
+	/* The locks are released in the reverse order in which they were grabbed
+	 */
+	lock_index = libcthreads_internal_lock_table_get_previous_lock_index(
+	              internal_lock_table,
+	              keys,
+	              number_of_keys,
+	              next_lock_index );
+
+	while( lock_index != -1 )
+	{
+		if( libcthreads_light_mutex_release(
+		     &( internal_lock_table->entries[ lock_index ].light_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release lock: %d.",
+			 function,
+			 lock_index );
+
+			result = -1;
+		}
+		lock_index = libcthreads_internal_lock_table_get_previous_lock_index(
+		              internal_lock_table,
+		              keys,
+		              number_of_keys,
+		              lock_index );
+	}
+	return( result );
+}
+
+/* Grabs the lock that guards a key
+ * Different keys can map onto the same lock, hence a thread must not grab
+ * a second key while holding one, use libcthreads_lock_table_grab_by_keys instead
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_lock_table_grab_by_key(
+     libcthreads_lock_table_t *lock_table,
+     uint64_t key,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_lock_table_t *internal_lock_table = NULL;
+	static char *function                                  = "libcthreads_lock_table_grab_by_key";
+	int lock_index                                         = 0;
+
+	if( lock_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_lock_table = (libcthreads_internal_lock_table_t *) lock_table;
+
+	lock_index = libcthreads_internal_lock_table_get_lock_index(
+	              internal_lock_table,
+	              key );
+
+	if( libcthreads_light_mutex_grab(
+	     &( internal_lock_table->entries[ lock_index ].light_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab lock: %d.",
+		 function,
+		 lock_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tries to grab the lock that guards a key
+ * Returns 1 if successful, 0 if the lock is grabbed by another thread or -1 on error
+ */
+int libcthreads_lock_table_try_grab_by_key(
+     libcthreads_lock_table_t *lock_table,
+     uint64_t key,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_lock_table_t *internal_lock_table = NULL;
+	static char *function                                  = "libcthreads_lock_table_try_grab_by_key";
+	int lock_index                                         = 0;
+	int result                                             = 0;
+
+	if( lock_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_lock_table = (libcthreads_internal_lock_table_t *) lock_table;
+
+	lock_index = libcthreads_internal_lock_table_get_lock_index(
+	              internal_lock_table,
+	              key );
+
+	result = libcthreads_light_mutex_try_grab(
+	          &( internal_lock_table->entries[ lock_index ].light_mutex ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to try to grab lock: %d.",
+		 function,
+		 lock_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Releases the lock that guards a key
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_lock_table_release_by_key(
+     libcthreads_lock_table_t *lock_table,
+     uint64_t key,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_lock_table_t *internal_lock_table = NULL;
+	static char *function                                  = "libcthreads_lock_table_release_by_key";
+	int lock_index                                         = 0;
+
+	if( lock_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_lock_table = (libcthreads_internal_lock_table_t *) lock_table;
+
+	lock_index = libcthreads_internal_lock_table_get_lock_index(
+	              internal_lock_table,
+	              key );
+
+	if( libcthreads_light_mutex_release(
+	     &( internal_lock_table->entries[ lock_index ].light_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release lock: %d.",
+		 function,
+		 lock_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Grabs the locks that guard multiple keys
+ * The locks are grabbed in ascending lock index order, so that threads that grab
+ * overlapping sets of keys, in any order, cannot deadlock. Every lock is grabbed once,
+ * also when multiple keys map onto the same lock
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_lock_table_grab_by_keys(
+     libcthreads_lock_table_t *lock_table,
+     const uint64_t *keys,
+     int number_of_keys,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_lock_table_t *internal_lock_table = NULL;
+	static char *function                                  = "libcthreads_lock_table_grab_by_keys";
+	int lock_index                                         = 0;
+
+	if( lock_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_lock_table = (libcthreads_internal_lock_table_t *) lock_table;
+
+	if( keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_keys < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of keys value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* The lock indexes are determined by repeatedly selecting the next larger index
+	 * so that no memory needs to be allocated to sort the keys
+	 */
+	lock_index = libcthreads_internal_lock_table_get_next_lock_index(
+	              internal_lock_table,
+	              keys,
+	              number_of_keys,
+	              -1 );
+
+	while( lock_index != -1 )
+	{
+		if( libcthreads_light_mutex_grab(
+		     &( internal_lock_table->entries[ lock_index ].light_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab lock: %d.",
+			 function,
+			 lock_index );
+
+			goto on_error;
+		}
+		lock_index = libcthreads_internal_lock_table_get_next_lock_index(
+		              internal_lock_table,
+		              keys,
+		              number_of_keys,
+		              lock_index );
+	}
+	return( 1 );
+
+on_error:
+	libcthreads_internal_lock_table_release_locks(
+	 internal_lock_table,
+	 keys,
+	 number_of_keys,
+	 lock_index,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Releases the locks that guard multiple keys
+ * The keys must be the same as those passed to libcthreads_lock_table_grab_by_keys,
+ * though not necessarily in the same order
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_lock_table_release_by_keys(
+     libcthreads_lock_table_t *lock_table,
+     const uint64_t *keys,
+     int number_of_keys,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_lock_table_t *internal_lock_table = NULL;
+	static char *function                                  = "libcthreads_lock_table_release_by_keys";
+
+	if( lock_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_lock_table = (libcthreads_internal_lock_table_t *) lock_table;
+
+	if( keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_keys < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of keys value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_internal_lock_table_release_locks(
+	     internal_lock_table,
+	     keys,
+	     number_of_keys,
+	     internal_lock_table->number_of_locks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release locks.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,121 @@
+/*
+ * Lock table functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_LOCK_TABLE_H )
+#define _LIBCTHREADS_INTERNAL_LOCK_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcthreads_definitions.h"
+#include "libcthreads_extern.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct libcthreads_internal_lock_table_entry libcthreads_internal_lock_table_entry_t;
+
+struct libcthreads_internal_lock_table_entry
+{
+	/* The light mutex that guards the keys that map onto this entry
+	 */
+	libcthreads_light_mutex_t light_mutex;
+
+	/* Padding so that every entry has its own cache line
+	 */
+	uint8_t padding[ LIBCTHREADS_CACHE_LINE_SIZE - sizeof( libcthreads_light_mutex_t ) ];
+};
+
+typedef struct libcthreads_internal_lock_table libcthreads_internal_lock_table_t;
+
+struct libcthreads_internal_lock_table
+{
+	/* The entries
+	 */
+	libcthreads_internal_lock_table_entry_t *entries;
+
+	/* The number of locks, which is a power of 2
+	 */
+	int number_of_locks;
+};
+
+LIBCTHREADS_EXTERN \
+int libcthreads_lock_table_initialize(
+     libcthreads_lock_table_t **lock_table,
+     int number_of_locks,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_lock_table_free(
+     libcthreads_lock_table_t **lock_table,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_lock_table_get_number_of_locks(
+     libcthreads_lock_table_t *lock_table,
+     int *number_of_locks,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_lock_table_grab_by_key(
+     libcthreads_lock_table_t *lock_table,
+     uint64_t key,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_lock_table_try_grab_by_key(
+     libcthreads_lock_table_t *lock_table,
+     uint64_t key,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_lock_table_release_by_key(
+     libcthreads_lock_table_t *lock_table,
+     uint64_t key,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_lock_table_grab_by_keys(
+     libcthreads_lock_table_t *lock_table,
+     const uint64_t *keys,
+     int number_of_keys,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_lock_table_release_by_keys(
+     libcthreads_lock_table_t *lock_table,
+     const uint64_t *keys,
+     int number_of_keys,
+     libcerror_error_t **error );
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCTHREADS_INTERNAL_LOCK_TABLE_H ) */
+
@@ -0,0 +1,383 @@
+/*
+ * MCS lock functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcthreads_atomic.h"
+#include "libcthreads_definitions.h"
+#include "libcthreads_futex.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_mcs_lock.h"
+#include "libcthreads_memory.h"
+#include "libcthreads_types.h"
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The number of iterations a waiting thread spins on its node before it parks
+ */
+#define LIBCTHREADS_MCS_LOCK_MAXIMUM_SPIN_COUNT		1000
+
+/* Fails to compile if the MCS lock node is too small to contain the internal MCS lock node
+ */
+typedef char libcthreads_mcs_lock_node_size_check[ ( sizeof( libcthreads_internal_mcs_lock_node_t ) <= sizeof( libcthreads_mcs_lock_node_t ) ) ? 1 : -1 ];
+
+/* Creates an MCS lock
+ * Make sure the value mcs_lock is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_mcs_lock_initialize(
+     libcthreads_mcs_lock_t **mcs_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_mcs_lock_t *internal_mcs_lock = NULL;
+	static char *function                              = "libcthreads_mcs_lock_initialize";
+
+	if( mcs_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MCS lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mcs_lock != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid MCS lock value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* The MCS lock is aligned to a cache line so that the tail
+	 * does not share a cache line with other data
+	 */
+	internal_mcs_lock = (libcthreads_internal_mcs_lock_t *) libcthreads_memory_allocate_aligned(
+	                                                         sizeof( libcthreads_internal_mcs_lock_t ),
+	                                                         LIBCTHREADS_CACHE_LINE_SIZE );
+
+	if( internal_mcs_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create MCS lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_mcs_lock,
+	     0,
+	     sizeof( libcthreads_internal_mcs_lock_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear MCS lock.",
+		 function );
+
+		libcthreads_memory_free_aligned(
+		 internal_mcs_lock );
+
+		return( -1 );
+	}
+	*mcs_lock = (libcthreads_mcs_lock_t *) internal_mcs_lock;
+
+	return( 1 );
+}
+
+/* Frees an MCS lock
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_mcs_lock_free(
+     libcthreads_mcs_lock_t **mcs_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_mcs_lock_t *internal_mcs_lock = NULL;
+	static char *function                              = "libcthreads_mcs_lock_free";
+	int result                                         = 1;
+
+	if( mcs_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MCS lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mcs_lock != NULL )
+	{
+		internal_mcs_lock = (libcthreads_internal_mcs_lock_t *) *mcs_lock;
+		*mcs_lock         = NULL;
+
+		if( libcthreads_atomic_load_pointer(
+		     &( internal_mcs_lock->tail ) ) != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to destroy MCS lock with error: Resource busy.",
+			 function );
+
+			result = -1;
+		}
+		libcthreads_memory_free_aligned(
+		 internal_mcs_lock );
+	}
+	return( result );
+}
+
+/* Grabs an MCS lock
+ * The node is stored by the caller, for example on the stack of the thread, and must
+ * remain valid until the MCS lock is released with the same node. Waiting threads are
+ * queued in FIFO order and each waiting thread spins on its own node, hence a hand-off
+ * only transfers the cache line of the node of the next waiting thread
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_mcs_lock_grab(
+     libcthreads_mcs_lock_t *mcs_lock,
+     libcthreads_mcs_lock_node_t *node,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_mcs_lock_t *internal_mcs_lock           = NULL;
+	libcthreads_internal_mcs_lock_node_t *internal_node          = NULL;
+	libcthreads_internal_mcs_lock_node_t *previous_internal_node = NULL;
+	static char *function                                        = "libcthreads_mcs_lock_grab";
+	int number_of_iterations                                     = 0;
+
+	if( mcs_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MCS lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	internal_mcs_lock = (libcthreads_internal_mcs_lock_t *) mcs_lock;
+	internal_node     = (libcthreads_internal_mcs_lock_node_t *) node;
+
+	internal_node->next  = NULL;
+	internal_node->state = LIBCTHREADS_MCS_LOCK_NODE_STATE_WAITING;
+
+	previous_internal_node = libcthreads_atomic_exchange_pointer(
+	                          &( internal_mcs_lock->tail ),
+	                          internal_node );
+
+	if( previous_internal_node != NULL )
+	{
+		libcthreads_atomic_store_pointer(
+		 &( previous_internal_node->next ),
+		 internal_node );
+
+		while( number_of_iterations < LIBCTHREADS_MCS_LOCK_MAXIMUM_SPIN_COUNT )
+		{
+			if( libcthreads_atomic_load_int(
+			     &( internal_node->state ) ) == LIBCTHREADS_MCS_LOCK_NODE_STATE_GRANTED )
+			{
+				return( 1 );
+			}
+			libcthreads_atomic_pause();
+
+			number_of_iterations++;
+		}
+		/* The node is marked as parked before waiting, so that the thread
+		 * that hands off the MCS lock wakes up this thread
+		 */
+		while( libcthreads_atomic_compare_exchange_int32(
+		        &( internal_node->state ),
+		        LIBCTHREADS_MCS_LOCK_NODE_STATE_WAITING,
+		        LIBCTHREADS_MCS_LOCK_NODE_STATE_PARKED ) != LIBCTHREADS_MCS_LOCK_NODE_STATE_GRANTED )
+		{
+			libcthreads_futex_wait(
+			 &( internal_node->state ),
+			 LIBCTHREADS_MCS_LOCK_NODE_STATE_PARKED );
+		}
+	}
+	return( 1 );
+}
+
+/* Tries to grab an MCS lock
+ * The node is stored by the caller and must remain valid until the MCS lock is released
+ * Returns 1 if successful, 0 if the MCS lock is grabbed by another thread or -1 on error
+ */
+int libcthreads_mcs_lock_try_grab(
+     libcthreads_mcs_lock_t *mcs_lock,
+     libcthreads_mcs_lock_node_t *node,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_mcs_lock_t *internal_mcs_lock  = NULL;
+	libcthreads_internal_mcs_lock_node_t *internal_node = NULL;
+	static char *function                               = "libcthreads_mcs_lock_try_grab";
+
+	if( mcs_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MCS lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	internal_mcs_lock = (libcthreads_internal_mcs_lock_t *) mcs_lock;
+	internal_node     = (libcthreads_internal_mcs_lock_node_t *) node;
+
+	internal_node->next  = NULL;
+	internal_node->state = LIBCTHREADS_MCS_LOCK_NODE_STATE_GRANTED;
+
+	if( libcthreads_atomic_compare_exchange_pointer(
+	     &( internal_mcs_lock->tail ),
+	     NULL,
+	     internal_node ) != NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Releases an MCS lock
+ * The node must be the node that was used to grab the MCS lock
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_mcs_lock_release(
+     libcthreads_mcs_lock_t *mcs_lock,
+     libcthreads_mcs_lock_node_t *node,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_mcs_lock_t *internal_mcs_lock       = NULL;
+	libcthreads_internal_mcs_lock_node_t *internal_node      = NULL;
+	libcthreads_internal_mcs_lock_node_t *next_internal_node = NULL;
+	static char *function                                    = "libcthreads_mcs_lock_release";
+
+	if( mcs_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid MCS lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	internal_mcs_lock = (libcthreads_internal_mcs_lock_t *) mcs_lock;
+	internal_node     = (libcthreads_internal_mcs_lock_node_t *) node;
+
+	if( libcthreads_atomic_load_pointer(
+	     &( internal_mcs_lock->tail ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid MCS lock - not grabbed.",
+		 function );
+
+		return( -1 );
+	}
+	next_internal_node = libcthreads_atomic_load_pointer(
+	                      &( internal_node->next ) );
+
+	if( next_internal_node == NULL )
+	{
+		/* Without a next waiting thread the MCS lock is released by clearing the tail
+		 */
+		if( libcthreads_atomic_compare_exchange_pointer(
+		     &( internal_mcs_lock->tail ),
+		     internal_node,
+		     NULL ) == internal_node )
+		{
+			return( 1 );
+		}
+		/* Another thread has queued itself but not yet linked its node
+		 */
+		do
+		{
+			libcthreads_atomic_pause();
+
+			next_internal_node = libcthreads_atomic_load_pointer(
+			                      &( internal_node->next ) );
+		}
+		while( next_internal_node == NULL );
+	}
+	if( libcthreads_atomic_exchange_int32(
+	     &( next_internal_node->state ),
+	     LIBCTHREADS_MCS_LOCK_NODE_STATE_GRANTED ) == LIBCTHREADS_MCS_LOCK_NODE_STATE_PARKED )
+	{
+		libcthreads_futex_wake_single(
+		 &( next_internal_node->state ) );
+	}
+	return( 1 );
+}
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,117 @@
+/*
+ * MCS lock functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_MCS_LOCK_H )
+#define _LIBCTHREADS_INTERNAL_MCS_LOCK_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcthreads_definitions.h"
+#include "libcthreads_extern.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The MCS lock node states
+ */
+enum LIBCTHREADS_MCS_LOCK_NODE_STATES
+{
+	/* The MCS lock was handed off to the thread of the node
+	 */
+	LIBCTHREADS_MCS_LOCK_NODE_STATE_GRANTED	= 0,
+
+	/* The thread of the node spins until the MCS lock is handed off
+	 */
+	LIBCTHREADS_MCS_LOCK_NODE_STATE_WAITING	= 1,
+
+	/* The thread of the node waits in the kernel until the MCS lock is handed off
+	 */
+	LIBCTHREADS_MCS_LOCK_NODE_STATE_PARKED	= 2
+};
+
+typedef struct libcthreads_internal_mcs_lock_node libcthreads_internal_mcs_lock_node_t;
+
+struct libcthreads_internal_mcs_lock_node
+{
+	/* The node of the next waiting thread
+	 */
+	libcthreads_internal_mcs_lock_node_t *next;
+
+	/* The state
+	 */
+	int32_t state;
+};
+
+typedef struct libcthreads_internal_mcs_lock libcthreads_internal_mcs_lock_t;
+
+struct libcthreads_internal_mcs_lock
+{
+	/* The node of the last waiting thread, which is NULL if the MCS lock is not grabbed
+	 */
+	libcthreads_internal_mcs_lock_node_t *tail;
+
+	/* Padding so that the tail does not share a cache line with other data
+	 */
+	uint8_t padding[ LIBCTHREADS_CACHE_LINE_SIZE - sizeof( libcthreads_internal_mcs_lock_node_t * ) ];
+};
+
+LIBCTHREADS_EXTERN \
+int libcthreads_mcs_lock_initialize(
+     libcthreads_mcs_lock_t **mcs_lock,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_mcs_lock_free(
+     libcthreads_mcs_lock_t **mcs_lock,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_mcs_lock_grab(
+     libcthreads_mcs_lock_t *mcs_lock,
+     libcthreads_mcs_lock_node_t *node,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_mcs_lock_try_grab(
+     libcthreads_mcs_lock_t *mcs_lock,
+     libcthreads_mcs_lock_node_t *node,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_mcs_lock_release(
+     libcthreads_mcs_lock_t *mcs_lock,
+     libcthreads_mcs_lock_node_t *node,
+     libcerror_error_t **error );
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCTHREADS_INTERNAL_MCS_LOCK_H ) */
+
@@ -0,0 +1,82 @@
+/*
+ * Memory functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcthreads_memory.h"
+
+/* Allocates memory that is aligned to a specific boundary
+ * The alignment must be a power of 2
+ * The memory must be freed with libcthreads_memory_free_aligned
+ * Returns a pointer to the aligned memory or NULL on error
+ */
+void *libcthreads_memory_allocate_aligned(
+       size_t size,
+       size_t alignment )
+{
+	uint8_t *aligned_memory = NULL;
+	uint8_t *memory         = NULL;
+	size_t alignment_offset = 0;
+
+	if( ( alignment < sizeof( void * ) )
+	 || ( ( alignment & ( alignment - 1 ) ) != 0 ) )
+	{
+		return( NULL );
+	}
+	if( size > ( (size_t) SSIZE_MAX - alignment - sizeof( void * ) ) )
+	{
+		return( NULL );
+	}
+	/* Allocate additional space to store the original pointer in front of the aligned memory
+	 */
+	memory = (uint8_t *) memory_allocate(
+	                      size + alignment + sizeof( void * ) );
+
+	if( memory == NULL )
+	{
+		return( NULL );
+	}
+	aligned_memory   = &( memory[ sizeof( void * ) ] );
+	alignment_offset = (size_t) ( (intptr_t) aligned_memory ) & ( alignment - 1 );
+
+	if( alignment_offset != 0 )
+	{
+		aligned_memory += alignment - alignment_offset;
+	}
+	( (void **) aligned_memory )[ -1 ] = (void *) memory;
+
+	return( (void *) aligned_memory );
+}
+
+/* Frees memory allocated by libcthreads_memory_allocate_aligned
+ */
+void libcthreads_memory_free_aligned(
+      void *memory )
+{
+	if( memory != NULL )
+	{
+		memory_free(
+		 ( (void **) memory )[ -1 ] );
+	}
+}
+
@@ -33,12 +33,35 @@
 #include <pthread.h>
 #endif
 
+#include "libcthreads_atomic.h"
+#include "libcthreads_definitions.h"
 #include "libcthreads_libcerror.h"
 #include "libcthreads_mutex.h"
+#include "libcthreads_profile.h"
+#include "libcthreads_spin_wait.h"
 #include "libcthreads_types.h"
+#include "libcthreads_unused.h"
+#include "libcthreads_validator.h"
 
 #if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
 
+/* Fails to compile if the platform mutex is larger than the mutex storage is sized for
+ */
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+typedef char libcthreads_mutex_platform_size_check[ ( sizeof( CRITICAL_SECTION ) <= LIBCTHREADS_STORAGE_MAXIMUM_PLATFORM_MUTEX_SIZE ) ? 1 : -1 ];
+
+#elif defined( WINAPI )
+typedef char libcthreads_mutex_platform_size_check[ ( sizeof( HANDLE ) <= LIBCTHREADS_STORAGE_MAXIMUM_PLATFORM_MUTEX_SIZE ) ? 1 : -1 ];
+
+#elif defined( HAVE_PTHREAD_H )
+typedef char libcthreads_mutex_platform_size_check[ ( sizeof( pthread_mutex_t ) <= LIBCTHREADS_STORAGE_MAXIMUM_PLATFORM_MUTEX_SIZE ) ? 1 : -1 ];
+
+#endif
+
+/* Fails to compile if the mutex storage is too small to contain the internal mutex
+ */
+typedef char libcthreads_mutex_storage_size_check[ ( sizeof( libcthreads_internal_mutex_t ) <= sizeof( libcthreads_mutex_storage_t ) ) ? 1 : -1 ];
+
 /* Creates a mutex
  * Make sure the value mutex is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -180,6 +203,142 @@ on_error:
 	return( -1 );
 }
 
+/* Initializes a mutex in storage that is provided by the caller
+ * This allows for mutexes without memory allocation, for example as a global or in an array
+ * The mutex must be freed with libcthreads_mutex_free, which does not free the storage
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_mutex_initialize_in_place(
+     libcthreads_mutex_storage_t *storage,
+     libcthreads_mutex_t **mutex,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_mutex_t *internal_mutex = NULL;
+	static char *function                        = "libcthreads_mutex_initialize_in_place";
+
+#if defined( WINAPI ) && ( WINVER < 0x0600 )
+	DWORD error_code                             = 0;
+
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	int pthread_result                           = 0;
+#endif
+
+	if( storage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage.",
+		 function );
+
+		return( -1 );
+	}
+	if( mutex == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mutex != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mutex value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_mutex = (libcthreads_internal_mutex_t *) storage;
+
+	if( memory_set(
+	     internal_mutex,
+	     0,
+	     sizeof( libcthreads_internal_mutex_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear mutex.",
+		 function );
+
+		return( -1 );
+	}
+	internal_mutex->flags = LIBCTHREADS_INTERNAL_FLAG_IN_PLACE;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	InitializeCriticalSection(
+	 &( internal_mutex->critical_section ) );
+
+#elif defined( WINAPI )
+	internal_mutex->mutex_handle = CreateMutex(
+	                                NULL,
+	                                FALSE,
+	                                NULL );
+
+	if( internal_mutex->mutex_handle == NULL )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 error_code,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex handle.",
+		 function );
+
+		goto on_error;
+	}
+
+#elif defined( HAVE_PTHREAD_H )
+	pthread_result = pthread_mutex_init(
+	                  &( internal_mutex->mutex ),
+	                  NULL );
+
+	switch( pthread_result )
+	{
+		case 0:
+			break;
+
+		case EAGAIN:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to initialize mutex with error: Insufficient resources.",
+			 function );
+
+			goto on_error;
+
+		default:
+			libcerror_system_set_error(
+			 error,
+			 pthread_result,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to initialize mutex.",
+			 function );
+
+			goto on_error;
+	}
+#endif
+	*mutex = (libcthreads_mutex_t *) internal_mutex;
+
+	return( 1 );
+
+on_error:
+	return( -1 );
+}
+
 /* Frees a mutex
  * Returns 1 if successful or -1 on error
  */
@@ -279,53 +438,54 @@ int libcthreads_mutex_free(
 				break;
 		}
 #endif
-		memory_free(
-		 internal_mutex );
+		if( ( internal_mutex->flags & LIBCTHREADS_INTERNAL_FLAG_IN_PLACE ) == 0 )
+		{
+			memory_free(
+			 internal_mutex );
+		}
 	}
 	return( result );
 }
 
-/* Grabs a mutex
- * Returns 1 if successful or -1 on error
+/* Tries to grab a mutex, without validation
+ * Returns 1 if successful, 0 if not or -1 on error
  */
-int libcthreads_mutex_grab(
-     libcthreads_mutex_t *mutex,
-     libcerror_error_t **error )
+static int libcthreads_internal_mutex_try_grab(
+            libcthreads_internal_mutex_t *internal_mutex,
+            libcerror_error_t **error )
 {
-	libcthreads_internal_mutex_t *internal_mutex = NULL;
-	static char *function                        = "libcthreads_mutex_grab";
-
 #if defined( WINAPI ) && ( WINVER < 0x0600 )
-	DWORD error_code                             = 0;
-	DWORD wait_status                            = 0;
+	static char *function = "libcthreads_internal_mutex_try_grab";
+	DWORD error_code      = 0;
+	DWORD wait_status     = 0;
 
 #elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
-	int pthread_result                           = 0;
+	static char *function = "libcthreads_internal_mutex_try_grab";
+	int pthread_result    = 0;
 #endif
+	int result            = 1;
 
-	if( mutex == NULL )
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	if( TryEnterCriticalSection(
+	     &( internal_mutex->critical_section ) ) != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid mutex.",
-		 function );
-
-		return( -1 );
+		result = 1;
+	}
+	else
+	{
+		result = 0;
 	}
-	internal_mutex = (libcthreads_internal_mutex_t *) mutex;
-
-#if defined( WINAPI ) && ( WINVER >= 0x0600 )
-	EnterCriticalSection(
-	 &( internal_mutex->critical_section ) );
 
 #elif defined( WINAPI )
 	wait_status = WaitForSingleObject(
 	               internal_mutex->mutex_handle,
-	               INFINITE );
+	               0 );
 
-	if( wait_status == WAIT_FAILED )
+	if( wait_status == WAIT_TIMEOUT )
+	{
+		result = 0;
+	}
+	else if( wait_status == WAIT_FAILED )
 	{
 		error_code = GetLastError();
 
@@ -341,7 +501,7 @@ int libcthreads_mutex_grab(
 	}
 
 #elif defined( HAVE_PTHREAD_H )
-	pthread_result = pthread_mutex_lock(
+	pthread_result = pthread_mutex_trylock(
 	                  &( internal_mutex->mutex ) );
 
 	switch( pthread_result )
@@ -349,12 +509,16 @@ int libcthreads_mutex_grab(
 		case 0:
 			break;
 
+		case EBUSY:
+			result = 0;
+			break;
+
 		case EAGAIN:
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to lock mutex with error: Maximum number of locks exceeded.",
+			 "%s: unable to try lock mutex with error: Maximum number of locks exceeded.",
 			 function );
 
 			return( -1 );
@@ -364,7 +528,7 @@ int libcthreads_mutex_grab(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to lock mutex with error: Deadlock condition detected.",
+			 "%s: unable to try lock mutex with error: Deadlock condition detected.",
 			 function );
 
 			return( -1 );
@@ -375,68 +539,85 @@ int libcthreads_mutex_grab(
 			 pthread_result,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to lock mutex.",
+			 "%s: unable to try lock mutex.",
 			 function );
 
 			return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Tries to grabs a mutex
- * Returns 1 if successful, 0 if not or -1 on error
+/* Grabs a mutex, without profiling
+ * Returns 1 if successful or -1 on error
  */
-int libcthreads_mutex_try_grab(
-     libcthreads_mutex_t *mutex,
-     libcerror_error_t **error )
+static int libcthreads_internal_mutex_grab(
+            libcthreads_internal_mutex_t *internal_mutex,
+            libcerror_error_t **error )
 {
-	libcthreads_internal_mutex_t *internal_mutex = NULL;
-	static char *function                        = "libcthreads_mutex_try_grab";
-	int result                                   = 1;
+	static char *function    = "libcthreads_internal_mutex_grab";
+	int number_of_iterations = 0;
+	int result               = 0;
+	int spin_limit           = 0;
 
 #if defined( WINAPI ) && ( WINVER < 0x0600 )
-	DWORD error_code                             = 0;
-	DWORD wait_status                            = 0;
+	DWORD error_code         = 0;
+	DWORD wait_status        = 0;
 
 #elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
-	int pthread_result                           = 0;
+	int pthread_result       = 0;
 #endif
 
-	if( mutex == NULL )
+	spin_limit = libcthreads_spin_wait_get_limit(
+	              &( internal_mutex->spin_wait ) );
+
+	if( spin_limit > 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid mutex.",
-		 function );
+		/* Spin on a try grab so that a short critical section of another thread
+		 * can end without the cost of parking and waking up the thread
+		 */
+		while( number_of_iterations < spin_limit )
+		{
+			result = libcthreads_internal_mutex_try_grab(
+			          internal_mutex,
+			          error );
 
-		return( -1 );
-	}
-	internal_mutex = (libcthreads_internal_mutex_t *) mutex;
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to try grab mutex.",
+				 function );
 
-#if defined( WINAPI ) && ( WINVER >= 0x0600 )
-	if( TryEnterCriticalSection(
-	     &( internal_mutex->critical_section ) ) != 0 )
-	{
-		result = 1;
-	}
-	else
-	{
-		result = 0;
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				libcthreads_spin_wait_update(
+				 &( internal_mutex->spin_wait ),
+				 number_of_iterations );
+
+				internal_mutex->number_of_spin_hits++;
+
+				return( 1 );
+			}
+			libcthreads_atomic_pause();
+
+			number_of_iterations++;
+		}
 	}
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	EnterCriticalSection(
+	 &( internal_mutex->critical_section ) );
 
 #elif defined( WINAPI )
 	wait_status = WaitForSingleObject(
 	               internal_mutex->mutex_handle,
-	               0 );
+	               INFINITE );
 
-	if( wait_status == WAIT_TIMEOUT )
-	{
-		result = 0;
-	}
-	else if( wait_status == WAIT_FAILED )
+	if( wait_status == WAIT_FAILED )
 	{
 		error_code = GetLastError();
 
@@ -452,7 +633,7 @@ int libcthreads_mutex_try_grab(
 	}
 
 #elif defined( HAVE_PTHREAD_H )
-	pthread_result = pthread_mutex_trylock(
+	pthread_result = pthread_mutex_lock(
 	                  &( internal_mutex->mutex ) );
 
 	switch( pthread_result )
@@ -460,16 +641,12 @@ int libcthreads_mutex_try_grab(
 		case 0:
 			break;
 
-		case EBUSY:
-			result = 0;
-			break;
-
 		case EAGAIN:
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to try lock mutex with error: Maximum number of locks exceeded.",
+			 "%s: unable to lock mutex with error: Maximum number of locks exceeded.",
 			 function );
 
 			return( -1 );
@@ -479,7 +656,7 @@ int libcthreads_mutex_try_grab(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to try lock mutex with error: Deadlock condition detected.",
+			 "%s: unable to lock mutex with error: Deadlock condition detected.",
 			 function );
 
 			return( -1 );
@@ -490,10 +667,228 @@ int libcthreads_mutex_try_grab(
 			 pthread_result,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to try lock mutex.",
+			 "%s: unable to lock mutex.",
+			 function );
+
+			return( -1 );
+	}
+#endif
+	if( spin_limit > 0 )
+	{
+		libcthreads_spin_wait_update(
+		 &( internal_mutex->spin_wait ),
+		 number_of_iterations );
+
+		internal_mutex->number_of_parks++;
+	}
+	return( 1 );
+}
+
+/* Grabs a mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_mutex_grab(
+     libcthreads_mutex_t *mutex,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_mutex_t *internal_mutex = NULL;
+	static char *function                        = "libcthreads_mutex_grab";
+
+#if defined( HAVE_LOCK_PROFILING )
+	libcthreads_profile_t *profile               = NULL;
+	uint64_t start_timestamp                     = 0;
+	int result                                   = 0;
+#endif
+
+#if defined( HAVE_LOCK_VALIDATOR )
+	libcthreads_lock_class_t *lock_class         = NULL;
+#endif
+
+	if( mutex == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mutex.",
+		 function );
+
+		return( -1 );
+	}
+	internal_mutex = (libcthreads_internal_mutex_t *) mutex;
+
+#if defined( HAVE_LOCK_VALIDATOR )
+	lock_class = (libcthreads_lock_class_t *) libcthreads_atomic_load_pointer(
+	                                           &( internal_mutex->lock_class ) );
+
+	if( lock_class != NULL )
+	{
+		if( libcthreads_validator_acquire(
+		     lock_class,
+		     (intptr_t *) mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to validate acquisition of mutex.",
 			 function );
 
 			return( -1 );
+		}
+	}
+#endif
+#if defined( HAVE_LOCK_PROFILING )
+	profile = (libcthreads_profile_t *) libcthreads_atomic_load_pointer(
+	                                     &( internal_mutex->profile ) );
+
+	if( profile != NULL )
+	{
+		start_timestamp = libcthreads_profile_get_timestamp();
+
+		/* Try grab first to determine if the grab is contended
+		 */
+		result = libcthreads_internal_mutex_try_grab(
+		          internal_mutex,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to try grab mutex.",
+			 function );
+
+#if defined( HAVE_LOCK_VALIDATOR )
+			if( lock_class != NULL )
+			{
+				libcthreads_validator_release(
+				 (intptr_t *) mutex,
+				 NULL );
+			}
+#endif
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			internal_mutex->grab_timestamp = libcthreads_profile_add_acquisition(
+			                                  profile,
+			                                  start_timestamp,
+			                                  0 );
+
+			return( 1 );
+		}
+	}
+#endif /* defined( HAVE_LOCK_PROFILING ) */
+
+	if( libcthreads_internal_mutex_grab(
+	     internal_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+#if defined( HAVE_LOCK_VALIDATOR )
+		if( lock_class != NULL )
+		{
+			libcthreads_validator_release(
+			 (intptr_t *) mutex,
+			 NULL );
+		}
+#endif
+		return( -1 );
+	}
+#if defined( HAVE_LOCK_PROFILING )
+	if( profile != NULL )
+	{
+		internal_mutex->grab_timestamp = libcthreads_profile_add_acquisition(
+		                                  profile,
+		                                  start_timestamp,
+		                                  1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Tries to grabs a mutex
+ * A successful try grab is recorded by the lock order validator without validating the order,
+ * since a try grab cannot deadlock
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libcthreads_mutex_try_grab(
+     libcthreads_mutex_t *mutex,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_mutex_t *internal_mutex = NULL;
+	static char *function                        = "libcthreads_mutex_try_grab";
+	int result                                   = 0;
+
+#if defined( HAVE_LOCK_VALIDATOR )
+	libcthreads_lock_class_t *lock_class         = NULL;
+#endif
+
+	if( mutex == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mutex.",
+		 function );
+
+		return( -1 );
+	}
+	internal_mutex = (libcthreads_internal_mutex_t *) mutex;
+
+	result = libcthreads_internal_mutex_try_grab(
+	          internal_mutex,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to try grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LOCK_VALIDATOR )
+	if( result != 0 )
+	{
+		lock_class = (libcthreads_lock_class_t *) libcthreads_atomic_load_pointer(
+		                                           &( internal_mutex->lock_class ) );
+
+		if( lock_class != NULL )
+		{
+			if( libcthreads_validator_try_acquire(
+			     lock_class,
+			     (intptr_t *) mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to record acquisition of mutex.",
+				 function );
+
+				libcthreads_mutex_release(
+				 mutex,
+				 NULL );
+
+				return( -1 );
+			}
+		}
 	}
 #endif
 	return( result );
@@ -517,6 +912,10 @@ int libcthreads_mutex_release(
 	int pthread_result                           = 0;
 #endif
 
+#if defined( HAVE_LOCK_PROFILING )
+	libcthreads_profile_t *profile               = NULL;
+#endif
+
 	if( mutex == NULL )
 	{
 		libcerror_error_set(
@@ -530,6 +929,41 @@ int libcthreads_mutex_release(
 	}
 	internal_mutex = (libcthreads_internal_mutex_t *) mutex;
 
+#if defined( HAVE_LOCK_VALIDATOR )
+	if( libcthreads_atomic_load_pointer(
+	     &( internal_mutex->lock_class ) ) != NULL )
+	{
+		if( libcthreads_validator_release(
+		     (intptr_t *) mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to validate release of mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+#if defined( HAVE_LOCK_PROFILING )
+	profile = (libcthreads_profile_t *) libcthreads_atomic_load_pointer(
+	                                     &( internal_mutex->profile ) );
+
+	/* The hold time is only known when the mutex was grabbed with libcthreads_mutex_grab
+	 */
+	if( ( profile != NULL )
+	 && ( internal_mutex->grab_timestamp != 0 ) )
+	{
+		libcthreads_profile_add_hold(
+		 profile,
+		 internal_mutex->grab_timestamp );
+
+		internal_mutex->grab_timestamp = 0;
+	}
+#endif
 #if defined( WINAPI ) && ( WINVER >= 0x0600 )
 	LeaveCriticalSection(
 	 &( internal_mutex->critical_section ) );
@@ -597,5 +1031,313 @@ int libcthreads_mutex_release(
 	return( 1 );
 }
 
+/* Sets the maximum spin count of the mutex
+ * A thread that finds the mutex grabbed spins for an adaptive number of iterations,
+ * bounded by the maximum spin count, before it parks
+ * The adaptive number of iterations follows the recent time it took to grab the mutex,
+ * which benefits mutexes that protect short critical sections
+ * A maximum spin count of 0 disables spinning, which is the default
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_mutex_set_maximum_spin_count(
+     libcthreads_mutex_t *mutex,
+     int maximum_spin_count,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_mutex_t *internal_mutex = NULL;
+	static char *function                        = "libcthreads_mutex_set_maximum_spin_count";
+
+	if( mutex == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mutex.",
+		 function );
+
+		return( -1 );
+	}
+	internal_mutex = (libcthreads_internal_mutex_t *) mutex;
+
+	if( maximum_spin_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum spin count value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	libcthreads_atomic_store_int(
+	 &( internal_mutex->spin_wait.maximum_spin_count ),
+	 maximum_spin_count );
+
+	if( internal_mutex->spin_wait.spin_count > maximum_spin_count )
+	{
+		libcthreads_atomic_store_int(
+		 &( internal_mutex->spin_wait.spin_count ),
+		 maximum_spin_count );
+	}
+	if( libcthreads_mutex_release(
+	     mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the spin statistics of the mutex
+ * The number of spin hits is the number of grabs that were satisfied while spinning
+ * The number of parks is the number of grabs that parked after spinning
+ * The spin count is the current adaptive number of spin iterations
+ * The mutex is grabbed to retrieve the statistics, hence this function cannot be called while holding it
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_mutex_get_spin_statistics(
+     libcthreads_mutex_t *mutex,
+     uint64_t *number_of_spin_hits,
+     uint64_t *number_of_parks,
+     int *spin_count,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_mutex_t *internal_mutex = NULL;
+	static char *function                        = "libcthreads_mutex_get_spin_statistics";
+
+	if( mutex == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mutex.",
+		 function );
+
+		return( -1 );
+	}
+	internal_mutex = (libcthreads_internal_mutex_t *) mutex;
+
+	if( number_of_spin_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of spin hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_parks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of parks.",
+		 function );
+
+		return( -1 );
+	}
+	if( spin_count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid spin count.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_spin_hits = internal_mutex->number_of_spin_hits;
+	*number_of_parks     = internal_mutex->number_of_parks;
+	*spin_count          = internal_mutex->spin_wait.spin_count;
+
+	if( libcthreads_mutex_release(
+	     mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the name under which the lock contention of the mutex is profiled
+ * Mutexes with the same name share their profile, for example a name of the call site
+ * that creates the mutex attributes the contention of all mutexes it creates
+ * The hold time includes the time spent waiting on a condition with the mutex
+ * The name is only used when libcthreads was built with lock profiling support
+ * The mutex should not be in use by other threads when setting the name
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_mutex_set_profile_name(
+     libcthreads_mutex_t *mutex,
+     const char *name,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libcthreads_mutex_set_profile_name";
+
+#if defined( HAVE_LOCK_PROFILING )
+	libcthreads_internal_mutex_t *internal_mutex = NULL;
+	libcthreads_profile_t *profile               = NULL;
+#endif
+
+	if( mutex == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LOCK_PROFILING )
+	internal_mutex = (libcthreads_internal_mutex_t *) mutex;
+
+	if( libcthreads_profile_get_by_name(
+	     name,
+	     &profile,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve profile.",
+		 function );
+
+		return( -1 );
+	}
+	internal_mutex->grab_timestamp = 0;
+
+	libcthreads_atomic_store_pointer(
+	 &( internal_mutex->profile ),
+	 profile );
+#endif
+	return( 1 );
+}
+
+/* Sets the name of the lock class of the mutex, which is used to validate the lock order
+ * Mutexes with the same name are of the same lock class
+ * A possible deadlock is reported the first time mutexes of two lock classes are grabbed in reverse order
+ * The name is only used when libcthreads was built with lock validator support
+ * The mutex should not be in use by other threads when setting the name
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_mutex_set_class_name(
+     libcthreads_mutex_t *mutex,
+     const char *name,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libcthreads_mutex_set_class_name";
+
+#if defined( HAVE_LOCK_VALIDATOR )
+	libcthreads_internal_mutex_t *internal_mutex = NULL;
+	libcthreads_lock_class_t *lock_class         = NULL;
+#endif
+
+	if( mutex == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LOCK_VALIDATOR )
+	internal_mutex = (libcthreads_internal_mutex_t *) mutex;
+
+	if( libcthreads_validator_get_class_by_name(
+	     name,
+	     &lock_class,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve lock class.",
+		 function );
+
+		return( -1 );
+	}
+	libcthreads_atomic_store_pointer(
+	 &( internal_mutex->lock_class ),
+	 lock_class );
+#endif
+	return( 1 );
+}
+
 #endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
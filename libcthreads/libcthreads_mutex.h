@@ -31,7 +31,10 @@
 
 #include "libcthreads_extern.h"
 #include "libcthreads_libcerror.h"
+#include "libcthreads_profile.h"
+#include "libcthreads_spin_wait.h"
 #include "libcthreads_types.h"
+#include "libcthreads_validator.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -61,6 +64,36 @@ struct libcthreads_internal_mutex
 #else
 #error Missing mutex type
 #endif
+
+	/* The adaptive spin wait state
+	 */
+	libcthreads_spin_wait_t spin_wait;
+
+	/* The number of grabs that were satisfied while spinning
+	 */
+	uint64_t number_of_spin_hits;
+
+	/* The number of grabs that blocked after spinning
+	 */
+	uint64_t number_of_parks;
+
+	/* The lock class, used to validate the lock order
+	 * The lock class and profile are always present, so that the size
+	 * of the structure does not depend on the configuration
+	 */
+	libcthreads_lock_class_t *lock_class;
+
+	/* The lock contention profile
+	 */
+	libcthreads_profile_t *profile;
+
+	/* The timestamp of the last grab, used to determine the hold time
+	 */
+	uint64_t grab_timestamp;
+
+	/* The flags
+	 */
+	uint8_t flags;
 };
 
 LIBCTHREADS_EXTERN \
@@ -68,6 +101,12 @@ int libcthreads_mutex_initialize(
      libcthreads_mutex_t **mutex,
      libcerror_error_t **error );
 
+LIBCTHREADS_EXTERN \
+int libcthreads_mutex_initialize_in_place(
+     libcthreads_mutex_storage_t *storage,
+     libcthreads_mutex_t **mutex,
+     libcerror_error_t **error );
+
 LIBCTHREADS_EXTERN \
 int libcthreads_mutex_free(
      libcthreads_mutex_t **mutex,
@@ -88,6 +127,32 @@ int libcthreads_mutex_release(
      libcthreads_mutex_t *mutex,
      libcerror_error_t **error );
 
+LIBCTHREADS_EXTERN \
+int libcthreads_mutex_set_maximum_spin_count(
+     libcthreads_mutex_t *mutex,
+     int maximum_spin_count,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_mutex_get_spin_statistics(
+     libcthreads_mutex_t *mutex,
+     uint64_t *number_of_spin_hits,
+     uint64_t *number_of_parks,
+     int *spin_count,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_mutex_set_profile_name(
+     libcthreads_mutex_t *mutex,
+     const char *name,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_mutex_set_class_name(
+     libcthreads_mutex_t *mutex,
+     const char *name,
+     libcerror_error_t **error );
+
 #endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
 #if defined( __cplusplus )
@@ -0,0 +1,164 @@
+/*
+ * Once functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libcthreads_atomic.h"
+#include "libcthreads_futex.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_once.h"
+#include "libcthreads_types.h"
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Initializes a once
+ * The once is stored by the caller, hence no memory is allocated and no free is needed
+ * A once can also be initialized with LIBCTHREADS_ONCE_INIT
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_once_initialize(
+     libcthreads_once_t *once,
+     libcerror_error_t **error )
+{
+	static char *function = "libcthreads_once_initialize";
+
+	if( once == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid once.",
+		 function );
+
+		return( -1 );
+	}
+	*once = LIBCTHREADS_ONCE_STATE_NOT_CALLED;
+
+	return( 1 );
+}
+
+/* Calls a callback function once
+ * The first thread calls the callback function, other threads that call the once at the same time wait
+ * until the callback function has returned. When the callback function fails the error is returned to the calling
+ * thread and the next call of the once calls the callback function again
+ * After the callback function was called successfully a call only requires a single atomic load
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_once_call(
+     libcthreads_once_t *once,
+     int (*callback_function)(
+            void *arguments,
+            libcerror_error_t **error ),
+     void *arguments,
+     libcerror_error_t **error )
+{
+	static char *function = "libcthreads_once_call";
+	int32_t state         = 0;
+	int result            = 0;
+
+	if( once == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid once.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_atomic_load_sequential_int32(
+	     once ) == LIBCTHREADS_ONCE_STATE_CALLED )
+	{
+		return( 1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		state = libcthreads_atomic_compare_exchange_int32(
+		         once,
+		         LIBCTHREADS_ONCE_STATE_NOT_CALLED,
+		         LIBCTHREADS_ONCE_STATE_CALLING );
+
+		if( state == LIBCTHREADS_ONCE_STATE_NOT_CALLED )
+		{
+			result = callback_function(
+			          arguments,
+			          error );
+
+			state = libcthreads_atomic_exchange_int32(
+			         once,
+			         ( result == 1 ) ? LIBCTHREADS_ONCE_STATE_CALLED : LIBCTHREADS_ONCE_STATE_NOT_CALLED );
+
+			if( state == LIBCTHREADS_ONCE_STATE_CONTENDED )
+			{
+				libcthreads_futex_wake_all(
+				 once );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to call callback function.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+		}
+		else if( state != LIBCTHREADS_ONCE_STATE_CALLED )
+		{
+			/* The once is marked as contended before waiting, so that the thread
+			 * that calls the function wakes up the waiting threads
+			 */
+			if( state == LIBCTHREADS_ONCE_STATE_CALLING )
+			{
+				libcthreads_atomic_compare_exchange_int32(
+				 once,
+				 LIBCTHREADS_ONCE_STATE_CALLING,
+				 LIBCTHREADS_ONCE_STATE_CONTENDED );
+			}
+			libcthreads_futex_wait(
+			 once,
+			 LIBCTHREADS_ONCE_STATE_CONTENDED );
+		}
+	}
+	while( state != LIBCTHREADS_ONCE_STATE_CALLED );
+
+	return( 1 );
+}
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
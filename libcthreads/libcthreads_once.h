@@ -0,0 +1,80 @@
+/*
+ * Once functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_ONCE_H )
+#define _LIBCTHREADS_INTERNAL_ONCE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcthreads_extern.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The once states
+ */
+enum LIBCTHREADS_ONCE_STATES
+{
+	/* The function has not been called or the call failed
+	 */
+	LIBCTHREADS_ONCE_STATE_NOT_CALLED	= 0,
+
+	/* The function is being called and no thread waits for it
+	 */
+	LIBCTHREADS_ONCE_STATE_CALLING		= 1,
+
+	/* The function is being called and threads might wait for it
+	 */
+	LIBCTHREADS_ONCE_STATE_CONTENDED	= 2,
+
+	/* The function was called successfully
+	 */
+	LIBCTHREADS_ONCE_STATE_CALLED		= 3
+};
+
+LIBCTHREADS_EXTERN \
+int libcthreads_once_initialize(
+     libcthreads_once_t *once,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_once_call(
+     libcthreads_once_t *once,
+     int (*callback_function)(
+            void *arguments,
+            libcerror_error_t **error ),
+     void *arguments,
+     libcerror_error_t **error );
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCTHREADS_INTERNAL_ONCE_H ) */
+
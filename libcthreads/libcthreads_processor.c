@@ -0,0 +1,89 @@
+/*
+ * Processor functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_SCHED_GETCPU ) && !defined( WINAPI )
+#define __USE_GNU
+#include <sched.h>
+#undef __USE_GNU
+#endif
+
+#if defined( HAVE_SYSCONF ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+#include <unistd.h>
+#endif
+
+#include "libcthreads_processor.h"
+
+/* Retrieves the number of processors that are online
+ * Returns the number of processors, which is 1 if the number cannot be determined
+ */
+int libcthreads_processor_get_number_of_processors(
+     void )
+{
+	int number_of_processors = 1;
+
+#if defined( WINAPI )
+	SYSTEM_INFO system_info;
+
+	GetSystemInfo(
+	 &system_info );
+
+	number_of_processors = (int) system_info.dwNumberOfProcessors;
+
+#elif defined( HAVE_SYSCONF ) && defined( _SC_NPROCESSORS_ONLN )
+	number_of_processors = (int) sysconf(
+	                              _SC_NPROCESSORS_ONLN );
+#endif
+	if( number_of_processors < 1 )
+	{
+		number_of_processors = 1;
+	}
+	return( number_of_processors );
+}
+
+/* Retrieves the index of the processor the calling thread runs on
+ * The thread can be moved to another processor at any time, hence the index is only a hint
+ * that spreads threads over per-processor data. If the processor cannot be determined an
+ * index is derived from the stack of the calling thread, which differs per thread
+ * Returns the processor index
+ */
+int libcthreads_processor_get_current_index(
+     void )
+{
+	int processor_index = -1;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	processor_index = (int) GetCurrentProcessorNumber();
+
+#elif defined( HAVE_SCHED_GETCPU ) && !defined( WINAPI )
+	processor_index = sched_getcpu();
+#endif
+	if( processor_index < 0 )
+	{
+		/* Thread stacks are at least page aligned and do not overlap
+		 */
+		processor_index = (int) ( ( (intptr_t) &processor_index >> 16 ) & 0x7fff );
+	}
+	return( processor_index );
+}
+
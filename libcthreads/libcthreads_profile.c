@@ -0,0 +1,726 @@
+/*
+ * Lock contention profile functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#include "libcthreads_atomic.h"
+#include "libcthreads_clock.h"
+#include "libcthreads_definitions.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_light_mutex.h"
+#include "libcthreads_profile.h"
+#include "libcthreads_striped_counter.h"
+#include "libcthreads_types.h"
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The profiles, in the order they were created
+ */
+static libcthreads_profile_t *libcthreads_profiles = NULL;
+
+/* The light mutex that protects the profiles
+ */
+static libcthreads_light_mutex_t libcthreads_profiles_mutex = LIBCTHREADS_LIGHT_MUTEX_INIT;
+
+/* Updates a maximum value that is modified by other threads
+ */
+static void libcthreads_internal_profile_update_maximum(
+             uint64_t *maximum_value,
+             uint64_t value )
+{
+	uint64_t current_value  = 0;
+	uint64_t previous_value = 0;
+
+	current_value = (uint64_t) libcthreads_atomic_load_int64(
+	                            maximum_value );
+
+	while( value > current_value )
+	{
+		previous_value = (uint64_t) libcthreads_atomic_compare_exchange_int64(
+		                             maximum_value,
+		                             current_value,
+		                             value );
+
+		if( previous_value == current_value )
+		{
+			break;
+		}
+		current_value = previous_value;
+	}
+}
+
+/* Retrieves a monotonic timestamp
+ * Returns the timestamp in nano seconds
+ */
+uint64_t libcthreads_profile_get_timestamp(
+          void )
+{
+	return( libcthreads_clock_get_monotonic_time() );
+}
+
+/* Frees a profile
+ */
+static void libcthreads_internal_profile_free(
+             libcthreads_profile_t **profile )
+{
+	if( *profile != NULL )
+	{
+		if( ( *profile )->number_of_acquisitions != NULL )
+		{
+			libcthreads_striped_counter_free(
+			 &( ( *profile )->number_of_acquisitions ),
+			 NULL );
+		}
+		if( ( *profile )->number_of_contended_acquisitions != NULL )
+		{
+			libcthreads_striped_counter_free(
+			 &( ( *profile )->number_of_contended_acquisitions ),
+			 NULL );
+		}
+		if( ( *profile )->total_wait_time != NULL )
+		{
+			libcthreads_striped_counter_free(
+			 &( ( *profile )->total_wait_time ),
+			 NULL );
+		}
+		if( ( *profile )->number_of_holds != NULL )
+		{
+			libcthreads_striped_counter_free(
+			 &( ( *profile )->number_of_holds ),
+			 NULL );
+		}
+		if( ( *profile )->total_hold_time != NULL )
+		{
+			libcthreads_striped_counter_free(
+			 &( ( *profile )->total_hold_time ),
+			 NULL );
+		}
+		if( ( *profile )->name != NULL )
+		{
+			memory_free(
+			 ( *profile )->name );
+		}
+		memory_free(
+		 *profile );
+
+		*profile = NULL;
+	}
+}
+
+/* Creates a profile
+ * Returns 1 if successful or -1 on error
+ */
+static int libcthreads_internal_profile_initialize(
+            libcthreads_profile_t **profile,
+            const char *name,
+            size_t name_size,
+            libcerror_error_t **error )
+{
+	libcthreads_profile_t *safe_profile = NULL;
+	static char *function               = "libcthreads_internal_profile_initialize";
+
+	safe_profile = memory_allocate_structure(
+	                libcthreads_profile_t );
+
+	if( safe_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create profile.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     safe_profile,
+	     0,
+	     sizeof( libcthreads_profile_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear profile.",
+		 function );
+
+		memory_free(
+		 safe_profile );
+
+		return( -1 );
+	}
+	safe_profile->name = narrow_string_allocate(
+	                      name_size );
+
+	if( safe_profile->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     safe_profile->name,
+	     name,
+	     name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		goto on_error;
+	}
+	safe_profile->name_size = name_size;
+
+	if( libcthreads_striped_counter_initialize(
+	     &( safe_profile->number_of_acquisitions ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create number of acquisitions counter.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_striped_counter_initialize(
+	     &( safe_profile->number_of_contended_acquisitions ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create number of contended acquisitions counter.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_striped_counter_initialize(
+	     &( safe_profile->total_wait_time ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create total wait time counter.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_striped_counter_initialize(
+	     &( safe_profile->number_of_holds ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create number of holds counter.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_striped_counter_initialize(
+	     &( safe_profile->total_hold_time ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create total hold time counter.",
+		 function );
+
+		goto on_error;
+	}
+	*profile = safe_profile;
+
+	return( 1 );
+
+on_error:
+	libcthreads_internal_profile_free(
+	 &safe_profile );
+
+	return( -1 );
+}
+
+/* Retrieves the profile of a specific name
+ * The profile is created if it does not exist
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_profile_get_by_name(
+     const char *name,
+     libcthreads_profile_t **profile,
+     libcerror_error_t **error )
+{
+	libcthreads_profile_t *last_profile = NULL;
+	libcthreads_profile_t *safe_profile = NULL;
+	static char *function               = "libcthreads_profile_get_by_name";
+	size_t name_size                    = 0;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid profile.",
+		 function );
+
+		return( -1 );
+	}
+	name_size = narrow_string_length(
+	             name ) + 1;
+
+	if( libcthreads_light_mutex_grab(
+	     &libcthreads_profiles_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab profiles mutex.",
+		 function );
+
+		return( -1 );
+	}
+	for( safe_profile = libcthreads_profiles;
+	     safe_profile != NULL;
+	     safe_profile = safe_profile->next_profile )
+	{
+		if( ( safe_profile->name_size == name_size )
+		 && ( narrow_string_compare(
+		       safe_profile->name,
+		       name,
+		       name_size ) == 0 ) )
+		{
+			break;
+		}
+		last_profile = safe_profile;
+	}
+	if( safe_profile == NULL )
+	{
+		if( libcthreads_internal_profile_initialize(
+		     &safe_profile,
+		     name,
+		     name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create profile.",
+			 function );
+
+			goto on_error;
+		}
+		if( last_profile == NULL )
+		{
+			libcthreads_profiles = safe_profile;
+		}
+		else
+		{
+			last_profile->next_profile = safe_profile;
+		}
+	}
+	if( libcthreads_light_mutex_release(
+	     &libcthreads_profiles_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release profiles mutex.",
+		 function );
+
+		return( -1 );
+	}
+	*profile = safe_profile;
+
+	return( 1 );
+
+on_error:
+	libcthreads_light_mutex_release(
+	 &libcthreads_profiles_mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Adds an acquisition to the profile
+ * Returns the timestamp of the acquisition, which is used to determine the hold time
+ */
+uint64_t libcthreads_profile_add_acquisition(
+          libcthreads_profile_t *profile,
+          uint64_t start_timestamp,
+          uint8_t is_contended )
+{
+	uint64_t timestamp = 0;
+	uint64_t wait_time = 0;
+
+	timestamp = libcthreads_profile_get_timestamp();
+
+	if( timestamp > start_timestamp )
+	{
+		wait_time = timestamp - start_timestamp;
+	}
+	libcthreads_striped_counter_add(
+	 profile->number_of_acquisitions,
+	 1,
+	 NULL );
+
+	if( is_contended != 0 )
+	{
+		libcthreads_striped_counter_add(
+		 profile->number_of_contended_acquisitions,
+		 1,
+		 NULL );
+	}
+	libcthreads_striped_counter_add(
+	 profile->total_wait_time,
+	 (int64_t) wait_time,
+	 NULL );
+
+	libcthreads_internal_profile_update_maximum(
+	 &( profile->maximum_wait_time ),
+	 wait_time );
+
+	return( timestamp );
+}
+
+/* Adds an exclusive hold to the profile
+ * The hold ends at the time this function is called
+ */
+void libcthreads_profile_add_hold(
+      libcthreads_profile_t *profile,
+      uint64_t grab_timestamp )
+{
+	uint64_t hold_time = 0;
+	uint64_t timestamp = 0;
+
+	timestamp = libcthreads_profile_get_timestamp();
+
+	if( timestamp > grab_timestamp )
+	{
+		hold_time = timestamp - grab_timestamp;
+	}
+	libcthreads_striped_counter_add(
+	 profile->number_of_holds,
+	 1,
+	 NULL );
+
+	libcthreads_striped_counter_add(
+	 profile->total_hold_time,
+	 (int64_t) hold_time,
+	 NULL );
+
+	libcthreads_internal_profile_update_maximum(
+	 &( profile->maximum_hold_time ),
+	 hold_time );
+}
+
+/* Prints the lock contention profiles of the locks that were given a profile name
+ * The profiles are only collected when libcthreads was built with lock profiling support
+ * The times are in nano seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_profile_fprint(
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	libcthreads_profile_t *profile = NULL;
+	static char *function          = "libcthreads_profile_fprint";
+	int64_t value                  = 0;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_light_mutex_grab(
+	     &libcthreads_profiles_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab profiles mutex.",
+		 function );
+
+		return( -1 );
+	}
+	for( profile = libcthreads_profiles;
+	     profile != NULL;
+	     profile = profile->next_profile )
+	{
+		fprintf(
+		 stream,
+		 "Lock profile: %s\n",
+		 profile->name );
+
+		if( libcthreads_striped_counter_get_value(
+		     profile->number_of_acquisitions,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of acquisitions.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 stream,
+		 "\tnumber of acquisitions\t\t\t: %" PRIu64 "\n",
+		 (uint64_t) value );
+
+		if( libcthreads_striped_counter_get_value(
+		     profile->number_of_contended_acquisitions,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of contended acquisitions.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 stream,
+		 "\tnumber of contended acquisitions\t: %" PRIu64 "\n",
+		 (uint64_t) value );
+
+		if( libcthreads_striped_counter_get_value(
+		     profile->total_wait_time,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve total wait time.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 stream,
+		 "\ttotal wait time\t\t\t\t: %" PRIu64 " ns\n",
+		 (uint64_t) value );
+
+		fprintf(
+		 stream,
+		 "\tmaximum wait time\t\t\t: %" PRIu64 " ns\n",
+		 (uint64_t) libcthreads_atomic_load_int64( &( profile->maximum_wait_time ) ) );
+
+		if( libcthreads_striped_counter_get_value(
+		     profile->number_of_holds,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of holds.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 stream,
+		 "\tnumber of holds\t\t\t\t: %" PRIu64 "\n",
+		 (uint64_t) value );
+
+		if( libcthreads_striped_counter_get_value(
+		     profile->total_hold_time,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve total hold time.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 stream,
+		 "\ttotal hold time\t\t\t\t: %" PRIu64 " ns\n",
+		 (uint64_t) value );
+
+		fprintf(
+		 stream,
+		 "\tmaximum hold time\t\t\t: %" PRIu64 " ns\n",
+		 (uint64_t) libcthreads_atomic_load_int64( &( profile->maximum_hold_time ) ) );
+
+		fprintf(
+		 stream,
+		 "\n" );
+	}
+	if( libcthreads_light_mutex_release(
+	     &libcthreads_profiles_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release profiles mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	libcthreads_light_mutex_release(
+	 &libcthreads_profiles_mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Resets the values of the lock contention profiles
+ * Acquisitions and holds that are in progress can still be added afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_profile_reset(
+     libcerror_error_t **error )
+{
+	libcthreads_profile_t *profile = NULL;
+	static char *function          = "libcthreads_profile_reset";
+
+	if( libcthreads_light_mutex_grab(
+	     &libcthreads_profiles_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab profiles mutex.",
+		 function );
+
+		return( -1 );
+	}
+	for( profile = libcthreads_profiles;
+	     profile != NULL;
+	     profile = profile->next_profile )
+	{
+		libcthreads_striped_counter_reset(
+		 profile->number_of_acquisitions,
+		 NULL );
+
+		libcthreads_striped_counter_reset(
+		 profile->number_of_contended_acquisitions,
+		 NULL );
+
+		libcthreads_striped_counter_reset(
+		 profile->total_wait_time,
+		 NULL );
+
+		libcthreads_atomic_store_int64(
+		 &( profile->maximum_wait_time ),
+		 0 );
+
+		libcthreads_striped_counter_reset(
+		 profile->number_of_holds,
+		 NULL );
+
+		libcthreads_striped_counter_reset(
+		 profile->total_hold_time,
+		 NULL );
+
+		libcthreads_atomic_store_int64(
+		 &( profile->maximum_hold_time ),
+		 0 );
+	}
+	if( libcthreads_light_mutex_release(
+	     &libcthreads_profiles_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release profiles mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
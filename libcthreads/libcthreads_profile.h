@@ -0,0 +1,122 @@
+/*
+ * Lock contention profile functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_PROFILE_H )
+#define _LIBCTHREADS_INTERNAL_PROFILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#include "libcthreads_extern.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct libcthreads_profile libcthreads_profile_t;
+
+/* The lock contention profile
+ * Profiles are shared by all locks with the same name and are kept until the process ends
+ * The times are in nano seconds
+ */
+struct libcthreads_profile
+{
+	/* The next profile
+	 */
+	libcthreads_profile_t *next_profile;
+
+	/* The name
+	 */
+	char *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The number of acquisitions
+	 */
+	libcthreads_striped_counter_t *number_of_acquisitions;
+
+	/* The number of acquisitions that had to wait for another thread
+	 */
+	libcthreads_striped_counter_t *number_of_contended_acquisitions;
+
+	/* The total wait time
+	 */
+	libcthreads_striped_counter_t *total_wait_time;
+
+	/* The maximum wait time
+	 */
+	uint64_t maximum_wait_time;
+
+	/* The number of exclusive holds
+	 */
+	libcthreads_striped_counter_t *number_of_holds;
+
+	/* The total hold time
+	 */
+	libcthreads_striped_counter_t *total_hold_time;
+
+	/* The maximum hold time
+	 */
+	uint64_t maximum_hold_time;
+};
+
+uint64_t libcthreads_profile_get_timestamp(
+          void );
+
+int libcthreads_profile_get_by_name(
+     const char *name,
+     libcthreads_profile_t **profile,
+     libcerror_error_t **error );
+
+uint64_t libcthreads_profile_add_acquisition(
+          libcthreads_profile_t *profile,
+          uint64_t start_timestamp,
+          uint8_t is_contended );
+
+void libcthreads_profile_add_hold(
+      libcthreads_profile_t *profile,
+      uint64_t grab_timestamp );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_profile_fprint(
+     FILE *stream,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_profile_reset(
+     libcerror_error_t **error );
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCTHREADS_INTERNAL_PROFILE_H ) */
+
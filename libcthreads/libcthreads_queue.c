@@ -23,15 +23,315 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libcthreads_atomic.h"
 #include "libcthreads_condition.h"
 #include "libcthreads_definitions.h"
 #include "libcthreads_libcerror.h"
+#include "libcthreads_memory.h"
 #include "libcthreads_mutex.h"
 #include "libcthreads_queue.h"
+#include "libcthreads_queue_selector.h"
+#include "libcthreads_spin_wait.h"
+#include "libcthreads_striped_counter.h"
 #include "libcthreads_types.h"
 
 #if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
 
+/* Determines if a value of a specific weight fits in the queue
+ * A value with a weight of 0 is not restricted by the maximum weight
+ * Returns 1 if the value fits or 0 if not
+ */
+static int libcthreads_internal_queue_value_fits(
+            libcthreads_internal_queue_t *internal_queue,
+            size_t weight )
+{
+	if( internal_queue->number_of_values >= internal_queue->allocated_number_of_values )
+	{
+		return( 0 );
+	}
+	if( weight == 0 )
+	{
+		return( 1 );
+	}
+	if( weight > ( (size_t) -1 - internal_queue->current_weight ) )
+	{
+		return( 0 );
+	}
+	if( ( internal_queue->maximum_weight == 0 )
+	 || ( internal_queue->current_weight == 0 ) )
+	{
+		return( 1 );
+	}
+	if( ( internal_queue->current_weight + weight ) > internal_queue->maximum_weight )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Notifies a consumer that waits on the empty condition
+ * Since a single value was pushed, waking up a single consumer suffices
+ * The notification is skipped if no consumer is waiting
+ * The condition mutex must be held by the caller
+ * Returns 1 if successful or -1 on error
+ */
+static int libcthreads_internal_queue_notify_consumer(
+            libcthreads_internal_queue_t *internal_queue,
+            libcerror_error_t **error )
+{
+	static char *function = "libcthreads_internal_queue_notify_consumer";
+
+	if( internal_queue->number_of_empty_waiters == 0 )
+	{
+		return( 1 );
+	}
+	if( libcthreads_condition_signal(
+	     internal_queue->empty_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to signal empty condition.",
+		 function );
+
+		return( -1 );
+	}
+	libcthreads_striped_counter_add(
+	 internal_queue->number_of_notifications,
+	 1,
+	 NULL );
+
+	return( 1 );
+}
+
+/* Notifies the producers that wait on the full condition
+ * Since a single value was popped, waking up a single producer suffices,
+ * unless the producers also wait for the weight of the queue to decrease
+ * or threads wait on the same condition for the queue to become empty
+ * The notification is skipped if no producer is waiting
+ * The condition mutex must be held by the caller
+ * Returns 1 if successful or -1 on error
+ */
+static int libcthreads_internal_queue_notify_producers(
+            libcthreads_internal_queue_t *internal_queue,
+            libcerror_error_t **error )
+{
+	static char *function = "libcthreads_internal_queue_notify_producers";
+	int result            = 0;
+
+	if( internal_queue->number_of_full_waiters == 0 )
+	{
+		return( 1 );
+	}
+	if( ( internal_queue->maximum_weight == 0 )
+	 && ( internal_queue->number_of_empty_queue_waiters == 0 ) )
+	{
+		result = libcthreads_condition_signal(
+		          internal_queue->full_condition,
+		          error );
+	}
+	else
+	{
+		result = libcthreads_condition_broadcast(
+		          internal_queue->full_condition,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to notify full condition.",
+		 function );
+
+		return( -1 );
+	}
+	libcthreads_striped_counter_add(
+	 internal_queue->number_of_notifications,
+	 1,
+	 NULL );
+
+	return( 1 );
+}
+
+/* Waits on a condition of the queue
+ * The number of waiters is maintained so that notifications can be skipped when nobody waits
+ * The condition mutex must be held by the caller
+ * Returns 1 if successful or -1 on error
+ */
+static int libcthreads_internal_queue_wait(
+            libcthreads_internal_queue_t *internal_queue,
+            libcthreads_condition_t *condition,
+            int *number_of_waiters,
+            libcerror_error_t **error )
+{
+	static char *function = "libcthreads_internal_queue_wait";
+	int result            = 0;
+
+	*number_of_waiters += 1;
+
+	result = libcthreads_condition_wait(
+	          condition,
+	          internal_queue->condition_mutex,
+	          error );
+
+	*number_of_waiters -= 1;
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to wait for condition.",
+		 function );
+
+		return( -1 );
+	}
+	libcthreads_striped_counter_add(
+	 internal_queue->number_of_wake_ups,
+	 1,
+	 NULL );
+
+	return( 1 );
+}
+
+/* Creates the statistics of the queue
+ * Returns 1 if successful or -1 on error
+ */
+static int libcthreads_internal_queue_initialize_statistics(
+            libcthreads_internal_queue_t *internal_queue,
+            libcerror_error_t **error )
+{
+	static char *function = "libcthreads_internal_queue_initialize_statistics";
+
+	if( libcthreads_striped_counter_initialize(
+	     &( internal_queue->number_of_spin_hits ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create number of spin hits striped counter.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_striped_counter_initialize(
+	     &( internal_queue->number_of_parks ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create number of parks striped counter.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_striped_counter_initialize(
+	     &( internal_queue->number_of_notifications ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create number of notifications striped counter.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_striped_counter_initialize(
+	     &( internal_queue->number_of_wake_ups ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create number of wake ups striped counter.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees the statistics of the queue
+ * Returns 1 if successful or -1 on error
+ */
+static int libcthreads_internal_queue_free_statistics(
+            libcthreads_internal_queue_t *internal_queue,
+            libcerror_error_t **error )
+{
+	static char *function = "libcthreads_internal_queue_free_statistics";
+	int result            = 1;
+
+	if( libcthreads_striped_counter_free(
+	     &( internal_queue->number_of_wake_ups ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free number of wake ups striped counter.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_striped_counter_free(
+	     &( internal_queue->number_of_notifications ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free number of notifications striped counter.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_striped_counter_free(
+	     &( internal_queue->number_of_parks ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free number of parks striped counter.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_striped_counter_free(
+	     &( internal_queue->number_of_spin_hits ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free number of spin hits striped counter.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
 /* Creates a queue
  * Make sure the value queue is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -44,6 +344,7 @@ int libcthreads_queue_initialize(
 	libcthreads_internal_queue_t *internal_queue = NULL;
 	static char *function                        = "libcthreads_queue_initialize";
 	size_t values_array_size                     = 0;
+	size_t weights_array_size                    = 0;
 
 	if( queue == NULL )
 	{
@@ -137,8 +438,9 @@ int libcthreads_queue_initialize(
 
 		return( -1 );
 	}
-	internal_queue->values_array = (intptr_t **) memory_allocate(
-	                                              values_array_size );
+	internal_queue->values_array = (intptr_t **) libcthreads_memory_allocate_aligned(
+	                                              values_array_size,
+	                                              LIBCTHREADS_CACHE_LINE_SIZE );
 
 	if( internal_queue->values_array == NULL )
 	{
@@ -165,6 +467,47 @@ int libcthreads_queue_initialize(
 
 		goto on_error;
 	}
+	weights_array_size = sizeof( size_t ) * maximum_number_of_values;
+
+	if( weights_array_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid weights array size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	internal_queue->weights_array = (size_t *) memory_allocate(
+	                                            weights_array_size );
+
+	if( internal_queue->weights_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create weights array.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_queue->weights_array,
+	     0,
+	     weights_array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear weights array.",
+		 function );
+
+		goto on_error;
+	}
 	internal_queue->allocated_number_of_values = maximum_number_of_values;
 
 	if( libcthreads_mutex_initialize(
@@ -206,6 +549,19 @@ int libcthreads_queue_initialize(
 
 		goto on_error;
 	}
+	if( libcthreads_internal_queue_initialize_statistics(
+	     internal_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create statistics.",
+		 function );
+
+		goto on_error;
+	}
 	*queue = (libcthreads_queue_t *) internal_queue;
 
 	return( 1 );
@@ -213,6 +569,16 @@ int libcthreads_queue_initialize(
 on_error:
 	if( internal_queue != NULL )
 	{
+		libcthreads_internal_queue_free_statistics(
+		 internal_queue,
+		 NULL );
+
+		if( internal_queue->full_condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( internal_queue->full_condition ),
+			 NULL );
+		}
 		if( internal_queue->empty_condition != NULL )
 		{
 			libcthreads_condition_free(
@@ -225,9 +591,14 @@ on_error:
 			 &( internal_queue->condition_mutex ),
 			 NULL );
 		}
-		if( internal_queue->values_array != NULL )
+		if( internal_queue->weights_array != NULL )
 		{
 			memory_free(
+			 internal_queue->weights_array );
+		}
+		if( internal_queue->values_array != NULL )
+		{
+			libcthreads_memory_free_aligned(
 			 internal_queue->values_array );
 		}
 		memory_free(
@@ -236,21 +607,20 @@ on_error:
 	return( -1 );
 }
 
-/* Frees a queue
- * Uses the value_free_function to free the value
+/* Creates a queue that stores values by copy
+ * The values are stored in a contiguous buffer that is aligned to a cache line
+ * Make sure the value queue is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
-int libcthreads_queue_free(
+int libcthreads_queue_initialize_with_value_size(
      libcthreads_queue_t **queue,
-     int (*value_free_function)(
-            intptr_t **value,
-            libcerror_error_t **error ),
+     int maximum_number_of_values,
+     size_t value_size,
      libcerror_error_t **error )
 {
 	libcthreads_internal_queue_t *internal_queue = NULL;
-	static char *function                        = "libcthreads_queue_free";
-	int result                                   = 1;
-	int value_index                              = 0;
+	static char *function                        = "libcthreads_queue_initialize_with_value_size";
+	size_t values_data_size                      = 0;
 
 	if( queue == NULL )
 	{
@@ -265,24 +635,284 @@ int libcthreads_queue_free(
 	}
 	if( *queue != NULL )
 	{
-		internal_queue = (libcthreads_internal_queue_t *) *queue;
-		*queue         = NULL;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid queue value already set.",
+		 function );
 
-		if( value_free_function != NULL )
-		{
-			for( value_index = 0;
-			     value_index < internal_queue->allocated_number_of_values;
-			     value_index++ )
-			{
-				if( value_free_function(
-				     &( internal_queue->values_array[ value_index ] ),
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free value: %d.",
+		return( -1 );
+	}
+	if( maximum_number_of_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_size == 0 )
+	 || ( value_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if SIZEOF_INT <= SIZEOF_SIZE_T
+	if( (size_t) maximum_number_of_values > (size_t) ( ( SSIZE_MAX - LIBCTHREADS_CACHE_LINE_SIZE ) / value_size ) )
+#else
+	if( maximum_number_of_values > (int) ( ( SSIZE_MAX - LIBCTHREADS_CACHE_LINE_SIZE ) / value_size ) )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum number of values value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	values_data_size = value_size * maximum_number_of_values;
+
+	/* Round the values data size up to a multiple of the cache line size
+	 */
+	values_data_size = ( values_data_size + LIBCTHREADS_CACHE_LINE_SIZE - 1 ) & ~( (size_t) LIBCTHREADS_CACHE_LINE_SIZE - 1 );
+
+	if( values_data_size == 0 )
+	{
+		values_data_size = LIBCTHREADS_CACHE_LINE_SIZE;
+	}
+	internal_queue = memory_allocate_structure(
+	                  libcthreads_internal_queue_t );
+
+	if( internal_queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_queue,
+	     0,
+	     sizeof( libcthreads_internal_queue_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear queue.",
+		 function );
+
+		memory_free(
+		 internal_queue );
+
+		return( -1 );
+	}
+	internal_queue->values_data = (uint8_t *) libcthreads_memory_allocate_aligned(
+	                                           values_data_size,
+	                                           LIBCTHREADS_CACHE_LINE_SIZE );
+
+	if( internal_queue->values_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create values data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_queue->values_data,
+	     0,
+	     values_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear values data.",
+		 function );
+
+		goto on_error;
+	}
+	internal_queue->allocated_number_of_values = maximum_number_of_values;
+	internal_queue->value_size                 = value_size;
+
+	if( libcthreads_mutex_initialize(
+	     &( internal_queue->condition_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( internal_queue->empty_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create empty condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( internal_queue->full_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create full condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_internal_queue_initialize_statistics(
+	     internal_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create statistics.",
+		 function );
+
+		goto on_error;
+	}
+	*queue = (libcthreads_queue_t *) internal_queue;
+
+	return( 1 );
+
+on_error:
+	if( internal_queue != NULL )
+	{
+		libcthreads_internal_queue_free_statistics(
+		 internal_queue,
+		 NULL );
+
+		if( internal_queue->full_condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( internal_queue->full_condition ),
+			 NULL );
+		}
+		if( internal_queue->empty_condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( internal_queue->empty_condition ),
+			 NULL );
+		}
+		if( internal_queue->condition_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_queue->condition_mutex ),
+			 NULL );
+		}
+		if( internal_queue->values_data != NULL )
+		{
+			libcthreads_memory_free_aligned(
+			 internal_queue->values_data );
+		}
+		memory_free(
+		 internal_queue );
+	}
+	return( -1 );
+}
+
+/* Frees a queue
+ * Uses the value_free_function to free the value, which is only used
+ * for a queue that stores value references
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_queue_free(
+     libcthreads_queue_t **queue,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libcthreads_internal_queue_t *internal_queue = NULL;
+	static char *function                        = "libcthreads_queue_free";
+	int result                                   = 1;
+	int value_index                              = 0;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( *queue != NULL )
+	{
+		internal_queue = (libcthreads_internal_queue_t *) *queue;
+		*queue         = NULL;
+
+		if( internal_queue->selector != NULL )
+		{
+			if( libcthreads_internal_queue_selector_remove_queue(
+			     internal_queue->selector,
+			     (libcthreads_queue_t *) internal_queue,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove queue from selector.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( internal_queue->values_array != NULL )
+		 && ( value_free_function != NULL ) )
+		{
+			for( value_index = 0;
+			     value_index < internal_queue->allocated_number_of_values;
+			     value_index++ )
+			{
+				if( value_free_function(
+				     &( internal_queue->values_array[ value_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free value: %d.",
 					 function,
 					 value_index );
 
@@ -290,9 +920,21 @@ int libcthreads_queue_free(
 				}
 			}
 		}
-		memory_free(
-		 internal_queue->values_array );
-
+		if( internal_queue->values_array != NULL )
+		{
+			libcthreads_memory_free_aligned(
+			 internal_queue->values_array );
+		}
+		if( internal_queue->weights_array != NULL )
+		{
+			memory_free(
+			 internal_queue->weights_array );
+		}
+		if( internal_queue->values_data != NULL )
+		{
+			libcthreads_memory_free_aligned(
+			 internal_queue->values_data );
+		}
 		if( libcthreads_condition_free(
 		     &( internal_queue->full_condition ),
 		     error ) != 1 )
@@ -326,54 +968,1673 @@ int libcthreads_queue_free(
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free condition mutex.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free condition mutex.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_internal_queue_free_statistics(
+		     internal_queue,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free statistics.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_queue );
+	}
+	return( result );
+}
+
+/* Sets the maximum weight of the queue
+ * The maximum weight restricts the sum of the weights of the values pushed with a weight
+ * A maximum weight of 0 represents no restriction
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_queue_set_maximum_weight(
+     libcthreads_queue_t *queue,
+     size_t maximum_weight,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_queue_t *internal_queue = NULL;
+	static char *function                        = "libcthreads_queue_set_maximum_weight";
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_queue = (libcthreads_internal_queue_t *) queue;
+
+	if( libcthreads_mutex_grab(
+	     internal_queue->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	internal_queue->maximum_weight = maximum_weight;
+
+	/* Wake up the waiting producers since their value might fit now
+	 * The condition broadcast must be protected by the mutex for the WINAPI version
+	 */
+	if( internal_queue->number_of_full_waiters > 0 )
+	{
+		if( libcthreads_condition_broadcast(
+		     internal_queue->full_condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast full condition.",
+			 function );
+
+			goto on_error;
+		}
+		libcthreads_striped_counter_add(
+	 internal_queue->number_of_notifications,
+	 1,
+	 NULL );
+	}
+	if( libcthreads_mutex_release(
+	     internal_queue->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	libcthreads_mutex_release(
+	 internal_queue->condition_mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Sets the maximum spin count of the queue
+ * A consumer that finds the queue empty spins for an adaptive number of iterations,
+ * bounded by the maximum spin count, before it parks on the empty condition
+ * A maximum spin count of 0 disables spinning
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_queue_set_maximum_spin_count(
+     libcthreads_queue_t *queue,
+     int maximum_spin_count,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_queue_t *internal_queue = NULL;
+	static char *function                        = "libcthreads_queue_set_maximum_spin_count";
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_queue = (libcthreads_internal_queue_t *) queue;
+
+	if( maximum_spin_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum spin count value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_queue->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	internal_queue->spin_wait.maximum_spin_count = maximum_spin_count;
+
+	if( internal_queue->spin_wait.spin_count > maximum_spin_count )
+	{
+		internal_queue->spin_wait.spin_count = maximum_spin_count;
+	}
+	if( libcthreads_mutex_release(
+	     internal_queue->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the wait statistics of the queue
+ * The number of spin hits is the number of waits that were satisfied while spinning
+ * The number of parks is the number of waits that parked on the empty condition
+ * The spin count is the current adaptive number of spin iterations
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_queue_get_wait_statistics(
+     libcthreads_queue_t *queue,
+     uint64_t *number_of_spin_hits,
+     uint64_t *number_of_parks,
+     int *spin_count,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_queue_t *internal_queue = NULL;
+	static char *function                        = "libcthreads_queue_get_wait_statistics";
+	int64_t value                                = 0;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_queue = (libcthreads_internal_queue_t *) queue;
+
+	if( number_of_spin_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of spin hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_parks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of parks.",
+		 function );
+
+		return( -1 );
+	}
+	if( spin_count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid spin count.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_striped_counter_get_value(
+	     internal_queue->number_of_spin_hits,
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of spin hits.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_spin_hits = (uint64_t) value;
+
+	if( libcthreads_striped_counter_get_value(
+	     internal_queue->number_of_parks,
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of parks.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_parks = (uint64_t) value;
+
+	*spin_count = libcthreads_atomic_load_int(
+	               &( internal_queue->spin_wait.spin_count ) );
+
+	return( 1 );
+}
+
+/* Retrieves the notification statistics of the queue
+ * The number of notifications is the number of times waiters were signalled
+ * The number of wake ups is the number of times a waiter returned from a condition wait
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_queue_get_notify_statistics(
+     libcthreads_queue_t *queue,
+     uint64_t *number_of_notifications,
+     uint64_t *number_of_wake_ups,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_queue_t *internal_queue = NULL;
+	static char *function                        = "libcthreads_queue_get_notify_statistics";
+	int64_t value                                = 0;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_queue = (libcthreads_internal_queue_t *) queue;
+
+	if( number_of_notifications == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of notifications.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_wake_ups == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of wake ups.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_striped_counter_get_value(
+	     internal_queue->number_of_notifications,
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of notifications.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_notifications = (uint64_t) value;
+
+	if( libcthreads_striped_counter_get_value(
+	     internal_queue->number_of_wake_ups,
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of wake ups.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_wake_ups = (uint64_t) value;
+
+	return( 1 );
+}
+
+/* Empties a queue
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_queue_empty(
+     libcthreads_queue_t *queue,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_queue_t *internal_queue = NULL;
+	static char *function                        = "libcthreads_queue_empty";
+	int result                                   = 1;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_queue = (libcthreads_internal_queue_t *) queue;
+
+	if( ( internal_queue->values_array == NULL )
+	 && ( internal_queue->values_data == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid queue - missing values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_queue->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	/* The producers also wait on the full condition, hence the notification
+	 * of a pop must wake up all waiters while the queue is being emptied
+	 */
+	while( internal_queue->number_of_values != 0 )
+	{
+		internal_queue->number_of_empty_queue_waiters += 1;
+
+		result = libcthreads_internal_queue_wait(
+		          internal_queue,
+		          internal_queue->full_condition,
+		          &( internal_queue->number_of_full_waiters ),
+		          error );
+
+		internal_queue->number_of_empty_queue_waiters -= 1;
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to wait for full condition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     internal_queue->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	libcthreads_mutex_release(
+	 internal_queue->condition_mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Tries to pop a value off the queue
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libcthreads_queue_try_pop(
+     libcthreads_queue_t *queue,
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_queue_t *internal_queue = NULL;
+	static char *function                        = "libcthreads_queue_try_pop";
+	int result                                   = 1;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_queue = (libcthreads_internal_queue_t *) queue;
+
+	if( internal_queue->value_size != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid queue - unsupported queue that stores values by copy.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_queue->values_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid queue - missing values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_queue->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_queue->number_of_values == 0 )
+	{
+		result = 0;
+	}
+	else
+	{
+		*value = internal_queue->values_array[ internal_queue->pop_index ];
+
+		internal_queue->current_weight -= internal_queue->weights_array[ internal_queue->pop_index ];
+
+		internal_queue->weights_array[ internal_queue->pop_index ] = 0;
+
+		internal_queue->pop_index++;
+
+		if( internal_queue->pop_index >= internal_queue->allocated_number_of_values )
+		{
+			internal_queue->pop_index = 0;
+		}
+		libcthreads_atomic_store_int(
+		 &( internal_queue->number_of_values ),
+		 internal_queue->number_of_values - 1 );
+
+		/* The notification must be protected by the mutex for the WINAPI version
+		 */
+		if( libcthreads_internal_queue_notify_producers(
+		     internal_queue,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to notify producers.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     internal_queue->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	libcthreads_mutex_release(
+	 internal_queue->condition_mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Pops a value off the queue
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_queue_pop(
+     libcthreads_queue_t *queue,
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_queue_t *internal_queue = NULL;
+	static char *function                        = "libcthreads_queue_pop";
+	int number_of_iterations                     = 0;
+	int spin_limit                               = 0;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_queue = (libcthreads_internal_queue_t *) queue;
+
+	if( internal_queue->value_size != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid queue - unsupported queue that stores values by copy.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_queue->values_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid queue - missing values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_queue->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_queue->number_of_values == 0 )
+	 && ( internal_queue->spin_wait.maximum_spin_count > 0 ) )
+	{
+		/* Spin without holding the mutex so that a producer can hand off a value
+		 * without the cost of parking and waking up the thread
+		 */
+		spin_limit = libcthreads_spin_wait_get_limit(
+		              &( internal_queue->spin_wait ) );
+
+		if( libcthreads_mutex_release(
+		     internal_queue->condition_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release condition mutex.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_iterations = libcthreads_spin_wait_while_zero(
+		                        &( internal_queue->number_of_values ),
+		                        spin_limit );
+
+		if( libcthreads_mutex_grab(
+		     internal_queue->condition_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab condition mutex.",
+			 function );
+
+			return( -1 );
+		}
+		libcthreads_spin_wait_update(
+		 &( internal_queue->spin_wait ),
+		 number_of_iterations );
+
+		if( internal_queue->number_of_values != 0 )
+		{
+			libcthreads_striped_counter_add(
+			 internal_queue->number_of_spin_hits,
+			 1,
+			 NULL );
+		}
+	}
+	if( internal_queue->number_of_values == 0 )
+	{
+		libcthreads_striped_counter_add(
+		 internal_queue->number_of_parks,
+		 1,
+		 NULL );
+	}
+	while( internal_queue->number_of_values == 0 )
+	{
+		if( libcthreads_internal_queue_wait(
+		     internal_queue,
+		     internal_queue->empty_condition,
+		     &( internal_queue->number_of_empty_waiters ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to wait for empty condition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*value = internal_queue->values_array[ internal_queue->pop_index ];
+
+	internal_queue->current_weight -= internal_queue->weights_array[ internal_queue->pop_index ];
+
+	internal_queue->weights_array[ internal_queue->pop_index ] = 0;
+
+	internal_queue->pop_index++;
+
+	if( internal_queue->pop_index >= internal_queue->allocated_number_of_values )
+	{
+		internal_queue->pop_index = 0;
+	}
+	libcthreads_atomic_store_int(
+	 &( internal_queue->number_of_values ),
+	 internal_queue->number_of_values - 1 );
+
+	/* The notification must be protected by the mutex for the WINAPI version
+	 */
+	if( libcthreads_internal_queue_notify_producers(
+	     internal_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to notify producers.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_release(
+	     internal_queue->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	libcthreads_mutex_release(
+	 internal_queue->condition_mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Tries to push a value onto the queue
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libcthreads_queue_try_push(
+     libcthreads_queue_t *queue,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_queue_t *internal_queue = NULL;
+	libcthreads_queue_selector_t *selector       = NULL;
+	static char *function                        = "libcthreads_queue_try_push";
+	int result                                   = 1;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_queue = (libcthreads_internal_queue_t *) queue;
+
+	if( internal_queue->value_size != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid queue - unsupported queue that stores values by copy.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_queue->values_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid queue - missing values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_queue->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_queue->number_of_values == internal_queue->allocated_number_of_values )
+	{
+		result = 0;
+	}
+	else
+	{
+		internal_queue->values_array[ internal_queue->push_index ] = value;
+
+		internal_queue->push_index++;
+
+		if( internal_queue->push_index >= internal_queue->allocated_number_of_values )
+		{
+			internal_queue->push_index = 0;
+		}
+		libcthreads_atomic_store_int(
+		 &( internal_queue->number_of_values ),
+		 internal_queue->number_of_values + 1 );
+
+		selector = internal_queue->selector;
+
+		/* The notification must be protected by the mutex for the WINAPI version
+		 */
+		if( libcthreads_internal_queue_notify_consumer(
+		     internal_queue,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to notify consumer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     internal_queue->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( selector != NULL )
+	{
+		if( libcthreads_internal_queue_selector_notify(
+		     selector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to notify queue selector.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+
+on_error:
+	libcthreads_mutex_release(
+	 internal_queue->condition_mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Pushes a value onto the queue
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_queue_push(
+     libcthreads_queue_t *queue,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_queue_t *internal_queue = NULL;
+	libcthreads_queue_selector_t *selector       = NULL;
+	static char *function                        = "libcthreads_queue_push";
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_queue = (libcthreads_internal_queue_t *) queue;
+
+	if( internal_queue->value_size != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid queue - unsupported queue that stores values by copy.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_queue->values_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid queue - missing values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_queue->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( internal_queue->number_of_values == internal_queue->allocated_number_of_values )
+	{
+		if( libcthreads_internal_queue_wait(
+		     internal_queue,
+		     internal_queue->full_condition,
+		     &( internal_queue->number_of_full_waiters ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to wait for full condition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_queue->values_array[ internal_queue->push_index ] = value;
+
+	internal_queue->push_index++;
+
+	if( internal_queue->push_index >= internal_queue->allocated_number_of_values )
+	{
+		internal_queue->push_index = 0;
+	}
+	libcthreads_atomic_store_int(
+	 &( internal_queue->number_of_values ),
+	 internal_queue->number_of_values + 1 );
+
+	selector = internal_queue->selector;
+
+	/* The notification must be protected by the mutex for the WINAPI version
+	 */
+	if( libcthreads_internal_queue_notify_consumer(
+	     internal_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to notify consumer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_release(
+	     internal_queue->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( selector != NULL )
+	{
+		if( libcthreads_internal_queue_selector_notify(
+		     selector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to notify queue selector.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	libcthreads_mutex_release(
+	 internal_queue->condition_mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Tries to push a value with a specific weight onto the queue
+ * The push fails if the queue is full or if the value does not fit in the remaining weight
+ * A value that exceeds the maximum weight is only pushed when the queue contains no weighted values
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libcthreads_queue_try_push_with_weight(
+     libcthreads_queue_t *queue,
+     intptr_t *value,
+     size_t weight,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_queue_t *internal_queue = NULL;
+	libcthreads_queue_selector_t *selector       = NULL;
+	static char *function                        = "libcthreads_queue_try_push_with_weight";
+	int result                                   = 1;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_queue = (libcthreads_internal_queue_t *) queue;
+
+	if( internal_queue->value_size != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid queue - unsupported queue that stores values by copy.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_queue->values_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid queue - missing values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_queue->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_internal_queue_value_fits(
+	     internal_queue,
+	     weight ) == 0 )
+	{
+		result = 0;
+	}
+	else
+	{
+		internal_queue->values_array[ internal_queue->push_index ]  = value;
+		internal_queue->weights_array[ internal_queue->push_index ] = weight;
+
+		internal_queue->current_weight += weight;
+
+		internal_queue->push_index++;
+
+		if( internal_queue->push_index >= internal_queue->allocated_number_of_values )
+		{
+			internal_queue->push_index = 0;
+		}
+		libcthreads_atomic_store_int(
+		 &( internal_queue->number_of_values ),
+		 internal_queue->number_of_values + 1 );
+
+		selector = internal_queue->selector;
+
+		/* The notification must be protected by the mutex for the WINAPI version
+		 */
+		if( libcthreads_internal_queue_notify_consumer(
+		     internal_queue,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to notify consumer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     internal_queue->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( selector != NULL )
+	{
+		if( libcthreads_internal_queue_selector_notify(
+		     selector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to notify queue selector.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+
+on_error:
+	libcthreads_mutex_release(
+	 internal_queue->condition_mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Pushes a value with a specific weight onto the queue
+ * Blocks while the queue is full or while the value does not fit in the remaining weight
+ * A value that exceeds the maximum weight is only pushed when the queue contains no weighted values
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_queue_push_with_weight(
+     libcthreads_queue_t *queue,
+     intptr_t *value,
+     size_t weight,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_queue_t *internal_queue = NULL;
+	libcthreads_queue_selector_t *selector       = NULL;
+	static char *function                        = "libcthreads_queue_push_with_weight";
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_queue = (libcthreads_internal_queue_t *) queue;
+
+	if( internal_queue->value_size != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid queue - unsupported queue that stores values by copy.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_queue->values_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid queue - missing values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_queue->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( libcthreads_internal_queue_value_fits(
+	        internal_queue,
+	        weight ) == 0 )
+	{
+		if( libcthreads_internal_queue_wait(
+		     internal_queue,
+		     internal_queue->full_condition,
+		     &( internal_queue->number_of_full_waiters ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to wait for full condition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_queue->values_array[ internal_queue->push_index ]  = value;
+	internal_queue->weights_array[ internal_queue->push_index ] = weight;
+
+	internal_queue->current_weight += weight;
+
+	internal_queue->push_index++;
+
+	if( internal_queue->push_index >= internal_queue->allocated_number_of_values )
+	{
+		internal_queue->push_index = 0;
+	}
+	libcthreads_atomic_store_int(
+	 &( internal_queue->number_of_values ),
+	 internal_queue->number_of_values + 1 );
+
+	selector = internal_queue->selector;
+
+	/* The notification must be protected by the mutex for the WINAPI version
+	 */
+	if( libcthreads_internal_queue_notify_consumer(
+	     internal_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to notify consumer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_release(
+	     internal_queue->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( selector != NULL )
+	{
+		if( libcthreads_internal_queue_selector_notify(
+		     selector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to notify queue selector.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	libcthreads_mutex_release(
+	 internal_queue->condition_mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Pushes a value onto the queue in sorted order
+ *
+ * Uses the value_compare_function to determine the similarity of the values
+ * The value_compare_function should return LIBCTHREADS_COMPARE_LESS,
+ * LIBCTHREADS_COMPARE_EQUAL, LIBCTHREADS_COMPARE_GREATER if successful or -1 on error
+ *
+ * Returns 1 if successful, 0 if the value already exists or -1 on error
+ */
+int libcthreads_queue_push_sorted(
+     libcthreads_queue_t *queue,
+     intptr_t *value,
+     int (*value_compare_function)(
+            intptr_t *first_value,
+            intptr_t *second_value,
+            libcerror_error_t **error ),
+     uint8_t sort_flags,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_queue_t *internal_queue = NULL;
+	libcthreads_queue_selector_t *selector       = NULL;
+	static char *function                        = "libcthreads_queue_push_sorted";
+	int compare_result                           = 0;
+	int pop_index                                = 0;
+	int previous_push_index                      = 0;
+	int push_index                               = 0;
+	int result                                   = 1;
+	int value_index                              = 0;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_queue = (libcthreads_internal_queue_t *) queue;
+
+	if( internal_queue->value_size != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid queue - unsupported queue that stores values by copy.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_queue->values_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid queue - missing values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_compare_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value compare function.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sort_flags & ~( LIBCTHREADS_SORT_FLAG_UNIQUE_VALUES ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported sort flags: 0x%02" PRIx8 ".",
+		 function,
+		 sort_flags );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_queue->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( internal_queue->number_of_values == internal_queue->allocated_number_of_values )
+	{
+		if( libcthreads_internal_queue_wait(
+		     internal_queue,
+		     internal_queue->full_condition,
+		     &( internal_queue->number_of_full_waiters ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to wait for full condition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	pop_index = internal_queue->pop_index;
+
+	for( value_index = 0;
+	     value_index < internal_queue->number_of_values;
+	     value_index++ )
+	{
+		compare_result = value_compare_function(
+		                  value,
+		                  internal_queue->values_array[ pop_index ],
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to compare value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		else if( compare_result == LIBCTHREADS_COMPARE_EQUAL )
+		{
+			if( ( sort_flags & LIBCTHREADS_SORT_FLAG_UNIQUE_VALUES ) != 0 )
+			{
+				result = 0;
+
+				break;
+			}
+		}
+		else if( compare_result == LIBCTHREADS_COMPARE_LESS )
+		{
+			result = 1;
+
+			break;
+		}
+		else if( compare_result != LIBCTHREADS_COMPARE_GREATER )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value compare function return value: %d.",
+			 function,
+			 compare_result );
+
+			goto on_error;
+		}
+		pop_index++;
+
+		if( pop_index >= internal_queue->allocated_number_of_values )
+		{
+			pop_index = 0;
+		}
+	}
+	if( result != 0 )
+	{
+		push_index = internal_queue->push_index;
+
+		if( compare_result == LIBCTHREADS_COMPARE_LESS )
+		{
+			previous_push_index = push_index - 1;
+
+			while( push_index != pop_index )
+			{
+				if( previous_push_index < 0 )
+				{
+					previous_push_index = internal_queue->allocated_number_of_values - 1;
+				}
+				internal_queue->values_array[ push_index ]  = internal_queue->values_array[ previous_push_index ];
+				internal_queue->weights_array[ push_index ] = internal_queue->weights_array[ previous_push_index ];
+
+				push_index = previous_push_index;
+
+				previous_push_index--;
+			}
+		}
+		internal_queue->values_array[ push_index ]  = value;
+		internal_queue->weights_array[ push_index ] = 0;
+
+		internal_queue->push_index++;
+
+		if( internal_queue->push_index >= internal_queue->allocated_number_of_values )
+		{
+			internal_queue->push_index = 0;
+		}
+		libcthreads_atomic_store_int(
+		 &( internal_queue->number_of_values ),
+		 internal_queue->number_of_values + 1 );
+
+		selector = internal_queue->selector;
+
+		/* The notification must be protected by the mutex for the WINAPI version
+		 */
+		if( libcthreads_internal_queue_notify_consumer(
+		     internal_queue,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to notify consumer.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
-		memory_free(
-		 internal_queue );
-	}
-	return( result );
-}
-
-/* Empties a queue
- * Returns 1 if successful or -1 on error
- */
-int libcthreads_queue_empty(
-     libcthreads_queue_t *queue,
-     libcerror_error_t **error )
-{
-	libcthreads_internal_queue_t *internal_queue = NULL;
-	static char *function                        = "libcthreads_queue_empty";
-	int result                                   = 1;
-
-	if( queue == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid queue.",
-		 function );
-
-		return( -1 );
-	}
-	internal_queue = (libcthreads_internal_queue_t *) queue;
-
-	if( internal_queue->values_array == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid queue - missing values array.",
-		 function );
-
-		return( -1 );
 	}
-	if( libcthreads_mutex_grab(
+	if( libcthreads_mutex_release(
 	     internal_queue->condition_mutex,
 	     error ) != 1 )
 	{
@@ -381,41 +2642,27 @@ int libcthreads_queue_empty(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab condition mutex.",
+		 "%s: unable to release condition mutex.",
 		 function );
 
 		return( -1 );
 	}
-	while( internal_queue->number_of_values != 0 )
+	if( selector != NULL )
 	{
-		if( libcthreads_condition_wait(
-		     internal_queue->full_condition,
-		     internal_queue->condition_mutex,
+		if( libcthreads_internal_queue_selector_notify(
+		     selector,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to wait for full condition.",
+			 "%s: unable to notify queue selector.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	if( libcthreads_mutex_release(
-	     internal_queue->condition_mutex,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release condition mutex.",
-		 function );
-
-		return( -1 );
-	}
 	return( result );
 
 on_error:
@@ -426,16 +2673,18 @@ on_error:
 	return( -1 );
 }
 
-/* Tries to pop a value off the queue
+/* Tries to pop a value off a queue that stores values by copy
+ * The value is copied into the value buffer, which must be of the queue value size
  * Returns 1 if successful, 0 if not or -1 on error
  */
-int libcthreads_queue_try_pop(
+int libcthreads_queue_try_pop_value(
      libcthreads_queue_t *queue,
-     intptr_t **value,
+     uint8_t *value,
+     size_t value_size,
      libcerror_error_t **error )
 {
 	libcthreads_internal_queue_t *internal_queue = NULL;
-	static char *function                        = "libcthreads_queue_try_pop";
+	static char *function                        = "libcthreads_queue_try_pop_value";
 	int result                                   = 1;
 
 	if( queue == NULL )
@@ -451,13 +2700,13 @@ int libcthreads_queue_try_pop(
 	}
 	internal_queue = (libcthreads_internal_queue_t *) queue;
 
-	if( internal_queue->values_array == NULL )
+	if( internal_queue->values_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid queue - missing values array.",
+		 "%s: invalid queue - missing values data.",
 		 function );
 
 		return( -1 );
@@ -473,6 +2722,17 @@ int libcthreads_queue_try_pop(
 
 		return( -1 );
 	}
+	if( value_size != internal_queue->value_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcthreads_mutex_grab(
 	     internal_queue->condition_mutex,
 	     error ) != 1 )
@@ -492,27 +2752,41 @@ int libcthreads_queue_try_pop(
 	}
 	else
 	{
-		*value = internal_queue->values_array[ internal_queue->pop_index ];
+		if( memory_copy(
+		     value,
+		     &( internal_queue->values_data[ (size_t) internal_queue->pop_index * internal_queue->value_size ] ),
+		     internal_queue->value_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value.",
+			 function );
 
+			goto on_error;
+		}
 		internal_queue->pop_index++;
 
 		if( internal_queue->pop_index >= internal_queue->allocated_number_of_values )
 		{
 			internal_queue->pop_index = 0;
 		}
-		internal_queue->number_of_values--;
+		libcthreads_atomic_store_int(
+		 &( internal_queue->number_of_values ),
+		 internal_queue->number_of_values - 1 );
 
-		/* The condition broadcast must be protected by the mutex for the WINAPI version
+		/* The notification must be protected by the mutex for the WINAPI version
 		 */
-		if( libcthreads_condition_broadcast(
-		     internal_queue->full_condition,
+		if( libcthreads_internal_queue_notify_producers(
+		     internal_queue,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to broadcast full condition.",
+			 "%s: unable to notify producers.",
 			 function );
 
 			goto on_error;
@@ -541,16 +2815,20 @@ on_error:
 	return( -1 );
 }
 
-/* Pops a value off the queue
+/* Pops a value off a queue that stores values by copy
+ * The value is copied into the value buffer, which must be of the queue value size
  * Returns 1 if successful or -1 on error
  */
-int libcthreads_queue_pop(
+int libcthreads_queue_pop_value(
      libcthreads_queue_t *queue,
-     intptr_t **value,
+     uint8_t *value,
+     size_t value_size,
      libcerror_error_t **error )
 {
 	libcthreads_internal_queue_t *internal_queue = NULL;
-	static char *function                        = "libcthreads_queue_pop";
+	static char *function                        = "libcthreads_queue_pop_value";
+	int number_of_iterations                     = 0;
+	int spin_limit                               = 0;
 
 	if( queue == NULL )
 	{
@@ -565,13 +2843,13 @@ int libcthreads_queue_pop(
 	}
 	internal_queue = (libcthreads_internal_queue_t *) queue;
 
-	if( internal_queue->values_array == NULL )
+	if( internal_queue->values_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid queue - missing values array.",
+		 "%s: invalid queue - missing values data.",
 		 function );
 
 		return( -1 );
@@ -587,6 +2865,17 @@ int libcthreads_queue_pop(
 
 		return( -1 );
 	}
+	if( value_size != internal_queue->value_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcthreads_mutex_grab(
 	     internal_queue->condition_mutex,
 	     error ) != 1 )
@@ -600,10 +2889,16 @@ int libcthreads_queue_pop(
 
 		return( -1 );
 	}
-	while( internal_queue->number_of_values == 0 )
+	if( ( internal_queue->number_of_values == 0 )
+	 && ( internal_queue->spin_wait.maximum_spin_count > 0 ) )
 	{
-		if( libcthreads_condition_wait(
-		     internal_queue->empty_condition,
+		/* Spin without holding the mutex so that a producer can hand off a value
+		 * without the cost of parking and waking up the thread
+		 */
+		spin_limit = libcthreads_spin_wait_get_limit(
+		              &( internal_queue->spin_wait ) );
+
+		if( libcthreads_mutex_release(
 		     internal_queue->condition_mutex,
 		     error ) != 1 )
 		{
@@ -611,151 +2906,103 @@ int libcthreads_queue_pop(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to wait for empty condition.",
+			 "%s: unable to release condition mutex.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-	}
-	*value = internal_queue->values_array[ internal_queue->pop_index ];
-
-	internal_queue->pop_index++;
-
-	if( internal_queue->pop_index >= internal_queue->allocated_number_of_values )
-	{
-		internal_queue->pop_index = 0;
-	}
-	internal_queue->number_of_values--;
+		number_of_iterations = libcthreads_spin_wait_while_zero(
+		                        &( internal_queue->number_of_values ),
+		                        spin_limit );
 
-	/* The condition broadcast must be protected by the mutex for the WINAPI version
-	 */
-	if( libcthreads_condition_broadcast(
-	     internal_queue->full_condition,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to broadcast full condition.",
-		 function );
+		if( libcthreads_mutex_grab(
+		     internal_queue->condition_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab condition mutex.",
+			 function );
 
-		goto on_error;
-	}
-	if( libcthreads_mutex_release(
-	     internal_queue->condition_mutex,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release condition mutex.",
-		 function );
+			return( -1 );
+		}
+		libcthreads_spin_wait_update(
+		 &( internal_queue->spin_wait ),
+		 number_of_iterations );
 
-		return( -1 );
+		if( internal_queue->number_of_values != 0 )
+		{
+			libcthreads_striped_counter_add(
+			 internal_queue->number_of_spin_hits,
+			 1,
+			 NULL );
+		}
 	}
-	return( 1 );
-
-on_error:
-	libcthreads_mutex_release(
-	 internal_queue->condition_mutex,
-	 NULL );
-
-	return( -1 );
-}
-
-/* Tries to push a value onto the queue
- * Returns 1 if successful, 0 if not or -1 on error
- */
-int libcthreads_queue_try_push(
-     libcthreads_queue_t *queue,
-     intptr_t *value,
-     libcerror_error_t **error )
-{
-	libcthreads_internal_queue_t *internal_queue = NULL;
-	static char *function                        = "libcthreads_queue_try_push";
-	int result                                   = 1;
-
-	if( queue == NULL )
+	if( internal_queue->number_of_values == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid queue.",
-		 function );
-
-		return( -1 );
+		libcthreads_striped_counter_add(
+		 internal_queue->number_of_parks,
+		 1,
+		 NULL );
 	}
-	internal_queue = (libcthreads_internal_queue_t *) queue;
-
-	if( internal_queue->values_array == NULL )
+	while( internal_queue->number_of_values == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid queue - missing values array.",
-		 function );
+		if( libcthreads_internal_queue_wait(
+		     internal_queue,
+		     internal_queue->empty_condition,
+		     &( internal_queue->number_of_empty_waiters ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to wait for empty condition.",
+			 function );
 
-		return( -1 );
+			goto on_error;
+		}
 	}
-	if( value == NULL )
+	if( memory_copy(
+	     value,
+	     &( internal_queue->values_data[ (size_t) internal_queue->pop_index * internal_queue->value_size ] ),
+	     internal_queue->value_size ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy value.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libcthreads_mutex_grab(
-	     internal_queue->condition_mutex,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab condition mutex.",
-		 function );
+	internal_queue->pop_index++;
 
-		return( -1 );
-	}
-	if( internal_queue->number_of_values == internal_queue->allocated_number_of_values )
-	{
-		result = 0;
-	}
-	else
+	if( internal_queue->pop_index >= internal_queue->allocated_number_of_values )
 	{
-		internal_queue->values_array[ internal_queue->push_index ] = value;
-
-		internal_queue->push_index++;
-
-		if( internal_queue->push_index >= internal_queue->allocated_number_of_values )
-		{
-			internal_queue->push_index = 0;
-		}
-		internal_queue->number_of_values++;
-
-		/* The condition broadcast must be protected by the mutex for the WINAPI version
-		 */
-		if( libcthreads_condition_broadcast(
-		     internal_queue->empty_condition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to broadcast empty condition.",
-			 function );
+		internal_queue->pop_index = 0;
+	}
+	libcthreads_atomic_store_int(
+	 &( internal_queue->number_of_values ),
+	 internal_queue->number_of_values - 1 );
 
-			goto on_error;
-		}
+	/* The notification must be protected by the mutex for the WINAPI version
+	 */
+	if( libcthreads_internal_queue_notify_producers(
+	     internal_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to notify producers.",
+		 function );
+
+		goto on_error;
 	}
 	if( libcthreads_mutex_release(
 	     internal_queue->condition_mutex,
@@ -770,7 +3017,7 @@ int libcthreads_queue_try_push(
 
 		return( -1 );
 	}
-	return( result );
+	return( 1 );
 
 on_error:
 	libcthreads_mutex_release(
@@ -780,16 +3027,20 @@ on_error:
 	return( -1 );
 }
 
-/* Pushes a value onto the queue
- * Returns 1 if successful or -1 on error
+/* Tries to push a value onto a queue that stores values by copy
+ * The value is copied from the value buffer, which must be of the queue value size
+ * Returns 1 if successful, 0 if not or -1 on error
  */
-int libcthreads_queue_push(
+int libcthreads_queue_try_push_value(
      libcthreads_queue_t *queue,
-     intptr_t *value,
+     const uint8_t *value,
+     size_t value_size,
      libcerror_error_t **error )
 {
 	libcthreads_internal_queue_t *internal_queue = NULL;
-	static char *function                        = "libcthreads_queue_push";
+	libcthreads_queue_selector_t *selector       = NULL;
+	static char *function                        = "libcthreads_queue_try_push_value";
+	int result                                   = 1;
 
 	if( queue == NULL )
 	{
@@ -804,13 +3055,13 @@ int libcthreads_queue_push(
 	}
 	internal_queue = (libcthreads_internal_queue_t *) queue;
 
-	if( internal_queue->values_array == NULL )
+	if( internal_queue->values_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid queue - missing values array.",
+		 "%s: invalid queue - missing values data.",
 		 function );
 
 		return( -1 );
@@ -826,6 +3077,17 @@ int libcthreads_queue_push(
 
 		return( -1 );
 	}
+	if( value_size != internal_queue->value_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcthreads_mutex_grab(
 	     internal_queue->condition_mutex,
 	     error ) != 1 )
@@ -839,47 +3101,53 @@ int libcthreads_queue_push(
 
 		return( -1 );
 	}
-	while( internal_queue->number_of_values == internal_queue->allocated_number_of_values )
+	if( internal_queue->number_of_values == internal_queue->allocated_number_of_values )
 	{
-		if( libcthreads_condition_wait(
-		     internal_queue->full_condition,
-		     internal_queue->condition_mutex,
-		     error ) != 1 )
+		result = 0;
+	}
+	else
+	{
+		if( memory_copy(
+		     &( internal_queue->values_data[ (size_t) internal_queue->push_index * internal_queue->value_size ] ),
+		     value,
+		     internal_queue->value_size ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to wait for full condition.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value.",
 			 function );
 
 			goto on_error;
 		}
-	}
-	internal_queue->values_array[ internal_queue->push_index ] = value;
+		internal_queue->push_index++;
 
-	internal_queue->push_index++;
+		if( internal_queue->push_index >= internal_queue->allocated_number_of_values )
+		{
+			internal_queue->push_index = 0;
+		}
+		libcthreads_atomic_store_int(
+		 &( internal_queue->number_of_values ),
+		 internal_queue->number_of_values + 1 );
 
-	if( internal_queue->push_index >= internal_queue->allocated_number_of_values )
-	{
-		internal_queue->push_index = 0;
-	}
-	internal_queue->number_of_values++;
+		selector = internal_queue->selector;
 
-	/* The condition broadcast must be protected by the mutex for the WINAPI version
-	 */
-	if( libcthreads_condition_broadcast(
-	     internal_queue->empty_condition,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to broadcast empty condition.",
-		 function );
+		/* The notification must be protected by the mutex for the WINAPI version
+		 */
+		if( libcthreads_internal_queue_notify_consumer(
+		     internal_queue,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to notify consumer.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
 	if( libcthreads_mutex_release(
 	     internal_queue->condition_mutex,
@@ -894,7 +3162,23 @@ int libcthreads_queue_push(
 
 		return( -1 );
 	}
-	return( 1 );
+	if( selector != NULL )
+	{
+		if( libcthreads_internal_queue_selector_notify(
+		     selector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to notify queue selector.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
 
 on_error:
 	libcthreads_mutex_release(
@@ -904,32 +3188,19 @@ on_error:
 	return( -1 );
 }
 
-/* Pushes a value onto the queue in sorted order
- *
- * Uses the value_compare_function to determine the similarity of the values
- * The value_compare_function should return LIBCTHREADS_COMPARE_LESS,
- * LIBCTHREADS_COMPARE_EQUAL, LIBCTHREADS_COMPARE_GREATER if successful or -1 on error
- *
- * Returns 1 if successful, 0 if the value already exists or -1 on error
+/* Pushes a value onto a queue that stores values by copy
+ * The value is copied from the value buffer, which must be of the queue value size
+ * Returns 1 if successful or -1 on error
  */
-int libcthreads_queue_push_sorted(
+int libcthreads_queue_push_value(
      libcthreads_queue_t *queue,
-     intptr_t *value,
-     int (*value_compare_function)(
-            intptr_t *first_value,
-            intptr_t *second_value,
-            libcerror_error_t **error ),
-     uint8_t sort_flags,
+     const uint8_t *value,
+     size_t value_size,
      libcerror_error_t **error )
 {
 	libcthreads_internal_queue_t *internal_queue = NULL;
-	static char *function                        = "libcthreads_queue_push_sorted";
-	int compare_result                           = 0;
-	int pop_index                                = 0;
-	int previous_push_index                      = 0;
-	int push_index                               = 0;
-	int result                                   = 1;
-	int value_index                              = 0;
+	libcthreads_queue_selector_t *selector       = NULL;
+	static char *function                        = "libcthreads_queue_push_value";
 
 	if( queue == NULL )
 	{
@@ -944,13 +3215,13 @@ int libcthreads_queue_push_sorted(
 	}
 	internal_queue = (libcthreads_internal_queue_t *) queue;
 
-	if( internal_queue->values_array == NULL )
+	if( internal_queue->values_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid queue - missing values array.",
+		 "%s: invalid queue - missing values data.",
 		 function );
 
 		return( -1 );
@@ -966,29 +3237,17 @@ int libcthreads_queue_push_sorted(
 
 		return( -1 );
 	}
-	if( value_compare_function == NULL )
+	if( value_size != internal_queue->value_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value compare function.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( sort_flags & ~( LIBCTHREADS_SORT_FLAG_UNIQUE_VALUES ) ) != 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported sort flags: 0x%02" PRIx8 ".",
-		 function,
-		 sort_flags );
-
-		return( -1 );
-	}
 	if( libcthreads_mutex_grab(
 	     internal_queue->condition_mutex,
 	     error ) != 1 )
@@ -1004,9 +3263,10 @@ int libcthreads_queue_push_sorted(
 	}
 	while( internal_queue->number_of_values == internal_queue->allocated_number_of_values )
 	{
-		if( libcthreads_condition_wait(
+		if( libcthreads_internal_queue_wait(
+		     internal_queue,
 		     internal_queue->full_condition,
-		     internal_queue->condition_mutex,
+		     &( internal_queue->number_of_full_waiters ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1019,109 +3279,46 @@ int libcthreads_queue_push_sorted(
 			goto on_error;
 		}
 	}
-	pop_index = internal_queue->pop_index;
-
-	for( value_index = 0;
-	     value_index < internal_queue->number_of_values;
-	     value_index++ )
+	if( memory_copy(
+	     &( internal_queue->values_data[ (size_t) internal_queue->push_index * internal_queue->value_size ] ),
+	     value,
+	     internal_queue->value_size ) == NULL )
 	{
-		compare_result = value_compare_function(
-		                  value,
-		                  internal_queue->values_array[ pop_index ],
-		                  error );
-
-		if( compare_result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to compare value: %d.",
-			 function,
-			 value_index );
-
-			goto on_error;
-		}
-		else if( compare_result == LIBCTHREADS_COMPARE_EQUAL )
-		{
-			if( ( sort_flags & LIBCTHREADS_SORT_FLAG_UNIQUE_VALUES ) != 0 )
-			{
-				result = 0;
-
-				break;
-			}
-		}
-		else if( compare_result == LIBCTHREADS_COMPARE_LESS )
-		{
-			result = 1;
-
-			break;
-		}
-		else if( compare_result != LIBCTHREADS_COMPARE_GREATER )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported value compare function return value: %d.",
-			 function,
-			 compare_result );
-
-			goto on_error;
-		}
-		pop_index++;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy value.",
+		 function );
 
-		if( pop_index >= internal_queue->allocated_number_of_values )
-		{
-			pop_index = 0;
-		}
+		goto on_error;
 	}
-	if( result != 0 )
-	{
-		push_index = internal_queue->push_index;
-
-		if( compare_result == LIBCTHREADS_COMPARE_LESS )
-		{
-			previous_push_index = push_index - 1;
-
-			while( push_index != pop_index )
-			{
-				if( previous_push_index < 0 )
-				{
-					previous_push_index = internal_queue->allocated_number_of_values - 1;
-				}
-				internal_queue->values_array[ push_index ] = internal_queue->values_array[ previous_push_index ];
-
-				push_index = previous_push_index;
-
-				previous_push_index--;
-			}
-		}
-		internal_queue->values_array[ push_index ] = value;
+	internal_queue->push_index++;
 
-		internal_queue->push_index++;
+	if( internal_queue->push_index >= internal_queue->allocated_number_of_values )
+	{
+		internal_queue->push_index = 0;
+	}
+	libcthreads_atomic_store_int(
+	 &( internal_queue->number_of_values ),
+	 internal_queue->number_of_values + 1 );
 
-		if( internal_queue->push_index >= internal_queue->allocated_number_of_values )
-		{
-			internal_queue->push_index = 0;
-		}
-		internal_queue->number_of_values++;
+	selector = internal_queue->selector;
 
-		/* The condition broadcast must be protected by the mutex for the WINAPI version
-		 */
-		if( libcthreads_condition_broadcast(
-		     internal_queue->empty_condition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to broadcast empty condition.",
-			 function );
+	/* The notification must be protected by the mutex for the WINAPI version
+	 */
+	if( libcthreads_internal_queue_notify_consumer(
+	     internal_queue,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to notify consumer.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
 	if( libcthreads_mutex_release(
 	     internal_queue->condition_mutex,
@@ -1136,7 +3333,23 @@ int libcthreads_queue_push_sorted(
 
 		return( -1 );
 	}
-	return( result );
+	if( selector != NULL )
+	{
+		if( libcthreads_internal_queue_selector_notify(
+		     selector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to notify queue selector.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
 
 on_error:
 	libcthreads_mutex_release(
@@ -1146,5 +3359,6 @@ on_error:
 	return( -1 );
 }
 
+
 #endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
@@ -25,8 +25,11 @@
 #include <common.h>
 #include <types.h>
 
+#include "libcthreads_definitions.h"
 #include "libcthreads_extern.h"
 #include "libcthreads_libcerror.h"
+#include "libcthreads_spin_wait.h"
+#include "libcthreads_striped_counter.h"
 #include "libcthreads_types.h"
 
 #if defined( __cplusplus )
@@ -39,25 +42,29 @@ typedef struct libcthreads_internal_queue libcthreads_internal_queue_t;
 
 struct libcthreads_internal_queue
 {
-	/* The (current) pop index
+	/* The allocated number of values
 	 */
-	int pop_index;
+	int allocated_number_of_values;
 
-	/* The (current) push index
+	/* The values array
 	 */
-	int push_index;
+	intptr_t **values_array;
 
-	/* The number of values
+	/* The weights array, which contains the weight per value
 	 */
-	int number_of_values;
+	size_t *weights_array;
 
-	/* The allocated number of values
+	/* The maximum weight, which is 0 if the weight of the queue is not limited
 	 */
-	int allocated_number_of_values;
+	size_t maximum_weight;
 
-	/* The values array
+	/* The value size, which is 0 if the queue stores value references
 	 */
-	intptr_t **values_array;
+	size_t value_size;
+
+	/* The values data, which contains the values stored by copy
+	 */
+	uint8_t *values_data;
 
 	/* The condition mutex
 	 */
@@ -70,6 +77,77 @@ struct libcthreads_internal_queue
 	/* The queue full condition
 	 */
 	libcthreads_condition_t *full_condition;
+
+	/* The queue selector, which is notified when a value is pushed onto the queue
+	 */
+	libcthreads_queue_selector_t *selector;
+
+	/* The number of consumer waits that were satisfied while spinning
+	 * The statistics are striped counters since every thread updates them
+	 */
+	libcthreads_striped_counter_t *number_of_spin_hits;
+
+	/* The number of consumer waits that parked on the empty condition
+	 */
+	libcthreads_striped_counter_t *number_of_parks;
+
+	/* The number of condition notifications
+	 */
+	libcthreads_striped_counter_t *number_of_notifications;
+
+	/* The number of wake ups from a condition wait
+	 */
+	libcthreads_striped_counter_t *number_of_wake_ups;
+
+	/* The padding that separates the read-mostly state from the shared state
+	 */
+	uint8_t read_mostly_padding[ LIBCTHREADS_CACHE_LINE_SIZE ];
+
+	/* The number of values
+	 * The value is modified with atomic stores while holding the condition mutex
+	 * since spinning consumers read it without holding the condition mutex
+	 */
+	int number_of_values;
+
+	/* The current weight, which is the sum of the weights of the values in the queue
+	 */
+	size_t current_weight;
+
+	/* The padding that separates the shared state from the consumer state
+	 */
+	uint8_t shared_padding[ LIBCTHREADS_CACHE_LINE_SIZE ];
+
+	/* The (current) pop index
+	 */
+	int pop_index;
+
+	/* The number of consumers waiting on the empty condition
+	 */
+	int number_of_empty_waiters;
+
+	/* The adaptive spin wait state of the consumers
+	 */
+	libcthreads_spin_wait_t spin_wait;
+
+	/* The padding that separates the consumer state from the producer state
+	 */
+	uint8_t consumer_padding[ LIBCTHREADS_CACHE_LINE_SIZE ];
+
+	/* The (current) push index
+	 */
+	int push_index;
+
+	/* The number of producers waiting on the full condition
+	 */
+	int number_of_full_waiters;
+
+	/* The number of threads waiting on the full condition for the queue to become empty
+	 */
+	int number_of_empty_queue_waiters;
+
+	/* The padding that separates the producer state from adjacent allocations
+	 */
+	uint8_t producer_padding[ LIBCTHREADS_CACHE_LINE_SIZE ];
 };
 
 LIBCTHREADS_EXTERN \
@@ -78,6 +156,13 @@ int libcthreads_queue_initialize(
      int maximum_number_of_values,
      libcerror_error_t **error );
 
+LIBCTHREADS_EXTERN \
+int libcthreads_queue_initialize_with_value_size(
+     libcthreads_queue_t **queue,
+     int maximum_number_of_values,
+     size_t value_size,
+     libcerror_error_t **error );
+
 LIBCTHREADS_EXTERN \
 int libcthreads_queue_free(
      libcthreads_queue_t **queue,
@@ -86,6 +171,33 @@ int libcthreads_queue_free(
             libcerror_error_t **error ),
      libcerror_error_t **error );
 
+LIBCTHREADS_EXTERN \
+int libcthreads_queue_set_maximum_weight(
+     libcthreads_queue_t *queue,
+     size_t maximum_weight,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_queue_set_maximum_spin_count(
+     libcthreads_queue_t *queue,
+     int maximum_spin_count,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_queue_get_wait_statistics(
+     libcthreads_queue_t *queue,
+     uint64_t *number_of_spin_hits,
+     uint64_t *number_of_parks,
+     int *spin_count,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_queue_get_notify_statistics(
+     libcthreads_queue_t *queue,
+     uint64_t *number_of_notifications,
+     uint64_t *number_of_wake_ups,
+     libcerror_error_t **error );
+
 LIBCTHREADS_EXTERN \
 int libcthreads_queue_empty(
      libcthreads_queue_t *queue,
@@ -115,6 +227,20 @@ int libcthreads_queue_push(
      intptr_t *value,
      libcerror_error_t **error );
 
+LIBCTHREADS_EXTERN \
+int libcthreads_queue_try_push_with_weight(
+     libcthreads_queue_t *queue,
+     intptr_t *value,
+     size_t weight,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_queue_push_with_weight(
+     libcthreads_queue_t *queue,
+     intptr_t *value,
+     size_t weight,
+     libcerror_error_t **error );
+
 LIBCTHREADS_EXTERN \
 int libcthreads_queue_push_sorted(
      libcthreads_queue_t *queue,
@@ -126,6 +252,34 @@ int libcthreads_queue_push_sorted(
      uint8_t sort_flags,
      libcerror_error_t **error );
 
+LIBCTHREADS_EXTERN \
+int libcthreads_queue_try_pop_value(
+     libcthreads_queue_t *queue,
+     uint8_t *value,
+     size_t value_size,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_queue_pop_value(
+     libcthreads_queue_t *queue,
+     uint8_t *value,
+     size_t value_size,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_queue_try_push_value(
+     libcthreads_queue_t *queue,
+     const uint8_t *value,
+     size_t value_size,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_queue_push_value(
+     libcthreads_queue_t *queue,
+     const uint8_t *value,
+     size_t value_size,
+     libcerror_error_t **error );
+
 #endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
 #if defined( __cplusplus )
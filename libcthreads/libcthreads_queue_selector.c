@@ -0,0 +1,946 @@
+/*
+ * Queue selector functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcthreads_condition.h"
+#include "libcthreads_definitions.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_mutex.h"
+#include "libcthreads_queue.h"
+#include "libcthreads_queue_selector.h"
+#include "libcthreads_types.h"
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The number of queues the queues array is resized by
+ */
+#define LIBCTHREADS_QUEUE_SELECTOR_QUEUES_ARRAY_INCREMENT	8
+
+/* Creates a queue selector
+ * A queue selector allows to wait for values on multiple queues at once
+ * Make sure the value selector is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_queue_selector_initialize(
+     libcthreads_queue_selector_t **selector,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_queue_selector_t *internal_selector = NULL;
+	static char *function                                    = "libcthreads_queue_selector_initialize";
+
+	if( selector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid selector.",
+		 function );
+
+		return( -1 );
+	}
+	if( *selector != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid selector value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBCTHREADS_QUEUE_SELECTOR_FLAG_PRIORITY ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	internal_selector = memory_allocate_structure(
+	                     libcthreads_internal_queue_selector_t );
+
+	if( internal_selector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create selector.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_selector,
+	     0,
+	     sizeof( libcthreads_internal_queue_selector_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear selector.",
+		 function );
+
+		memory_free(
+		 internal_selector );
+
+		return( -1 );
+	}
+	internal_selector->flags = flags;
+
+	if( libcthreads_mutex_initialize(
+	     &( internal_selector->condition_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( internal_selector->notify_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create notify condition.",
+		 function );
+
+		goto on_error;
+	}
+	*selector = (libcthreads_queue_selector_t *) internal_selector;
+
+	return( 1 );
+
+on_error:
+	if( internal_selector != NULL )
+	{
+		if( internal_selector->condition_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_selector->condition_mutex ),
+			 NULL );
+		}
+		memory_free(
+		 internal_selector );
+	}
+	return( -1 );
+}
+
+/* Frees a queue selector
+ * The queues are detached from the selector but not freed
+ * The queues should not be pushed onto while the selector is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_queue_selector_free(
+     libcthreads_queue_selector_t **selector,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_queue_t *internal_queue             = NULL;
+	libcthreads_internal_queue_selector_t *internal_selector = NULL;
+	static char *function                                    = "libcthreads_queue_selector_free";
+	int queue_index                                          = 0;
+	int result                                               = 1;
+
+	if( selector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid selector.",
+		 function );
+
+		return( -1 );
+	}
+	if( *selector != NULL )
+	{
+		internal_selector = (libcthreads_internal_queue_selector_t *) *selector;
+		*selector         = NULL;
+
+		for( queue_index = 0;
+		     queue_index < internal_selector->number_of_queues;
+		     queue_index++ )
+		{
+			internal_queue = (libcthreads_internal_queue_t *) internal_selector->queues_array[ queue_index ];
+
+			if( libcthreads_mutex_grab(
+			     internal_queue->condition_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab condition mutex of queue: %d.",
+				 function,
+				 queue_index );
+
+				result = -1;
+
+				continue;
+			}
+			internal_queue->selector = NULL;
+
+			if( libcthreads_mutex_release(
+			     internal_queue->condition_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release condition mutex of queue: %d.",
+				 function,
+				 queue_index );
+
+				result = -1;
+			}
+		}
+		if( internal_selector->queues_array != NULL )
+		{
+			memory_free(
+			 internal_selector->queues_array );
+		}
+		if( libcthreads_condition_free(
+		     &( internal_selector->notify_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free notify condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_selector->condition_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free condition mutex.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_selector );
+	}
+	return( result );
+}
+
+/* Appends a queue to the selector
+ * A queue can only be appended to a single selector and must store value references
+ * The queue index represents the priority of the queue when LIBCTHREADS_QUEUE_SELECTOR_FLAG_PRIORITY is set
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_queue_selector_append_queue(
+     libcthreads_queue_selector_t *selector,
+     libcthreads_queue_t *queue,
+     int *queue_index,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_queue_t *internal_queue             = NULL;
+	libcthreads_internal_queue_selector_t *internal_selector = NULL;
+	libcthreads_queue_t **queues_array                       = NULL;
+	static char *function                                    = "libcthreads_queue_selector_append_queue";
+	size_t queues_array_size                                 = 0;
+	int allocated_number_of_queues                           = 0;
+
+	if( selector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid selector.",
+		 function );
+
+		return( -1 );
+	}
+	internal_selector = (libcthreads_internal_queue_selector_t *) selector;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	internal_queue = (libcthreads_internal_queue_t *) queue;
+
+	if( internal_queue->value_size != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid queue - unsupported queue that stores values by copy.",
+		 function );
+
+		return( -1 );
+	}
+	if( queue_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_selector->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_selector->number_of_queues >= internal_selector->allocated_number_of_queues )
+	{
+		if( internal_selector->allocated_number_of_queues > ( INT_MAX - LIBCTHREADS_QUEUE_SELECTOR_QUEUES_ARRAY_INCREMENT ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid selector - allocated number of queues value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		allocated_number_of_queues = internal_selector->allocated_number_of_queues + LIBCTHREADS_QUEUE_SELECTOR_QUEUES_ARRAY_INCREMENT;
+
+		queues_array_size = sizeof( libcthreads_queue_t * ) * allocated_number_of_queues;
+
+		queues_array = (libcthreads_queue_t **) memory_reallocate(
+		                                         internal_selector->queues_array,
+		                                         queues_array_size );
+
+		if( queues_array == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize queues array.",
+			 function );
+
+			goto on_error;
+		}
+		internal_selector->queues_array               = queues_array;
+		internal_selector->allocated_number_of_queues = allocated_number_of_queues;
+	}
+	/* The selector condition mutex is grabbed before the queue condition mutex
+	 * to prevent a deadlock with libcthreads_queue_selector_try_pop
+	 */
+	if( libcthreads_mutex_grab(
+	     internal_queue->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab queue condition mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_queue->selector != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid queue - selector value already set.",
+		 function );
+
+		libcthreads_mutex_release(
+		 internal_queue->condition_mutex,
+		 NULL );
+
+		goto on_error;
+	}
+	internal_queue->selector = selector;
+
+	if( libcthreads_mutex_release(
+	     internal_queue->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release queue condition mutex.",
+		 function );
+
+		goto on_error;
+	}
+	*queue_index = internal_selector->number_of_queues;
+
+	internal_selector->queues_array[ internal_selector->number_of_queues ] = queue;
+
+	internal_selector->number_of_queues++;
+
+	/* Values could have been pushed onto the queue before it was appended
+	 */
+	if( internal_selector->number_of_waiters > 0 )
+	{
+		if( libcthreads_condition_broadcast(
+		     internal_selector->notify_condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast notify condition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     internal_selector->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	libcthreads_mutex_release(
+	 internal_selector->condition_mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Removes a queue from the selector
+ * This function is called when a queue that is attached to the selector is freed
+ * The indexes of the queues appended after the removed queue are decremented
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_internal_queue_selector_remove_queue(
+     libcthreads_queue_selector_t *selector,
+     libcthreads_queue_t *queue,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_queue_selector_t *internal_selector = NULL;
+	static char *function                                    = "libcthreads_internal_queue_selector_remove_queue";
+	int queue_index                                          = 0;
+
+	if( selector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid selector.",
+		 function );
+
+		return( -1 );
+	}
+	internal_selector = (libcthreads_internal_queue_selector_t *) selector;
+
+	if( queue == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_selector->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	for( queue_index = 0;
+	     queue_index < internal_selector->number_of_queues;
+	     queue_index++ )
+	{
+		if( internal_selector->queues_array[ queue_index ] == queue )
+		{
+			break;
+		}
+	}
+	if( queue_index < internal_selector->number_of_queues )
+	{
+		internal_selector->number_of_queues--;
+
+		while( queue_index < internal_selector->number_of_queues )
+		{
+			internal_selector->queues_array[ queue_index ] = internal_selector->queues_array[ queue_index + 1 ];
+
+			queue_index++;
+		}
+		internal_selector->queues_array[ queue_index ] = NULL;
+
+		if( internal_selector->next_queue_index >= internal_selector->number_of_queues )
+		{
+			internal_selector->next_queue_index = 0;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     internal_selector->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Notifies the selector that a value was pushed onto one of its queues
+ * This function is called by the queue after it released its condition mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_internal_queue_selector_notify(
+     libcthreads_queue_selector_t *selector,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_queue_selector_t *internal_selector = NULL;
+	static char *function                                    = "libcthreads_internal_queue_selector_notify";
+
+	if( selector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid selector.",
+		 function );
+
+		return( -1 );
+	}
+	internal_selector = (libcthreads_internal_queue_selector_t *) selector;
+
+	if( libcthreads_mutex_grab(
+	     internal_selector->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	/* Since a single value was pushed, waking up a single consumer suffices
+	 * The condition signal must be protected by the mutex for the WINAPI version
+	 */
+	if( internal_selector->number_of_waiters > 0 )
+	{
+		if( libcthreads_condition_signal(
+		     internal_selector->notify_condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal notify condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 internal_selector->condition_mutex,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( libcthreads_mutex_release(
+	     internal_selector->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tries to pop a value off one of the queues of the selector
+ * The selector condition mutex must be held by the caller
+ * Returns 1 if successful, 0 if all queues are empty or -1 on error
+ */
+static int libcthreads_internal_queue_selector_pop_locked(
+            libcthreads_internal_queue_selector_t *internal_selector,
+            int *queue_index,
+            intptr_t **value,
+            libcerror_error_t **error )
+{
+	static char *function = "libcthreads_internal_queue_selector_pop_locked";
+	int first_queue_index = 0;
+	int queue_iterator    = 0;
+	int result            = 0;
+	int safe_queue_index  = 0;
+
+	if( ( internal_selector->flags & LIBCTHREADS_QUEUE_SELECTOR_FLAG_PRIORITY ) == 0 )
+	{
+		first_queue_index = internal_selector->next_queue_index;
+	}
+	for( queue_iterator = 0;
+	     queue_iterator < internal_selector->number_of_queues;
+	     queue_iterator++ )
+	{
+		safe_queue_index = ( first_queue_index + queue_iterator ) % internal_selector->number_of_queues;
+
+		result = libcthreads_queue_try_pop(
+		          internal_selector->queues_array[ safe_queue_index ],
+		          value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop value off queue: %d.",
+			 function,
+			 safe_queue_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			internal_selector->next_queue_index = ( safe_queue_index + 1 ) % internal_selector->number_of_queues;
+
+			*queue_index = safe_queue_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Tries to pop a value off one of the queues of the selector
+ * By default the queues are selected in round-robin order
+ * If LIBCTHREADS_QUEUE_SELECTOR_FLAG_PRIORITY is set the first queue that contains a value is selected
+ * Returns 1 if successful, 0 if all queues are empty or -1 on error
+ */
+int libcthreads_queue_selector_try_pop(
+     libcthreads_queue_selector_t *selector,
+     int *queue_index,
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_queue_selector_t *internal_selector = NULL;
+	static char *function                                    = "libcthreads_queue_selector_try_pop";
+	int result                                               = 0;
+
+	if( selector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid selector.",
+		 function );
+
+		return( -1 );
+	}
+	internal_selector = (libcthreads_internal_queue_selector_t *) selector;
+
+	if( queue_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue index.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_selector->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	result = libcthreads_internal_queue_selector_pop_locked(
+	          internal_selector,
+	          queue_index,
+	          value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to pop value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_release(
+	     internal_selector->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	libcthreads_mutex_release(
+	 internal_selector->condition_mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Pops a value off one of the queues of the selector
+ * This function blocks, without consuming CPU time, until a value is pushed onto one of the queues
+ * By default the queues are selected in round-robin order
+ * If LIBCTHREADS_QUEUE_SELECTOR_FLAG_PRIORITY is set the first queue that contains a value is selected
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_queue_selector_pop(
+     libcthreads_queue_selector_t *selector,
+     int *queue_index,
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_queue_selector_t *internal_selector = NULL;
+	static char *function                                    = "libcthreads_queue_selector_pop";
+	int result                                               = 0;
+
+	if( selector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid selector.",
+		 function );
+
+		return( -1 );
+	}
+	internal_selector = (libcthreads_internal_queue_selector_t *) selector;
+
+	if( queue_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue index.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_selector->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	/* The queues notify the selector after releasing their condition mutex
+	 * A value pushed after the queues were checked therefore results in a signal
+	 * that is received by the wait below
+	 */
+	do
+	{
+		result = libcthreads_internal_queue_selector_pop_locked(
+		          internal_selector,
+		          queue_index,
+		          value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop value.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			internal_selector->number_of_waiters += 1;
+
+			result = libcthreads_condition_wait(
+			          internal_selector->notify_condition,
+			          internal_selector->condition_mutex,
+			          error );
+
+			internal_selector->number_of_waiters -= 1;
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to wait for notify condition.",
+				 function );
+
+				goto on_error;
+			}
+			/* Check the queues again after the wake up
+			 */
+			result = 0;
+		}
+	}
+	while( result == 0 );
+
+	if( libcthreads_mutex_release(
+	     internal_selector->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	libcthreads_mutex_release(
+	 internal_selector->condition_mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,123 @@
+/*
+ * Queue selector functions
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_QUEUE_SELECTOR_H )
+#define _LIBCTHREADS_INTERNAL_QUEUE_SELECTOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcthreads_extern.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct libcthreads_internal_queue_selector libcthreads_internal_queue_selector_t;
+
+struct libcthreads_internal_queue_selector
+{
+	/* The number of queues
+	 */
+	int number_of_queues;
+
+	/* The allocated number of queues
+	 */
+	int allocated_number_of_queues;
+
+	/* The queues array
+	 */
+	libcthreads_queue_t **queues_array;
+
+	/* The index of the queue to select first in round-robin order
+	 */
+	int next_queue_index;
+
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The condition mutex
+	 */
+	libcthreads_mutex_t *condition_mutex;
+
+	/* The notify condition, which is signalled when a value is pushed onto one of the queues
+	 */
+	libcthreads_condition_t *notify_condition;
+
+	/* The number of consumers waiting on the notify condition
+	 */
+	int number_of_waiters;
+};
+
+LIBCTHREADS_EXTERN \
+int libcthreads_queue_selector_initialize(
+     libcthreads_queue_selector_t **selector,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_queue_selector_free(
+     libcthreads_queue_selector_t **selector,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_queue_selector_append_queue(
+     libcthreads_queue_selector_t *selector,
+     libcthreads_queue_t *queue,
+     int *queue_index,
+     libcerror_error_t **error );
+
+int libcthreads_internal_queue_selector_remove_queue(
+     libcthreads_queue_selector_t *selector,
+     libcthreads_queue_t *queue,
+     libcerror_error_t **error );
+
+int libcthreads_internal_queue_selector_notify(
+     libcthreads_queue_selector_t *selector,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_queue_selector_try_pop(
+     libcthreads_queue_selector_t *selector,
+     int *queue_index,
+     intptr_t **value,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_queue_selector_pop(
+     libcthreads_queue_selector_t *selector,
+     int *queue_index,
+     intptr_t **value,
+     libcerror_error_t **error );
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCTHREADS_INTERNAL_QUEUE_SELECTOR_H ) */
+
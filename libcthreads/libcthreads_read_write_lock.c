@@ -33,137 +33,303 @@
 #include <pthread.h>
 #endif
 
+#if ( defined( HAVE_CLOCK_GETTIME ) || defined( HAVE_NANOSLEEP ) ) && !defined( WINAPI )
+#include <time.h>
+#endif
+
+#if !defined( HAVE_NANOSLEEP ) && defined( HAVE_SCHED_H ) && !defined( WINAPI )
+#include <sched.h>
+#endif
+
+#include "libcthreads_atomic.h"
+#include "libcthreads_clock.h"
+#include "libcthreads_definitions.h"
 #include "libcthreads_libcerror.h"
+#include "libcthreads_light_mutex.h"
+#include "libcthreads_profile.h"
 #include "libcthreads_read_write_lock.h"
 #include "libcthreads_types.h"
+#include "libcthreads_unused.h"
 
 #if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
 
-/* Creates a read/write lock
- * Make sure the value read_write_lock is referencing, is set to NULL
- * Returns 1 if successful or -1 on error
+#if defined( HAVE_PTHREAD_H ) && defined( HAVE_PTHREAD_RWLOCK_TIMEDRDLOCK ) && defined( HAVE_PTHREAD_RWLOCK_TIMEDWRLOCK ) && defined( HAVE_CLOCK_GETTIME ) && !defined( WINAPI )
+#define LIBCTHREADS_HAVE_TIMED_READ_WRITE_LOCK
+#endif
+
+/* Fails to compile if the platform read/write lock is larger than the read/write lock storage is sized for
  */
-int libcthreads_read_write_lock_initialize(
-     libcthreads_read_write_lock_t **read_write_lock,
-     libcerror_error_t **error )
-{
-	libcthreads_internal_read_write_lock_t *internal_read_write_lock = NULL;
-	static char *function                                            = "libcthreads_read_write_lock_initialize";
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+typedef char libcthreads_read_write_lock_platform_size_check[ ( sizeof( SRWLOCK ) <= LIBCTHREADS_STORAGE_MAXIMUM_PLATFORM_READ_WRITE_LOCK_SIZE ) ? 1 : -1 ];
 
-#if defined( WINAPI ) && ( WINVER >= 0x0400 ) && ( WINVER < 0x0600 )
-	DWORD error_code                                                 = 0;
+#elif defined( WINAPI )
+typedef char libcthreads_read_write_lock_platform_size_check[ ( ( 2 * sizeof( CRITICAL_SECTION ) ) + sizeof( int ) + sizeof( HANDLE ) <= LIBCTHREADS_STORAGE_MAXIMUM_PLATFORM_READ_WRITE_LOCK_SIZE ) ? 1 : -1 ];
+
+#elif defined( HAVE_PTHREAD_H )
+typedef char libcthreads_read_write_lock_platform_size_check[ ( sizeof( pthread_rwlock_t ) <= LIBCTHREADS_STORAGE_MAXIMUM_PLATFORM_READ_WRITE_LOCK_SIZE ) ? 1 : -1 ];
 
-#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
-	int pthread_result                                               = 0;
 #endif
 
-	if( read_write_lock == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid read/write lock.",
-		 function );
+/* Fails to compile if the read/write lock storage is too small to contain the internal read/write lock
+ */
+typedef char libcthreads_read_write_lock_storage_size_check[ ( sizeof( libcthreads_internal_read_write_lock_t ) <= sizeof( libcthreads_read_write_lock_storage_t ) ) ? 1 : -1 ];
 
-		return( -1 );
+#if defined( WINAPI ) && ( WINVER == 0x0600 )
+
+/* TryAcquireSRWLockExclusive and TryAcquireSRWLockShared are available as of Windows 7,
+ * hence when building for Windows Vista they are looked up at run-time
+ */
+typedef BOOLEAN (WINAPI *libcthreads_read_write_lock_try_acquire_function_t)(
+                 PSRWLOCK slim_read_write_lock );
+
+/* Tries to acquire a slim read/write lock with a function that is looked up at run-time
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+static int libcthreads_read_write_lock_try_acquire_slim_read_write_lock(
+            SRWLOCK *slim_read_write_lock,
+            const char *function_name,
+            libcerror_error_t **error )
+{
+	libcthreads_read_write_lock_try_acquire_function_t try_acquire_function = NULL;
+	HMODULE library_handle                                                  = NULL;
+	static char *function                                                   = "libcthreads_read_write_lock_try_acquire_slim_read_write_lock";
+
+	library_handle = GetModuleHandleA(
+	                  "kernel32.dll" );
+
+	if( library_handle != NULL )
+	{
+		try_acquire_function = (libcthreads_read_write_lock_try_acquire_function_t) GetProcAddress(
+		                                                                             library_handle,
+		                                                                             function_name );
 	}
-	if( *read_write_lock != NULL )
+	if( try_acquire_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid read/write lock value already set.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: missing function: %s, not supported before Windows 7.",
+		 function,
+		 function_name );
 
 		return( -1 );
 	}
-	internal_read_write_lock = memory_allocate_structure(
-	                            libcthreads_internal_read_write_lock_t );
+	if( try_acquire_function(
+	     slim_read_write_lock ) == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
 
-	if( internal_read_write_lock == NULL )
+#endif /* defined( WINAPI ) && ( WINVER == 0x0600 ) */
+
+#if !defined( LIBCTHREADS_HAVE_TIMED_READ_WRITE_LOCK )
+
+/* Sleeps for approximately 1 millisecond, used to poll for a timed grab
+ */
+static void libcthreads_internal_read_write_lock_sleep(
+             void )
+{
+#if defined( WINAPI )
+	Sleep(
+	 1 );
+
+#elif defined( HAVE_NANOSLEEP )
+	struct timespec sleep_time;
+
+	sleep_time.tv_sec  = 0;
+	sleep_time.tv_nsec = 1000000;
+
+	nanosleep(
+	 &sleep_time,
+	 NULL );
+
+#elif defined( HAVE_SCHED_YIELD )
+	sched_yield();
+
+#endif
+}
+
+#else
+
+/* Grabs the read/write lock for reading or writing, without the writer mutex, waiting at most until a deadline
+ * The deadline is in nano seconds of the monotonic clock, refer to libcthreads_clock_get_deadline
+ * Returns 1 if successful, 0 if the deadline passed or -1 on error
+ */
+static int libcthreads_internal_read_write_lock_timed_grab(
+            libcthreads_internal_read_write_lock_t *internal_read_write_lock,
+            uint8_t for_write,
+            uint64_t deadline,
+            libcerror_error_t **error )
+{
+	struct timespec absolute_time;
+
+	static char *function   = "libcthreads_internal_read_write_lock_timed_grab";
+	uint32_t remaining_time = 0;
+	int pthread_result      = 0;
+
+	/* The timed lock functions use the system time, which can change while waiting,
+	 * hence the monotonic deadline is checked again when the timed lock times out
+	 */
+	do
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create read/write lock.",
-		 function );
+		remaining_time = libcthreads_clock_get_remaining_time(
+		                  deadline );
 
-		goto on_error;
+		if( clock_gettime(
+		     CLOCK_REALTIME,
+		     &absolute_time ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 errno,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve current time.",
+			 function );
+
+			return( -1 );
+		}
+		absolute_time.tv_sec  += (time_t) ( remaining_time / 1000 );
+		absolute_time.tv_nsec += (long) ( remaining_time % 1000 ) * 1000000;
+
+		if( absolute_time.tv_nsec >= 1000000000L )
+		{
+			absolute_time.tv_sec  += 1;
+			absolute_time.tv_nsec -= 1000000000L;
+		}
+		if( for_write != 0 )
+		{
+			pthread_result = pthread_rwlock_timedwrlock(
+			                  &( internal_read_write_lock->read_write_lock ),
+			                  &absolute_time );
+		}
+		else
+		{
+			pthread_result = pthread_rwlock_timedrdlock(
+			                  &( internal_read_write_lock->read_write_lock ),
+			                  &absolute_time );
+		}
 	}
-	if( memory_set(
-	     internal_read_write_lock,
-	     0,
-	     sizeof( libcthreads_internal_read_write_lock_t ) ) == NULL )
+	while( ( pthread_result == ETIMEDOUT )
+	    && ( remaining_time != 0 ) );
+
+	switch( pthread_result )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear read/write lock.",
-		 function );
+		case 0:
+			break;
 
-		memory_free(
-		 internal_read_write_lock );
+		case ETIMEDOUT:
+			return( 0 );
 
-		return( -1 );
+		case EAGAIN:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to timed lock read/write lock with error: Maximum number of locks exceeded.",
+			 function );
+
+			return( -1 );
+
+		case EDEADLK:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to timed lock read/write lock with error: Deadlock condition detected.",
+			 function );
+
+			return( -1 );
+
+		default:
+			libcerror_system_set_error(
+			 error,
+			 pthread_result,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to timed lock read/write lock.",
+			 function );
+
+			return( -1 );
 	}
+	return( 1 );
+}
+
+#endif /* !defined( LIBCTHREADS_HAVE_TIMED_READ_WRITE_LOCK ) */
+
+/* Grabs the read/write lock for writing, without the writer mutex
+ * Returns 1 if successful or -1 on error
+ */
+static int libcthreads_internal_read_write_lock_grab_for_write(
+            libcthreads_internal_read_write_lock_t *internal_read_write_lock,
+            libcerror_error_t **error )
+{
+#if defined( WINAPI ) && ( WINVER >= 0x0400 ) && ( WINVER < 0x0600 )
+	static char *function = "libcthreads_internal_read_write_lock_grab_for_write";
+	DWORD error_code      = 0;
+	DWORD wait_status     = 0;
+
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	static char *function = "libcthreads_internal_read_write_lock_grab_for_write";
+	int pthread_result    = 0;
+#endif
+
 #if defined( WINAPI ) && ( WINVER >= 0x0600 )
-	InitializeSRWLock(
+	LIBCTHREADS_UNREFERENCED_PARAMETER( error )
+
+	AcquireSRWLockExclusive(
 	 &( internal_read_write_lock->slim_read_write_lock ) );
 
 #elif defined( WINAPI ) && ( WINVER >= 0x0400 )
-	InitializeCriticalSection(
+	EnterCriticalSection(
 	 &( internal_read_write_lock->write_critical_section ) );
 
-	InitializeCriticalSection(
-	 &( internal_read_write_lock->read_critical_section ) );
-
-	internal_read_write_lock->no_read_event_handle = CreateEvent(
-	                                                  NULL,
-	                                                  TRUE,
-	                                                  TRUE,
-	                                                  NULL );
+	wait_status = WaitForSingleObject(
+	               internal_read_write_lock->no_read_event_handle,
+	               INFINITE );
 
-	if( internal_read_write_lock->no_read_event_handle == NULL )
+	if( wait_status == WAIT_FAILED )
 	{
 		error_code = GetLastError();
 
+		LeaveCriticalSection(
+		 &( internal_read_write_lock->write_critical_section ) );
+
 		libcerror_system_set_error(
 		 error,
 		 error_code,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize no read event handle.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: wait for no read event handle failed.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #elif defined( WINAPI )
 
-#error libcthreads_read_write_lock_initialize for Windows earlier than NT4 not implemented
+#error libcthreads_internal_read_write_lock_grab_for_write for Windows earlier than NT4 not implemented
 
 #elif defined( HAVE_PTHREAD_H )
-	pthread_result = pthread_rwlock_init(
-	                  &( internal_read_write_lock->read_write_lock ),
-	                  NULL );
+	pthread_result = pthread_rwlock_wrlock(
+	                  &( internal_read_write_lock->read_write_lock ) );
 
 	switch( pthread_result )
 	{
 		case 0:
 			break;
 
-		case EAGAIN:
+		case EDEADLK:
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to initialize read/write lock with error: Insufficient resources.",
+			 "%s: unable to lock read/write lock for write with error: Deadlock condition detected.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 
 		default:
 			libcerror_system_set_error(
@@ -171,155 +337,198 @@ int libcthreads_read_write_lock_initialize(
 			 pthread_result,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to initialize read/write lock.",
+			 "%s: unable to lock read/write lock for write.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 	}
 #endif
-	*read_write_lock = (libcthreads_read_write_lock_t *) internal_read_write_lock;
-
 	return( 1 );
-
-on_error:
-	if( internal_read_write_lock != NULL )
-	{
-#if defined( WINAPI ) && ( WINVER >= 0x0400 ) && ( WINVER < 0x0600 )
-		DeleteCriticalSection(
-		 &( internal_read_write_lock->read_critical_section ) );
-
-		DeleteCriticalSection(
-		 &( internal_read_write_lock->write_critical_section ) );
-#endif
-		memory_free(
-		 internal_read_write_lock );
-	}
-	return( -1 );
 }
 
-/* Frees a read/write lock
- * Returns 1 if successful or -1 on error
+/* Tries to grab the read/write lock for writing, without the writer mutex
+ * Returns 1 if successful, 0 if not or -1 on error
  */
-int libcthreads_read_write_lock_free(
-     libcthreads_read_write_lock_t **read_write_lock,
-     libcerror_error_t **error )
+static int libcthreads_internal_read_write_lock_try_grab_for_write(
+            libcthreads_internal_read_write_lock_t *internal_read_write_lock,
+            libcerror_error_t **error )
 {
-	libcthreads_internal_read_write_lock_t *internal_read_write_lock = NULL;
-	static char *function                                            = "libcthreads_read_write_lock_free";
-	int result                                                       = 1;
-
 #if defined( WINAPI ) && ( WINVER >= 0x0400 ) && ( WINVER < 0x0600 )
-	DWORD error_code                                                 = 0;
+	static char *function = "libcthreads_internal_read_write_lock_try_grab_for_write";
+	DWORD error_code      = 0;
+	DWORD wait_status     = 0;
+
+#elif defined( WINAPI ) && ( WINVER == 0x0600 )
+	static char *function = "libcthreads_internal_read_write_lock_try_grab_for_write";
 
 #elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
-	int pthread_result                                               = 0;
+	static char *function = "libcthreads_internal_read_write_lock_try_grab_for_write";
+	int pthread_result    = 0;
 #endif
+	int result            = 1;
 
-	if( read_write_lock == NULL )
+#if defined( WINAPI ) && ( WINVER >= 0x0601 )
+	LIBCTHREADS_UNREFERENCED_PARAMETER( error )
+
+	if( TryAcquireSRWLockExclusive(
+	     &( internal_read_write_lock->slim_read_write_lock ) ) == 0 )
+	{
+		result = 0;
+	}
+#elif defined( WINAPI ) && ( WINVER >= 0x0600 )
+	result = libcthreads_read_write_lock_try_acquire_slim_read_write_lock(
+	          &( internal_read_write_lock->slim_read_write_lock ),
+	          "TryAcquireSRWLockExclusive",
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid read/write lock.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to try lock read/write lock for write.",
 		 function );
 
 		return( -1 );
 	}
-	if( *read_write_lock != NULL )
+#elif defined( WINAPI ) && ( WINVER >= 0x0400 )
+	if( TryEnterCriticalSection(
+	     &( internal_read_write_lock->write_critical_section ) ) == 0 )
 	{
-		internal_read_write_lock = (libcthreads_internal_read_write_lock_t *) *read_write_lock;
-		*read_write_lock         = NULL;
+		return( 0 );
+	}
+	wait_status = WaitForSingleObject(
+	               internal_read_write_lock->no_read_event_handle,
+	               0 );
 
-#if defined( WINAPI ) && ( WINVER >= 0x0400 ) && ( WINVER < 0x0600 )
-		if( CloseHandle(
-		     internal_read_write_lock->no_read_event_handle ) == 0 )
-		{
-			error_code = GetLastError();
+	if( wait_status == WAIT_TIMEOUT )
+	{
+		LeaveCriticalSection(
+		 &( internal_read_write_lock->write_critical_section ) );
 
-			libcerror_system_set_error(
-			 error,
-			 error_code,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free no read event handle.",
-			 function );
+		result = 0;
+	}
+	else if( wait_status == WAIT_FAILED )
+	{
+		error_code = GetLastError();
 
-			result = -1;
-		}
-		DeleteCriticalSection(
-		 &( internal_read_write_lock->read_critical_section ) );
-
-		DeleteCriticalSection(
+		LeaveCriticalSection(
 		 &( internal_read_write_lock->write_critical_section ) );
 
-#elif defined( WINAPI ) && ( WINVER < 0x0400 )
+		libcerror_system_set_error(
+		 error,
+		 error_code,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: wait for no read event handle failed.",
+		 function );
 
-#error libcthreads_read_write_lock_free for Windows earlier than NT4 not implemented
+		return( -1 );
+	}
+#elif defined( WINAPI )
+
+#error libcthreads_internal_read_write_lock_try_grab_for_write for Windows earlier than NT4 not implemented
 
 #elif defined( HAVE_PTHREAD_H )
-		pthread_result = pthread_rwlock_destroy(
-		                  &( internal_read_write_lock->read_write_lock ) );
+	pthread_result = pthread_rwlock_trywrlock(
+	                  &( internal_read_write_lock->read_write_lock ) );
 
-		switch( pthread_result )
-		{
-			case 0:
-				break;
+	switch( pthread_result )
+	{
+		case 0:
+			break;
 
-			case EAGAIN:
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to destroy read/write lock with error: Insufficient resources.",
-				 function );
+		case EBUSY:
+			result = 0;
+			break;
 
-				result = -1;
-				break;
+		case EDEADLK:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to try lock read/write lock for write with error: Deadlock condition detected.",
+			 function );
 
-			case EBUSY:
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to destroy read/write lock with error: Resource busy.",
-				 function );
+			return( -1 );
 
-				result = -1;
-				break;
+		default:
+			libcerror_system_set_error(
+			 error,
+			 pthread_result,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to try lock read/write lock for write.",
+			 function );
 
-			default:
-				libcerror_system_set_error(
-				 error,
-				 pthread_result,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to destroy read/write lock.",
-				 function );
+			return( -1 );
+	}
+#endif
+	return( result );
+}
 
-				result = -1;
-				break;
-		}
+/* Releases the read/write lock for writing, without the writer mutex
+ * Returns 1 if successful or -1 on error
+ */
+static int libcthreads_internal_read_write_lock_release_for_write(
+            libcthreads_internal_read_write_lock_t *internal_read_write_lock,
+            libcerror_error_t **error )
+{
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	static char *function = "libcthreads_internal_read_write_lock_release_for_write";
+	int pthread_result    = 0;
 #endif
-		memory_free(
-		 internal_read_write_lock );
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	LIBCTHREADS_UNREFERENCED_PARAMETER( error )
+
+	ReleaseSRWLockExclusive(
+	 &( internal_read_write_lock->slim_read_write_lock ) );
+
+#elif defined( WINAPI ) && ( WINVER >= 0x0400 )
+	LIBCTHREADS_UNREFERENCED_PARAMETER( error )
+
+	LeaveCriticalSection(
+	 &( internal_read_write_lock->write_critical_section ) );
+
+#elif defined( WINAPI )
+
+#error libcthreads_internal_read_write_lock_release_for_write for Windows earlier than NT4 not implemented
+
+#elif defined( HAVE_PTHREAD_H )
+	pthread_result = pthread_rwlock_unlock(
+	                  &( internal_read_write_lock->read_write_lock ) );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 pthread_result,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to unlock read/write lock.",
+		 function );
+
+		return( -1 );
 	}
-	return( result );
+#endif
+	return( 1 );
 }
 
-/* Grabs a read/write lock for reading
+/* Creates a read/write lock
+ * Make sure the value read_write_lock is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
-int libcthreads_read_write_lock_grab_for_read(
-     libcthreads_read_write_lock_t *read_write_lock,
+int libcthreads_read_write_lock_initialize(
+     libcthreads_read_write_lock_t **read_write_lock,
      libcerror_error_t **error )
 {
 	libcthreads_internal_read_write_lock_t *internal_read_write_lock = NULL;
-	static char *function                                            = "libcthreads_read_write_lock_grab_for_read";
+	static char *function                                            = "libcthreads_read_write_lock_initialize";
 
 #if defined( WINAPI ) && ( WINVER >= 0x0400 ) && ( WINVER < 0x0600 )
 	DWORD error_code                                                 = 0;
-	BOOL result                                                      = 0;
 
 #elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
 	int pthread_result                                               = 0;
@@ -336,120 +545,1179 @@ int libcthreads_read_write_lock_grab_for_read(
 
 		return( -1 );
 	}
-	internal_read_write_lock = (libcthreads_internal_read_write_lock_t *) read_write_lock;
+	if( *read_write_lock != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read/write lock value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_write_lock = memory_allocate_structure(
+	                            libcthreads_internal_read_write_lock_t );
+
+	if( internal_read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_read_write_lock,
+	     0,
+	     sizeof( libcthreads_internal_read_write_lock_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read/write lock.",
+		 function );
+
+		memory_free(
+		 internal_read_write_lock );
 
+		return( -1 );
+	}
 #if defined( WINAPI ) && ( WINVER >= 0x0600 )
-	AcquireSRWLockShared(
+	InitializeSRWLock(
 	 &( internal_read_write_lock->slim_read_write_lock ) );
 
 #elif defined( WINAPI ) && ( WINVER >= 0x0400 )
-	EnterCriticalSection(
+	InitializeCriticalSection(
 	 &( internal_read_write_lock->write_critical_section ) );
 
-	EnterCriticalSection(
+	InitializeCriticalSection(
 	 &( internal_read_write_lock->read_critical_section ) );
 
-	internal_read_write_lock->number_of_readers++;
+	internal_read_write_lock->no_read_event_handle = CreateEvent(
+	                                                  NULL,
+	                                                  TRUE,
+	                                                  TRUE,
+	                                                  NULL );
 
-	if( internal_read_write_lock->number_of_readers == 1 )
+	if( internal_read_write_lock->no_read_event_handle == NULL )
 	{
-		result = ResetEvent(
-		          internal_read_write_lock->no_read_event_handle );
+		error_code = GetLastError();
 
-		if( result == 0 )
-		{
-			error_code = GetLastError();
+		libcerror_system_set_error(
+		 error,
+		 error_code,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize no read event handle.",
+		 function );
 
-			internal_read_write_lock->number_of_readers--;
-		}
+		goto on_error;
 	}
-	else
+#elif defined( WINAPI )
+
+#error libcthreads_read_write_lock_initialize for Windows earlier than NT4 not implemented
+
+#elif defined( HAVE_PTHREAD_H )
+	pthread_result = pthread_rwlock_init(
+	                  &( internal_read_write_lock->read_write_lock ),
+	                  NULL );
+
+	switch( pthread_result )
+	{
+		case 0:
+			break;
+
+		case EAGAIN:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to initialize read/write lock with error: Insufficient resources.",
+			 function );
+
+			goto on_error;
+
+		default:
+			libcerror_system_set_error(
+			 error,
+			 pthread_result,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to initialize read/write lock.",
+			 function );
+
+			goto on_error;
+	}
+#endif
+	internal_read_write_lock->writer_mutex = LIBCTHREADS_LIGHT_MUTEX_INIT;
+
+	*read_write_lock = (libcthreads_read_write_lock_t *) internal_read_write_lock;
+
+	return( 1 );
+
+on_error:
+	if( internal_read_write_lock != NULL )
+	{
+#if defined( WINAPI ) && ( WINVER >= 0x0400 ) && ( WINVER < 0x0600 )
+		DeleteCriticalSection(
+		 &( internal_read_write_lock->read_critical_section ) );
+
+		DeleteCriticalSection(
+		 &( internal_read_write_lock->write_critical_section ) );
+#endif
+		memory_free(
+		 internal_read_write_lock );
+	}
+	return( -1 );
+}
+
+/* Initializes a read/write lock in storage that is provided by the caller
+ * This allows for read/write locks without memory allocation, for example as a global or in an array
+ * The read/write lock must be freed with libcthreads_read_write_lock_free, which does not free the storage
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_read_write_lock_initialize_in_place(
+     libcthreads_read_write_lock_storage_t *storage,
+     libcthreads_read_write_lock_t **read_write_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_read_write_lock_t *internal_read_write_lock = NULL;
+	static char *function                                            = "libcthreads_read_write_lock_initialize_in_place";
+
+#if defined( WINAPI ) && ( WINVER >= 0x0400 ) && ( WINVER < 0x0600 )
+	DWORD error_code                                                 = 0;
+
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	int pthread_result                                               = 0;
+#endif
+
+	if( storage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid storage.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_write_lock != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read/write lock value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_write_lock = (libcthreads_internal_read_write_lock_t *) storage;
+
+	if( memory_set(
+	     internal_read_write_lock,
+	     0,
+	     sizeof( libcthreads_internal_read_write_lock_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_write_lock->flags = LIBCTHREADS_INTERNAL_FLAG_IN_PLACE;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	InitializeSRWLock(
+	 &( internal_read_write_lock->slim_read_write_lock ) );
+
+#elif defined( WINAPI ) && ( WINVER >= 0x0400 )
+	InitializeCriticalSection(
+	 &( internal_read_write_lock->write_critical_section ) );
+
+	InitializeCriticalSection(
+	 &( internal_read_write_lock->read_critical_section ) );
+
+	internal_read_write_lock->no_read_event_handle = CreateEvent(
+	                                                  NULL,
+	                                                  TRUE,
+	                                                  TRUE,
+	                                                  NULL );
+
+	if( internal_read_write_lock->no_read_event_handle == NULL )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 error_code,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize no read event handle.",
+		 function );
+
+		goto on_error;
+	}
+#elif defined( WINAPI )
+
+#error libcthreads_read_write_lock_initialize for Windows earlier than NT4 not implemented
+
+#elif defined( HAVE_PTHREAD_H )
+	pthread_result = pthread_rwlock_init(
+	                  &( internal_read_write_lock->read_write_lock ),
+	                  NULL );
+
+	switch( pthread_result )
+	{
+		case 0:
+			break;
+
+		case EAGAIN:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to initialize read/write lock with error: Insufficient resources.",
+			 function );
+
+			goto on_error;
+
+		default:
+			libcerror_system_set_error(
+			 error,
+			 pthread_result,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to initialize read/write lock.",
+			 function );
+
+			goto on_error;
+	}
+#endif
+	internal_read_write_lock->writer_mutex = LIBCTHREADS_LIGHT_MUTEX_INIT;
+
+	*read_write_lock = (libcthreads_read_write_lock_t *) internal_read_write_lock;
+
+	return( 1 );
+
+on_error:
+	if( internal_read_write_lock != NULL )
+	{
+#if defined( WINAPI ) && ( WINVER >= 0x0400 ) && ( WINVER < 0x0600 )
+		DeleteCriticalSection(
+		 &( internal_read_write_lock->read_critical_section ) );
+
+		DeleteCriticalSection(
+		 &( internal_read_write_lock->write_critical_section ) );
+#endif
+	}
+	return( -1 );
+}
+
+/* Frees a read/write lock
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_read_write_lock_free(
+     libcthreads_read_write_lock_t **read_write_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_read_write_lock_t *internal_read_write_lock = NULL;
+	static char *function                                            = "libcthreads_read_write_lock_free";
+	int result                                                       = 1;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0400 ) && ( WINVER < 0x0600 )
+	DWORD error_code                                                 = 0;
+
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	int pthread_result                                               = 0;
+#endif
+
+	if( read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_write_lock != NULL )
+	{
+		internal_read_write_lock = (libcthreads_internal_read_write_lock_t *) *read_write_lock;
+		*read_write_lock         = NULL;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0400 ) && ( WINVER < 0x0600 )
+		if( CloseHandle(
+		     internal_read_write_lock->no_read_event_handle ) == 0 )
+		{
+			error_code = GetLastError();
+
+			libcerror_system_set_error(
+			 error,
+			 error_code,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free no read event handle.",
+			 function );
+
+			result = -1;
+		}
+		DeleteCriticalSection(
+		 &( internal_read_write_lock->read_critical_section ) );
+
+		DeleteCriticalSection(
+		 &( internal_read_write_lock->write_critical_section ) );
+
+#elif defined( WINAPI ) && ( WINVER < 0x0400 )
+
+#error libcthreads_read_write_lock_free for Windows earlier than NT4 not implemented
+
+#elif defined( HAVE_PTHREAD_H )
+		pthread_result = pthread_rwlock_destroy(
+		                  &( internal_read_write_lock->read_write_lock ) );
+
+		switch( pthread_result )
+		{
+			case 0:
+				break;
+
+			case EAGAIN:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to destroy read/write lock with error: Insufficient resources.",
+				 function );
+
+				result = -1;
+				break;
+
+			case EBUSY:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to destroy read/write lock with error: Resource busy.",
+				 function );
+
+				result = -1;
+				break;
+
+			default:
+				libcerror_system_set_error(
+				 error,
+				 pthread_result,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to destroy read/write lock.",
+				 function );
+
+				result = -1;
+				break;
+		}
+#endif
+		if( ( internal_read_write_lock->flags & LIBCTHREADS_INTERNAL_FLAG_IN_PLACE ) == 0 )
+		{
+			memory_free(
+			 internal_read_write_lock );
+		}
+	}
+	return( result );
+}
+
+/* Grabs a read/write lock for reading, without profiling
+ * Returns 1 if successful or -1 on error
+ */
+static int libcthreads_internal_read_write_lock_grab_for_read(
+            libcthreads_internal_read_write_lock_t *internal_read_write_lock,
+            libcerror_error_t **error )
+{
+#if defined( WINAPI ) && ( WINVER >= 0x0400 ) && ( WINVER < 0x0600 )
+	static char *function = "libcthreads_internal_read_write_lock_grab_for_read";
+	DWORD error_code      = 0;
+	BOOL result           = 0;
+
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	static char *function = "libcthreads_internal_read_write_lock_grab_for_read";
+	int pthread_result    = 0;
+#endif
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	LIBCTHREADS_UNREFERENCED_PARAMETER( error )
+
+	AcquireSRWLockShared(
+	 &( internal_read_write_lock->slim_read_write_lock ) );
+
+#elif defined( WINAPI ) && ( WINVER >= 0x0400 )
+	EnterCriticalSection(
+	 &( internal_read_write_lock->write_critical_section ) );
+
+	EnterCriticalSection(
+	 &( internal_read_write_lock->read_critical_section ) );
+
+	internal_read_write_lock->number_of_readers++;
+
+	if( internal_read_write_lock->number_of_readers == 1 )
+	{
+		result = ResetEvent(
+		          internal_read_write_lock->no_read_event_handle );
+
+		if( result == 0 )
+		{
+			error_code = GetLastError();
+
+			internal_read_write_lock->number_of_readers--;
+		}
+	}
+	else
+	{
+		result = 1;
+	}
+	LeaveCriticalSection(
+	 &( internal_read_write_lock->read_critical_section ) );
+
+	LeaveCriticalSection(
+	 &( internal_read_write_lock->write_critical_section ) );
+
+	if( result == 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 error_code,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: reset of no read event failed.",
+		 function );
+
+		return( -1 );
+	}
+#elif defined( WINAPI )
+
+#error libcthreads_internal_read_write_lock_grab_for_read for Windows earlier than NT4 not implemented
+
+#elif defined( HAVE_PTHREAD_H )
+	pthread_result = pthread_rwlock_rdlock(
+	                  &( internal_read_write_lock->read_write_lock ) );
+
+	switch( pthread_result )
+	{
+		case 0:
+			break;
+
+		case EAGAIN:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to lock read/write lock for read with error: Maximum number of locks exceeded.",
+			 function );
+
+			return( -1 );
+
+		case EDEADLK:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to lock read/write lock for read with error: Deadlock condition detected.",
+			 function );
+
+			return( -1 );
+
+		default:
+			libcerror_system_set_error(
+			 error,
+			 pthread_result,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to lock read/write lock for read.",
+			 function );
+
+			return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Grabs a read/write lock for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_read_write_lock_grab_for_read(
+     libcthreads_read_write_lock_t *read_write_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_read_write_lock_t *internal_read_write_lock = NULL;
+	static char *function                                            = "libcthreads_read_write_lock_grab_for_read";
+
+#if defined( HAVE_LOCK_PROFILING )
+	libcthreads_profile_t *profile                                   = NULL;
+	uint64_t start_timestamp                                         = 0;
+	int result                                                       = 0;
+#endif
+
+	if( read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_write_lock = (libcthreads_internal_read_write_lock_t *) read_write_lock;
+
+#if defined( HAVE_LOCK_PROFILING )
+	profile = (libcthreads_profile_t *) libcthreads_atomic_load_pointer(
+	                                     &( internal_read_write_lock->profile ) );
+
+	if( profile != NULL )
+	{
+		start_timestamp = libcthreads_profile_get_timestamp();
+
+		/* Try grab first to determine if the grab is contended
+		 */
+		result = libcthreads_read_write_lock_try_grab_for_read(
+		          read_write_lock,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to try grab read/write lock for read.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			libcthreads_profile_add_acquisition(
+			 profile,
+			 start_timestamp,
+			 0 );
+
+			return( 1 );
+		}
+	}
+#endif /* defined( HAVE_LOCK_PROFILING ) */
+
+	if( libcthreads_internal_read_write_lock_grab_for_read(
+	     internal_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for read.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LOCK_PROFILING )
+	if( profile != NULL )
+	{
+		libcthreads_profile_add_acquisition(
+		 profile,
+		 start_timestamp,
+		 1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Tries to grab a read/write lock for reading
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libcthreads_read_write_lock_try_grab_for_read(
+     libcthreads_read_write_lock_t *read_write_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_read_write_lock_t *internal_read_write_lock = NULL;
+	static char *function                                            = "libcthreads_read_write_lock_try_grab_for_read";
+	int result                                                       = 1;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0400 ) && ( WINVER < 0x0600 )
+	DWORD error_code                                                 = 0;
+	BOOL event_result                                                = 0;
+
+#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+	int pthread_result                                               = 0;
+#endif
+
+	if( read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_write_lock = (libcthreads_internal_read_write_lock_t *) read_write_lock;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0601 )
+	if( TryAcquireSRWLockShared(
+	     &( internal_read_write_lock->slim_read_write_lock ) ) == 0 )
+	{
+		result = 0;
+	}
+#elif defined( WINAPI ) && ( WINVER >= 0x0600 )
+	result = libcthreads_read_write_lock_try_acquire_slim_read_write_lock(
+	          &( internal_read_write_lock->slim_read_write_lock ),
+	          "TryAcquireSRWLockShared",
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to try lock read/write lock for read.",
+		 function );
+
+		return( -1 );
+	}
+#elif defined( WINAPI ) && ( WINVER >= 0x0400 )
+	if( TryEnterCriticalSection(
+	     &( internal_read_write_lock->write_critical_section ) ) == 0 )
+	{
+		return( 0 );
+	}
+	EnterCriticalSection(
+	 &( internal_read_write_lock->read_critical_section ) );
+
+	internal_read_write_lock->number_of_readers++;
+
+	if( internal_read_write_lock->number_of_readers == 1 )
+	{
+		event_result = ResetEvent(
+		                internal_read_write_lock->no_read_event_handle );
+
+		if( event_result == 0 )
+		{
+			error_code = GetLastError();
+
+			internal_read_write_lock->number_of_readers--;
+		}
+	}
+	else
+	{
+		event_result = 1;
+	}
+	LeaveCriticalSection(
+	 &( internal_read_write_lock->read_critical_section ) );
+
+	LeaveCriticalSection(
+	 &( internal_read_write_lock->write_critical_section ) );
+
+	if( event_result == 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 error_code,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: reset of no read event failed.",
+		 function );
+
+		return( -1 );
+	}
+#elif defined( WINAPI )
+
+#error libcthreads_read_write_lock_try_grab_for_read for Windows earlier than NT4 not implemented
+
+#elif defined( HAVE_PTHREAD_H )
+	pthread_result = pthread_rwlock_tryrdlock(
+	                  &( internal_read_write_lock->read_write_lock ) );
+
+	switch( pthread_result )
+	{
+		case 0:
+			break;
+
+		case EBUSY:
+			result = 0;
+			break;
+
+		case EAGAIN:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to try lock read/write lock for read with error: Maximum number of locks exceeded.",
+			 function );
+
+			return( -1 );
+
+		default:
+			libcerror_system_set_error(
+			 error,
+			 pthread_result,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to try lock read/write lock for read.",
+			 function );
+
+			return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Grabs a read/write lock for reading, waiting at most a specific timeout
+ * The timeout is in milliseconds, a timeout of 0 is equivalent to a try grab
+ * On platforms without a timed read/write lock the lock is polled in intervals of
+ * approximately 1 millisecond, hence the actual wait can exceed the timeout
+ * Returns 1 if successful, 0 if the timeout expired or -1 on error
+ */
+int libcthreads_read_write_lock_timed_grab_for_read(
+     libcthreads_read_write_lock_t *read_write_lock,
+     uint32_t timeout,
+     libcerror_error_t **error )
+{
+	static char *function = "libcthreads_read_write_lock_timed_grab_for_read";
+	uint64_t deadline     = 0;
+	int result            = 0;
+
+	if( read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	deadline = libcthreads_clock_get_deadline(
+	            timeout );
+
+#if defined( LIBCTHREADS_HAVE_TIMED_READ_WRITE_LOCK )
+	result = libcthreads_internal_read_write_lock_timed_grab(
+	          (libcthreads_internal_read_write_lock_t *) read_write_lock,
+	          0,
+	          deadline,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to timed grab read/write lock for read.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	do
+	{
+		result = libcthreads_read_write_lock_try_grab_for_read(
+		          read_write_lock,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to try grab read/write lock for read.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			break;
+		}
+		if( libcthreads_clock_get_remaining_time(
+		     deadline ) == 0 )
+		{
+			break;
+		}
+		libcthreads_internal_read_write_lock_sleep();
+	}
+	while( result == 0 );
+
+#endif /* defined( LIBCTHREADS_HAVE_TIMED_READ_WRITE_LOCK ) */
+
+	return( result );
+}
+
+/* Grabs a read/write lock for writing
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_read_write_lock_grab_for_write(
+     libcthreads_read_write_lock_t *read_write_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_read_write_lock_t *internal_read_write_lock = NULL;
+	static char *function                                            = "libcthreads_read_write_lock_grab_for_write";
+
+#if defined( HAVE_LOCK_PROFILING )
+	libcthreads_profile_t *profile                                   = NULL;
+	uint64_t start_timestamp                                         = 0;
+	int result                                                       = 0;
+#endif
+
+	if( read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_write_lock = (libcthreads_internal_read_write_lock_t *) read_write_lock;
+
+#if defined( HAVE_LOCK_PROFILING )
+	profile = (libcthreads_profile_t *) libcthreads_atomic_load_pointer(
+	                                     &( internal_read_write_lock->profile ) );
+
+	if( profile != NULL )
+	{
+		start_timestamp = libcthreads_profile_get_timestamp();
+
+		/* Try grab first to determine if the grab is contended
+		 */
+		result = libcthreads_read_write_lock_try_grab_for_write(
+		          read_write_lock,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to try grab read/write lock for write.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			internal_read_write_lock->grab_timestamp = libcthreads_profile_add_acquisition(
+			                                            profile,
+			                                            start_timestamp,
+			                                            0 );
+
+			return( 1 );
+		}
+	}
+#endif /* defined( HAVE_LOCK_PROFILING ) */
+
+	if( libcthreads_light_mutex_grab(
+	     &( internal_read_write_lock->writer_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab writer mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_internal_read_write_lock_grab_for_write(
+	     internal_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for write.",
+		 function );
+
+		libcthreads_light_mutex_release(
+		 &( internal_read_write_lock->writer_mutex ),
+		 NULL );
+
+		return( -1 );
+	}
+#if defined( HAVE_LOCK_PROFILING )
+	if( profile != NULL )
+	{
+		internal_read_write_lock->grab_timestamp = libcthreads_profile_add_acquisition(
+		                                            profile,
+		                                            start_timestamp,
+		                                            1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Tries to grab a read/write lock for writing
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libcthreads_read_write_lock_try_grab_for_write(
+     libcthreads_read_write_lock_t *read_write_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_read_write_lock_t *internal_read_write_lock = NULL;
+	static char *function                                            = "libcthreads_read_write_lock_try_grab_for_write";
+	int result                                                       = 0;
+
+	if( read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_write_lock = (libcthreads_internal_read_write_lock_t *) read_write_lock;
+
+	result = libcthreads_light_mutex_try_grab(
+	          &( internal_read_write_lock->writer_mutex ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to try grab writer mutex.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = libcthreads_internal_read_write_lock_try_grab_for_write(
+	          internal_read_write_lock,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to try grab read/write lock for write.",
+			 function );
+		}
+		libcthreads_light_mutex_release(
+		 &( internal_read_write_lock->writer_mutex ),
+		 NULL );
+	}
+	return( result );
+}
+
+/* Grabs a read/write lock for writing, waiting at most a specific timeout
+ * The timeout is in milliseconds, a timeout of 0 is equivalent to a try grab
+ * On platforms without a timed read/write lock the lock is polled in intervals of
+ * approximately 1 millisecond, hence the actual wait can exceed the timeout
+ * Returns 1 if successful, 0 if the timeout expired or -1 on error
+ */
+int libcthreads_read_write_lock_timed_grab_for_write(
+     libcthreads_read_write_lock_t *read_write_lock,
+     uint32_t timeout,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_read_write_lock_t *internal_read_write_lock = NULL;
+	static char *function                                            = "libcthreads_read_write_lock_timed_grab_for_write";
+	uint64_t deadline                                                = 0;
+	int result                                                       = 0;
+
+	if( read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_write_lock = (libcthreads_internal_read_write_lock_t *) read_write_lock;
+
+	deadline = libcthreads_clock_get_deadline(
+	            timeout );
+
+	result = libcthreads_light_mutex_grab_with_deadline(
+	          &( internal_read_write_lock->writer_mutex ),
+	          deadline,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab writer mutex.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+#if defined( LIBCTHREADS_HAVE_TIMED_READ_WRITE_LOCK )
+	result = libcthreads_internal_read_write_lock_timed_grab(
+	          internal_read_write_lock,
+	          1,
+	          deadline,
+	          error );
+#else
+	do
+	{
+		result = libcthreads_internal_read_write_lock_try_grab_for_write(
+		          internal_read_write_lock,
+		          error );
+
+		if( result != 0 )
+		{
+			break;
+		}
+		if( libcthreads_clock_get_remaining_time(
+		     deadline ) == 0 )
+		{
+			break;
+		}
+		libcthreads_internal_read_write_lock_sleep();
+	}
+	while( result == 0 );
+
+#endif /* defined( LIBCTHREADS_HAVE_TIMED_READ_WRITE_LOCK ) */
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to timed grab read/write lock for write.",
+			 function );
+		}
+		libcthreads_light_mutex_release(
+		 &( internal_read_write_lock->writer_mutex ),
+		 NULL );
+	}
+	return( result );
+}
+
+/* Grabs a read/write lock for upgradable reading
+ * An upgradable read can be held together with other reads, but not with another upgradable read
+ * or a write. It can be upgraded to a write with libcthreads_read_write_lock_upgrade, during which
+ * no other writer can grab the read/write lock, hence data read before the upgrade remains valid
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_read_write_lock_grab_for_upgradable_read(
+     libcthreads_read_write_lock_t *read_write_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_read_write_lock_t *internal_read_write_lock = NULL;
+	static char *function                                            = "libcthreads_read_write_lock_grab_for_upgradable_read";
+
+	if( read_write_lock == NULL )
 	{
-		result = 1;
-	}
-	LeaveCriticalSection(
-	 &( internal_read_write_lock->read_critical_section ) );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read/write lock.",
+		 function );
 
-	LeaveCriticalSection(
-	 &( internal_read_write_lock->write_critical_section ) );
+		return( -1 );
+	}
+	internal_read_write_lock = (libcthreads_internal_read_write_lock_t *) read_write_lock;
 
-	if( result == 0 )
+	if( libcthreads_light_mutex_grab(
+	     &( internal_read_write_lock->writer_mutex ),
+	     error ) != 1 )
 	{
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
-		 error_code,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: reset of no read event failed.",
+		 "%s: unable to grab writer mutex.",
 		 function );
 
 		return( -1 );
 	}
-#elif defined( WINAPI )
-
-#error libcthreads_read_write_lock_grab_for_read for Windows earlier than NT4 not implemented
-
-#elif defined( HAVE_PTHREAD_H )
-	pthread_result = pthread_rwlock_rdlock(
-	                  &( internal_read_write_lock->read_write_lock ) );
-
-	switch( pthread_result )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     read_write_lock,
+	     error ) != 1 )
 	{
-		case 0:
-			break;
-
-		case EAGAIN:
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to lock read/write lock for read with error: Maximum number of locks exceeded.",
-			 function );
-
-			return( -1 );
-
-		case EDEADLK:
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to lock read/write lock for read with error: Deadlock condition detected.",
-			 function );
-
-			return( -1 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for read.",
+		 function );
 
-		default:
-			libcerror_system_set_error(
-			 error,
-			 pthread_result,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to lock read/write lock for read.",
-			 function );
+		libcthreads_light_mutex_release(
+		 &( internal_read_write_lock->writer_mutex ),
+		 NULL );
 
-			return( -1 );
+		return( -1 );
 	}
-#endif
 	return( 1 );
 }
 
-/* Grabs a read/write lock for writing
+/* Upgrades a read/write lock grabbed for upgradable reading to writing
+ * Waits until the other readers have released the read/write lock
+ * The read/write lock must be released with libcthreads_read_write_lock_release_for_write
  * Returns 1 if successful or -1 on error
  */
-int libcthreads_read_write_lock_grab_for_write(
+int libcthreads_read_write_lock_upgrade(
      libcthreads_read_write_lock_t *read_write_lock,
      libcerror_error_t **error )
 {
 	libcthreads_internal_read_write_lock_t *internal_read_write_lock = NULL;
-	static char *function                                            = "libcthreads_read_write_lock_grab_for_write";
-
-#if defined( WINAPI ) && ( WINVER >= 0x0400 ) && ( WINVER < 0x0600 )
-	DWORD error_code                                                 = 0;
-	DWORD wait_status                                                = 0;
-
-#elif defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
-	int pthread_result                                               = 0;
-#endif
+	static char *function                                            = "libcthreads_read_write_lock_upgrade";
 
 	if( read_write_lock == NULL )
 	{
@@ -464,70 +1732,47 @@ int libcthreads_read_write_lock_grab_for_write(
 	}
 	internal_read_write_lock = (libcthreads_internal_read_write_lock_t *) read_write_lock;
 
-#if defined( WINAPI ) && ( WINVER >= 0x0600 )
-	AcquireSRWLockExclusive(
-	 &( internal_read_write_lock->slim_read_write_lock ) );
-
-#elif defined( WINAPI ) && ( WINVER >= 0x0400 )
-	EnterCriticalSection(
-	 &( internal_read_write_lock->write_critical_section ) );
-
-	wait_status = WaitForSingleObject(
-	               internal_read_write_lock->no_read_event_handle,
-	               INFINITE );
-
-	if( wait_status == WAIT_FAILED )
+	if( libcthreads_atomic_load_int(
+	     &( internal_read_write_lock->writer_mutex ) ) == LIBCTHREADS_LIGHT_MUTEX_STATE_RELEASED )
 	{
-		error_code = GetLastError();
-
-		LeaveCriticalSection(
-		 &( internal_read_write_lock->write_critical_section ) );
-
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
-		 error_code,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: wait for no read event handle failed.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read/write lock - not grabbed for upgradable read.",
 		 function );
 
 		return( -1 );
 	}
-#elif defined( WINAPI )
-
-#error libcthreads_read_write_lock_grab_for_write for Windows earlier than NT4 not implemented
-
-#elif defined( HAVE_PTHREAD_H )
-	pthread_result = pthread_rwlock_wrlock(
-	                  &( internal_read_write_lock->read_write_lock ) );
-
-	switch( pthread_result )
+	/* The writer mutex remains grabbed, hence no other writer can grab the read/write lock
+	 * between releasing the read and grabbing the write
+	 */
+	if( libcthreads_read_write_lock_release_for_read(
+	     read_write_lock,
+	     error ) != 1 )
 	{
-		case 0:
-			break;
-
-		case EDEADLK:
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to lock read/write lock for write with error: Deadlock condition detected.",
-			 function );
-
-			return( -1 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for read.",
+		 function );
 
-		default:
-			libcerror_system_set_error(
-			 error,
-			 pthread_result,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to lock read/write lock for write.",
-			 function );
+		return( -1 );
+	}
+	if( libcthreads_internal_read_write_lock_grab_for_write(
+	     internal_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for write.",
+		 function );
 
-			return( -1 );
+		return( -1 );
 	}
-#endif
 	return( 1 );
 }
 
@@ -637,8 +1882,8 @@ int libcthreads_read_write_lock_release_for_write(
 	libcthreads_internal_read_write_lock_t *internal_read_write_lock = NULL;
 	static char *function                                            = "libcthreads_read_write_lock_release_for_write";
 
-#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
-	int pthread_result                                               = 0;
+#if defined( HAVE_LOCK_PROFILING )
+	libcthreads_profile_t *profile                                   = NULL;
 #endif
 
 	if( read_write_lock == NULL )
@@ -654,34 +1899,168 @@ int libcthreads_read_write_lock_release_for_write(
 	}
 	internal_read_write_lock = (libcthreads_internal_read_write_lock_t *) read_write_lock;
 
-#if defined( WINAPI ) && ( WINVER >= 0x0600 )
-	ReleaseSRWLockExclusive(
-	 &( internal_read_write_lock->slim_read_write_lock ) );
+#if defined( HAVE_LOCK_PROFILING )
+	profile = (libcthreads_profile_t *) libcthreads_atomic_load_pointer(
+	                                     &( internal_read_write_lock->profile ) );
 
-#elif defined( WINAPI ) && ( WINVER >= 0x0400 )
-	LeaveCriticalSection(
-	 &( internal_read_write_lock->write_critical_section ) );
+	/* The hold time is only known when the read/write lock was grabbed with
+	 * libcthreads_read_write_lock_grab_for_write
+	 */
+	if( ( profile != NULL )
+	 && ( internal_read_write_lock->grab_timestamp != 0 ) )
+	{
+		libcthreads_profile_add_hold(
+		 profile,
+		 internal_read_write_lock->grab_timestamp );
 
-#elif defined( WINAPI )
+		internal_read_write_lock->grab_timestamp = 0;
+	}
+#endif
+
+	if( libcthreads_internal_read_write_lock_release_for_write(
+	     internal_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for write.",
+		 function );
 
-#error libcthreads_read_write_lock_release_for_write for Windows earlier than NT4 not implemented
+		return( -1 );
+	}
+	if( libcthreads_light_mutex_release(
+	     &( internal_read_write_lock->writer_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release writer mutex.",
+		 function );
 
-#elif defined( HAVE_PTHREAD_H )
-	pthread_result = pthread_rwlock_unlock(
-	                  &( internal_read_write_lock->read_write_lock ) );
+		return( -1 );
+	}
+	return( 1 );
+}
 
-	if( pthread_result != 0 )
+/* Releases a read/write lock for upgradable reading
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_read_write_lock_release_for_upgradable_read(
+     libcthreads_read_write_lock_t *read_write_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_read_write_lock_t *internal_read_write_lock = NULL;
+	static char *function                                            = "libcthreads_read_write_lock_release_for_upgradable_read";
+
+	if( read_write_lock == NULL )
 	{
-		libcerror_system_set_error(
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_read_write_lock = (libcthreads_internal_read_write_lock_t *) read_write_lock;
+
+	if( libcthreads_read_write_lock_release_for_read(
+	     read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
 		 error,
-		 pthread_result,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to unlock read/write lock.",
+		 "%s: unable to release read/write lock for read.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_light_mutex_release(
+	     &( internal_read_write_lock->writer_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release writer mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the name under which the lock contention of the read/write lock is profiled
+ * Read/write locks with the same name share their profile
+ * The hold time is only profiled for grabs for writing, since multiple readers can hold the lock
+ * The name is only used when libcthreads was built with lock profiling support
+ * The read/write lock should not be in use by other threads when setting the name
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_read_write_lock_set_profile_name(
+     libcthreads_read_write_lock_t *read_write_lock,
+     const char *name,
+     libcerror_error_t **error )
+{
+	static char *function                                            = "libcthreads_read_write_lock_set_profile_name";
+
+#if defined( HAVE_LOCK_PROFILING )
+	libcthreads_internal_read_write_lock_t *internal_read_write_lock = NULL;
+	libcthreads_profile_t *profile                                   = NULL;
+#endif
+
+	if( read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LOCK_PROFILING )
+	internal_read_write_lock = (libcthreads_internal_read_write_lock_t *) read_write_lock;
+
+	if( libcthreads_profile_get_by_name(
+	     name,
+	     &profile,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve profile.",
 		 function );
 
 		return( -1 );
 	}
+	internal_read_write_lock->grab_timestamp = 0;
+
+	libcthreads_atomic_store_pointer(
+	 &( internal_read_write_lock->profile ),
+	 profile );
 #endif
 	return( 1 );
 }
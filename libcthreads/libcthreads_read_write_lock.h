@@ -35,6 +35,7 @@
 
 #include "libcthreads_extern.h"
 #include "libcthreads_libcerror.h"
+#include "libcthreads_profile.h"
 #include "libcthreads_types.h"
 
 #if defined( __cplusplus )
@@ -77,6 +78,24 @@ struct libcthreads_internal_read_write_lock
 #else
 #error Missing read/write lock type
 #endif
+
+	/* The light mutex that serializes writers and upgradable readers
+	 */
+	libcthreads_light_mutex_t writer_mutex;
+
+	/* The lock contention profile
+	 * The profile is always present, so that the size of the structure
+	 * does not depend on the configuration
+	 */
+	libcthreads_profile_t *profile;
+
+	/* The timestamp of the last grab for writing, used to determine the hold time
+	 */
+	uint64_t grab_timestamp;
+
+	/* The flags
+	 */
+	uint8_t flags;
 };
 
 LIBCTHREADS_EXTERN \
@@ -84,6 +103,12 @@ int libcthreads_read_write_lock_initialize(
      libcthreads_read_write_lock_t **read_write_lock,
      libcerror_error_t **error );
 
+LIBCTHREADS_EXTERN \
+int libcthreads_read_write_lock_initialize_in_place(
+     libcthreads_read_write_lock_storage_t *storage,
+     libcthreads_read_write_lock_t **read_write_lock,
+     libcerror_error_t **error );
+
 LIBCTHREADS_EXTERN \
 int libcthreads_read_write_lock_free(
      libcthreads_read_write_lock_t **read_write_lock,
@@ -94,11 +119,43 @@ int libcthreads_read_write_lock_grab_for_read(
      libcthreads_read_write_lock_t *read_write_lock,
      libcerror_error_t **error );
 
+LIBCTHREADS_EXTERN \
+int libcthreads_read_write_lock_try_grab_for_read(
+     libcthreads_read_write_lock_t *read_write_lock,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_read_write_lock_timed_grab_for_read(
+     libcthreads_read_write_lock_t *read_write_lock,
+     uint32_t timeout,
+     libcerror_error_t **error );
+
 LIBCTHREADS_EXTERN \
 int libcthreads_read_write_lock_grab_for_write(
      libcthreads_read_write_lock_t *read_write_lock,
      libcerror_error_t **error );
 
+LIBCTHREADS_EXTERN \
+int libcthreads_read_write_lock_try_grab_for_write(
+     libcthreads_read_write_lock_t *read_write_lock,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_read_write_lock_timed_grab_for_write(
+     libcthreads_read_write_lock_t *read_write_lock,
+     uint32_t timeout,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_read_write_lock_grab_for_upgradable_read(
+     libcthreads_read_write_lock_t *read_write_lock,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_read_write_lock_upgrade(
+     libcthreads_read_write_lock_t *read_write_lock,
+     libcerror_error_t **error );
+
 LIBCTHREADS_EXTERN \
 int libcthreads_read_write_lock_release_for_read(
      libcthreads_read_write_lock_t *read_write_lock,
@@ -109,6 +166,17 @@ int libcthreads_read_write_lock_release_for_write(
      libcthreads_read_write_lock_t *read_write_lock,
      libcerror_error_t **error );
 
+LIBCTHREADS_EXTERN \
+int libcthreads_read_write_lock_release_for_upgradable_read(
+     libcthreads_read_write_lock_t *read_write_lock,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_read_write_lock_set_profile_name(
+     libcthreads_read_write_lock_t *read_write_lock,
+     const char *name,
+     libcerror_error_t **error );
+
 #endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
 #if defined( __cplusplus )
@@ -40,6 +40,7 @@
 #include "libcthreads_mutex.h"
 #include "libcthreads_repeating_thread.h"
 #include "libcthreads_thread_attributes.h"
+#include "libcthreads_thread_local_key.h"
 #include "libcthreads_types.h"
 
 #if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
@@ -117,6 +118,9 @@ DWORD WINAPI libcthreads_repeating_thread_callback_function_helper(
 			result = (DWORD) ( internal_repeating_thread->callback_function_result != 1 );
 		}
 	}
+#if ( WINVER < 0x0600 )
+	libcthreads_thread_local_key_run_destructors();
+#endif
 	ExitThread(
 	 result );
 }
@@ -0,0 +1,502 @@
+/*
+ * Semaphore functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcthreads_atomic.h"
+#include "libcthreads_clock.h"
+#include "libcthreads_definitions.h"
+#include "libcthreads_futex.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_semaphore.h"
+#include "libcthreads_types.h"
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates a semaphore
+ * Make sure the value semaphore is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_semaphore_initialize(
+     libcthreads_semaphore_t **semaphore,
+     int initial_count,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_semaphore_t *internal_semaphore = NULL;
+	static char *function                                = "libcthreads_semaphore_initialize";
+
+	if( semaphore == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid semaphore.",
+		 function );
+
+		return( -1 );
+	}
+	if( *semaphore != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid semaphore value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( initial_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid initial count value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if SIZEOF_INT > 4
+	if( initial_count > (int) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid initial count value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* SIZEOF_INT > 4 */
+
+	internal_semaphore = memory_allocate_structure(
+	                      libcthreads_internal_semaphore_t );
+
+	if( internal_semaphore == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create semaphore.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_semaphore,
+	     0,
+	     sizeof( libcthreads_internal_semaphore_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear semaphore.",
+		 function );
+
+		memory_free(
+		 internal_semaphore );
+
+		return( -1 );
+	}
+	internal_semaphore->count = (int32_t) initial_count;
+
+	*semaphore = (libcthreads_semaphore_t *) internal_semaphore;
+
+	return( 1 );
+}
+
+/* Frees a semaphore
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_semaphore_free(
+     libcthreads_semaphore_t **semaphore,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_semaphore_t *internal_semaphore = NULL;
+	static char *function                                = "libcthreads_semaphore_free";
+	int result                                           = 1;
+
+	if( semaphore == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid semaphore.",
+		 function );
+
+		return( -1 );
+	}
+	if( *semaphore != NULL )
+	{
+		internal_semaphore = (libcthreads_internal_semaphore_t *) *semaphore;
+		*semaphore         = NULL;
+
+		if( libcthreads_atomic_load_sequential_int32(
+		     &( internal_semaphore->number_of_waiters ) ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to destroy semaphore with error: Resource busy.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_semaphore );
+	}
+	return( result );
+}
+
+/* Tries to take a permit of the semaphore without waiting
+ * Returns 1 if successful or 0 if no permit is available
+ */
+static int libcthreads_internal_semaphore_try_acquire(
+            libcthreads_internal_semaphore_t *internal_semaphore )
+{
+	int32_t count          = 0;
+	int32_t previous_count = 0;
+
+	count = libcthreads_atomic_load_sequential_int32(
+	         &( internal_semaphore->count ) );
+
+	while( count > 0 )
+	{
+		previous_count = libcthreads_atomic_compare_exchange_int32(
+		                  &( internal_semaphore->count ),
+		                  count,
+		                  count - 1 );
+
+		if( previous_count == count )
+		{
+			return( 1 );
+		}
+		count = previous_count;
+	}
+	return( 0 );
+}
+
+/* Acquires a permit of a semaphore
+ * An acquire when permits are available only requires a single atomic compare and exchange,
+ * the thread only waits in the kernel when no permit is available
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_semaphore_acquire(
+     libcthreads_semaphore_t *semaphore,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_semaphore_t *internal_semaphore = NULL;
+	static char *function                                = "libcthreads_semaphore_acquire";
+
+	if( semaphore == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid semaphore.",
+		 function );
+
+		return( -1 );
+	}
+	internal_semaphore = (libcthreads_internal_semaphore_t *) semaphore;
+
+	if( libcthreads_internal_semaphore_try_acquire(
+	     internal_semaphore ) != 0 )
+	{
+		return( 1 );
+	}
+	/* The waiter is registered before it checks the count again, while a release
+	 * changes the count before it checks for waiters, hence either the waiter sees
+	 * the permit or the release sees the waiter
+	 */
+	libcthreads_atomic_add_int32(
+	 &( internal_semaphore->number_of_waiters ),
+	 1 );
+
+	while( libcthreads_internal_semaphore_try_acquire(
+	        internal_semaphore ) == 0 )
+	{
+		libcthreads_futex_wait(
+		 &( internal_semaphore->count ),
+		 0 );
+	}
+	libcthreads_atomic_add_int32(
+	 &( internal_semaphore->number_of_waiters ),
+	 -1 );
+
+	return( 1 );
+}
+
+/* Tries to acquire a permit of a semaphore
+ * Returns 1 if successful, 0 if no permit is available or -1 on error
+ */
+int libcthreads_semaphore_try_acquire(
+     libcthreads_semaphore_t *semaphore,
+     libcerror_error_t **error )
+{
+	static char *function = "libcthreads_semaphore_try_acquire";
+
+	if( semaphore == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid semaphore.",
+		 function );
+
+		return( -1 );
+	}
+	return( libcthreads_internal_semaphore_try_acquire(
+	         (libcthreads_internal_semaphore_t *) semaphore ) );
+}
+
+/* Acquires a permit of a semaphore, waiting at most a specific timeout
+ * The timeout is in milliseconds, a timeout of 0 is equivalent to a try acquire
+ * The timeout is measured against a deadline on the monotonic clock, hence wake ups
+ * before the timeout expired do not extend the wait
+ * Returns 1 if successful, 0 if the timeout expired or -1 on error
+ */
+int libcthreads_semaphore_timed_acquire(
+     libcthreads_semaphore_t *semaphore,
+     uint32_t timeout,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_semaphore_t *internal_semaphore = NULL;
+	static char *function                                = "libcthreads_semaphore_timed_acquire";
+	uint64_t deadline                                    = 0;
+	uint32_t remaining_time                              = 0;
+	int result                                           = 0;
+
+	if( semaphore == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid semaphore.",
+		 function );
+
+		return( -1 );
+	}
+	internal_semaphore = (libcthreads_internal_semaphore_t *) semaphore;
+
+	result = libcthreads_internal_semaphore_try_acquire(
+	          internal_semaphore );
+
+	if( ( result != 0 )
+	 || ( timeout == 0 ) )
+	{
+		return( result );
+	}
+	deadline = libcthreads_clock_get_deadline(
+	            timeout );
+
+	libcthreads_atomic_add_int32(
+	 &( internal_semaphore->number_of_waiters ),
+	 1 );
+
+	do
+	{
+		result = libcthreads_internal_semaphore_try_acquire(
+		          internal_semaphore );
+
+		if( result != 0 )
+		{
+			break;
+		}
+		remaining_time = libcthreads_clock_get_remaining_time(
+		                  deadline );
+
+		if( remaining_time == 0 )
+		{
+			break;
+		}
+		libcthreads_futex_timed_wait(
+		 &( internal_semaphore->count ),
+		 0,
+		 remaining_time );
+	}
+	while( result == 0 );
+
+	libcthreads_atomic_add_int32(
+	 &( internal_semaphore->number_of_waiters ),
+	 -1 );
+
+	return( result );
+}
+
+/* Releases a number of permits of a semaphore
+ * Waiting threads are only woken up when there are threads waiting, at most one per permit
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_semaphore_release(
+     libcthreads_semaphore_t *semaphore,
+     int count,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_semaphore_t *internal_semaphore = NULL;
+	static char *function                                = "libcthreads_semaphore_release";
+	int32_t number_of_waiters                            = 0;
+	int32_t previous_count                               = 0;
+	int32_t safe_count                                   = 0;
+
+	if( semaphore == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid semaphore.",
+		 function );
+
+		return( -1 );
+	}
+	internal_semaphore = (libcthreads_internal_semaphore_t *) semaphore;
+
+	if( count <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid count value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+#if SIZEOF_INT > 4
+	if( count > (int) INT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid count value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* SIZEOF_INT > 4 */
+
+	safe_count = libcthreads_atomic_load_sequential_int32(
+	              &( internal_semaphore->count ) );
+
+	do
+	{
+		if( safe_count > ( INT32_MAX - (int32_t) count ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid semaphore - count value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		previous_count = safe_count;
+
+		safe_count = libcthreads_atomic_compare_exchange_int32(
+		              &( internal_semaphore->count ),
+		              previous_count,
+		              previous_count + (int32_t) count );
+	}
+	while( safe_count != previous_count );
+
+	number_of_waiters = libcthreads_atomic_load_sequential_int32(
+	                     &( internal_semaphore->number_of_waiters ) );
+
+	/* Only wake up as many waiters as there are permits released, so that
+	 * the waiters do not all race for a few permits
+	 */
+	if( number_of_waiters > (int32_t) count )
+	{
+		number_of_waiters = (int32_t) count;
+	}
+	if( number_of_waiters == 1 )
+	{
+		libcthreads_futex_wake_single(
+		 &( internal_semaphore->count ) );
+	}
+	else if( number_of_waiters > 1 )
+	{
+		libcthreads_futex_wake_multiple(
+		 &( internal_semaphore->count ),
+		 (int) number_of_waiters );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of available permits of a semaphore
+ * The value can be changed by other threads at any time, hence it is only indicative
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_semaphore_get_count(
+     libcthreads_semaphore_t *semaphore,
+     int *count,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_semaphore_t *internal_semaphore = NULL;
+	static char *function                                = "libcthreads_semaphore_get_count";
+
+	if( semaphore == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid semaphore.",
+		 function );
+
+		return( -1 );
+	}
+	internal_semaphore = (libcthreads_internal_semaphore_t *) semaphore;
+
+	if( count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid count.",
+		 function );
+
+		return( -1 );
+	}
+	*count = (int) libcthreads_atomic_load_sequential_int32(
+	                &( internal_semaphore->count ) );
+
+	return( 1 );
+}
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,97 @@
+/*
+ * Semaphore functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_SEMAPHORE_H )
+#define _LIBCTHREADS_INTERNAL_SEMAPHORE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcthreads_extern.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct libcthreads_internal_semaphore libcthreads_internal_semaphore_t;
+
+struct libcthreads_internal_semaphore
+{
+	/* The number of available permits, which is also the address the waiting threads wait on
+	 */
+	int32_t count;
+
+	/* The number of threads that wait for a permit
+	 */
+	int32_t number_of_waiters;
+};
+
+LIBCTHREADS_EXTERN \
+int libcthreads_semaphore_initialize(
+     libcthreads_semaphore_t **semaphore,
+     int initial_count,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_semaphore_free(
+     libcthreads_semaphore_t **semaphore,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_semaphore_acquire(
+     libcthreads_semaphore_t *semaphore,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_semaphore_try_acquire(
+     libcthreads_semaphore_t *semaphore,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_semaphore_timed_acquire(
+     libcthreads_semaphore_t *semaphore,
+     uint32_t timeout,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_semaphore_release(
+     libcthreads_semaphore_t *semaphore,
+     int count,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_semaphore_get_count(
+     libcthreads_semaphore_t *semaphore,
+     int *count,
+     libcerror_error_t **error );
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCTHREADS_INTERNAL_SEMAPHORE_H ) */
+
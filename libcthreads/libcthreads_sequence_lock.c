@@ -0,0 +1,346 @@
+/*
+ * Sequence lock functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcthreads_atomic.h"
+#include "libcthreads_definitions.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_light_mutex.h"
+#include "libcthreads_sequence_lock.h"
+#include "libcthreads_types.h"
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates a sequence lock
+ * Make sure the value sequence_lock is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_sequence_lock_initialize(
+     libcthreads_sequence_lock_t **sequence_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_sequence_lock_t *internal_sequence_lock = NULL;
+	static char *function                                        = "libcthreads_sequence_lock_initialize";
+
+	if( sequence_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequence lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sequence_lock != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sequence lock value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sequence_lock = memory_allocate_structure(
+	                          libcthreads_internal_sequence_lock_t );
+
+	if( internal_sequence_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sequence lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_sequence_lock,
+	     0,
+	     sizeof( libcthreads_internal_sequence_lock_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sequence lock.",
+		 function );
+
+		memory_free(
+		 internal_sequence_lock );
+
+		return( -1 );
+	}
+	internal_sequence_lock->writer_mutex = LIBCTHREADS_LIGHT_MUTEX_INIT;
+
+	*sequence_lock = (libcthreads_sequence_lock_t *) internal_sequence_lock;
+
+	return( 1 );
+}
+
+/* Frees a sequence lock
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_sequence_lock_free(
+     libcthreads_sequence_lock_t **sequence_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_sequence_lock_t *internal_sequence_lock = NULL;
+	static char *function                                        = "libcthreads_sequence_lock_free";
+	int result                                                   = 1;
+
+	if( sequence_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequence lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sequence_lock != NULL )
+	{
+		internal_sequence_lock = (libcthreads_internal_sequence_lock_t *) *sequence_lock;
+		*sequence_lock         = NULL;
+
+		if( ( libcthreads_atomic_load_int(
+		       &( internal_sequence_lock->sequence ) ) & 1 ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to destroy sequence lock with error: Resource busy.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_sequence_lock );
+	}
+	return( result );
+}
+
+/* Begins a read section of a sequence lock
+ * A read section does not modify the sequence lock, hence readers do not contend with each other
+ * The data read in the read section can be inconsistent, hence it must only be used after
+ * libcthreads_sequence_lock_end_read confirms the read section was not interrupted by a writer
+ * The data must be small and must not contain pointers that a writer could free
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_sequence_lock_begin_read(
+     libcthreads_sequence_lock_t *sequence_lock,
+     uint32_t *sequence,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_sequence_lock_t *internal_sequence_lock = NULL;
+	static char *function                                        = "libcthreads_sequence_lock_begin_read";
+	int32_t safe_sequence                                        = 0;
+
+	if( sequence_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequence lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sequence_lock = (libcthreads_internal_sequence_lock_t *) sequence_lock;
+
+	if( sequence == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequence.",
+		 function );
+
+		return( -1 );
+	}
+	/* Wait until a writer in progress has finished
+	 */
+	safe_sequence = libcthreads_atomic_load_int(
+	                 &( internal_sequence_lock->sequence ) );
+
+	while( ( safe_sequence & 1 ) != 0 )
+	{
+		libcthreads_atomic_pause();
+
+		safe_sequence = libcthreads_atomic_load_int(
+		                 &( internal_sequence_lock->sequence ) );
+	}
+	*sequence = (uint32_t) safe_sequence;
+
+	return( 1 );
+}
+
+/* Ends a read section of a sequence lock
+ * Returns 1 if the data read in the read section is consistent, 0 if a writer modified
+ * the data and the read section must be retried or -1 on error
+ */
+int libcthreads_sequence_lock_end_read(
+     libcthreads_sequence_lock_t *sequence_lock,
+     uint32_t sequence,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_sequence_lock_t *internal_sequence_lock = NULL;
+	static char *function                                        = "libcthreads_sequence_lock_end_read";
+
+	if( sequence_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequence lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sequence_lock = (libcthreads_internal_sequence_lock_t *) sequence_lock;
+
+	/* Make sure the data is read before the sequence is read again
+	 */
+	libcthreads_atomic_acquire_fence();
+
+	if( (uint32_t) libcthreads_atomic_load_int(
+	                &( internal_sequence_lock->sequence ) ) != sequence )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Grabs a sequence lock for writing
+ * The sequence is made odd before the data is modified, so that readers detect the modification
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_sequence_lock_grab_for_write(
+     libcthreads_sequence_lock_t *sequence_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_sequence_lock_t *internal_sequence_lock = NULL;
+	static char *function                                        = "libcthreads_sequence_lock_grab_for_write";
+
+	if( sequence_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequence lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sequence_lock = (libcthreads_internal_sequence_lock_t *) sequence_lock;
+
+	if( libcthreads_light_mutex_grab(
+	     &( internal_sequence_lock->writer_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab writer mutex.",
+		 function );
+
+		return( -1 );
+	}
+	libcthreads_atomic_add_int32(
+	 &( internal_sequence_lock->sequence ),
+	 1 );
+
+	return( 1 );
+}
+
+/* Releases a sequence lock for writing
+ * The sequence is made even after the data is modified
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_sequence_lock_release_for_write(
+     libcthreads_sequence_lock_t *sequence_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_sequence_lock_t *internal_sequence_lock = NULL;
+	static char *function                                        = "libcthreads_sequence_lock_release_for_write";
+
+	if( sequence_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequence lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sequence_lock = (libcthreads_internal_sequence_lock_t *) sequence_lock;
+
+	if( ( libcthreads_atomic_load_int(
+	       &( internal_sequence_lock->sequence ) ) & 1 ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sequence lock - not grabbed for write.",
+		 function );
+
+		return( -1 );
+	}
+	libcthreads_atomic_add_int32(
+	 &( internal_sequence_lock->sequence ),
+	 1 );
+
+	if( libcthreads_light_mutex_release(
+	     &( internal_sequence_lock->writer_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release writer mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,90 @@
+/*
+ * Sequence lock functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_SEQUENCE_LOCK_H )
+#define _LIBCTHREADS_INTERNAL_SEQUENCE_LOCK_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcthreads_extern.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct libcthreads_internal_sequence_lock libcthreads_internal_sequence_lock_t;
+
+struct libcthreads_internal_sequence_lock
+{
+	/* The sequence, which is odd while a writer holds the lock
+	 */
+	int32_t sequence;
+
+	/* The light mutex that serializes writers
+	 */
+	libcthreads_light_mutex_t writer_mutex;
+};
+
+LIBCTHREADS_EXTERN \
+int libcthreads_sequence_lock_initialize(
+     libcthreads_sequence_lock_t **sequence_lock,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_sequence_lock_free(
+     libcthreads_sequence_lock_t **sequence_lock,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_sequence_lock_begin_read(
+     libcthreads_sequence_lock_t *sequence_lock,
+     uint32_t *sequence,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_sequence_lock_end_read(
+     libcthreads_sequence_lock_t *sequence_lock,
+     uint32_t sequence,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_sequence_lock_grab_for_write(
+     libcthreads_sequence_lock_t *sequence_lock,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_sequence_lock_release_for_write(
+     libcthreads_sequence_lock_t *sequence_lock,
+     libcerror_error_t **error );
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCTHREADS_INTERNAL_SEQUENCE_LOCK_H ) */
+
@@ -0,0 +1,572 @@
+/*
+ * Sharded read/write lock functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcthreads_atomic.h"
+#include "libcthreads_definitions.h"
+#include "libcthreads_futex.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_light_mutex.h"
+#include "libcthreads_memory.h"
+#include "libcthreads_processor.h"
+#include "libcthreads_sharded_read_write_lock.h"
+#include "libcthreads_types.h"
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The maximum number of shards
+ */
+#define LIBCTHREADS_SHARDED_READ_WRITE_LOCK_MAXIMUM_NUMBER_OF_SHARDS	1024
+
+/* Creates a sharded read/write lock
+ * Make sure the value sharded_read_write_lock is referencing, is set to NULL
+ * A number of shards of 0 represents one shard per processor
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_sharded_read_write_lock_initialize(
+     libcthreads_sharded_read_write_lock_t **sharded_read_write_lock,
+     int number_of_shards,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_sharded_read_write_lock_t *internal_sharded_read_write_lock = NULL;
+	static char *function                                                            = "libcthreads_sharded_read_write_lock_initialize";
+	size_t shards_size                                                               = 0;
+
+	if( sharded_read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sharded_read_write_lock != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sharded read/write lock value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_shards < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of shards value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_shards > LIBCTHREADS_SHARDED_READ_WRITE_LOCK_MAXIMUM_NUMBER_OF_SHARDS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of shards value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_shards == 0 )
+	{
+		number_of_shards = libcthreads_processor_get_number_of_processors();
+
+		if( number_of_shards > LIBCTHREADS_SHARDED_READ_WRITE_LOCK_MAXIMUM_NUMBER_OF_SHARDS )
+		{
+			number_of_shards = LIBCTHREADS_SHARDED_READ_WRITE_LOCK_MAXIMUM_NUMBER_OF_SHARDS;
+		}
+	}
+	internal_sharded_read_write_lock = memory_allocate_structure(
+	                                    libcthreads_internal_sharded_read_write_lock_t );
+
+	if( internal_sharded_read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sharded read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_sharded_read_write_lock,
+	     0,
+	     sizeof( libcthreads_internal_sharded_read_write_lock_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sharded read/write lock.",
+		 function );
+
+		memory_free(
+		 internal_sharded_read_write_lock );
+
+		return( -1 );
+	}
+	shards_size = sizeof( libcthreads_internal_sharded_read_write_lock_shard_t ) * number_of_shards;
+
+	/* Every shard is aligned to a cache line so that readers via different shards
+	 * do not share a cache line
+	 */
+	internal_sharded_read_write_lock->shards = (libcthreads_internal_sharded_read_write_lock_shard_t *) libcthreads_memory_allocate_aligned(
+	                                                                                                     shards_size,
+	                                                                                                     LIBCTHREADS_CACHE_LINE_SIZE );
+
+	if( internal_sharded_read_write_lock->shards == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create shards.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_sharded_read_write_lock->shards,
+	     0,
+	     shards_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear shards.",
+		 function );
+
+		goto on_error;
+	}
+	internal_sharded_read_write_lock->number_of_shards = number_of_shards;
+	internal_sharded_read_write_lock->writer_mutex     = LIBCTHREADS_LIGHT_MUTEX_INIT;
+
+	*sharded_read_write_lock = (libcthreads_sharded_read_write_lock_t *) internal_sharded_read_write_lock;
+
+	return( 1 );
+
+on_error:
+	if( internal_sharded_read_write_lock != NULL )
+	{
+		if( internal_sharded_read_write_lock->shards != NULL )
+		{
+			libcthreads_memory_free_aligned(
+			 internal_sharded_read_write_lock->shards );
+		}
+		memory_free(
+		 internal_sharded_read_write_lock );
+	}
+	return( -1 );
+}
+
+/* Frees a sharded read/write lock
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_sharded_read_write_lock_free(
+     libcthreads_sharded_read_write_lock_t **sharded_read_write_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_sharded_read_write_lock_t *internal_sharded_read_write_lock = NULL;
+	static char *function                                                            = "libcthreads_sharded_read_write_lock_free";
+	int result                                                                       = 1;
+	int shard_index                                                                  = 0;
+
+	if( sharded_read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sharded_read_write_lock != NULL )
+	{
+		internal_sharded_read_write_lock = (libcthreads_internal_sharded_read_write_lock_t *) *sharded_read_write_lock;
+		*sharded_read_write_lock         = NULL;
+
+		if( libcthreads_atomic_load_sequential_int32(
+		     &( internal_sharded_read_write_lock->write_state ) ) != 0 )
+		{
+			result = 0;
+		}
+		for( shard_index = 0;
+		     shard_index < internal_sharded_read_write_lock->number_of_shards;
+		     shard_index++ )
+		{
+			if( libcthreads_atomic_load_sequential_int32(
+			     &( internal_sharded_read_write_lock->shards[ shard_index ].number_of_readers ) ) != 0 )
+			{
+				result = 0;
+			}
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to destroy sharded read/write lock with error: Resource busy.",
+			 function );
+
+			result = -1;
+		}
+		libcthreads_memory_free_aligned(
+		 internal_sharded_read_write_lock->shards );
+
+		memory_free(
+		 internal_sharded_read_write_lock );
+	}
+	return( result );
+}
+
+/* Retrieves the number of shards
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_sharded_read_write_lock_get_number_of_shards(
+     libcthreads_sharded_read_write_lock_t *sharded_read_write_lock,
+     int *number_of_shards,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_sharded_read_write_lock_t *internal_sharded_read_write_lock = NULL;
+	static char *function                                                            = "libcthreads_sharded_read_write_lock_get_number_of_shards";
+
+	if( sharded_read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sharded_read_write_lock = (libcthreads_internal_sharded_read_write_lock_t *) sharded_read_write_lock;
+
+	if( number_of_shards == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of shards.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_shards = internal_sharded_read_write_lock->number_of_shards;
+
+	return( 1 );
+}
+
+/* Grabs a sharded read/write lock for reading
+ * A reader only modifies the shard of the processor it runs on, hence readers on different
+ * processors do not share a cache line. The shard index must be passed to the corresponding
+ * libcthreads_sharded_read_write_lock_release_for_read, since the thread can be moved to another processor
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_sharded_read_write_lock_grab_for_read(
+     libcthreads_sharded_read_write_lock_t *sharded_read_write_lock,
+     int *shard_index,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_sharded_read_write_lock_shard_t *shard                      = NULL;
+	libcthreads_internal_sharded_read_write_lock_t *internal_sharded_read_write_lock = NULL;
+	static char *function                                                            = "libcthreads_sharded_read_write_lock_grab_for_read";
+	int safe_shard_index                                                             = 0;
+
+	if( sharded_read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sharded_read_write_lock = (libcthreads_internal_sharded_read_write_lock_t *) sharded_read_write_lock;
+
+	if( shard_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shard index.",
+		 function );
+
+		return( -1 );
+	}
+	safe_shard_index = libcthreads_processor_get_current_index() % internal_sharded_read_write_lock->number_of_shards;
+
+	shard = &( internal_sharded_read_write_lock->shards[ safe_shard_index ] );
+
+	/* The reader is registered in its shard before it checks for a writer, while a writer
+	 * sets the write state before it checks the shards, hence either the reader sees the
+	 * writer or the writer sees the reader
+	 */
+	libcthreads_atomic_add_int32(
+	 &( shard->number_of_readers ),
+	 1 );
+
+	while( libcthreads_atomic_load_sequential_int32(
+	        &( internal_sharded_read_write_lock->write_state ) ) != 0 )
+	{
+		/* Back off and wait until the writer has released the lock
+		 */
+		if( libcthreads_atomic_add_int32(
+		     &( shard->number_of_readers ),
+		     -1 ) == 0 )
+		{
+			libcthreads_futex_wake_single(
+			 &( shard->number_of_readers ) );
+		}
+		while( libcthreads_atomic_load_sequential_int32(
+		        &( internal_sharded_read_write_lock->write_state ) ) != 0 )
+		{
+			libcthreads_futex_wait(
+			 &( internal_sharded_read_write_lock->write_state ),
+			 1 );
+		}
+		libcthreads_atomic_add_int32(
+		 &( shard->number_of_readers ),
+		 1 );
+	}
+	*shard_index = safe_shard_index;
+
+	return( 1 );
+}
+
+/* Releases a sharded read/write lock for reading
+ * The shard index must be the one returned by libcthreads_sharded_read_write_lock_grab_for_read
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_sharded_read_write_lock_release_for_read(
+     libcthreads_sharded_read_write_lock_t *sharded_read_write_lock,
+     int shard_index,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_sharded_read_write_lock_shard_t *shard                      = NULL;
+	libcthreads_internal_sharded_read_write_lock_t *internal_sharded_read_write_lock = NULL;
+	static char *function                                                            = "libcthreads_sharded_read_write_lock_release_for_read";
+
+	if( sharded_read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sharded_read_write_lock = (libcthreads_internal_sharded_read_write_lock_t *) sharded_read_write_lock;
+
+	if( ( shard_index < 0 )
+	 || ( shard_index >= internal_sharded_read_write_lock->number_of_shards ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid shard index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	shard = &( internal_sharded_read_write_lock->shards[ shard_index ] );
+
+	if( libcthreads_atomic_load_sequential_int32(
+	     &( shard->number_of_readers ) ) <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sharded read/write lock - shard not grabbed for read.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_atomic_add_int32(
+	     &( shard->number_of_readers ),
+	     -1 ) == 0 )
+	{
+		/* Only a writer waits for the number of readers of a shard to become 0
+		 */
+		if( libcthreads_atomic_load_sequential_int32(
+		     &( internal_sharded_read_write_lock->write_state ) ) != 0 )
+		{
+			libcthreads_futex_wake_single(
+			 &( shard->number_of_readers ) );
+		}
+	}
+	return( 1 );
+}
+
+/* Grabs a sharded read/write lock for writing
+ * A writer waits for the readers of every shard, hence writing is more expensive than
+ * with a regular read/write lock
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_sharded_read_write_lock_grab_for_write(
+     libcthreads_sharded_read_write_lock_t *sharded_read_write_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_sharded_read_write_lock_shard_t *shard                      = NULL;
+	libcthreads_internal_sharded_read_write_lock_t *internal_sharded_read_write_lock = NULL;
+	static char *function                                                            = "libcthreads_sharded_read_write_lock_grab_for_write";
+	int32_t number_of_readers                                                        = 0;
+	int shard_index                                                                  = 0;
+
+	if( sharded_read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sharded_read_write_lock = (libcthreads_internal_sharded_read_write_lock_t *) sharded_read_write_lock;
+
+	if( libcthreads_light_mutex_grab(
+	     &( internal_sharded_read_write_lock->writer_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab writer mutex.",
+		 function );
+
+		return( -1 );
+	}
+	libcthreads_atomic_add_int32(
+	 &( internal_sharded_read_write_lock->write_state ),
+	 1 );
+
+	for( shard_index = 0;
+	     shard_index < internal_sharded_read_write_lock->number_of_shards;
+	     shard_index++ )
+	{
+		shard = &( internal_sharded_read_write_lock->shards[ shard_index ] );
+
+		number_of_readers = libcthreads_atomic_load_sequential_int32(
+		                     &( shard->number_of_readers ) );
+
+		while( number_of_readers != 0 )
+		{
+			libcthreads_futex_wait(
+			 &( shard->number_of_readers ),
+			 number_of_readers );
+
+			number_of_readers = libcthreads_atomic_load_sequential_int32(
+			                     &( shard->number_of_readers ) );
+		}
+	}
+	return( 1 );
+}
+
+/* Releases a sharded read/write lock for writing
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_sharded_read_write_lock_release_for_write(
+     libcthreads_sharded_read_write_lock_t *sharded_read_write_lock,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_sharded_read_write_lock_t *internal_sharded_read_write_lock = NULL;
+	static char *function                                                            = "libcthreads_sharded_read_write_lock_release_for_write";
+
+	if( sharded_read_write_lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sharded read/write lock.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sharded_read_write_lock = (libcthreads_internal_sharded_read_write_lock_t *) sharded_read_write_lock;
+
+	if( libcthreads_atomic_load_sequential_int32(
+	     &( internal_sharded_read_write_lock->write_state ) ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sharded read/write lock - not grabbed for write.",
+		 function );
+
+		return( -1 );
+	}
+	libcthreads_atomic_add_int32(
+	 &( internal_sharded_read_write_lock->write_state ),
+	 -1 );
+
+	libcthreads_futex_wake_all(
+	 &( internal_sharded_read_write_lock->write_state ) );
+
+	if( libcthreads_light_mutex_release(
+	     &( internal_sharded_read_write_lock->writer_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release writer mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
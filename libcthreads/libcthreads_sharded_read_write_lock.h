@@ -0,0 +1,119 @@
+/*
+ * Sharded read/write lock functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_SHARDED_READ_WRITE_LOCK_H )
+#define _LIBCTHREADS_INTERNAL_SHARDED_READ_WRITE_LOCK_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcthreads_definitions.h"
+#include "libcthreads_extern.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct libcthreads_internal_sharded_read_write_lock_shard libcthreads_internal_sharded_read_write_lock_shard_t;
+
+struct libcthreads_internal_sharded_read_write_lock_shard
+{
+	/* The number of readers that hold the lock via this shard
+	 */
+	int32_t number_of_readers;
+
+	/* Padding so that every shard has its own cache line
+	 */
+	uint8_t padding[ LIBCTHREADS_CACHE_LINE_SIZE - sizeof( int32_t ) ];
+};
+
+typedef struct libcthreads_internal_sharded_read_write_lock libcthreads_internal_sharded_read_write_lock_t;
+
+struct libcthreads_internal_sharded_read_write_lock
+{
+	/* The shards
+	 */
+	libcthreads_internal_sharded_read_write_lock_shard_t *shards;
+
+	/* The number of shards
+	 */
+	int number_of_shards;
+
+	/* Value to indicate a writer holds or waits for the lock
+	 */
+	int32_t write_state;
+
+	/* The light mutex that serializes writers
+	 */
+	libcthreads_light_mutex_t writer_mutex;
+};
+
+LIBCTHREADS_EXTERN \
+int libcthreads_sharded_read_write_lock_initialize(
+     libcthreads_sharded_read_write_lock_t **sharded_read_write_lock,
+     int number_of_shards,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_sharded_read_write_lock_free(
+     libcthreads_sharded_read_write_lock_t **sharded_read_write_lock,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_sharded_read_write_lock_get_number_of_shards(
+     libcthreads_sharded_read_write_lock_t *sharded_read_write_lock,
+     int *number_of_shards,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_sharded_read_write_lock_grab_for_read(
+     libcthreads_sharded_read_write_lock_t *sharded_read_write_lock,
+     int *shard_index,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_sharded_read_write_lock_release_for_read(
+     libcthreads_sharded_read_write_lock_t *sharded_read_write_lock,
+     int shard_index,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_sharded_read_write_lock_grab_for_write(
+     libcthreads_sharded_read_write_lock_t *sharded_read_write_lock,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_sharded_read_write_lock_release_for_write(
+     libcthreads_sharded_read_write_lock_t *sharded_read_write_lock,
+     libcerror_error_t **error );
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCTHREADS_INTERNAL_SHARDED_READ_WRITE_LOCK_H ) */
+
@@ -0,0 +1,112 @@
+/*
+ * Spin wait functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libcthreads_atomic.h"
+#include "libcthreads_spin_wait.h"
+
+/* The minimum number of spin iterations once spinning is enabled
+ */
+#define LIBCTHREADS_SPIN_WAIT_MINIMUM_SPIN_COUNT	10
+
+/* Determines the number of iterations to spin before parking
+ * The limit is twice the adaptive spin count, bounded by the maximum spin count
+ * This function can be called without holding the mutex that protects the spin wait state
+ * Returns the number of iterations or 0 if spinning is disabled
+ */
+int libcthreads_spin_wait_get_limit(
+     libcthreads_spin_wait_t *spin_wait )
+{
+	int maximum_spin_count = 0;
+	int spin_count         = 0;
+	int spin_limit         = 0;
+
+	if( spin_wait == NULL )
+	{
+		return( 0 );
+	}
+	maximum_spin_count = libcthreads_atomic_load_int(
+	                      &( spin_wait->maximum_spin_count ) );
+
+	if( maximum_spin_count <= 0 )
+	{
+		return( 0 );
+	}
+	spin_count = libcthreads_atomic_load_int(
+	              &( spin_wait->spin_count ) );
+
+	if( spin_count > ( ( maximum_spin_count - LIBCTHREADS_SPIN_WAIT_MINIMUM_SPIN_COUNT ) / 2 ) )
+	{
+		spin_limit = maximum_spin_count;
+	}
+	else
+	{
+		spin_limit = ( spin_count * 2 ) + LIBCTHREADS_SPIN_WAIT_MINIMUM_SPIN_COUNT;
+	}
+	return( spin_limit );
+}
+
+/* Spins while the value is zero
+ * This function is called without holding the condition mutex that protects the value
+ * Returns the number of iterations spun
+ */
+int libcthreads_spin_wait_while_zero(
+     int *value,
+     int spin_limit )
+{
+	int number_of_iterations = 0;
+
+	if( value == NULL )
+	{
+		return( 0 );
+	}
+	while( number_of_iterations < spin_limit )
+	{
+		if( libcthreads_atomic_load_int( value ) != 0 )
+		{
+			break;
+		}
+		libcthreads_atomic_pause();
+
+		number_of_iterations++;
+	}
+	return( number_of_iterations );
+}
+
+/* Updates the adaptive spin count after spinning
+ * The spin count moves 1/8th towards the number of iterations of the last spin
+ * so that it follows the recent hand-off latency
+ */
+void libcthreads_spin_wait_update(
+      libcthreads_spin_wait_t *spin_wait,
+      int number_of_iterations )
+{
+	if( spin_wait == NULL )
+	{
+		return;
+	}
+	libcthreads_atomic_store_int(
+	 &( spin_wait->spin_count ),
+	 spin_wait->spin_count + ( ( number_of_iterations - spin_wait->spin_count ) / 8 ) );
+}
+
@@ -0,0 +1,64 @@
+/*
+ * Spin wait functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_SPIN_WAIT_H )
+#define _LIBCTHREADS_INTERNAL_SPIN_WAIT_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcthreads_spin_wait libcthreads_spin_wait_t;
+
+/* The adaptive spin wait state
+ * The values are modified while holding the (condition) mutex of the owner
+ */
+struct libcthreads_spin_wait
+{
+	/* The maximum number of spin iterations, which is 0 if spinning is disabled
+	 */
+	int maximum_spin_count;
+
+	/* The adaptive number of spin iterations, which follows the recent hand-off latency
+	 */
+	int spin_count;
+};
+
+int libcthreads_spin_wait_get_limit(
+     libcthreads_spin_wait_t *spin_wait );
+
+int libcthreads_spin_wait_while_zero(
+     int *value,
+     int spin_limit );
+
+void libcthreads_spin_wait_update(
+      libcthreads_spin_wait_t *spin_wait,
+      int number_of_iterations );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCTHREADS_INTERNAL_SPIN_WAIT_H ) */
+
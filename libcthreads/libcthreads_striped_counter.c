@@ -0,0 +1,351 @@
+/*
+ * Striped counter functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcthreads_atomic.h"
+#include "libcthreads_definitions.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_memory.h"
+#include "libcthreads_processor.h"
+#include "libcthreads_striped_counter.h"
+#include "libcthreads_types.h"
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The maximum number of cells
+ */
+#define LIBCTHREADS_STRIPED_COUNTER_MAXIMUM_NUMBER_OF_CELLS	1024
+
+/* Creates a striped counter
+ * Make sure the value striped_counter is referencing, is set to NULL
+ * A number of cells of 0 represents one cell per processor
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_striped_counter_initialize(
+     libcthreads_striped_counter_t **striped_counter,
+     int number_of_cells,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_striped_counter_t *internal_striped_counter = NULL;
+	static char *function                                            = "libcthreads_striped_counter_initialize";
+	size_t cells_size                                                = 0;
+
+	if( striped_counter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid striped counter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *striped_counter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid striped counter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_cells < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of cells value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_cells > LIBCTHREADS_STRIPED_COUNTER_MAXIMUM_NUMBER_OF_CELLS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of cells value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_cells == 0 )
+	{
+		number_of_cells = libcthreads_processor_get_number_of_processors();
+
+		if( number_of_cells > LIBCTHREADS_STRIPED_COUNTER_MAXIMUM_NUMBER_OF_CELLS )
+		{
+			number_of_cells = LIBCTHREADS_STRIPED_COUNTER_MAXIMUM_NUMBER_OF_CELLS;
+		}
+	}
+	internal_striped_counter = memory_allocate_structure(
+	                            libcthreads_internal_striped_counter_t );
+
+	if( internal_striped_counter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create striped counter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_striped_counter,
+	     0,
+	     sizeof( libcthreads_internal_striped_counter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear striped counter.",
+		 function );
+
+		memory_free(
+		 internal_striped_counter );
+
+		return( -1 );
+	}
+	cells_size = sizeof( libcthreads_internal_striped_counter_cell_t ) * number_of_cells;
+
+	/* Every cell is aligned to a cache line so that threads that add via different cells
+	 * do not share a cache line
+	 */
+	internal_striped_counter->cells = (libcthreads_internal_striped_counter_cell_t *) libcthreads_memory_allocate_aligned(
+	                                                                                   cells_size,
+	                                                                                   LIBCTHREADS_CACHE_LINE_SIZE );
+
+	if( internal_striped_counter->cells == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cells.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_striped_counter->cells,
+	     0,
+	     cells_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cells.",
+		 function );
+
+		goto on_error;
+	}
+	internal_striped_counter->number_of_cells = number_of_cells;
+
+	*striped_counter = (libcthreads_striped_counter_t *) internal_striped_counter;
+
+	return( 1 );
+
+on_error:
+	if( internal_striped_counter != NULL )
+	{
+		if( internal_striped_counter->cells != NULL )
+		{
+			libcthreads_memory_free_aligned(
+			 internal_striped_counter->cells );
+		}
+		memory_free(
+		 internal_striped_counter );
+	}
+	return( -1 );
+}
+
+/* Frees a striped counter
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_striped_counter_free(
+     libcthreads_striped_counter_t **striped_counter,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_striped_counter_t *internal_striped_counter = NULL;
+	static char *function                                            = "libcthreads_striped_counter_free";
+
+	if( striped_counter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid striped counter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *striped_counter != NULL )
+	{
+		internal_striped_counter = (libcthreads_internal_striped_counter_t *) *striped_counter;
+		*striped_counter         = NULL;
+
+		libcthreads_memory_free_aligned(
+		 internal_striped_counter->cells );
+
+		memory_free(
+		 internal_striped_counter );
+	}
+	return( 1 );
+}
+
+/* Adds a value to a striped counter
+ * The value is added to the cell of the processor the calling thread runs on, hence threads
+ * on different processors do not share a cache line. A negative value subtracts from the counter
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_striped_counter_add(
+     libcthreads_striped_counter_t *striped_counter,
+     int64_t value,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_striped_counter_t *internal_striped_counter = NULL;
+	static char *function                                            = "libcthreads_striped_counter_add";
+	int cell_index                                                   = 0;
+
+	if( striped_counter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid striped counter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_striped_counter = (libcthreads_internal_striped_counter_t *) striped_counter;
+
+	cell_index = libcthreads_processor_get_current_index() % internal_striped_counter->number_of_cells;
+
+	libcthreads_atomic_add_int64(
+	 &( internal_striped_counter->cells[ cell_index ].value ),
+	 value );
+
+	return( 1 );
+}
+
+/* Retrieves the value of a striped counter
+ * The value is the sum of the cells. Values that are added while the cells are summed
+ * are not necessarily included
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_striped_counter_get_value(
+     libcthreads_striped_counter_t *striped_counter,
+     int64_t *value,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_striped_counter_t *internal_striped_counter = NULL;
+	static char *function                                            = "libcthreads_striped_counter_get_value";
+	int64_t safe_value                                               = 0;
+	int cell_index                                                   = 0;
+
+	if( striped_counter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid striped counter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_striped_counter = (libcthreads_internal_striped_counter_t *) striped_counter;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	for( cell_index = 0;
+	     cell_index < internal_striped_counter->number_of_cells;
+	     cell_index++ )
+	{
+		safe_value += libcthreads_atomic_load_int64(
+		               &( internal_striped_counter->cells[ cell_index ].value ) );
+	}
+	*value = safe_value;
+
+	return( 1 );
+}
+
+/* Resets the value of a striped counter to 0
+ * Values that are added while the cells are reset are not necessarily cleared
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_striped_counter_reset(
+     libcthreads_striped_counter_t *striped_counter,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_striped_counter_t *internal_striped_counter = NULL;
+	static char *function                                            = "libcthreads_striped_counter_reset";
+	int cell_index                                                   = 0;
+
+	if( striped_counter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid striped counter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_striped_counter = (libcthreads_internal_striped_counter_t *) striped_counter;
+
+	for( cell_index = 0;
+	     cell_index < internal_striped_counter->number_of_cells;
+	     cell_index++ )
+	{
+		libcthreads_atomic_store_int64(
+		 &( internal_striped_counter->cells[ cell_index ].value ),
+		 0 );
+	}
+	return( 1 );
+}
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
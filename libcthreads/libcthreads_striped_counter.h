@@ -0,0 +1,100 @@
+/*
+ * Striped counter functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_STRIPED_COUNTER_H )
+#define _LIBCTHREADS_INTERNAL_STRIPED_COUNTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcthreads_definitions.h"
+#include "libcthreads_extern.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct libcthreads_internal_striped_counter_cell libcthreads_internal_striped_counter_cell_t;
+
+struct libcthreads_internal_striped_counter_cell
+{
+	/* The part of the value that was added via this cell
+	 */
+	int64_t value;
+
+	/* Padding so that every cell has its own cache line
+	 */
+	uint8_t padding[ LIBCTHREADS_CACHE_LINE_SIZE - sizeof( int64_t ) ];
+};
+
+typedef struct libcthreads_internal_striped_counter libcthreads_internal_striped_counter_t;
+
+struct libcthreads_internal_striped_counter
+{
+	/* The cells
+	 */
+	libcthreads_internal_striped_counter_cell_t *cells;
+
+	/* The number of cells
+	 */
+	int number_of_cells;
+};
+
+LIBCTHREADS_EXTERN \
+int libcthreads_striped_counter_initialize(
+     libcthreads_striped_counter_t **striped_counter,
+     int number_of_cells,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_striped_counter_free(
+     libcthreads_striped_counter_t **striped_counter,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_striped_counter_add(
+     libcthreads_striped_counter_t *striped_counter,
+     int64_t value,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_striped_counter_get_value(
+     libcthreads_striped_counter_t *striped_counter,
+     int64_t *value,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_striped_counter_reset(
+     libcthreads_striped_counter_t *striped_counter,
+     libcerror_error_t **error );
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCTHREADS_INTERNAL_STRIPED_COUNTER_H ) */
+
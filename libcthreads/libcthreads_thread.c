@@ -37,7 +37,9 @@
 #include "libcthreads_libcerror.h"
 #include "libcthreads_thread.h"
 #include "libcthreads_thread_attributes.h"
+#include "libcthreads_thread_local_key.h"
 #include "libcthreads_types.h"
+#include "libcthreads_unused.h"
 
 #if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
 
@@ -51,20 +53,27 @@ DWORD WINAPI libcthreads_thread_callback_function_helper(
 {
 	libcthreads_internal_thread_t *internal_thread = NULL;
 	DWORD result                                   = 1;
-	int callback_function_result                   = 0;
 
 	if( arguments != NULL )
 	{
 		internal_thread = (libcthreads_internal_thread_t *) arguments;
 
-		if( ( internal_thread != NULL )
-		 && ( internal_thread->callback_function != NULL ) )
+		if( internal_thread->callback_function != NULL )
 		{
-			callback_function_result = internal_thread->callback_function(
-			                            internal_thread->callback_function_arguments );
+			internal_thread->callback_function_result = internal_thread->callback_function(
+			                                             internal_thread->callback_function_arguments );
+		}
+		result = (DWORD) ( internal_thread->callback_function_result != 1 );
+
+		if( internal_thread->is_detached != 0 )
+		{
+			memory_free(
+			 internal_thread );
 		}
-		result = (DWORD) ( callback_function_result != 1 );
 	}
+#if ( WINVER < 0x0600 )
+	libcthreads_thread_local_key_run_destructors();
+#endif
 	ExitThread(
 	 result );
 }
@@ -72,34 +81,31 @@ DWORD WINAPI libcthreads_thread_callback_function_helper(
 #elif defined( HAVE_PTHREAD_H )
 
 /* Start function helper function for pthread
- * Returns a pointer to a newly allocated int containing 1 if successful or -1 on error
- * NULL is return if the helper function was unable to run the callback
+ * The result of the callback function is stored in the thread
+ * Returns NULL
  */
 void *libcthreads_thread_callback_function_helper(
        void *arguments )
 {
 	libcthreads_internal_thread_t *internal_thread = NULL;
-	int *result                                    = NULL;
 
 	if( arguments != NULL )
 	{
 		internal_thread = (libcthreads_internal_thread_t *) arguments;
 
-		if( ( internal_thread != NULL )
-		 && ( internal_thread->callback_function != NULL ) )
+		if( internal_thread->callback_function != NULL )
+		{
+			internal_thread->callback_function_result = internal_thread->callback_function(
+			                                             internal_thread->callback_function_arguments );
+		}
+		if( internal_thread->is_detached != 0 )
 		{
-			result = (int *) memory_allocate(
-			                  sizeof( int ) );
-
-			if( result != NULL )
-			{
-				*result = internal_thread->callback_function(
-				           internal_thread->callback_function_arguments );
-			}
+			memory_free(
+			 internal_thread );
 		}
 	}
 	pthread_exit(
-	 (void *) result );
+	 NULL );
 
 #if defined( __MINGW32__ )
 	return( NULL );
@@ -283,6 +289,195 @@ on_error:
 	return( -1 );
 }
 
+/* Creates a detached thread
+ * A detached thread cannot be joined and frees its resources when the callback function returns,
+ * hence the result of the callback function is discarded
+ *
+ * The callback_function should return 1 if successful and -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_thread_create_detached(
+     const libcthreads_thread_attributes_t *thread_attributes,
+     int (*callback_function)(
+            void *arguments ),
+     void *callback_function_arguments,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_thread_t *internal_thread = NULL;
+	static char *function                          = "libcthreads_thread_create_detached";
+
+#if defined( WINAPI )
+	SECURITY_ATTRIBUTES *security_attributes       = NULL;
+	HANDLE thread_handle                           = NULL;
+	DWORD error_code                               = 0;
+	DWORD thread_identifier                        = 0;
+
+#elif defined( HAVE_PTHREAD_H )
+	pthread_attr_t attributes;
+
+	pthread_t thread                               = 0;
+	int pthread_result                             = 0;
+#endif
+
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread = memory_allocate_structure(
+	                   libcthreads_internal_thread_t );
+
+	if( internal_thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create thread.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_thread,
+	     0,
+	     sizeof( libcthreads_internal_thread_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear thread.",
+		 function );
+
+		memory_free(
+		 internal_thread );
+
+		return( -1 );
+	}
+	internal_thread->callback_function           = callback_function;
+	internal_thread->callback_function_arguments = callback_function_arguments;
+	internal_thread->is_detached                 = 1;
+
+	/* Once created the thread owns and frees internal_thread, hence the thread handle
+	 * and identifier are not stored in it
+	 */
+#if defined( WINAPI )
+	if( thread_attributes != NULL )
+	{
+		security_attributes = &( ( (libcthreads_internal_thread_attributes_t *) thread_attributes )->security_attributes );
+	}
+	thread_handle = CreateThread(
+	                 security_attributes,
+	                 0, /* stack size */
+	                 &libcthreads_thread_callback_function_helper,
+	                 (void *) internal_thread,
+	                 0, /* creation flags */
+	                 &thread_identifier );
+
+	if( thread_handle == NULL )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 error_code,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The thread is running and owns internal_thread, hence failing to close
+	 * the thread handle only leaks the handle and is not reported as an error
+	 */
+	CloseHandle(
+	 thread_handle );
+
+#elif defined( HAVE_PTHREAD_H )
+	/* The thread is created detached, so that it cannot fail to be detached
+	 * after it started and took ownership of internal_thread. The thread
+	 * attributes do not contain settings other than the defaults on this platform.
+	 */
+	LIBCTHREADS_UNREFERENCED_PARAMETER( thread_attributes )
+
+	pthread_result = pthread_attr_init(
+	                  &attributes );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 pthread_result,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize thread attributes.",
+		 function );
+
+		goto on_error;
+	}
+	pthread_result = pthread_attr_setdetachstate(
+	                  &attributes,
+	                  PTHREAD_CREATE_DETACHED );
+
+	if( pthread_result == 0 )
+	{
+		pthread_result = pthread_create(
+		                  &thread,
+		                  &attributes,
+		                  &libcthreads_thread_callback_function_helper,
+		                  (void *) internal_thread );
+	}
+	pthread_attr_destroy(
+	 &attributes );
+
+
+	switch( pthread_result )
+	{
+		case 0:
+			break;
+
+		case EAGAIN:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to create thread with error: Insufficient resources.",
+			 function );
+
+			goto on_error;
+
+		default:
+			libcerror_system_set_error(
+			 error,
+			 pthread_result,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to create thread.",
+			 function );
+
+			goto on_error;
+	}
+#endif /* defined( WINAPI ) else defined( HAVE_PTHREAD_H ) */
+
+	return( 1 );
+
+on_error:
+	if( internal_thread != NULL )
+	{
+		memory_free(
+		 internal_thread );
+	}
+	return( -1 );
+}
+
 /* Joins the current with a specified thread
  * The the thread is freed after join
  * Returns 1 if successful or -1 on error
@@ -300,7 +495,6 @@ int libcthreads_thread_join(
 	DWORD wait_status                              = 0;
 
 #elif defined( HAVE_PTHREAD_H )
-	int *thread_return_value                       = NULL;
 	int pthread_result                             = 0;
 #endif
 
@@ -352,7 +546,7 @@ int libcthreads_thread_join(
 #elif defined( HAVE_PTHREAD_H )
 	pthread_result = pthread_join(
 	                  internal_thread->thread,
-	                  (void **) &thread_return_value );
+	                  NULL );
 
 	if( pthread_result == EDEADLK )
 	{
@@ -377,10 +571,7 @@ int libcthreads_thread_join(
 
 		result = -1;
 	}
-	/* If the thread returns NULL it never got around to launching the callback function
-	 */
-	else if( ( thread_return_value != NULL )
-	      && ( *thread_return_value != 1 ) )
+	else if( internal_thread->callback_function_result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -388,17 +579,10 @@ int libcthreads_thread_join(
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
 		 "%s: thread returned an error status of: %d.",
 		 function,
-		 *thread_return_value );
+		 internal_thread->callback_function_result );
 
 		result = -1;
 	}
-	if( thread_return_value != NULL )
-	{
-		memory_free(
-		 thread_return_value );
-
-		thread_return_value = NULL;
-	}
 #endif /* defined( WINAPI ) else defined( HAVE_PTHREAD_H ) */
 
 	memory_free(
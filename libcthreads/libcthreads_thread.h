@@ -69,6 +69,14 @@ struct libcthreads_internal_thread
 	/* The callback function arguments
 	 */
 	void *callback_function_arguments;
+
+	/* The callback function result
+	 */
+	int callback_function_result;
+
+	/* Value to indicate the thread is detached and frees itself when the callback function returns
+	 */
+	uint8_t is_detached;
 };
 
 LIBCTHREADS_EXTERN \
@@ -80,6 +88,14 @@ int libcthreads_thread_create(
      void *callback_function_arguments,
      libcerror_error_t **error );
 
+LIBCTHREADS_EXTERN \
+int libcthreads_thread_create_detached(
+     const libcthreads_thread_attributes_t *thread_attributes,
+     int (*callback_function)(
+            void *arguments ),
+     void *callback_function_arguments,
+     libcerror_error_t **error );
+
 LIBCTHREADS_EXTERN \
 int libcthreads_thread_join(
      libcthreads_thread_t **thread,
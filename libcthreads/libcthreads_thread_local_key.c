@@ -0,0 +1,700 @@
+/*
+ * Thread local key functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include <errno.h>
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "libcthreads_definitions.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_light_mutex.h"
+#include "libcthreads_thread_local_key.h"
+#include "libcthreads_types.h"
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+
+/* Fiber local storage callback function for WINAPI
+ * Windows calls this function when a thread exits or when the key is deleted
+ */
+VOID WINAPI libcthreads_thread_local_key_callback_function_helper(
+             PVOID data )
+{
+	libcthreads_thread_local_key_value_t *thread_local_key_value = NULL;
+
+	if( data != NULL )
+	{
+		thread_local_key_value = (libcthreads_thread_local_key_value_t *) data;
+
+		if( ( thread_local_key_value->destructor_function != NULL )
+		 && ( thread_local_key_value->value != NULL ) )
+		{
+			thread_local_key_value->destructor_function(
+			 thread_local_key_value->value );
+		}
+		memory_free(
+		 thread_local_key_value );
+	}
+}
+
+#elif defined( WINAPI )
+
+/* Thread local storage has no callback when a thread exits, hence the keys with
+ * a destructor function are registered so the thread start functions can run them
+ */
+static libcthreads_internal_thread_local_key_t *libcthreads_thread_local_keys = NULL;
+
+static libcthreads_light_mutex_t libcthreads_thread_local_keys_mutex = LIBCTHREADS_LIGHT_MUTEX_INIT;
+
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0600 ) */
+
+/* Creates a thread local key
+ * Make sure the value thread_local_key is referencing, is set to NULL
+ *
+ * The destructor_function is optional and can be NULL. When a thread exits, including
+ * threads created by libcthreads_thread_create and thread pool workers, it is called
+ * with the value of that thread if not NULL. On Windows versions before Vista it is
+ * only called for threads created by libcthreads
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_thread_local_key_create(
+     libcthreads_thread_local_key_t **thread_local_key,
+     void (*destructor_function)(
+            void *value ),
+     libcerror_error_t **error )
+{
+	libcthreads_internal_thread_local_key_t *internal_thread_local_key = NULL;
+	static char *function                                              = "libcthreads_thread_local_key_create";
+
+#if defined( WINAPI )
+	DWORD error_code                                                   = 0;
+
+#elif defined( HAVE_PTHREAD_H )
+	int pthread_result                                                 = 0;
+#endif
+
+	if( thread_local_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread local key.",
+		 function );
+
+		return( -1 );
+	}
+	if( *thread_local_key != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid thread local key value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread_local_key = memory_allocate_structure(
+	                             libcthreads_internal_thread_local_key_t );
+
+	if( internal_thread_local_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create thread local key.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_thread_local_key,
+	     0,
+	     sizeof( libcthreads_internal_thread_local_key_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear thread local key.",
+		 function );
+
+		memory_free(
+		 internal_thread_local_key );
+
+		return( -1 );
+	}
+	internal_thread_local_key->destructor_function = destructor_function;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	/* Fiber local storage is used since, unlike thread local storage, it supports
+	 * a callback when a thread exits
+	 */
+	internal_thread_local_key->storage_index = FlsAlloc(
+	                                            &libcthreads_thread_local_key_callback_function_helper );
+
+	if( internal_thread_local_key->storage_index == FLS_OUT_OF_INDEXES )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 error_code,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to allocate fiber local storage index.",
+		 function );
+
+		goto on_error;
+	}
+#elif defined( WINAPI )
+	internal_thread_local_key->storage_index = TlsAlloc();
+
+	if( internal_thread_local_key->storage_index == TLS_OUT_OF_INDEXES )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 error_code,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to allocate thread local storage index.",
+		 function );
+
+		goto on_error;
+	}
+	if( destructor_function != NULL )
+	{
+		if( libcthreads_light_mutex_grab(
+		     &libcthreads_thread_local_keys_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab thread local keys mutex.",
+			 function );
+
+			TlsFree(
+			 internal_thread_local_key->storage_index );
+
+			goto on_error;
+		}
+		internal_thread_local_key->next_key = libcthreads_thread_local_keys;
+		libcthreads_thread_local_keys       = internal_thread_local_key;
+
+		if( libcthreads_light_mutex_release(
+		     &libcthreads_thread_local_keys_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release thread local keys mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#elif defined( HAVE_PTHREAD_H )
+	pthread_result = pthread_key_create(
+	                  &( internal_thread_local_key->key ),
+	                  destructor_function );
+
+	switch( pthread_result )
+	{
+		case 0:
+			break;
+
+		case EAGAIN:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create key with error: Insufficient resources.",
+			 function );
+
+			goto on_error;
+
+		default:
+			libcerror_system_set_error(
+			 error,
+			 pthread_result,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create key.",
+			 function );
+
+			goto on_error;
+	}
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0600 ) */
+
+	*thread_local_key = (libcthreads_thread_local_key_t *) internal_thread_local_key;
+
+	return( 1 );
+
+on_error:
+	if( internal_thread_local_key != NULL )
+	{
+		memory_free(
+		 internal_thread_local_key );
+	}
+	return( -1 );
+}
+
+/* Deletes a thread local key
+ * The destructor function is not called for the values of threads that are still running,
+ * except on Windows Vista or later, hence these values should be cleaned up beforehand
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_thread_local_key_delete(
+     libcthreads_thread_local_key_t **thread_local_key,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_thread_local_key_t *internal_thread_local_key = NULL;
+	static char *function                                              = "libcthreads_thread_local_key_delete";
+	int result                                                         = 1;
+
+#if defined( WINAPI ) && ( WINVER < 0x0600 )
+	libcthreads_internal_thread_local_key_t *key                       = NULL;
+	libcthreads_internal_thread_local_key_t *previous_key              = NULL;
+#endif
+#if defined( WINAPI )
+	DWORD error_code                                                   = 0;
+
+#elif defined( HAVE_PTHREAD_H )
+	int pthread_result                                                 = 0;
+#endif
+
+	if( thread_local_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread local key.",
+		 function );
+
+		return( -1 );
+	}
+	if( *thread_local_key != NULL )
+	{
+		internal_thread_local_key = (libcthreads_internal_thread_local_key_t *) *thread_local_key;
+		*thread_local_key         = NULL;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+		if( FlsFree(
+		     internal_thread_local_key->storage_index ) == 0 )
+		{
+			error_code = GetLastError();
+
+			libcerror_system_set_error(
+			 error,
+			 error_code,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free fiber local storage index.",
+			 function );
+
+			result = -1;
+		}
+#elif defined( WINAPI )
+		if( internal_thread_local_key->destructor_function != NULL )
+		{
+			if( libcthreads_light_mutex_grab(
+			     &libcthreads_thread_local_keys_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab thread local keys mutex.",
+				 function );
+
+				*thread_local_key = (libcthreads_thread_local_key_t *) internal_thread_local_key;
+
+				return( -1 );
+			}
+			previous_key = NULL;
+			key          = libcthreads_thread_local_keys;
+
+			while( ( key != NULL )
+			    && ( key != internal_thread_local_key ) )
+			{
+				previous_key = key;
+				key          = key->next_key;
+			}
+			if( key != NULL )
+			{
+				if( previous_key == NULL )
+				{
+					libcthreads_thread_local_keys = key->next_key;
+				}
+				else
+				{
+					previous_key->next_key = key->next_key;
+				}
+			}
+			if( libcthreads_light_mutex_release(
+			     &libcthreads_thread_local_keys_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release thread local keys mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( TlsFree(
+		     internal_thread_local_key->storage_index ) == 0 )
+		{
+			error_code = GetLastError();
+
+			libcerror_system_set_error(
+			 error,
+			 error_code,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free thread local storage index.",
+			 function );
+
+			result = -1;
+		}
+#elif defined( HAVE_PTHREAD_H )
+		pthread_result = pthread_key_delete(
+		                  internal_thread_local_key->key );
+
+		if( pthread_result != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 pthread_result,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to delete key.",
+			 function );
+
+			result = -1;
+		}
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0600 ) */
+
+		memory_free(
+		 internal_thread_local_key );
+	}
+	return( result );
+}
+
+/* Retrieves the value of the current thread
+ * The value is NULL if the current thread has not set a value
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_thread_local_key_get_value(
+     libcthreads_thread_local_key_t *thread_local_key,
+     void **value,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_thread_local_key_t *internal_thread_local_key = NULL;
+	static char *function                                              = "libcthreads_thread_local_key_get_value";
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	libcthreads_thread_local_key_value_t *thread_local_key_value       = NULL;
+#endif
+
+	if( thread_local_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread local key.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread_local_key = (libcthreads_internal_thread_local_key_t *) thread_local_key;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	thread_local_key_value = (libcthreads_thread_local_key_value_t *) FlsGetValue(
+	                                                                   internal_thread_local_key->storage_index );
+
+	if( thread_local_key_value == NULL )
+	{
+		*value = NULL;
+	}
+	else
+	{
+		*value = thread_local_key_value->value;
+	}
+#elif defined( WINAPI )
+	*value = TlsGetValue(
+	          internal_thread_local_key->storage_index );
+
+#elif defined( HAVE_PTHREAD_H )
+	*value = pthread_getspecific(
+	          internal_thread_local_key->key );
+
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0600 ) */
+
+	return( 1 );
+}
+
+/* Sets the value of the current thread
+ * The destructor function is not called for a value that is replaced
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_thread_local_key_set_value(
+     libcthreads_thread_local_key_t *thread_local_key,
+     void *value,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_thread_local_key_t *internal_thread_local_key = NULL;
+	static char *function                                              = "libcthreads_thread_local_key_set_value";
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	libcthreads_thread_local_key_value_t *thread_local_key_value       = NULL;
+	DWORD error_code                                                   = 0;
+
+#elif defined( WINAPI )
+	DWORD error_code                                                   = 0;
+
+#elif defined( HAVE_PTHREAD_H )
+	int pthread_result                                                 = 0;
+#endif
+
+	if( thread_local_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread local key.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread_local_key = (libcthreads_internal_thread_local_key_t *) thread_local_key;
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+	/* The fiber local storage callback is passed the stored data only, hence the stored data
+	 * also contains the destructor function
+	 */
+	thread_local_key_value = (libcthreads_thread_local_key_value_t *) FlsGetValue(
+	                                                                   internal_thread_local_key->storage_index );
+
+	if( thread_local_key_value == NULL )
+	{
+		if( value == NULL )
+		{
+			return( 1 );
+		}
+		thread_local_key_value = memory_allocate_structure(
+		                          libcthreads_thread_local_key_value_t );
+
+		if( thread_local_key_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create thread local key value.",
+			 function );
+
+			return( -1 );
+		}
+		thread_local_key_value->destructor_function = internal_thread_local_key->destructor_function;
+		thread_local_key_value->value               = NULL;
+
+		if( FlsSetValue(
+		     internal_thread_local_key->storage_index,
+		     (PVOID) thread_local_key_value ) == 0 )
+		{
+			error_code = GetLastError();
+
+			libcerror_system_set_error(
+			 error,
+			 error_code,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set fiber local storage value.",
+			 function );
+
+			memory_free(
+			 thread_local_key_value );
+
+			return( -1 );
+		}
+	}
+	thread_local_key_value->value = value;
+
+#elif defined( WINAPI )
+	if( TlsSetValue(
+	     internal_thread_local_key->storage_index,
+	     (LPVOID) value ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 error_code,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set thread local storage value.",
+		 function );
+
+		return( -1 );
+	}
+#elif defined( HAVE_PTHREAD_H )
+	pthread_result = pthread_setspecific(
+	                  internal_thread_local_key->key,
+	                  value );
+
+	if( pthread_result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 pthread_result,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0600 ) */
+
+	return( 1 );
+}
+
+#if defined( WINAPI ) && ( WINVER < 0x0600 )
+
+/* Runs the destructor functions of the thread local keys for the values of the current thread
+ * This function is called by the thread start functions when a thread exits, since
+ * thread local storage has no callback when a thread exits
+ */
+void libcthreads_thread_local_key_run_destructors(
+      void )
+{
+	libcerror_error_t *error                     = NULL;
+	libcthreads_internal_thread_local_key_t *key = NULL;
+	void (*destructor_function)(
+	       void *value )                         = NULL;
+	void *value                                  = NULL;
+	int number_of_calls                          = 0;
+	int number_of_keys                           = 0;
+
+	/* The value is cleared before its destructor function is called without the mutex
+	 * grabbed, hence the keys are scanned again after every call. A destructor function
+	 * can set a value again, hence the number of calls is bounded
+	 */
+	do
+	{
+		if( libcthreads_light_mutex_grab(
+		     &libcthreads_thread_local_keys_mutex,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		destructor_function = NULL;
+		value               = NULL;
+		number_of_keys      = 0;
+
+		for( key = libcthreads_thread_local_keys;
+		     key != NULL;
+		     key = key->next_key )
+		{
+			number_of_keys++;
+
+			if( destructor_function == NULL )
+			{
+				value = TlsGetValue(
+				         key->storage_index );
+
+				if( value != NULL )
+				{
+					TlsSetValue(
+					 key->storage_index,
+					 NULL );
+
+					destructor_function = key->destructor_function;
+				}
+			}
+		}
+		if( libcthreads_light_mutex_release(
+		     &libcthreads_thread_local_keys_mutex,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( destructor_function == NULL )
+		{
+			break;
+		}
+		destructor_function(
+		 value );
+
+		number_of_calls++;
+	}
+	while( number_of_calls < ( number_of_keys * LIBCTHREADS_THREAD_LOCAL_KEY_DESTRUCTOR_ITERATIONS ) );
+
+	return;
+
+on_error:
+#if defined( HAVE_VERBOSE_OUTPUT )
+	libcerror_error_backtrace_fprint(
+	 error,
+	 stdout );
+#endif
+	libcerror_error_free(
+	 &error );
+}
+
+#endif /* defined( WINAPI ) && ( WINVER < 0x0600 ) */
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,128 @@
+/*
+ * Thread local key functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_THREAD_LOCAL_KEY_H )
+#define _LIBCTHREADS_INTERNAL_THREAD_LOCAL_KEY_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "libcthreads_extern.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+#if defined( WINAPI ) && ( WINVER >= 0x0600 )
+
+typedef struct libcthreads_thread_local_key_value libcthreads_thread_local_key_value_t;
+
+struct libcthreads_thread_local_key_value
+{
+	/* The destructor function
+	 */
+	void (*destructor_function)(
+	       void *value );
+
+	/* The value
+	 */
+	void *value;
+};
+
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0600 ) */
+
+typedef struct libcthreads_internal_thread_local_key libcthreads_internal_thread_local_key_t;
+
+struct libcthreads_internal_thread_local_key
+{
+#if defined( WINAPI )
+	/* The fiber or thread local storage index
+	 */
+	DWORD storage_index;
+
+#elif defined( HAVE_PTHREAD_H )
+	/* The key
+	 */
+	pthread_key_t key;
+
+#else
+#error Missing thread local key type
+#endif
+
+	/* The destructor function
+	 */
+	void (*destructor_function)(
+	       void *value );
+
+#if defined( WINAPI ) && ( WINVER < 0x0600 )
+	/* The next key with a destructor function
+	 */
+	libcthreads_internal_thread_local_key_t *next_key;
+#endif
+};
+
+LIBCTHREADS_EXTERN \
+int libcthreads_thread_local_key_create(
+     libcthreads_thread_local_key_t **thread_local_key,
+     void (*destructor_function)(
+            void *value ),
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_thread_local_key_delete(
+     libcthreads_thread_local_key_t **thread_local_key,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_thread_local_key_get_value(
+     libcthreads_thread_local_key_t *thread_local_key,
+     void **value,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_thread_local_key_set_value(
+     libcthreads_thread_local_key_t *thread_local_key,
+     void *value,
+     libcerror_error_t **error );
+
+#if defined( WINAPI ) && ( WINVER < 0x0600 )
+
+void libcthreads_thread_local_key_run_destructors(
+      void );
+
+#endif /* defined( WINAPI ) && ( WINVER < 0x0600 ) */
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCTHREADS_INTERNAL_THREAD_LOCAL_KEY_H ) */
+
@@ -29,13 +29,18 @@
 #include <Threadpoolapiset.h>
 #endif
 
+#include "libcthreads_atomic.h"
 #include "libcthreads_condition.h"
 #include "libcthreads_definitions.h"
 #include "libcthreads_libcerror.h"
+#include "libcthreads_memory.h"
 #include "libcthreads_mutex.h"
 #include "libcthreads_queue.h"
+#include "libcthreads_spin_wait.h"
+#include "libcthreads_striped_counter.h"
 #include "libcthreads_thread.h"
 #include "libcthreads_thread_attributes.h"
+#include "libcthreads_thread_local_key.h"
 #include "libcthreads_thread_pool.h"
 #include "libcthreads_types.h"
 #include "libcthreads_unused.h"
@@ -176,6 +181,9 @@ DWORD WINAPI libcthreads_thread_pool_callback_function_helper(
 			}
 		}
 	}
+#if ( WINVER < 0x0600 )
+	libcthreads_thread_local_key_run_destructors();
+#endif
 	ExitThread(
 	 result );
 }
@@ -267,6 +275,301 @@ void *libcthreads_thread_pool_callback_function_helper(
 
 #endif /* defined( WINAPI ) && ( WINVER >= 0x0602 ) */
 
+/* Determines if a value of a specific weight fits in the queue of the thread pool
+ * A value with a weight of 0 is not restricted by the maximum weight
+ * Returns 1 if the value fits or 0 if not
+ */
+static int libcthreads_internal_thread_pool_value_fits(
+            libcthreads_internal_thread_pool_t *internal_thread_pool,
+            size_t weight )
+{
+	if( internal_thread_pool->number_of_values >= internal_thread_pool->allocated_number_of_values )
+	{
+		return( 0 );
+	}
+	if( weight == 0 )
+	{
+		return( 1 );
+	}
+	if( weight > ( (size_t) -1 - internal_thread_pool->current_weight ) )
+	{
+		return( 0 );
+	}
+	if( ( internal_thread_pool->maximum_weight == 0 )
+	 || ( internal_thread_pool->current_weight == 0 ) )
+	{
+		return( 1 );
+	}
+	if( ( internal_thread_pool->current_weight + weight ) > internal_thread_pool->maximum_weight )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Notifies a consumer that waits on the empty condition
+ * Since a single value was pushed, waking up a single consumer suffices
+ * The notification is skipped if no consumer is waiting
+ * The condition mutex must be held by the caller
+ * Returns 1 if successful or -1 on error
+ */
+static int libcthreads_internal_thread_pool_notify_consumer(
+            libcthreads_internal_thread_pool_t *internal_thread_pool,
+            libcerror_error_t **error )
+{
+	static char *function = "libcthreads_internal_thread_pool_notify_consumer";
+
+	if( internal_thread_pool->number_of_empty_waiters == 0 )
+	{
+		return( 1 );
+	}
+	if( libcthreads_condition_signal(
+	     internal_thread_pool->empty_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to signal empty condition.",
+		 function );
+
+		return( -1 );
+	}
+	libcthreads_striped_counter_add(
+	 internal_thread_pool->number_of_notifications,
+	 1,
+	 NULL );
+
+	return( 1 );
+}
+
+/* Notifies the producers that wait on the full condition
+ * Since a single value was popped, waking up a single producer suffices,
+ * unless the producers also wait for the weight of the queue to decrease
+ * or the thread pool is being joined
+ * The notification is skipped if no producer is waiting
+ * The condition mutex must be held by the caller
+ * Returns 1 if successful or -1 on error
+ */
+static int libcthreads_internal_thread_pool_notify_producers(
+            libcthreads_internal_thread_pool_t *internal_thread_pool,
+            libcerror_error_t **error )
+{
+	static char *function = "libcthreads_internal_thread_pool_notify_producers";
+	int result            = 0;
+
+	if( internal_thread_pool->number_of_full_waiters == 0 )
+	{
+		return( 1 );
+	}
+	if( ( internal_thread_pool->maximum_weight == 0 )
+	 && ( internal_thread_pool->status != LIBCTHREADS_STATUS_EXIT ) )
+	{
+		result = libcthreads_condition_signal(
+		          internal_thread_pool->full_condition,
+		          error );
+	}
+	else
+	{
+		result = libcthreads_condition_broadcast(
+		          internal_thread_pool->full_condition,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to notify full condition.",
+		 function );
+
+		return( -1 );
+	}
+	libcthreads_striped_counter_add(
+	 internal_thread_pool->number_of_notifications,
+	 1,
+	 NULL );
+
+	return( 1 );
+}
+
+/* Waits on a condition of the thread pool
+ * The number of waiters is maintained so that notifications can be skipped when nobody waits
+ * The condition mutex must be held by the caller
+ * Returns 1 if successful or -1 on error
+ */
+static int libcthreads_internal_thread_pool_wait(
+            libcthreads_internal_thread_pool_t *internal_thread_pool,
+            libcthreads_condition_t *condition,
+            int *number_of_waiters,
+            libcerror_error_t **error )
+{
+	static char *function = "libcthreads_internal_thread_pool_wait";
+	int result            = 0;
+
+	*number_of_waiters += 1;
+
+	result = libcthreads_condition_wait(
+	          condition,
+	          internal_thread_pool->condition_mutex,
+	          error );
+
+	*number_of_waiters -= 1;
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to wait for condition.",
+		 function );
+
+		return( -1 );
+	}
+	libcthreads_striped_counter_add(
+	 internal_thread_pool->number_of_wake_ups,
+	 1,
+	 NULL );
+
+	return( 1 );
+}
+
+/* Creates the statistics of the thread pool
+ * Returns 1 if successful or -1 on error
+ */
+static int libcthreads_internal_thread_pool_initialize_statistics(
+            libcthreads_internal_thread_pool_t *internal_thread_pool,
+            libcerror_error_t **error )
+{
+	static char *function = "libcthreads_internal_thread_pool_initialize_statistics";
+
+	if( libcthreads_striped_counter_initialize(
+	     &( internal_thread_pool->number_of_spin_hits ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create number of spin hits striped counter.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_striped_counter_initialize(
+	     &( internal_thread_pool->number_of_parks ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create number of parks striped counter.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_striped_counter_initialize(
+	     &( internal_thread_pool->number_of_notifications ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create number of notifications striped counter.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_striped_counter_initialize(
+	     &( internal_thread_pool->number_of_wake_ups ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create number of wake ups striped counter.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees the statistics of the thread pool
+ * Returns 1 if successful or -1 on error
+ */
+static int libcthreads_internal_thread_pool_free_statistics(
+            libcthreads_internal_thread_pool_t *internal_thread_pool,
+            libcerror_error_t **error )
+{
+	static char *function = "libcthreads_internal_thread_pool_free_statistics";
+	int result            = 1;
+
+	if( libcthreads_striped_counter_free(
+	     &( internal_thread_pool->number_of_wake_ups ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free number of wake ups striped counter.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_striped_counter_free(
+	     &( internal_thread_pool->number_of_notifications ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free number of notifications striped counter.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_striped_counter_free(
+	     &( internal_thread_pool->number_of_parks ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free number of parks striped counter.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_striped_counter_free(
+	     &( internal_thread_pool->number_of_spin_hits ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free number of spin hits striped counter.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
 /* Creates a thread pool
  * Make sure the value thread_pool is referencing, is set to NULL
  *
@@ -460,8 +763,9 @@ int libcthreads_thread_pool_create(
 
 		goto on_error;
 	}
-	internal_thread_pool->values_array = (intptr_t **) memory_allocate(
-	                                                    array_size );
+	internal_thread_pool->values_array = (intptr_t **) libcthreads_memory_allocate_aligned(
+	                                                    array_size,
+	                                                    LIBCTHREADS_CACHE_LINE_SIZE );
 
 	if( internal_thread_pool->values_array == NULL )
 	{
@@ -488,6 +792,47 @@ int libcthreads_thread_pool_create(
 
 		goto on_error;
 	}
+	array_size = sizeof( size_t ) * maximum_number_of_values;
+
+	if( array_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid weights array size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	internal_thread_pool->weights_array = (size_t *) memory_allocate(
+	                                                  array_size );
+
+	if( internal_thread_pool->weights_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create weights array.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_thread_pool->weights_array,
+	     0,
+	     array_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear weights array.",
+		 function );
+
+		goto on_error;
+	}
 	internal_thread_pool->allocated_number_of_values = maximum_number_of_values;
 
 	/* The callback must be set before the callback function helper threads are created */
@@ -533,6 +878,19 @@ int libcthreads_thread_pool_create(
 
 		goto on_error;
 	}
+	if( libcthreads_internal_thread_pool_initialize_statistics(
+	     internal_thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create statistics.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( WINAPI ) && ( WINVER >= 0x0602 )
 	InitializeThreadpoolEnvironment(
 	 &( internal_thread_pool->callback_environment ) );
@@ -874,6 +1232,10 @@ on_error:
 		}
 #endif /* defined( WINAPI ) && ( WINVER >= 0x0602 ) */
 
+		libcthreads_internal_thread_pool_free_statistics(
+		 internal_thread_pool,
+		 NULL );
+
 		if( internal_thread_pool->full_condition != NULL )
 		{
 			libcthreads_condition_free(
@@ -892,9 +1254,14 @@ on_error:
 			 &( internal_thread_pool->condition_mutex ),
 			 NULL );
 		}
-		if( internal_thread_pool->values_array != NULL )
+		if( internal_thread_pool->weights_array != NULL )
 		{
 			memory_free(
+			 internal_thread_pool->weights_array );
+		}
+		if( internal_thread_pool->values_array != NULL )
+		{
+			libcthreads_memory_free_aligned(
 			 internal_thread_pool->values_array );
 		}
 		memory_free(
@@ -911,8 +1278,10 @@ int libcthreads_internal_thread_pool_pop(
      intptr_t **value,
      libcerror_error_t **error )
 {
-	static char *function = "libcthreads_internal_thread_pool_pop";
-	int result            = 0;
+	static char *function    = "libcthreads_internal_thread_pool_pop";
+	int number_of_iterations = 0;
+	int result               = 0;
+	int spin_limit           = 0;
 
 	if( internal_thread_pool == NULL )
 	{
@@ -949,14 +1318,33 @@ int libcthreads_internal_thread_pool_pop(
 
 		return( -1 );
 	}
-	while( internal_thread_pool->number_of_values == 0 )
+	if( ( internal_thread_pool->number_of_values == 0 )
+	 && ( internal_thread_pool->spin_wait.maximum_spin_count > 0 ) )
 	{
-		if( internal_thread_pool->status == LIBCTHREADS_STATUS_EXIT )
+		/* Spin without holding the mutex so that a producer can hand off a value
+		 * without the cost of parking and waking up the thread
+		 */
+		spin_limit = libcthreads_spin_wait_get_limit(
+		              &( internal_thread_pool->spin_wait ) );
+
+		if( libcthreads_mutex_release(
+		     internal_thread_pool->condition_mutex,
+		     error ) != 1 )
 		{
-			break;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release condition mutex.",
+			 function );
+
+			return( -1 );
 		}
-		if( libcthreads_condition_wait(
-		     internal_thread_pool->empty_condition,
+		number_of_iterations = libcthreads_spin_wait_while_zero(
+		                        &( internal_thread_pool->number_of_values ),
+		                        spin_limit );
+
+		if( libcthreads_mutex_grab(
 		     internal_thread_pool->condition_mutex,
 		     error ) != 1 )
 		{
@@ -964,15 +1352,60 @@ int libcthreads_internal_thread_pool_pop(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to wait for empty condition.",
+			 "%s: unable to grab condition mutex.",
 			 function );
 
-			goto on_error;
+			return( -1 );
+		}
+		libcthreads_spin_wait_update(
+		 &( internal_thread_pool->spin_wait ),
+		 number_of_iterations );
+
+		if( internal_thread_pool->number_of_values != 0 )
+		{
+			libcthreads_striped_counter_add(
+			 internal_thread_pool->number_of_spin_hits,
+			 1,
+			 NULL );
 		}
 	}
-	if( internal_thread_pool->number_of_values > 0 )
+	if( ( internal_thread_pool->number_of_values == 0 )
+	 && ( internal_thread_pool->status != LIBCTHREADS_STATUS_EXIT ) )
 	{
-		*value = internal_thread_pool->values_array[ internal_thread_pool->pop_index ];
+		libcthreads_striped_counter_add(
+		 internal_thread_pool->number_of_parks,
+		 1,
+		 NULL );
+	}
+	while( internal_thread_pool->number_of_values == 0 )
+	{
+		if( internal_thread_pool->status == LIBCTHREADS_STATUS_EXIT )
+		{
+			break;
+		}
+		if( libcthreads_internal_thread_pool_wait(
+		     internal_thread_pool,
+		     internal_thread_pool->empty_condition,
+		     &( internal_thread_pool->number_of_empty_waiters ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to wait for empty condition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_thread_pool->number_of_values > 0 )
+	{
+		*value = internal_thread_pool->values_array[ internal_thread_pool->pop_index ];
+
+		internal_thread_pool->current_weight -= internal_thread_pool->weights_array[ internal_thread_pool->pop_index ];
+
+		internal_thread_pool->weights_array[ internal_thread_pool->pop_index ] = 0;
 
 		internal_thread_pool->pop_index++;
 
@@ -980,19 +1413,21 @@ int libcthreads_internal_thread_pool_pop(
 		{
 			internal_thread_pool->pop_index = 0;
 		}
-		internal_thread_pool->number_of_values--;
+		libcthreads_atomic_store_int(
+		 &( internal_thread_pool->number_of_values ),
+		 internal_thread_pool->number_of_values - 1 );
 
 		result = 1;
 
-		if( libcthreads_condition_broadcast(
-		     internal_thread_pool->full_condition,
+		if( libcthreads_internal_thread_pool_notify_producers(
+		     internal_thread_pool,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to broadcast full condition.",
+			 "%s: unable to notify producers.",
 			 function );
 
 			goto on_error;
@@ -1087,9 +1522,10 @@ int libcthreads_thread_pool_push(
 	}
 	while( internal_thread_pool->number_of_values == internal_thread_pool->allocated_number_of_values )
 	{
-		if( libcthreads_condition_wait(
+		if( libcthreads_internal_thread_pool_wait(
+		     internal_thread_pool,
 		     internal_thread_pool->full_condition,
-		     internal_thread_pool->condition_mutex,
+		     &( internal_thread_pool->number_of_full_waiters ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1110,19 +1546,186 @@ int libcthreads_thread_pool_push(
 	{
 		internal_thread_pool->push_index = 0;
 	}
-	internal_thread_pool->number_of_values++;
+	libcthreads_atomic_store_int(
+	 &( internal_thread_pool->number_of_values ),
+	 internal_thread_pool->number_of_values + 1 );
 
-	/* The condition broadcast must be protected by the mutex for the WINAPI version
+	/* The notification must be protected by the mutex for the WINAPI version
 	 */
-	if( libcthreads_condition_broadcast(
-	     internal_thread_pool->empty_condition,
+	if( libcthreads_internal_thread_pool_notify_consumer(
+	     internal_thread_pool,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to broadcast empty condition.",
+		 "%s: unable to notify consumer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_release(
+	     internal_thread_pool->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && ( WINVER >= 0x0602 )
+	thread_pool_work = CreateThreadpoolWork(
+	                    &libcthreads_thread_pool_callback_function_helper,
+	                    (void *) internal_thread_pool,
+	                    &( internal_thread_pool->callback_environment ) );
+
+	if( thread_pool_work == NULL )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 error_code,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool work.",
+		 function );
+
+		return( -1 );
+	}
+	SubmitThreadpoolWork(
+	 thread_pool_work );
+
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0602 ) */
+
+	return( 1 );
+
+on_error:
+	libcthreads_mutex_release(
+	 internal_thread_pool->condition_mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Pushes a value with a specific weight onto the queue of the thread pool
+ * Blocks while the queue is full or while the value does not fit in the remaining weight
+ * A value that exceeds the maximum weight is only pushed when the queue contains no weighted values
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_thread_pool_push_with_weight(
+     libcthreads_thread_pool_t *thread_pool,
+     intptr_t *value,
+     size_t weight,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_thread_pool_t *internal_thread_pool = NULL;
+	static char *function                                    = "libcthreads_thread_pool_push_with_weight";
+
+#if defined( WINAPI ) && ( WINVER >= 0x0602 )
+	TP_WORK *thread_pool_work                                = NULL;
+	DWORD error_code                                         = 0;
+#endif
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread_pool = (libcthreads_internal_thread_pool_t *) thread_pool;
+
+	if( internal_thread_pool->values_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid thread pool - missing values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_thread_pool->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( libcthreads_internal_thread_pool_value_fits(
+	        internal_thread_pool,
+	        weight ) == 0 )
+	{
+		if( libcthreads_internal_thread_pool_wait(
+		     internal_thread_pool,
+		     internal_thread_pool->full_condition,
+		     &( internal_thread_pool->number_of_full_waiters ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to wait for full condition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_thread_pool->values_array[ internal_thread_pool->push_index ]  = value;
+	internal_thread_pool->weights_array[ internal_thread_pool->push_index ] = weight;
+
+	internal_thread_pool->current_weight += weight;
+
+	internal_thread_pool->push_index++;
+
+	if( internal_thread_pool->push_index >= internal_thread_pool->allocated_number_of_values )
+	{
+		internal_thread_pool->push_index = 0;
+	}
+	libcthreads_atomic_store_int(
+	 &( internal_thread_pool->number_of_values ),
+	 internal_thread_pool->number_of_values + 1 );
+
+	/* The notification must be protected by the mutex for the WINAPI version
+	 */
+	if( libcthreads_internal_thread_pool_notify_consumer(
+	     internal_thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to notify consumer.",
 		 function );
 
 		goto on_error;
@@ -1280,9 +1883,10 @@ int libcthreads_thread_pool_push_sorted(
 	}
 	while( internal_thread_pool->number_of_values == internal_thread_pool->allocated_number_of_values )
 	{
-		if( libcthreads_condition_wait(
+		if( libcthreads_internal_thread_pool_wait(
+		     internal_thread_pool,
 		     internal_thread_pool->full_condition,
-		     internal_thread_pool->condition_mutex,
+		     &( internal_thread_pool->number_of_full_waiters ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1366,14 +1970,16 @@ int libcthreads_thread_pool_push_sorted(
 				{
 					previous_push_index = internal_thread_pool->allocated_number_of_values - 1;
 				}
-				internal_thread_pool->values_array[ push_index ] = internal_thread_pool->values_array[ previous_push_index ];
+				internal_thread_pool->values_array[ push_index ]  = internal_thread_pool->values_array[ previous_push_index ];
+				internal_thread_pool->weights_array[ push_index ] = internal_thread_pool->weights_array[ previous_push_index ];
 
 				push_index = previous_push_index;
 
 				previous_push_index--;
 			}
 		}
-		internal_thread_pool->values_array[ push_index ] = value;
+		internal_thread_pool->values_array[ push_index ]  = value;
+		internal_thread_pool->weights_array[ push_index ] = 0;
 
 		internal_thread_pool->push_index++;
 
@@ -1381,19 +1987,21 @@ int libcthreads_thread_pool_push_sorted(
 		{
 			internal_thread_pool->push_index = 0;
 		}
-		internal_thread_pool->number_of_values++;
+		libcthreads_atomic_store_int(
+		 &( internal_thread_pool->number_of_values ),
+		 internal_thread_pool->number_of_values + 1 );
 
-		/* The condition broadcast must be protected by the mutex for the WINAPI version
+		/* The notification must be protected by the mutex for the WINAPI version
 		 */
-		if( libcthreads_condition_broadcast(
-		     internal_thread_pool->empty_condition,
+		if( libcthreads_internal_thread_pool_notify_consumer(
+		     internal_thread_pool,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to broadcast empty condition.",
+			 "%s: unable to notify consumer.",
 			 function );
 
 			goto on_error;
@@ -1447,6 +2055,352 @@ on_error:
 	return( -1 );
 }
 
+/* Sets the maximum weight of the queue of the thread pool
+ * The maximum weight restricts the sum of the weights of the values pushed with a weight
+ * A maximum weight of 0 represents no restriction
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_thread_pool_set_maximum_weight(
+     libcthreads_thread_pool_t *thread_pool,
+     size_t maximum_weight,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_thread_pool_t *internal_thread_pool = NULL;
+	static char *function                                    = "libcthreads_thread_pool_set_maximum_weight";
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread_pool = (libcthreads_internal_thread_pool_t *) thread_pool;
+
+	if( libcthreads_mutex_grab(
+	     internal_thread_pool->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread_pool->maximum_weight = maximum_weight;
+
+	/* Wake up the waiting producers since their value might fit now
+	 * The condition broadcast must be protected by the mutex for the WINAPI version
+	 */
+	if( internal_thread_pool->number_of_full_waiters > 0 )
+	{
+		if( libcthreads_condition_broadcast(
+		     internal_thread_pool->full_condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast full condition.",
+			 function );
+
+			goto on_error;
+		}
+		libcthreads_striped_counter_add(
+	 internal_thread_pool->number_of_notifications,
+	 1,
+	 NULL );
+	}
+	if( libcthreads_mutex_release(
+	     internal_thread_pool->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	libcthreads_mutex_release(
+	 internal_thread_pool->condition_mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Sets the maximum spin count of the thread pool
+ * A consumer that finds the thread pool empty spins for an adaptive number of iterations,
+ * bounded by the maximum spin count, before it parks on the empty condition
+ * A maximum spin count of 0 disables spinning
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_thread_pool_set_maximum_spin_count(
+     libcthreads_thread_pool_t *thread_pool,
+     int maximum_spin_count,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_thread_pool_t *internal_thread_pool = NULL;
+	static char *function                                    = "libcthreads_thread_pool_set_maximum_spin_count";
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread_pool = (libcthreads_internal_thread_pool_t *) thread_pool;
+
+	if( maximum_spin_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum spin count value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_thread_pool->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread_pool->spin_wait.maximum_spin_count = maximum_spin_count;
+
+	if( internal_thread_pool->spin_wait.spin_count > maximum_spin_count )
+	{
+		internal_thread_pool->spin_wait.spin_count = maximum_spin_count;
+	}
+	if( libcthreads_mutex_release(
+	     internal_thread_pool->condition_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release condition mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the wait statistics of the thread pool
+ * The number of spin hits is the number of waits that were satisfied while spinning
+ * The number of parks is the number of waits that parked on the empty condition
+ * The spin count is the current adaptive number of spin iterations
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_thread_pool_get_wait_statistics(
+     libcthreads_thread_pool_t *thread_pool,
+     uint64_t *number_of_spin_hits,
+     uint64_t *number_of_parks,
+     int *spin_count,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_thread_pool_t *internal_thread_pool = NULL;
+	static char *function                                    = "libcthreads_thread_pool_get_wait_statistics";
+	int64_t value                                            = 0;
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread_pool = (libcthreads_internal_thread_pool_t *) thread_pool;
+
+	if( number_of_spin_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of spin hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_parks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of parks.",
+		 function );
+
+		return( -1 );
+	}
+	if( spin_count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid spin count.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_striped_counter_get_value(
+	     internal_thread_pool->number_of_spin_hits,
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of spin hits.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_spin_hits = (uint64_t) value;
+
+	if( libcthreads_striped_counter_get_value(
+	     internal_thread_pool->number_of_parks,
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of parks.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_parks = (uint64_t) value;
+
+	*spin_count = libcthreads_atomic_load_int(
+	               &( internal_thread_pool->spin_wait.spin_count ) );
+
+	return( 1 );
+}
+
+/* Retrieves the notification statistics of the thread pool
+ * The number of notifications is the number of times waiters were signalled
+ * The number of wake ups is the number of times a waiter returned from a condition wait
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_thread_pool_get_notify_statistics(
+     libcthreads_thread_pool_t *thread_pool,
+     uint64_t *number_of_notifications,
+     uint64_t *number_of_wake_ups,
+     libcerror_error_t **error )
+{
+	libcthreads_internal_thread_pool_t *internal_thread_pool = NULL;
+	static char *function                                    = "libcthreads_thread_pool_get_notify_statistics";
+	int64_t value                                            = 0;
+
+	if( thread_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread_pool = (libcthreads_internal_thread_pool_t *) thread_pool;
+
+	if( number_of_notifications == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of notifications.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_wake_ups == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of wake ups.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_striped_counter_get_value(
+	     internal_thread_pool->number_of_notifications,
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of notifications.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_notifications = (uint64_t) value;
+
+	if( libcthreads_striped_counter_get_value(
+	     internal_thread_pool->number_of_wake_ups,
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of wake ups.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_wake_ups = (uint64_t) value;
+
+	return( 1 );
+}
+
 /* Joins the current with a specified thread pool
  * The the thread is freed after join
  * Returns 1 if successful or -1 on error
@@ -1531,9 +2485,10 @@ int libcthreads_thread_pool_join(
 	{
 		/* Wait here to all the values in the queue have been processed
 		 */
-		if( libcthreads_condition_wait(
+		if( libcthreads_internal_thread_pool_wait(
+		     internal_thread_pool,
 		     internal_thread_pool->full_condition,
-		     internal_thread_pool->condition_mutex,
+		     &( internal_thread_pool->number_of_full_waiters ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1701,6 +2656,19 @@ int libcthreads_thread_pool_join(
 
 		result = -1;
 	}
+	if( libcthreads_internal_thread_pool_free_statistics(
+	     internal_thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free statistics.",
+		 function );
+
+		result = -1;
+	}
 #if defined( WINAPI ) && ( WINVER < 0x0602 )
 	memory_free(
 	 internal_thread_pool->thread_identifiers_array );
@@ -1714,6 +2682,8 @@ int libcthreads_thread_pool_join(
 #endif
 
 	memory_free(
+	 internal_thread_pool->weights_array );
+	libcthreads_memory_free_aligned(
 	 internal_thread_pool->values_array );
 	memory_free(
 	 internal_thread_pool );
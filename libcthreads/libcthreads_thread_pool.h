@@ -29,8 +29,11 @@
 #include <Threadpoolapiset.h>
 #endif
 
+#include "libcthreads_definitions.h"
 #include "libcthreads_extern.h"
 #include "libcthreads_libcerror.h"
+#include "libcthreads_spin_wait.h"
+#include "libcthreads_striped_counter.h"
 #include "libcthreads_types.h"
 
 #if defined( __cplusplus )
@@ -91,18 +94,6 @@ struct libcthreads_internal_thread_pool
 	 */
 	void *callback_function_arguments;
 
-	/* The (current) pop index
-	 */
-	int pop_index;
-
-	/* The (current) push index
-	 */
-	int push_index;
-
-	/* The number of values
-	 */
-	int number_of_values;
-
 	/* The allocated number of values
 	 */
 	int allocated_number_of_values;
@@ -111,6 +102,14 @@ struct libcthreads_internal_thread_pool
 	 */
 	intptr_t **values_array;
 
+	/* The weights array, which contains the weight per value
+	 */
+	size_t *weights_array;
+
+	/* The maximum weight, which is 0 if the weight of the queue is not limited
+	 */
+	size_t maximum_weight;
+
 	/* The condition mutex
 	 */
 	libcthreads_mutex_t *condition_mutex;
@@ -123,9 +122,72 @@ struct libcthreads_internal_thread_pool
 	 */
 	libcthreads_condition_t *full_condition;
 
+	/* The number of worker waits that were satisfied while spinning
+	 * The statistics are striped counters since every thread updates them
+	 */
+	libcthreads_striped_counter_t *number_of_spin_hits;
+
+	/* The number of worker waits that parked on the empty condition
+	 */
+	libcthreads_striped_counter_t *number_of_parks;
+
+	/* The number of condition notifications
+	 */
+	libcthreads_striped_counter_t *number_of_notifications;
+
+	/* The number of wake ups from a condition wait
+	 */
+	libcthreads_striped_counter_t *number_of_wake_ups;
+
 	/* The status
 	 */
 	uint8_t status;
+
+	/* The padding that separates the read-mostly state from the shared state
+	 */
+	uint8_t read_mostly_padding[ LIBCTHREADS_CACHE_LINE_SIZE ];
+
+	/* The number of values
+	 * The value is modified with atomic stores while holding the condition mutex
+	 * since spinning consumers read it without holding the condition mutex
+	 */
+	int number_of_values;
+
+	/* The current weight, which is the sum of the weights of the values in the queue
+	 */
+	size_t current_weight;
+
+	/* The padding that separates the shared state from the consumer state
+	 */
+	uint8_t shared_padding[ LIBCTHREADS_CACHE_LINE_SIZE ];
+
+	/* The (current) pop index
+	 */
+	int pop_index;
+
+	/* The number of consumers waiting on the empty condition
+	 */
+	int number_of_empty_waiters;
+
+	/* The adaptive spin wait state of the consumers
+	 */
+	libcthreads_spin_wait_t spin_wait;
+
+	/* The padding that separates the consumer state from the producer state
+	 */
+	uint8_t consumer_padding[ LIBCTHREADS_CACHE_LINE_SIZE ];
+
+	/* The (current) push index
+	 */
+	int push_index;
+
+	/* The number of producers waiting on the full condition
+	 */
+	int number_of_full_waiters;
+
+	/* The padding that separates the producer state from adjacent allocations
+	 */
+	uint8_t producer_padding[ LIBCTHREADS_CACHE_LINE_SIZE ];
 };
 
 LIBCTHREADS_EXTERN \
@@ -151,6 +213,13 @@ int libcthreads_thread_pool_push(
      intptr_t *value,
      libcerror_error_t **error );
 
+LIBCTHREADS_EXTERN \
+int libcthreads_thread_pool_push_with_weight(
+     libcthreads_thread_pool_t *thread_pool,
+     intptr_t *value,
+     size_t weight,
+     libcerror_error_t **error );
+
 LIBCTHREADS_EXTERN \
 int libcthreads_thread_pool_push_sorted(
      libcthreads_thread_pool_t *thread_pool,
@@ -162,6 +231,33 @@ int libcthreads_thread_pool_push_sorted(
      uint8_t sort_flags,
      libcerror_error_t **error );
 
+LIBCTHREADS_EXTERN \
+int libcthreads_thread_pool_set_maximum_weight(
+     libcthreads_thread_pool_t *thread_pool,
+     size_t maximum_weight,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_thread_pool_set_maximum_spin_count(
+     libcthreads_thread_pool_t *thread_pool,
+     int maximum_spin_count,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_thread_pool_get_wait_statistics(
+     libcthreads_thread_pool_t *thread_pool,
+     uint64_t *number_of_spin_hits,
+     uint64_t *number_of_parks,
+     int *spin_count,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_thread_pool_get_notify_statistics(
+     libcthreads_thread_pool_t *thread_pool,
+     uint64_t *number_of_notifications,
+     uint64_t *number_of_wake_ups,
+     libcerror_error_t **error );
+
 LIBCTHREADS_EXTERN \
 int libcthreads_thread_pool_join(
      libcthreads_thread_pool_t **thread_pool,
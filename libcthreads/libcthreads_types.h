@@ -34,29 +34,105 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libcthreads_barrier {}		libcthreads_barrier_t;
 typedef struct libcthreads_condition {}		libcthreads_condition_t;
+typedef struct libcthreads_epoch {}		libcthreads_epoch_t;
+typedef struct libcthreads_epoch_participant {}	libcthreads_epoch_participant_t;
+typedef struct libcthreads_hazard_pointer {}	libcthreads_hazard_pointer_t;
+typedef struct libcthreads_hazard_pointer_domain {}	libcthreads_hazard_pointer_domain_t;
+typedef struct libcthreads_latch {}		libcthreads_latch_t;
 typedef struct libcthreads_lock {}		libcthreads_lock_t;
+typedef struct libcthreads_lock_table {}	libcthreads_lock_table_t;
+typedef struct libcthreads_mcs_lock {}		libcthreads_mcs_lock_t;
 typedef struct libcthreads_mutex {}		libcthreads_mutex_t;
 typedef struct libcthreads_queue {}		libcthreads_queue_t;
+typedef struct libcthreads_queue_selector {}	libcthreads_queue_selector_t;
 typedef struct libcthreads_read_write_lock {}	libcthreads_read_write_lock_t;
 typedef struct libcthreads_repeating_thread {}	libcthreads_repeating_thread_t;
+typedef struct libcthreads_semaphore {}		libcthreads_semaphore_t;
+typedef struct libcthreads_sequence_lock {}	libcthreads_sequence_lock_t;
+typedef struct libcthreads_sharded_read_write_lock {}	libcthreads_sharded_read_write_lock_t;
+typedef struct libcthreads_striped_counter {}	libcthreads_striped_counter_t;
 typedef struct libcthreads_thread {}		libcthreads_thread_t;
 typedef struct libcthreads_thread_attributes {}	libcthreads_thread_attributes_t;
+typedef struct libcthreads_thread_local_key {}	libcthreads_thread_local_key_t;
 typedef struct libcthreads_thread_pool {}	libcthreads_thread_pool_t;
 
 #else
+typedef intptr_t libcthreads_barrier_t;
 typedef intptr_t libcthreads_condition_t;
+typedef intptr_t libcthreads_epoch_t;
+typedef intptr_t libcthreads_epoch_participant_t;
+typedef intptr_t libcthreads_hazard_pointer_t;
+typedef intptr_t libcthreads_hazard_pointer_domain_t;
+typedef intptr_t libcthreads_latch_t;
 typedef intptr_t libcthreads_lock_t;
+typedef intptr_t libcthreads_lock_table_t;
+typedef intptr_t libcthreads_mcs_lock_t;
 typedef intptr_t libcthreads_mutex_t;
 typedef intptr_t libcthreads_queue_t;
+typedef intptr_t libcthreads_queue_selector_t;
 typedef intptr_t libcthreads_read_write_lock_t;
 typedef intptr_t libcthreads_repeating_thread_t;
+typedef intptr_t libcthreads_semaphore_t;
+typedef intptr_t libcthreads_sequence_lock_t;
+typedef intptr_t libcthreads_sharded_read_write_lock_t;
+typedef intptr_t libcthreads_striped_counter_t;
 typedef intptr_t libcthreads_thread_t;
 typedef intptr_t libcthreads_thread_attributes_t;
+typedef intptr_t libcthreads_thread_local_key_t;
 typedef intptr_t libcthreads_thread_pool_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+/* The following type definitions are stored by the caller
+ * Their size does not depend on the platform or the configuration
+ */
+typedef int32_t libcthreads_light_mutex_t;
+typedef int32_t libcthreads_once_t;
+
+typedef struct libcthreads_lazy_value
+{
+	intptr_t data[ 2 ];
+
+} libcthreads_lazy_value_t;
+
+/* The lock storage is sized for the largest supported platform mutex, which is
+ * the 64 bytes pthread_mutex_t of macOS, the 32 bytes of internal state and
+ * a reserve of 32 bytes
+ */
+typedef struct libcthreads_lock_storage
+{
+	uint64_t data[ 16 ];
+
+} libcthreads_lock_storage_t;
+
+typedef struct libcthreads_mcs_lock_node
+{
+	intptr_t data[ 2 ];
+
+} libcthreads_mcs_lock_node_t;
+
+/* The mutex storage is sized for the largest supported platform mutex, which is
+ * the 64 bytes pthread_mutex_t of macOS, the 56 bytes of internal state and
+ * a reserve of 72 bytes
+ */
+typedef struct libcthreads_mutex_storage
+{
+	uint64_t data[ 24 ];
+
+} libcthreads_mutex_storage_t;
+
+/* The read/write lock storage is sized for the largest supported platform read/write
+ * lock, which is the 200 bytes pthread_rwlock_t of macOS, the 32 bytes of internal
+ * state and a reserve of 88 bytes
+ */
+typedef struct libcthreads_read_write_lock_storage
+{
+	uint64_t data[ 40 ];
+
+} libcthreads_read_write_lock_storage_t;
+
 #endif /* defined( HAVE_LOCAL_LIBCTHREADS ) && defined( HAVE_MULTI_THREAD_SUPPORT ) */
 
 #endif /* !defined( _LIBCTHREADS_INTERNAL_TYPES_H ) */
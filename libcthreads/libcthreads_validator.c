@@ -0,0 +1,975 @@
+/*
+ * Lock order validator functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_EXECINFO_H ) && !defined( WINAPI )
+#include <execinfo.h>
+#endif
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "libcthreads_definitions.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_light_mutex.h"
+#include "libcthreads_types.h"
+#include "libcthreads_validator.h"
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The lock classes
+ */
+static libcthreads_lock_class_t *libcthreads_validator_classes = NULL;
+
+/* The threads that hold locks
+ */
+static libcthreads_validator_thread_t *libcthreads_validator_threads = NULL;
+
+/* The light mutex that protects the validator state
+ */
+static libcthreads_light_mutex_t libcthreads_validator_mutex = LIBCTHREADS_LIGHT_MUTEX_INIT;
+
+/* The stream the reports are printed to, where NULL represents stderr
+ */
+static FILE *libcthreads_validator_report_stream = NULL;
+
+/* Value to indicate the reports should not be printed
+ */
+static uint8_t libcthreads_validator_report_disabled = 0;
+
+/* The number of reports
+ */
+static int libcthreads_validator_number_of_reports = 0;
+
+/* The generation of the last search for a dependency path
+ */
+static uint32_t libcthreads_validator_visit_generation = 0;
+
+/* Captures the stack of the calling thread
+ */
+static void libcthreads_internal_validator_capture_stack(
+             libcthreads_validator_stack_t *stack )
+{
+#if defined( WINAPI ) && ( WINVER >= 0x0501 )
+	stack->number_of_frames = (int) CaptureStackBackTrace(
+	                                 0,
+	                                 LIBCTHREADS_VALIDATOR_MAXIMUM_NUMBER_OF_FRAMES,
+	                                 stack->frames,
+	                                 NULL );
+
+#elif defined( HAVE_BACKTRACE ) && !defined( WINAPI )
+	stack->number_of_frames = backtrace(
+	                           stack->frames,
+	                           LIBCTHREADS_VALIDATOR_MAXIMUM_NUMBER_OF_FRAMES );
+
+#else
+	stack->number_of_frames = 0;
+#endif
+}
+
+/* Prints the stack of an acquisition
+ */
+static void libcthreads_internal_validator_stack_fprint(
+             libcthreads_validator_stack_t *stack,
+             FILE *stream )
+{
+#if defined( HAVE_BACKTRACE_SYMBOLS ) && !defined( WINAPI )
+	char **symbols  = NULL;
+#endif
+	int frame_index = 0;
+
+	if( stack->number_of_frames <= 0 )
+	{
+		fprintf(
+		 stream,
+		 "\t(stack not available)\n" );
+
+		return;
+	}
+#if defined( HAVE_BACKTRACE_SYMBOLS ) && !defined( WINAPI )
+	symbols = backtrace_symbols(
+	           stack->frames,
+	           stack->number_of_frames );
+#endif
+	for( frame_index = 0;
+	     frame_index < stack->number_of_frames;
+	     frame_index++ )
+	{
+#if defined( HAVE_BACKTRACE_SYMBOLS ) && !defined( WINAPI )
+		if( symbols != NULL )
+		{
+			fprintf(
+			 stream,
+			 "\t#%d %s\n",
+			 frame_index,
+			 symbols[ frame_index ] );
+
+			continue;
+		}
+#endif
+		fprintf(
+		 stream,
+		 "\t#%d %p\n",
+		 frame_index,
+		 stack->frames[ frame_index ] );
+	}
+#if defined( HAVE_BACKTRACE_SYMBOLS ) && !defined( WINAPI )
+	if( symbols != NULL )
+	{
+		/* The symbols are allocated by backtrace_symbols with malloc
+		 */
+		free(
+		 symbols );
+	}
+#endif
+}
+
+/* Determines if the calling thread is the thread of the validator thread
+ * Returns 1 if the calling thread is the thread or 0 if not
+ */
+static int libcthreads_internal_validator_thread_is_current(
+            libcthreads_validator_thread_t *validator_thread )
+{
+#if defined( WINAPI )
+	if( validator_thread->thread_identifier == GetCurrentThreadId() )
+	{
+		return( 1 );
+	}
+#elif defined( HAVE_PTHREAD_H )
+	if( pthread_equal(
+	     validator_thread->thread,
+	     pthread_self() ) != 0 )
+	{
+		return( 1 );
+	}
+#endif
+	return( 0 );
+}
+
+/* Searches for a dependency path between two lock classes
+ * On success dependency_class and dependency are set to the last dependency of the path
+ * The validator mutex must be held
+ * Returns 1 if a path was found or 0 if not
+ */
+static int libcthreads_internal_validator_find_path(
+            libcthreads_lock_class_t *from_class,
+            libcthreads_lock_class_t *to_class,
+            libcthreads_lock_class_t **dependency_class,
+            libcthreads_validator_dependency_t **dependency )
+{
+	libcthreads_validator_dependency_t *safe_dependency = NULL;
+
+	from_class->visit_generation = libcthreads_validator_visit_generation;
+
+	for( safe_dependency = from_class->dependencies;
+	     safe_dependency != NULL;
+	     safe_dependency = safe_dependency->next_dependency )
+	{
+		if( safe_dependency->lock_class == to_class )
+		{
+			*dependency_class = from_class;
+			*dependency       = safe_dependency;
+
+			return( 1 );
+		}
+	}
+	for( safe_dependency = from_class->dependencies;
+	     safe_dependency != NULL;
+	     safe_dependency = safe_dependency->next_dependency )
+	{
+		if( safe_dependency->lock_class->visit_generation == libcthreads_validator_visit_generation )
+		{
+			continue;
+		}
+		if( libcthreads_internal_validator_find_path(
+		     safe_dependency->lock_class,
+		     to_class,
+		     dependency_class,
+		     dependency ) != 0 )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Reports a lock order inversion
+ * The validator mutex must be held
+ */
+static void libcthreads_internal_validator_report(
+             libcthreads_lock_class_t *lock_class,
+             libcthreads_lock_class_t *held_class,
+             libcthreads_validator_stack_t *stack,
+             libcthreads_lock_class_t *dependency_class,
+             libcthreads_validator_dependency_t *dependency )
+{
+	FILE *stream = NULL;
+
+	libcthreads_validator_number_of_reports++;
+
+	if( libcthreads_validator_report_disabled != 0 )
+	{
+		return;
+	}
+	stream = libcthreads_validator_report_stream;
+
+	if( stream == NULL )
+	{
+		stream = stderr;
+	}
+	fprintf(
+	 stream,
+	 "libcthreads: possible deadlock: lock class: %s acquired while holding lock class: %s\n",
+	 lock_class->name,
+	 held_class->name );
+
+	fprintf(
+	 stream,
+	 "which is the reverse of the order in which lock class: %s was acquired while holding lock class: %s\n",
+	 dependency->lock_class->name,
+	 dependency_class->name );
+
+	fprintf(
+	 stream,
+	 "Current acquisition stack:\n" );
+
+	libcthreads_internal_validator_stack_fprint(
+	 stack,
+	 stream );
+
+	fprintf(
+	 stream,
+	 "Previous acquisition stack:\n" );
+
+	libcthreads_internal_validator_stack_fprint(
+	 &( dependency->stack ),
+	 stream );
+
+	fprintf(
+	 stream,
+	 "\n" );
+
+	fflush(
+	 stream );
+}
+
+/* Retrieves the lock class of a specific name
+ * The lock class is created if it does not exist
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_validator_get_class_by_name(
+     const char *name,
+     libcthreads_lock_class_t **lock_class,
+     libcerror_error_t **error )
+{
+	libcthreads_lock_class_t *last_class = NULL;
+	libcthreads_lock_class_t *safe_class = NULL;
+	static char *function                = "libcthreads_validator_get_class_by_name";
+	size_t name_size                     = 0;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( lock_class == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock class.",
+		 function );
+
+		return( -1 );
+	}
+	name_size = narrow_string_length(
+	             name ) + 1;
+
+	if( libcthreads_light_mutex_grab(
+	     &libcthreads_validator_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab validator mutex.",
+		 function );
+
+		return( -1 );
+	}
+	for( safe_class = libcthreads_validator_classes;
+	     safe_class != NULL;
+	     safe_class = safe_class->next_class )
+	{
+		if( ( safe_class->name_size == name_size )
+		 && ( narrow_string_compare(
+		       safe_class->name,
+		       name,
+		       name_size ) == 0 ) )
+		{
+			break;
+		}
+		last_class = safe_class;
+	}
+	if( safe_class == NULL )
+	{
+		safe_class = memory_allocate_structure(
+		              libcthreads_lock_class_t );
+
+		if( safe_class == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create lock class.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     safe_class,
+		     0,
+		     sizeof( libcthreads_lock_class_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear lock class.",
+			 function );
+
+			memory_free(
+			 safe_class );
+
+			goto on_error;
+		}
+		safe_class->name = narrow_string_allocate(
+		                    name_size );
+
+		if( safe_class->name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create name.",
+			 function );
+
+			memory_free(
+			 safe_class );
+
+			goto on_error;
+		}
+		if( narrow_string_copy(
+		     safe_class->name,
+		     name,
+		     name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name.",
+			 function );
+
+			memory_free(
+			 safe_class->name );
+
+			memory_free(
+			 safe_class );
+
+			goto on_error;
+		}
+		safe_class->name_size = name_size;
+
+		if( last_class == NULL )
+		{
+			libcthreads_validator_classes = safe_class;
+		}
+		else
+		{
+			last_class->next_class = safe_class;
+		}
+	}
+	if( libcthreads_light_mutex_release(
+	     &libcthreads_validator_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release validator mutex.",
+		 function );
+
+		return( -1 );
+	}
+	*lock_class = safe_class;
+
+	return( 1 );
+
+on_error:
+	libcthreads_light_mutex_release(
+	 &libcthreads_validator_mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the validator thread of the calling thread, which is created if needed
+ * The validator mutex must be grabbed by the caller
+ * Returns a pointer to the validator thread or NULL if it could not be created
+ */
+static libcthreads_validator_thread_t *libcthreads_internal_validator_get_current_thread(
+                                        void )
+{
+	libcthreads_validator_thread_t *validator_thread = NULL;
+
+	for( validator_thread = libcthreads_validator_threads;
+	     validator_thread != NULL;
+	     validator_thread = validator_thread->next_thread )
+	{
+		if( libcthreads_internal_validator_thread_is_current(
+		     validator_thread ) != 0 )
+		{
+			break;
+		}
+	}
+	if( validator_thread == NULL )
+	{
+		validator_thread = memory_allocate_structure(
+		                    libcthreads_validator_thread_t );
+
+		if( validator_thread == NULL )
+		{
+			return( NULL );
+		}
+		validator_thread->number_of_held_locks = 0;
+
+#if defined( WINAPI )
+		validator_thread->thread_identifier = GetCurrentThreadId();
+
+#elif defined( HAVE_PTHREAD_H )
+		validator_thread->thread = pthread_self();
+#endif
+		validator_thread->next_thread = libcthreads_validator_threads;
+		libcthreads_validator_threads = validator_thread;
+	}
+	return( validator_thread );
+}
+
+/* Records a lock as held by the validator thread
+ * The validator mutex must be grabbed by the caller
+ */
+static void libcthreads_internal_validator_append_held_lock(
+             libcthreads_validator_thread_t *validator_thread,
+             libcthreads_lock_class_t *lock_class,
+             intptr_t *lock )
+{
+	int held_lock_index = 0;
+
+	/* Locks beyond the maximum are not tracked
+	 */
+	if( validator_thread->number_of_held_locks < LIBCTHREADS_VALIDATOR_MAXIMUM_NUMBER_OF_HELD_LOCKS )
+	{
+		held_lock_index = validator_thread->number_of_held_locks;
+
+		validator_thread->held_classes[ held_lock_index ] = lock_class;
+		validator_thread->held_locks[ held_lock_index ]   = lock;
+
+		validator_thread->number_of_held_locks++;
+	}
+}
+
+/* Validates and records the acquisition of a lock by the calling thread
+ * This function must be called before the lock is grabbed, so that a possible deadlock
+ * is reported before it occurs
+ * A lock order inversion is reported the first time the dependency between the lock classes is seen
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_validator_acquire(
+     libcthreads_lock_class_t *lock_class,
+     intptr_t *lock,
+     libcerror_error_t **error )
+{
+	libcthreads_validator_stack_t stack;
+
+	libcthreads_lock_class_t *dependency_class         = NULL;
+	libcthreads_lock_class_t *held_class               = NULL;
+	libcthreads_validator_dependency_t *dependency     = NULL;
+	libcthreads_validator_dependency_t *new_dependency = NULL;
+	libcthreads_validator_thread_t *validator_thread   = NULL;
+	static char *function                              = "libcthreads_validator_acquire";
+	int held_lock_index                                = 0;
+
+	if( lock_class == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock class.",
+		 function );
+
+		return( -1 );
+	}
+	if( lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock.",
+		 function );
+
+		return( -1 );
+	}
+	stack.number_of_frames = -1;
+
+	if( libcthreads_light_mutex_grab(
+	     &libcthreads_validator_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab validator mutex.",
+		 function );
+
+		return( -1 );
+	}
+	validator_thread = libcthreads_internal_validator_get_current_thread();
+
+	if( validator_thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create validator thread.",
+		 function );
+
+		goto on_error;
+	}
+	for( held_lock_index = 0;
+	     held_lock_index < validator_thread->number_of_held_locks;
+	     held_lock_index++ )
+	{
+		held_class = validator_thread->held_classes[ held_lock_index ];
+
+		if( held_class == lock_class )
+		{
+			continue;
+		}
+		for( dependency = held_class->dependencies;
+		     dependency != NULL;
+		     dependency = dependency->next_dependency )
+		{
+			if( dependency->lock_class == lock_class )
+			{
+				break;
+			}
+		}
+		if( dependency != NULL )
+		{
+			continue;
+		}
+		if( stack.number_of_frames == -1 )
+		{
+			libcthreads_internal_validator_capture_stack(
+			 &stack );
+		}
+		libcthreads_validator_visit_generation++;
+
+		if( libcthreads_internal_validator_find_path(
+		     lock_class,
+		     held_class,
+		     &dependency_class,
+		     &dependency ) != 0 )
+		{
+			libcthreads_internal_validator_report(
+			 lock_class,
+			 held_class,
+			 &stack,
+			 dependency_class,
+			 dependency );
+		}
+		/* The dependency is also added when reported, so that the inversion is reported only once
+		 */
+		new_dependency = memory_allocate_structure(
+		                  libcthreads_validator_dependency_t );
+
+		if( new_dependency == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create dependency.",
+			 function );
+
+			goto on_error;
+		}
+		new_dependency->lock_class      = lock_class;
+		new_dependency->stack           = stack;
+		new_dependency->next_dependency = held_class->dependencies;
+		held_class->dependencies        = new_dependency;
+	}
+	libcthreads_internal_validator_append_held_lock(
+	 validator_thread,
+	 lock_class,
+	 lock );
+
+	if( libcthreads_light_mutex_release(
+	     &libcthreads_validator_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release validator mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	libcthreads_light_mutex_release(
+	 &libcthreads_validator_mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Records the acquisition of a lock by a successful try grab of the calling thread
+ * A try grab cannot deadlock, hence the lock order is not validated, but the lock
+ * is recorded as held, so that the locks acquired while it is held are validated
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_validator_try_acquire(
+     libcthreads_lock_class_t *lock_class,
+     intptr_t *lock,
+     libcerror_error_t **error )
+{
+	libcthreads_validator_thread_t *validator_thread = NULL;
+	static char *function                            = "libcthreads_validator_try_acquire";
+
+	if( lock_class == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock class.",
+		 function );
+
+		return( -1 );
+	}
+	if( lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_light_mutex_grab(
+	     &libcthreads_validator_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab validator mutex.",
+		 function );
+
+		return( -1 );
+	}
+	validator_thread = libcthreads_internal_validator_get_current_thread();
+
+	if( validator_thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create validator thread.",
+		 function );
+
+		goto on_error;
+	}
+	libcthreads_internal_validator_append_held_lock(
+	 validator_thread,
+	 lock_class,
+	 lock );
+
+	if( libcthreads_light_mutex_release(
+	     &libcthreads_validator_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release validator mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	libcthreads_light_mutex_release(
+	 &libcthreads_validator_mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Records the release of a lock by the calling thread
+ * Locks that were not recorded by libcthreads_validator_acquire or libcthreads_validator_try_acquire are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_validator_release(
+     intptr_t *lock,
+     libcerror_error_t **error )
+{
+	libcthreads_validator_thread_t *previous_thread  = NULL;
+	libcthreads_validator_thread_t *validator_thread = NULL;
+	static char *function                            = "libcthreads_validator_release";
+	int held_lock_index                              = 0;
+
+	if( lock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lock.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_light_mutex_grab(
+	     &libcthreads_validator_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab validator mutex.",
+		 function );
+
+		return( -1 );
+	}
+	for( validator_thread = libcthreads_validator_threads;
+	     validator_thread != NULL;
+	     validator_thread = validator_thread->next_thread )
+	{
+		if( libcthreads_internal_validator_thread_is_current(
+		     validator_thread ) != 0 )
+		{
+			break;
+		}
+		previous_thread = validator_thread;
+	}
+	if( validator_thread != NULL )
+	{
+		/* Locks are not necessarily released in reverse order of acquisition
+		 */
+		for( held_lock_index = validator_thread->number_of_held_locks - 1;
+		     held_lock_index >= 0;
+		     held_lock_index-- )
+		{
+			if( validator_thread->held_locks[ held_lock_index ] == lock )
+			{
+				break;
+			}
+		}
+		if( held_lock_index >= 0 )
+		{
+			validator_thread->number_of_held_locks--;
+
+			while( held_lock_index < validator_thread->number_of_held_locks )
+			{
+				validator_thread->held_classes[ held_lock_index ] = validator_thread->held_classes[ held_lock_index + 1 ];
+				validator_thread->held_locks[ held_lock_index ]   = validator_thread->held_locks[ held_lock_index + 1 ];
+
+				held_lock_index++;
+			}
+		}
+		if( validator_thread->number_of_held_locks == 0 )
+		{
+			if( previous_thread == NULL )
+			{
+				libcthreads_validator_threads = validator_thread->next_thread;
+			}
+			else
+			{
+				previous_thread->next_thread = validator_thread->next_thread;
+			}
+			memory_free(
+			 validator_thread );
+		}
+	}
+	if( libcthreads_light_mutex_release(
+	     &libcthreads_validator_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release validator mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the stream the lock order validator reports possible deadlocks to
+ * A stream of NULL disables printing the reports, by default the reports are printed to stderr
+ * The reports are only made when libcthreads was built with lock validator support
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_validator_set_report_stream(
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "libcthreads_validator_set_report_stream";
+
+	if( libcthreads_light_mutex_grab(
+	     &libcthreads_validator_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab validator mutex.",
+		 function );
+
+		return( -1 );
+	}
+	libcthreads_validator_report_stream = stream;
+
+	if( stream == NULL )
+	{
+		libcthreads_validator_report_disabled = 1;
+	}
+	else
+	{
+		libcthreads_validator_report_disabled = 0;
+	}
+	if( libcthreads_light_mutex_release(
+	     &libcthreads_validator_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release validator mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of possible deadlocks the lock order validator reported
+ * Returns 1 if successful or -1 on error
+ */
+int libcthreads_validator_get_number_of_reports(
+     int *number_of_reports,
+     libcerror_error_t **error )
+{
+	static char *function = "libcthreads_validator_get_number_of_reports";
+
+	if( number_of_reports == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of reports.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_light_mutex_grab(
+	     &libcthreads_validator_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab validator mutex.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_reports = libcthreads_validator_number_of_reports;
+
+	if( libcthreads_light_mutex_release(
+	     &libcthreads_validator_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release validator mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,184 @@
+/*
+ * Lock order validator functions
+ *
+ * Copyright (C) 2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCTHREADS_INTERNAL_VALIDATOR_H )
+#define _LIBCTHREADS_INTERNAL_VALIDATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_PTHREAD_H ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
+#include "libcthreads_extern.h"
+#include "libcthreads_libcerror.h"
+#include "libcthreads_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The maximum number of stack frames stored per acquisition
+ */
+#define LIBCTHREADS_VALIDATOR_MAXIMUM_NUMBER_OF_FRAMES	16
+
+/* The maximum number of locks tracked per thread
+ */
+#define LIBCTHREADS_VALIDATOR_MAXIMUM_NUMBER_OF_HELD_LOCKS	32
+
+typedef struct libcthreads_lock_class libcthreads_lock_class_t;
+typedef struct libcthreads_validator_dependency libcthreads_validator_dependency_t;
+typedef struct libcthreads_validator_stack libcthreads_validator_stack_t;
+typedef struct libcthreads_validator_thread libcthreads_validator_thread_t;
+
+/* The stack of an acquisition
+ */
+struct libcthreads_validator_stack
+{
+	/* The frames
+	 */
+	void *frames[ LIBCTHREADS_VALIDATOR_MAXIMUM_NUMBER_OF_FRAMES ];
+
+	/* The number of frames
+	 */
+	int number_of_frames;
+};
+
+/* The lock class
+ * Lock classes are shared by all locks with the same name and are kept until the process ends
+ */
+struct libcthreads_lock_class
+{
+	/* The next lock class
+	 */
+	libcthreads_lock_class_t *next_class;
+
+	/* The name
+	 */
+	char *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The dependencies, which are the lock classes acquired while holding this lock class
+	 */
+	libcthreads_validator_dependency_t *dependencies;
+
+	/* The generation of the last search that visited the lock class
+	 */
+	uint32_t visit_generation;
+};
+
+/* The dependency between two lock classes
+ */
+struct libcthreads_validator_dependency
+{
+	/* The next dependency
+	 */
+	libcthreads_validator_dependency_t *next_dependency;
+
+	/* The lock class that was acquired
+	 */
+	libcthreads_lock_class_t *lock_class;
+
+	/* The stack of the first acquisition
+	 */
+	libcthreads_validator_stack_t stack;
+};
+
+/* The locks held by a thread
+ */
+struct libcthreads_validator_thread
+{
+	/* The next thread
+	 */
+	libcthreads_validator_thread_t *next_thread;
+
+#if defined( WINAPI )
+	/* The thread identifier
+	 */
+	DWORD thread_identifier;
+
+#elif defined( HAVE_PTHREAD_H )
+	/* The thread
+	 */
+	pthread_t thread;
+
+#else
+#error Missing validator thread type
+#endif
+
+	/* The lock classes of the held locks, in order of acquisition
+	 */
+	libcthreads_lock_class_t *held_classes[ LIBCTHREADS_VALIDATOR_MAXIMUM_NUMBER_OF_HELD_LOCKS ];
+
+	/* The held locks, in order of acquisition
+	 */
+	intptr_t *held_locks[ LIBCTHREADS_VALIDATOR_MAXIMUM_NUMBER_OF_HELD_LOCKS ];
+
+	/* The number of held locks
+	 */
+	int number_of_held_locks;
+};
+
+int libcthreads_validator_get_class_by_name(
+     const char *name,
+     libcthreads_lock_class_t **lock_class,
+     libcerror_error_t **error );
+
+int libcthreads_validator_acquire(
+     libcthreads_lock_class_t *lock_class,
+     intptr_t *lock,
+     libcerror_error_t **error );
+
+int libcthreads_validator_try_acquire(
+     libcthreads_lock_class_t *lock_class,
+     intptr_t *lock,
+     libcerror_error_t **error );
+
+int libcthreads_validator_release(
+     intptr_t *lock,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_validator_set_report_stream(
+     FILE *stream,
+     libcerror_error_t **error );
+
+LIBCTHREADS_EXTERN \
+int libcthreads_validator_get_number_of_reports(
+     int *number_of_reports,
+     libcerror_error_t **error );
+
+#endif /* !defined( HAVE_LOCAL_LIBCTHREADS ) || defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCTHREADS_INTERNAL_VALIDATOR_H ) */
+
@@ -0,0 +1,2163 @@
+/*
+ * Library atomic type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cthreads_test_libcerror.h"
+#include "cthreads_test_libcthreads.h"
+#include "cthreads_test_macros.h"
+#include "cthreads_test_unused.h"
+
+int32_t cthreads_test_int32_counter = 0;
+int64_t cthreads_test_int64_counter = 0;
+int cthreads_test_values[ 3 ]       = { 1, 2, 3 };
+
+/* The thread callback function that adds to the int32 counter
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_atomic_int32_fetch_add_callback_function(
+     void *arguments CTHREADS_TEST_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "cthreads_test_atomic_int32_fetch_add_callback_function";
+	int iterator             = 0;
+
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( arguments )
+
+	for( iterator = 0;
+	     iterator < 4096;
+	     iterator++ )
+	{
+		if( libcthreads_atomic_int32_fetch_add(
+		     &cthreads_test_int32_counter,
+		     1,
+		     LIBCTHREADS_MEMORY_ORDER_RELAXED,
+		     NULL,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add to counter.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* The thread callback function that adds to the int64 counter
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_atomic_int64_fetch_add_callback_function(
+     void *arguments CTHREADS_TEST_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "cthreads_test_atomic_int64_fetch_add_callback_function";
+	int iterator             = 0;
+
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( arguments )
+
+	for( iterator = 0;
+	     iterator < 4096;
+	     iterator++ )
+	{
+		if( libcthreads_atomic_int64_fetch_add(
+		     &cthreads_test_int64_counter,
+		     1,
+		     LIBCTHREADS_MEMORY_ORDER_RELAXED,
+		     NULL,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add to counter.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* Tests the libcthreads_atomic_int32_load function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_atomic_int32_load(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int32_t loaded_value     = 0;
+	int result               = 0;
+	int32_t value            = 0x12345678;
+
+	/* Test regular cases
+	 */
+	result = libcthreads_atomic_int32_load(
+	          &value,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE,
+	          &loaded_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT32(
+	 "loaded_value",
+	 loaded_value,
+	 value );
+
+	result = libcthreads_atomic_int32_load(
+	          &value,
+	          LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT,
+	          &loaded_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_atomic_int32_load(
+	          NULL,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE,
+	          &loaded_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_int32_load(
+	          &value,
+	          LIBCTHREADS_MEMORY_ORDER_RELEASE,
+	          &loaded_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_int32_load(
+	          &value,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_atomic_int32_store function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_atomic_int32_store(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int32_t value            = 0x12345678;
+
+	/* Test regular cases
+	 */
+	result = libcthreads_atomic_int32_store(
+	          &value,
+	          0x00000003,
+	          LIBCTHREADS_MEMORY_ORDER_RELEASE,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT32(
+	 "value",
+	 value,
+	 0x00000003 );
+
+	result = libcthreads_atomic_int32_store(
+	          &value,
+	          0x00000004,
+	          LIBCTHREADS_MEMORY_ORDER_RELAXED,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT32(
+	 "value",
+	 value,
+	 0x00000004 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_atomic_int32_store(
+	          NULL,
+	          0x00000003,
+	          LIBCTHREADS_MEMORY_ORDER_RELEASE,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_int32_store(
+	          &value,
+	          0x00000003,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_atomic_int32_exchange function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_atomic_int32_exchange(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int32_t previous_value   = 0;
+	int result               = 0;
+	int32_t value            = 0x12345678;
+
+	/* Test regular cases
+	 */
+	result = libcthreads_atomic_int32_exchange(
+	          &value,
+	          0x00000003,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE,
+	          &previous_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT32(
+	 "previous_value",
+	 previous_value,
+	 0x12345678 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT32(
+	 "value",
+	 value,
+	 0x00000003 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_atomic_int32_exchange(
+	          NULL,
+	          0x00000003,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE,
+	          &previous_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_int32_exchange(
+	          &value,
+	          0x00000003,
+	          -1,
+	          &previous_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_int32_exchange(
+	          &value,
+	          0x00000003,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_atomic_int32_compare_exchange function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_atomic_int32_compare_exchange(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int32_t expected_value   = 0;
+	int result               = 0;
+	int32_t value            = 0x12345678;
+
+	/* Test regular cases
+	 */
+	expected_value = 0x12345678;
+
+	result = libcthreads_atomic_int32_compare_exchange(
+	          &value,
+	          &expected_value,
+	          0x00000003,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT32(
+	 "value",
+	 value,
+	 0x00000003 );
+
+	expected_value = 0x12345678;
+
+	result = libcthreads_atomic_int32_compare_exchange(
+	          &value,
+	          &expected_value,
+	          0x00000004,
+	          LIBCTHREADS_MEMORY_ORDER_RELEASE,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT32(
+	 "expected_value",
+	 expected_value,
+	 0x00000003 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT32(
+	 "value",
+	 value,
+	 0x00000003 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_atomic_int32_compare_exchange(
+	          NULL,
+	          &expected_value,
+	          0x00000004,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_int32_compare_exchange(
+	          &value,
+	          NULL,
+	          0x00000004,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_int32_compare_exchange(
+	          &value,
+	          &expected_value,
+	          0x00000004,
+	          5,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_atomic_int32_fetch_add function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_atomic_int32_fetch_add(
+     void )
+{
+	libcthreads_thread_t *threads[ 4 ] = { NULL, NULL, NULL, NULL };
+	libcerror_error_t *error           = NULL;
+	int32_t previous_value             = 0;
+	int result                         = 0;
+	int thread_index                   = 0;
+	int32_t value                      = 0x00000003;
+
+	/* Test regular cases
+	 */
+	result = libcthreads_atomic_int32_fetch_add(
+	          &value,
+	          0x00000004,
+	          LIBCTHREADS_MEMORY_ORDER_RELAXED,
+	          &previous_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT32(
+	 "previous_value",
+	 previous_value,
+	 0x00000003 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT32(
+	 "value",
+	 value,
+	 0x00000007 );
+
+	result = libcthreads_atomic_int32_fetch_add(
+	          &value,
+	          0x00000004,
+	          LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_atomic_int32_store(
+	          &cthreads_test_int32_counter,
+	          0,
+	          LIBCTHREADS_MEMORY_ORDER_RELAXED,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test threads that add to the same value at the same time
+	 */
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          cthreads_test_atomic_int32_fetch_add_callback_function,
+		          NULL,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	CTHREADS_TEST_ASSERT_EQUAL_INT32(
+	 "cthreads_test_int32_counter",
+	 cthreads_test_int32_counter,
+	 4 * 4096 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_atomic_int32_fetch_add(
+	          NULL,
+	          0x00000004,
+	          LIBCTHREADS_MEMORY_ORDER_RELAXED,
+	          &previous_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_int32_fetch_add(
+	          &value,
+	          0x00000004,
+	          -1,
+	          &previous_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_atomic_int32_fetch_or function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_atomic_int32_fetch_or(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int32_t previous_value   = 0;
+	int result               = 0;
+	int32_t value            = 0x00000003;
+
+	/* Test regular cases
+	 */
+	result = libcthreads_atomic_int32_fetch_or(
+	          &value,
+	          0x00000010,
+	          LIBCTHREADS_MEMORY_ORDER_RELAXED,
+	          &previous_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT32(
+	 "previous_value",
+	 previous_value,
+	 0x00000003 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT32(
+	 "value",
+	 value,
+	 0x00000013 );
+
+	result = libcthreads_atomic_int32_fetch_or(
+	          &value,
+	          0x00000010,
+	          LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_atomic_int32_fetch_or(
+	          NULL,
+	          0x00000010,
+	          LIBCTHREADS_MEMORY_ORDER_RELAXED,
+	          &previous_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_int32_fetch_or(
+	          &value,
+	          0x00000010,
+	          -1,
+	          &previous_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_atomic_int64_load function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_atomic_int64_load(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int64_t loaded_value     = 0;
+	int result               = 0;
+	int64_t value            = 0x123456789abcdef0;
+
+	/* Test regular cases
+	 */
+	result = libcthreads_atomic_int64_load(
+	          &value,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE,
+	          &loaded_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT64(
+	 "loaded_value",
+	 loaded_value,
+	 value );
+
+	result = libcthreads_atomic_int64_load(
+	          &value,
+	          LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT,
+	          &loaded_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_atomic_int64_load(
+	          NULL,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE,
+	          &loaded_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_int64_load(
+	          &value,
+	          LIBCTHREADS_MEMORY_ORDER_RELEASE,
+	          &loaded_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_int64_load(
+	          &value,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_atomic_int64_store function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_atomic_int64_store(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int64_t value            = 0x123456789abcdef0;
+
+	/* Test regular cases
+	 */
+	result = libcthreads_atomic_int64_store(
+	          &value,
+	          0x0000000000000003,
+	          LIBCTHREADS_MEMORY_ORDER_RELEASE,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT64(
+	 "value",
+	 value,
+	 (int64_t) 0x0000000000000003 );
+
+	result = libcthreads_atomic_int64_store(
+	          &value,
+	          0x0000000000000004,
+	          LIBCTHREADS_MEMORY_ORDER_RELAXED,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT64(
+	 "value",
+	 value,
+	 (int64_t) 0x0000000000000004 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_atomic_int64_store(
+	          NULL,
+	          0x0000000000000003,
+	          LIBCTHREADS_MEMORY_ORDER_RELEASE,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_int64_store(
+	          &value,
+	          0x0000000000000003,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_atomic_int64_exchange function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_atomic_int64_exchange(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int64_t previous_value   = 0;
+	int result               = 0;
+	int64_t value            = 0x123456789abcdef0;
+
+	/* Test regular cases
+	 */
+	result = libcthreads_atomic_int64_exchange(
+	          &value,
+	          0x0000000000000003,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE,
+	          &previous_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT64(
+	 "previous_value",
+	 previous_value,
+	 (int64_t) 0x123456789abcdef0 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT64(
+	 "value",
+	 value,
+	 (int64_t) 0x0000000000000003 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_atomic_int64_exchange(
+	          NULL,
+	          0x0000000000000003,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE,
+	          &previous_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_int64_exchange(
+	          &value,
+	          0x0000000000000003,
+	          -1,
+	          &previous_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_int64_exchange(
+	          &value,
+	          0x0000000000000003,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_atomic_int64_compare_exchange function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_atomic_int64_compare_exchange(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int64_t expected_value   = 0;
+	int result               = 0;
+	int64_t value            = 0x123456789abcdef0;
+
+	/* Test regular cases
+	 */
+	expected_value = 0x123456789abcdef0;
+
+	result = libcthreads_atomic_int64_compare_exchange(
+	          &value,
+	          &expected_value,
+	          0x0000000000000003,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT64(
+	 "value",
+	 value,
+	 (int64_t) 0x0000000000000003 );
+
+	expected_value = 0x123456789abcdef0;
+
+	result = libcthreads_atomic_int64_compare_exchange(
+	          &value,
+	          &expected_value,
+	          0x0000000000000004,
+	          LIBCTHREADS_MEMORY_ORDER_RELEASE,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT64(
+	 "expected_value",
+	 expected_value,
+	 (int64_t) 0x0000000000000003 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT64(
+	 "value",
+	 value,
+	 (int64_t) 0x0000000000000003 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_atomic_int64_compare_exchange(
+	          NULL,
+	          &expected_value,
+	          0x0000000000000004,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_int64_compare_exchange(
+	          &value,
+	          NULL,
+	          0x0000000000000004,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_int64_compare_exchange(
+	          &value,
+	          &expected_value,
+	          0x0000000000000004,
+	          5,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_atomic_int64_fetch_add function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_atomic_int64_fetch_add(
+     void )
+{
+	libcthreads_thread_t *threads[ 4 ] = { NULL, NULL, NULL, NULL };
+	libcerror_error_t *error           = NULL;
+	int64_t previous_value             = 0;
+	int result                         = 0;
+	int thread_index                   = 0;
+	int64_t value                      = 0x0000000000000003;
+
+	/* Test regular cases
+	 */
+	result = libcthreads_atomic_int64_fetch_add(
+	          &value,
+	          0x0000000000000004,
+	          LIBCTHREADS_MEMORY_ORDER_RELAXED,
+	          &previous_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT64(
+	 "previous_value",
+	 previous_value,
+	 (int64_t) 0x0000000000000003 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT64(
+	 "value",
+	 value,
+	 (int64_t) 0x0000000000000007 );
+
+	result = libcthreads_atomic_int64_fetch_add(
+	          &value,
+	          0x0000000000000004,
+	          LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_atomic_int64_store(
+	          &cthreads_test_int64_counter,
+	          0,
+	          LIBCTHREADS_MEMORY_ORDER_RELAXED,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test threads that add to the same value at the same time
+	 */
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          cthreads_test_atomic_int64_fetch_add_callback_function,
+		          NULL,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	CTHREADS_TEST_ASSERT_EQUAL_INT64(
+	 "cthreads_test_int64_counter",
+	 cthreads_test_int64_counter,
+	 (int64_t) 4 * 4096 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_atomic_int64_fetch_add(
+	          NULL,
+	          0x0000000000000004,
+	          LIBCTHREADS_MEMORY_ORDER_RELAXED,
+	          &previous_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_int64_fetch_add(
+	          &value,
+	          0x0000000000000004,
+	          -1,
+	          &previous_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_atomic_int64_fetch_or function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_atomic_int64_fetch_or(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int64_t previous_value   = 0;
+	int result               = 0;
+	int64_t value            = 0x0000000000000003;
+
+	/* Test regular cases
+	 */
+	result = libcthreads_atomic_int64_fetch_or(
+	          &value,
+	          0x0000000000000010,
+	          LIBCTHREADS_MEMORY_ORDER_RELAXED,
+	          &previous_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT64(
+	 "previous_value",
+	 previous_value,
+	 (int64_t) 0x0000000000000003 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT64(
+	 "value",
+	 value,
+	 (int64_t) 0x0000000000000013 );
+
+	result = libcthreads_atomic_int64_fetch_or(
+	          &value,
+	          0x0000000000000010,
+	          LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_atomic_int64_fetch_or(
+	          NULL,
+	          0x0000000000000010,
+	          LIBCTHREADS_MEMORY_ORDER_RELAXED,
+	          &previous_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_int64_fetch_or(
+	          &value,
+	          0x0000000000000010,
+	          -1,
+	          &previous_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_atomic_pointer_load function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_atomic_pointer_load(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	intptr_t *loaded_value   = NULL;
+	int result               = 0;
+	intptr_t *value          = (intptr_t *) &( cthreads_test_values[ 0 ] );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_atomic_pointer_load(
+	          &value,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE,
+	          &loaded_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INTPTR(
+	 "loaded_value",
+	 (intptr_t) loaded_value,
+	 (intptr_t) value );
+
+	result = libcthreads_atomic_pointer_load(
+	          &value,
+	          LIBCTHREADS_MEMORY_ORDER_SEQUENTIALLY_CONSISTENT,
+	          &loaded_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_atomic_pointer_load(
+	          NULL,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE,
+	          &loaded_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_pointer_load(
+	          &value,
+	          LIBCTHREADS_MEMORY_ORDER_RELEASE,
+	          &loaded_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_pointer_load(
+	          &value,
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_atomic_pointer_store function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_atomic_pointer_store(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	intptr_t *value          = (intptr_t *) &( cthreads_test_values[ 0 ] );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_atomic_pointer_store(
+	          &value,
+	          (intptr_t *) &( cthreads_test_values[ 1 ] ),
+	          LIBCTHREADS_MEMORY_ORDER_RELEASE,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INTPTR(
+	 "value",
+	 (intptr_t) value,
+	 (intptr_t) (intptr_t *) &( cthreads_test_values[ 1 ] ) );
+
+	result = libcthreads_atomic_pointer_store(
+	          &value,
+	          (intptr_t *) &( cthreads_test_values[ 2 ] ),
+	          LIBCTHREADS_MEMORY_ORDER_RELAXED,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INTPTR(
+	 "value",
+	 (intptr_t) value,
+	 (intptr_t) (intptr_t *) &( cthreads_test_values[ 2 ] ) );
+
+	/* Test error cases
+	 */
+	result = libcthreads_atomic_pointer_store(
+	          NULL,
+	          (intptr_t *) &( cthreads_test_values[ 1 ] ),
+	          LIBCTHREADS_MEMORY_ORDER_RELEASE,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_pointer_store(
+	          &value,
+	          (intptr_t *) &( cthreads_test_values[ 1 ] ),
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_atomic_pointer_exchange function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_atomic_pointer_exchange(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	intptr_t *previous_value = NULL;
+	int result               = 0;
+	intptr_t *value          = (intptr_t *) &( cthreads_test_values[ 0 ] );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_atomic_pointer_exchange(
+	          &value,
+	          (intptr_t *) &( cthreads_test_values[ 1 ] ),
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE,
+	          &previous_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INTPTR(
+	 "previous_value",
+	 (intptr_t) previous_value,
+	 (intptr_t) (intptr_t *) &( cthreads_test_values[ 0 ] ) );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INTPTR(
+	 "value",
+	 (intptr_t) value,
+	 (intptr_t) (intptr_t *) &( cthreads_test_values[ 1 ] ) );
+
+	/* Test error cases
+	 */
+	result = libcthreads_atomic_pointer_exchange(
+	          NULL,
+	          (intptr_t *) &( cthreads_test_values[ 1 ] ),
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE,
+	          &previous_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_pointer_exchange(
+	          &value,
+	          (intptr_t *) &( cthreads_test_values[ 1 ] ),
+	          -1,
+	          &previous_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_pointer_exchange(
+	          &value,
+	          (intptr_t *) &( cthreads_test_values[ 1 ] ),
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_atomic_pointer_compare_exchange function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_atomic_pointer_compare_exchange(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	intptr_t *expected_value = NULL;
+	int result               = 0;
+	intptr_t *value          = (intptr_t *) &( cthreads_test_values[ 0 ] );
+
+	/* Test regular cases
+	 */
+	expected_value = (intptr_t *) &( cthreads_test_values[ 0 ] );
+
+	result = libcthreads_atomic_pointer_compare_exchange(
+	          &value,
+	          &expected_value,
+	          (intptr_t *) &( cthreads_test_values[ 1 ] ),
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INTPTR(
+	 "value",
+	 (intptr_t) value,
+	 (intptr_t) (intptr_t *) &( cthreads_test_values[ 1 ] ) );
+
+	expected_value = (intptr_t *) &( cthreads_test_values[ 0 ] );
+
+	result = libcthreads_atomic_pointer_compare_exchange(
+	          &value,
+	          &expected_value,
+	          (intptr_t *) &( cthreads_test_values[ 2 ] ),
+	          LIBCTHREADS_MEMORY_ORDER_RELEASE,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INTPTR(
+	 "expected_value",
+	 (intptr_t) expected_value,
+	 (intptr_t) (intptr_t *) &( cthreads_test_values[ 1 ] ) );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INTPTR(
+	 "value",
+	 (intptr_t) value,
+	 (intptr_t) (intptr_t *) &( cthreads_test_values[ 1 ] ) );
+
+	/* Test error cases
+	 */
+	result = libcthreads_atomic_pointer_compare_exchange(
+	          NULL,
+	          &expected_value,
+	          (intptr_t *) &( cthreads_test_values[ 2 ] ),
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_pointer_compare_exchange(
+	          &value,
+	          NULL,
+	          (intptr_t *) &( cthreads_test_values[ 2 ] ),
+	          LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_atomic_pointer_compare_exchange(
+	          &value,
+	          &expected_value,
+	          (intptr_t *) &( cthreads_test_values[ 2 ] ),
+	          5,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argc )
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_atomic_int32_load",
+	 cthreads_test_atomic_int32_load );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_atomic_int32_store",
+	 cthreads_test_atomic_int32_store );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_atomic_int32_exchange",
+	 cthreads_test_atomic_int32_exchange );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_atomic_int32_compare_exchange",
+	 cthreads_test_atomic_int32_compare_exchange );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_atomic_int32_fetch_add",
+	 cthreads_test_atomic_int32_fetch_add );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_atomic_int32_fetch_or",
+	 cthreads_test_atomic_int32_fetch_or );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_atomic_int64_load",
+	 cthreads_test_atomic_int64_load );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_atomic_int64_store",
+	 cthreads_test_atomic_int64_store );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_atomic_int64_exchange",
+	 cthreads_test_atomic_int64_exchange );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_atomic_int64_compare_exchange",
+	 cthreads_test_atomic_int64_compare_exchange );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_atomic_int64_fetch_add",
+	 cthreads_test_atomic_int64_fetch_add );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_atomic_int64_fetch_or",
+	 cthreads_test_atomic_int64_fetch_or );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_atomic_pointer_load",
+	 cthreads_test_atomic_pointer_load );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_atomic_pointer_store",
+	 cthreads_test_atomic_pointer_store );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_atomic_pointer_exchange",
+	 cthreads_test_atomic_pointer_exchange );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_atomic_pointer_compare_exchange",
+	 cthreads_test_atomic_pointer_compare_exchange );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
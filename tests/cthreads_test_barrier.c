@@ -0,0 +1,775 @@
+/*
+ * Library barrier type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cthreads_test_libcerror.h"
+#include "cthreads_test_libcthreads.h"
+#include "cthreads_test_macros.h"
+#include "cthreads_test_memory.h"
+#include "cthreads_test_unused.h"
+
+libcthreads_barrier_t *cthreads_test_barrier = NULL;
+libcthreads_lock_t *cthreads_test_lock       = NULL;
+int cthreads_test_number_of_arrivals         = 0;
+int cthreads_test_number_of_serial_threads   = 0;
+
+/* The thread callback function that waits at the barrier for a number of phases
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_barrier_wait_callback_function(
+     void *arguments )
+{
+	libcerror_error_t *error  = NULL;
+	static char *function     = "cthreads_test_barrier_wait_callback_function";
+	int *number_of_mismatches = NULL;
+	int number_of_arrivals    = 0;
+	int phase                 = 0;
+	int result                = 0;
+
+	number_of_mismatches = (int *) arguments;
+
+	for( phase = 1;
+	     phase <= 1000;
+	     phase++ )
+	{
+		result = libcthreads_lock_grab(
+		          cthreads_test_lock,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab lock.",
+			 function );
+
+			goto on_error;
+		}
+		cthreads_test_number_of_arrivals += 1;
+
+		result = libcthreads_lock_release(
+		          cthreads_test_lock,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release lock.",
+			 function );
+
+			goto on_error;
+		}
+		result = libcthreads_barrier_wait(
+		          cthreads_test_barrier,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to wait at barrier.",
+			 function );
+
+			goto on_error;
+		}
+		/* All threads have arrived in this phase, but no thread can arrive in the next phase
+		 * before all threads have passed the second barrier wait
+		 */
+		result = libcthreads_lock_grab(
+		          cthreads_test_lock,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab lock.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_arrivals = cthreads_test_number_of_arrivals;
+
+		result = libcthreads_lock_release(
+		          cthreads_test_lock,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release lock.",
+			 function );
+
+			goto on_error;
+		}
+		if( number_of_arrivals != ( phase * 4 ) )
+		{
+			*number_of_mismatches += 1;
+		}
+		result = libcthreads_barrier_wait(
+		          cthreads_test_barrier,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to wait at barrier.",
+			 function );
+
+			goto on_error;
+		}
+		if( result == 1 )
+		{
+			result = libcthreads_lock_grab(
+			          cthreads_test_lock,
+			          &error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab lock.",
+				 function );
+
+				goto on_error;
+			}
+			cthreads_test_number_of_serial_threads += 1;
+
+			result = libcthreads_lock_release(
+			          cthreads_test_lock,
+			          &error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release lock.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* Tests the libcthreads_barrier_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_barrier_initialize(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libcthreads_barrier_t *barrier = NULL;
+	int result                     = 0;
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcthreads_barrier_initialize(
+	          &barrier,
+	          2,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "barrier",
+	 barrier );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_barrier_free(
+	          &barrier,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "barrier",
+	 barrier );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_barrier_initialize(
+	          NULL,
+	          2,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	barrier = (libcthreads_barrier_t *) 0x12345678UL;
+
+	result = libcthreads_barrier_initialize(
+	          &barrier,
+	          2,
+	          &error );
+
+	barrier = NULL;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_barrier_initialize(
+	          &barrier,
+	          0,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "barrier",
+	 barrier );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcthreads_barrier_initialize with malloc failing
+		 */
+		cthreads_test_malloc_attempts_before_fail = test_number;
+
+		result = libcthreads_barrier_initialize(
+		          &barrier,
+		          2,
+		          &error );
+
+		if( cthreads_test_malloc_attempts_before_fail != -1 )
+		{
+			cthreads_test_malloc_attempts_before_fail = -1;
+
+			if( barrier != NULL )
+			{
+				libcthreads_barrier_free(
+				 &barrier,
+				 NULL );
+			}
+		}
+		else
+		{
+			CTHREADS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CTHREADS_TEST_ASSERT_IS_NULL(
+			 "barrier",
+			 barrier );
+
+			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcthreads_barrier_initialize with memset failing
+		 */
+		cthreads_test_memset_attempts_before_fail = test_number;
+
+		result = libcthreads_barrier_initialize(
+		          &barrier,
+		          2,
+		          &error );
+
+		if( cthreads_test_memset_attempts_before_fail != -1 )
+		{
+			cthreads_test_memset_attempts_before_fail = -1;
+
+			if( barrier != NULL )
+			{
+				libcthreads_barrier_free(
+				 &barrier,
+				 NULL );
+			}
+		}
+		else
+		{
+			CTHREADS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CTHREADS_TEST_ASSERT_IS_NULL(
+			 "barrier",
+			 barrier );
+
+			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( barrier != NULL )
+	{
+		libcthreads_barrier_free(
+		 &barrier,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_barrier_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_barrier_free(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libcthreads_barrier_t *barrier = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_barrier_initialize(
+	          &barrier,
+	          2,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_barrier_free(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_barrier_free(
+	          &barrier,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( barrier != NULL )
+	{
+		libcthreads_barrier_free(
+		 &barrier,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_barrier_wait function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_barrier_wait(
+     void )
+{
+	libcthreads_thread_t *threads[ 4 ] = { NULL, NULL, NULL, NULL };
+	libcerror_error_t *error             = NULL;
+	int number_of_mismatches[ 4 ]        = { 0, 0, 0, 0 };
+	int result                           = 0;
+	int thread_index                     = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_barrier_initialize(
+	          &cthreads_test_barrier,
+	          1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_barrier_wait(
+	          cthreads_test_barrier,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_barrier_wait(
+	          cthreads_test_barrier,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_barrier_free(
+	          &cthreads_test_barrier,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test threads that wait at the barrier for a number of phases
+	 */
+	result = libcthreads_lock_initialize(
+	          &cthreads_test_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_barrier_initialize(
+	          &cthreads_test_barrier,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          cthreads_test_barrier_wait_callback_function,
+		          (void *) &( number_of_mismatches[ thread_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "number_of_mismatches[ thread_index ]",
+		 number_of_mismatches[ thread_index ],
+		 0 );
+	}
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_number_of_arrivals",
+	 cthreads_test_number_of_arrivals,
+	 4000 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_number_of_serial_threads",
+	 cthreads_test_number_of_serial_threads,
+	 1000 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_barrier_wait(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_barrier_free(
+	          &cthreads_test_barrier,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_lock_free(
+	          &cthreads_test_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	if( cthreads_test_barrier != NULL )
+	{
+		libcthreads_barrier_free(
+		 &cthreads_test_barrier,
+		 NULL );
+	}
+	if( cthreads_test_lock != NULL )
+	{
+		libcthreads_lock_free(
+		 &cthreads_test_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argc )
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_barrier_initialize",
+	 cthreads_test_barrier_initialize );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_barrier_free",
+	 cthreads_test_barrier_free );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_barrier_wait",
+	 cthreads_test_barrier_wait );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1970 @@
+/*
+ * Library epoch type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cthreads_test_libcerror.h"
+#include "cthreads_test_libcthreads.h"
+#include "cthreads_test_macros.h"
+#include "cthreads_test_memory.h"
+#include "cthreads_test_unused.h"
+
+#define CTHREADS_TEST_EPOCH_VALUE_MAGIC	0x45504f43
+
+libcthreads_epoch_t *cthreads_test_epoch = NULL;
+int cthreads_test_number_of_freed_values = 0;
+int *cthreads_test_shared_value          = NULL;
+
+/* The value free function
+ * The value is overwritten before it is freed so that a use after free is detected
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_epoch_value_free_function(
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	static char *function = "cthreads_test_epoch_value_free_function";
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value != NULL )
+	{
+		*( (int *) *value ) = 0;
+
+		memory_free(
+		 *value );
+
+		*value = NULL;
+	}
+	cthreads_test_number_of_freed_values++;
+
+	return( 1 );
+}
+
+/* The writer thread callback function
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_epoch_write_callback_function(
+     void *arguments CTHREADS_TEST_ATTRIBUTE_UNUSED )
+{
+	libcthreads_epoch_participant_t *participant = NULL;
+	libcerror_error_t *error                     = NULL;
+	static char *function                        = "cthreads_test_epoch_write_callback_function";
+	int *new_value                               = NULL;
+	int *old_value                               = NULL;
+	int iterator                                 = 0;
+	int result                                   = 0;
+
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( arguments )
+
+	result = libcthreads_epoch_register_thread(
+	          cthreads_test_epoch,
+	          &participant,
+	          &error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to register thread.",
+		 function );
+
+		goto on_error;
+	}
+
+	for( iterator = 0;
+	     iterator < 10000;
+	     iterator++ )
+	{
+		new_value = (int *) memory_allocate(
+		                     sizeof( int ) );
+
+		if( new_value == NULL )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value.",
+			 function );
+
+			goto on_error;
+		}
+		*new_value = CTHREADS_TEST_EPOCH_VALUE_MAGIC;
+
+		/* The exchange publishes the initialized value to the readers
+		 */
+		result = libcthreads_atomic_pointer_exchange(
+		          (intptr_t **) &cthreads_test_shared_value,
+		          (intptr_t *) new_value,
+		          LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE,
+		          (intptr_t **) &old_value,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to exchange value.",
+			 function );
+
+			memory_free(
+			 new_value );
+
+			goto on_error;
+		}
+
+		result = libcthreads_epoch_defer_free(
+		          participant,
+		          (intptr_t *) old_value,
+		          cthreads_test_epoch_value_free_function,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to defer free of value.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = libcthreads_epoch_unregister_thread(
+	          &participant,
+	          &error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to unregister thread.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	if( participant != NULL )
+	{
+		libcthreads_epoch_unregister_thread(
+		 &participant,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The reader thread callback function
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_epoch_read_callback_function(
+     void *arguments )
+{
+	libcthreads_epoch_participant_t *participant = NULL;
+	libcerror_error_t *error                     = NULL;
+	static char *function                        = "cthreads_test_epoch_read_callback_function";
+	int *number_of_mismatches                    = NULL;
+	int *value                                   = NULL;
+	int iterator                                 = 0;
+	int result                                   = 0;
+
+	number_of_mismatches = (int *) arguments;
+
+	result = libcthreads_epoch_register_thread(
+	          cthreads_test_epoch,
+	          &participant,
+	          &error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to register thread.",
+		 function );
+
+		goto on_error;
+	}
+
+	for( iterator = 0;
+	     iterator < 10000;
+	     iterator++ )
+	{
+		result = libcthreads_epoch_enter(
+		          participant,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to enter critical section.",
+			 function );
+
+			goto on_error;
+		}
+		result = libcthreads_atomic_pointer_load(
+		          (intptr_t **) &cthreads_test_shared_value,
+		          LIBCTHREADS_MEMORY_ORDER_ACQUIRE,
+		          (intptr_t **) &value,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to load value.",
+			 function );
+
+			goto on_error;
+		}
+		if( *value != CTHREADS_TEST_EPOCH_VALUE_MAGIC )
+		{
+			*number_of_mismatches += 1;
+		}
+		result = libcthreads_epoch_exit(
+		          participant,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to exit critical section.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = libcthreads_epoch_unregister_thread(
+	          &participant,
+	          &error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to unregister thread.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	if( participant != NULL )
+	{
+		libcthreads_epoch_unregister_thread(
+		 &participant,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libcthreads_epoch_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_epoch_initialize(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libcthreads_epoch_t *epoch = NULL;
+	int result                 = 0;
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcthreads_epoch_initialize(
+	          &epoch,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "epoch",
+	 epoch );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_epoch_free(
+	          &epoch,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "epoch",
+	 epoch );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_epoch_initialize(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	epoch = (libcthreads_epoch_t *) 0x12345678UL;
+
+	result = libcthreads_epoch_initialize(
+	          &epoch,
+	          &error );
+
+	epoch = NULL;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcthreads_epoch_initialize with malloc failing
+		 */
+		cthreads_test_malloc_attempts_before_fail = test_number;
+
+		result = libcthreads_epoch_initialize(
+		          &epoch,
+		          &error );
+
+		if( cthreads_test_malloc_attempts_before_fail != -1 )
+		{
+			cthreads_test_malloc_attempts_before_fail = -1;
+
+			if( epoch != NULL )
+			{
+				libcthreads_epoch_free(
+				 &epoch,
+				 NULL );
+			}
+		}
+		else
+		{
+			CTHREADS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CTHREADS_TEST_ASSERT_IS_NULL(
+			 "epoch",
+			 epoch );
+
+			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcthreads_epoch_initialize with memset failing
+		 */
+		cthreads_test_memset_attempts_before_fail = test_number;
+
+		result = libcthreads_epoch_initialize(
+		          &epoch,
+		          &error );
+
+		if( cthreads_test_memset_attempts_before_fail != -1 )
+		{
+			cthreads_test_memset_attempts_before_fail = -1;
+
+			if( epoch != NULL )
+			{
+				libcthreads_epoch_free(
+				 &epoch,
+				 NULL );
+			}
+		}
+		else
+		{
+			CTHREADS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CTHREADS_TEST_ASSERT_IS_NULL(
+			 "epoch",
+			 epoch );
+
+			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( epoch != NULL )
+	{
+		libcthreads_epoch_free(
+		 &epoch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_epoch_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_epoch_free(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libcthreads_epoch_t *epoch                   = NULL;
+	libcthreads_epoch_participant_t *participant = NULL;
+	int result                                   = 0;
+	int *value                                   = NULL;
+
+	/* Initialize test
+	 */
+	result = libcthreads_epoch_initialize(
+	          &epoch,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_epoch_register_thread(
+	          epoch,
+	          &participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	value = (int *) memory_allocate(
+	                 sizeof( int ) );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	result = libcthreads_epoch_defer_free(
+	          participant,
+	          (intptr_t *) value,
+	          cthreads_test_epoch_value_free_function,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_epoch_free(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test free of an epoch with a registered participant
+	 */
+	cthreads_test_number_of_freed_values = 0;
+
+	result = libcthreads_epoch_free(
+	          &epoch,
+	          &error );
+
+	participant = NULL;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "epoch",
+	 epoch );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_number_of_freed_values",
+	 cthreads_test_number_of_freed_values,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( participant != NULL )
+	{
+		libcthreads_epoch_unregister_thread(
+		 &participant,
+		 NULL );
+	}
+	if( epoch != NULL )
+	{
+		libcthreads_epoch_free(
+		 &epoch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_epoch_register_thread function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_epoch_register_thread(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libcthreads_epoch_t *epoch                   = NULL;
+	libcthreads_epoch_participant_t *participant = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_epoch_initialize(
+	          &epoch,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_epoch_register_thread(
+	          epoch,
+	          &participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "participant",
+	 participant );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_epoch_register_thread(
+	          NULL,
+	          &participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_epoch_register_thread(
+	          epoch,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_epoch_register_thread(
+	          epoch,
+	          &participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_epoch_unregister_thread(
+	          &participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_epoch_free(
+	          &epoch,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( participant != NULL )
+	{
+		libcthreads_epoch_unregister_thread(
+		 &participant,
+		 NULL );
+	}
+	if( epoch != NULL )
+	{
+		libcthreads_epoch_free(
+		 &epoch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_epoch_unregister_thread function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_epoch_unregister_thread(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libcthreads_epoch_t *epoch                   = NULL;
+	libcthreads_epoch_participant_t *participant = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_epoch_initialize(
+	          &epoch,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_epoch_register_thread(
+	          epoch,
+	          &participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_epoch_unregister_thread(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test unregister of a participant that is in a critical section
+	 */
+	result = libcthreads_epoch_enter(
+	          participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_epoch_unregister_thread(
+	          &participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_epoch_exit(
+	          participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_epoch_unregister_thread(
+	          &participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "participant",
+	 participant );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_epoch_unregister_thread(
+	          &participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_epoch_free(
+	          &epoch,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( participant != NULL )
+	{
+		libcthreads_epoch_unregister_thread(
+		 &participant,
+		 NULL );
+	}
+	if( epoch != NULL )
+	{
+		libcthreads_epoch_free(
+		 &epoch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_epoch_enter function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_epoch_enter(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libcthreads_epoch_t *epoch                   = NULL;
+	libcthreads_epoch_participant_t *participant = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_epoch_initialize(
+	          &epoch,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_epoch_register_thread(
+	          epoch,
+	          &participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_epoch_enter(
+	          participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test nested critical sections
+	 */
+	result = libcthreads_epoch_enter(
+	          participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_epoch_exit(
+	          participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_epoch_exit(
+	          participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_epoch_enter(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_epoch_unregister_thread(
+	          &participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_epoch_free(
+	          &epoch,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( participant != NULL )
+	{
+		libcthreads_epoch_unregister_thread(
+		 &participant,
+		 NULL );
+	}
+	if( epoch != NULL )
+	{
+		libcthreads_epoch_free(
+		 &epoch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_epoch_exit function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_epoch_exit(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libcthreads_epoch_t *epoch                   = NULL;
+	libcthreads_epoch_participant_t *participant = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_epoch_initialize(
+	          &epoch,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_epoch_register_thread(
+	          epoch,
+	          &participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_epoch_enter(
+	          participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_epoch_exit(
+	          participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_epoch_exit(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test exit of a participant that is not in a critical section
+	 */
+	result = libcthreads_epoch_exit(
+	          participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_epoch_unregister_thread(
+	          &participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_epoch_free(
+	          &epoch,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( participant != NULL )
+	{
+		libcthreads_epoch_unregister_thread(
+		 &participant,
+		 NULL );
+	}
+	if( epoch != NULL )
+	{
+		libcthreads_epoch_free(
+		 &epoch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_epoch_defer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_epoch_defer_free(
+     void )
+{
+	libcerror_error_t *error                            = NULL;
+	libcthreads_epoch_t *epoch                          = NULL;
+	libcthreads_epoch_participant_t *participant        = NULL;
+	libcthreads_epoch_participant_t *reader_participant = NULL;
+	int *value                                          = NULL;
+	int iterator                                        = 0;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_epoch_initialize(
+	          &epoch,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_epoch_register_thread(
+	          epoch,
+	          &participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_epoch_register_thread(
+	          epoch,
+	          &reader_participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	cthreads_test_number_of_freed_values = 0;
+
+	for( iterator = 0;
+	     iterator < 16;
+	     iterator++ )
+	{
+		value = (int *) memory_allocate(
+		                 sizeof( int ) );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "value",
+		 value );
+
+		result = libcthreads_epoch_defer_free(
+		          participant,
+		          (intptr_t *) value,
+		          cthreads_test_epoch_value_free_function,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* A deferred value is freed after the global epoch advanced twice
+	 */
+	result = libcthreads_epoch_collect(
+	          participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_number_of_freed_values",
+	 cthreads_test_number_of_freed_values,
+	 0 );
+
+	result = libcthreads_epoch_collect(
+	          participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_number_of_freed_values",
+	 cthreads_test_number_of_freed_values,
+	 16 );
+
+	/* Test that a deferred value is not freed while another participant is in a critical section
+	 */
+	value = (int *) memory_allocate(
+	                 sizeof( int ) );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	cthreads_test_number_of_freed_values = 0;
+
+	result = libcthreads_epoch_enter(
+	          reader_participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_epoch_defer_free(
+	          participant,
+	          (intptr_t *) value,
+	          cthreads_test_epoch_value_free_function,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( iterator = 0;
+	     iterator < 4;
+	     iterator++ )
+	{
+		result = libcthreads_epoch_collect(
+		          participant,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_number_of_freed_values",
+	 cthreads_test_number_of_freed_values,
+	 0 );
+
+	result = libcthreads_epoch_exit(
+	          reader_participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_epoch_collect(
+	          participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_epoch_collect(
+	          participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_number_of_freed_values",
+	 cthreads_test_number_of_freed_values,
+	 1 );
+
+	/* Test that the deferred values of an unregistered participant are freed by another participant
+	 */
+	cthreads_test_number_of_freed_values = 0;
+
+	value = (int *) memory_allocate(
+	                 sizeof( int ) );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	result = libcthreads_epoch_defer_free(
+	          reader_participant,
+	          (intptr_t *) value,
+	          cthreads_test_epoch_value_free_function,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_epoch_unregister_thread(
+	          &reader_participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_epoch_collect(
+	          participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_epoch_collect(
+	          participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_number_of_freed_values",
+	 cthreads_test_number_of_freed_values,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_epoch_defer_free(
+	          NULL,
+	          (intptr_t *) &result,
+	          cthreads_test_epoch_value_free_function,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_epoch_defer_free(
+	          participant,
+	          NULL,
+	          cthreads_test_epoch_value_free_function,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_epoch_defer_free(
+	          participant,
+	          (intptr_t *) &result,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+
+	/* Test libcthreads_epoch_defer_free with malloc failing
+	 */
+	cthreads_test_malloc_attempts_before_fail = 0;
+
+	result = libcthreads_epoch_defer_free(
+	          participant,
+	          (intptr_t *) &result,
+	          cthreads_test_epoch_value_free_function,
+	          &error );
+
+	if( cthreads_test_malloc_attempts_before_fail != -1 )
+	{
+		cthreads_test_malloc_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libcthreads_epoch_unregister_thread(
+	          &participant,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_epoch_free(
+	          &epoch,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( reader_participant != NULL )
+	{
+		libcthreads_epoch_unregister_thread(
+		 &reader_participant,
+		 NULL );
+	}
+	if( participant != NULL )
+	{
+		libcthreads_epoch_unregister_thread(
+		 &participant,
+		 NULL );
+	}
+	if( epoch != NULL )
+	{
+		libcthreads_epoch_free(
+		 &epoch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_epoch_collect function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_epoch_collect(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libcthreads_thread_t *threads[ 4 ] = { NULL, NULL, NULL, NULL };
+	int number_of_mismatches[ 4 ]      = { 0, 0, 0, 0 };
+	int result                         = 0;
+	int thread_index                   = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_epoch_initialize(
+	          &cthreads_test_epoch,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	cthreads_test_shared_value = (int *) memory_allocate(
+	                              sizeof( int ) );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "cthreads_test_shared_value",
+	 cthreads_test_shared_value );
+
+	*cthreads_test_shared_value = CTHREADS_TEST_EPOCH_VALUE_MAGIC;
+
+	cthreads_test_number_of_freed_values = 0;
+
+	/* Test readers that run concurrently with a writer that replaces and frees the value
+	 */
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          ( thread_index == 0 ) ? cthreads_test_epoch_write_callback_function : cthreads_test_epoch_read_callback_function,
+		          (void *) &( number_of_mismatches[ thread_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "number_of_mismatches[ thread_index ]",
+		 number_of_mismatches[ thread_index ],
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = libcthreads_epoch_collect(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_epoch_free(
+	          &cthreads_test_epoch,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_number_of_freed_values",
+	 cthreads_test_number_of_freed_values,
+	 10000 );
+
+	memory_free(
+	 cthreads_test_shared_value );
+
+	cthreads_test_shared_value = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	if( cthreads_test_epoch != NULL )
+	{
+		libcthreads_epoch_free(
+		 &cthreads_test_epoch,
+		 NULL );
+	}
+	if( cthreads_test_shared_value != NULL )
+	{
+		memory_free(
+		 cthreads_test_shared_value );
+
+		cthreads_test_shared_value = NULL;
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argc )
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_epoch_initialize",
+	 cthreads_test_epoch_initialize );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_epoch_free",
+	 cthreads_test_epoch_free );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_epoch_register_thread",
+	 cthreads_test_epoch_register_thread );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_epoch_unregister_thread",
+	 cthreads_test_epoch_unregister_thread );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_epoch_enter",
+	 cthreads_test_epoch_enter );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_epoch_exit",
+	 cthreads_test_epoch_exit );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_epoch_defer_free",
+	 cthreads_test_epoch_defer_free );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_epoch_collect",
+	 cthreads_test_epoch_collect );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1889 @@
+/*
+ * Library hazard pointer type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cthreads_test_libcerror.h"
+#include "cthreads_test_libcthreads.h"
+#include "cthreads_test_macros.h"
+#include "cthreads_test_memory.h"
+#include "cthreads_test_unused.h"
+
+#define CTHREADS_TEST_HAZARD_POINTER_VALUE_MAGIC	0x48415a50
+
+libcthreads_hazard_pointer_domain_t *cthreads_test_hazard_pointer_domain = NULL;
+int cthreads_test_number_of_freed_values                                 = 0;
+int *cthreads_test_shared_value                                          = NULL;
+
+/* The value free function
+ * The value is overwritten before it is freed so that a use after free is detected
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_hazard_pointer_value_free_function(
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	static char *function = "cthreads_test_hazard_pointer_value_free_function";
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value != NULL )
+	{
+		*( (int *) *value ) = 0;
+
+		memory_free(
+		 *value );
+
+		*value = NULL;
+	}
+	cthreads_test_number_of_freed_values++;
+
+	return( 1 );
+}
+
+/* The writer thread callback function
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_hazard_pointer_write_callback_function(
+     void *arguments CTHREADS_TEST_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "cthreads_test_hazard_pointer_write_callback_function";
+	int *new_value           = NULL;
+	int *old_value           = NULL;
+	int iterator             = 0;
+	int result               = 0;
+
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( arguments )
+
+	for( iterator = 0;
+	     iterator < 10000;
+	     iterator++ )
+	{
+		new_value = (int *) memory_allocate(
+		                     sizeof( int ) );
+
+		if( new_value == NULL )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value.",
+			 function );
+
+			goto on_error;
+		}
+		*new_value = CTHREADS_TEST_HAZARD_POINTER_VALUE_MAGIC;
+
+		/* The exchange publishes the initialized value to the readers
+		 */
+		result = libcthreads_atomic_pointer_exchange(
+		          (intptr_t **) &cthreads_test_shared_value,
+		          (intptr_t *) new_value,
+		          LIBCTHREADS_MEMORY_ORDER_ACQUIRE_RELEASE,
+		          (intptr_t **) &old_value,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to exchange value.",
+			 function );
+
+			memory_free(
+			 new_value );
+
+			goto on_error;
+		}
+
+		result = libcthreads_hazard_pointer_domain_retire(
+		          cthreads_test_hazard_pointer_domain,
+		          (intptr_t *) old_value,
+		          cthreads_test_hazard_pointer_value_free_function,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to retire value.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* The reader thread callback function
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_hazard_pointer_read_callback_function(
+     void *arguments )
+{
+	libcthreads_hazard_pointer_t *hazard_pointer = NULL;
+	libcerror_error_t *error             = NULL;
+	static char *function                = "cthreads_test_hazard_pointer_read_callback_function";
+	int *number_of_mismatches            = NULL;
+	int *value                           = NULL;
+	int iterator                         = 0;
+	int result                           = 0;
+
+	number_of_mismatches = (int *) arguments;
+
+	result = libcthreads_hazard_pointer_acquire(
+	          cthreads_test_hazard_pointer_domain,
+	          &hazard_pointer,
+	          &error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to acquire hazard pointer.",
+		 function );
+
+		goto on_error;
+	}
+
+	for( iterator = 0;
+	     iterator < 10000;
+	     iterator++ )
+	{
+		result = libcthreads_hazard_pointer_protect(
+		          hazard_pointer,
+		          (intptr_t **) &cthreads_test_shared_value,
+		          (intptr_t **) &value,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to protect value.",
+			 function );
+
+			goto on_error;
+		}
+		if( *value != CTHREADS_TEST_HAZARD_POINTER_VALUE_MAGIC )
+		{
+			*number_of_mismatches += 1;
+		}
+		result = libcthreads_hazard_pointer_clear(
+		          hazard_pointer,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to clear hazard pointer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = libcthreads_hazard_pointer_release(
+	          &hazard_pointer,
+	          &error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release hazard pointer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	if( hazard_pointer != NULL )
+	{
+		libcthreads_hazard_pointer_release(
+		 &hazard_pointer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libcthreads_hazard_pointer_domain_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_hazard_pointer_domain_initialize(
+     void )
+{
+	libcerror_error_t *error                                   = NULL;
+	libcthreads_hazard_pointer_domain_t *hazard_pointer_domain = NULL;
+	int result                                                 = 0;
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcthreads_hazard_pointer_domain_initialize(
+	          &hazard_pointer_domain,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "hazard_pointer_domain",
+	 hazard_pointer_domain );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_hazard_pointer_domain_free(
+	          &hazard_pointer_domain,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "hazard_pointer_domain",
+	 hazard_pointer_domain );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_hazard_pointer_domain_initialize(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	hazard_pointer_domain = (libcthreads_hazard_pointer_domain_t *) 0x12345678UL;
+
+	result = libcthreads_hazard_pointer_domain_initialize(
+	          &hazard_pointer_domain,
+	          &error );
+
+	hazard_pointer_domain = NULL;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcthreads_hazard_pointer_domain_initialize with malloc failing
+		 */
+		cthreads_test_malloc_attempts_before_fail = test_number;
+
+		result = libcthreads_hazard_pointer_domain_initialize(
+		          &hazard_pointer_domain,
+		          &error );
+
+		if( cthreads_test_malloc_attempts_before_fail != -1 )
+		{
+			cthreads_test_malloc_attempts_before_fail = -1;
+
+			if( hazard_pointer_domain != NULL )
+			{
+				libcthreads_hazard_pointer_domain_free(
+				 &hazard_pointer_domain,
+				 NULL );
+			}
+		}
+		else
+		{
+			CTHREADS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CTHREADS_TEST_ASSERT_IS_NULL(
+			 "hazard_pointer_domain",
+			 hazard_pointer_domain );
+
+			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcthreads_hazard_pointer_domain_initialize with memset failing
+		 */
+		cthreads_test_memset_attempts_before_fail = test_number;
+
+		result = libcthreads_hazard_pointer_domain_initialize(
+		          &hazard_pointer_domain,
+		          &error );
+
+		if( cthreads_test_memset_attempts_before_fail != -1 )
+		{
+			cthreads_test_memset_attempts_before_fail = -1;
+
+			if( hazard_pointer_domain != NULL )
+			{
+				libcthreads_hazard_pointer_domain_free(
+				 &hazard_pointer_domain,
+				 NULL );
+			}
+		}
+		else
+		{
+			CTHREADS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CTHREADS_TEST_ASSERT_IS_NULL(
+			 "hazard_pointer_domain",
+			 hazard_pointer_domain );
+
+			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hazard_pointer_domain != NULL )
+	{
+		libcthreads_hazard_pointer_domain_free(
+		 &hazard_pointer_domain,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_hazard_pointer_domain_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_hazard_pointer_domain_free(
+     void )
+{
+	libcerror_error_t *error                                   = NULL;
+	libcthreads_hazard_pointer_domain_t *hazard_pointer_domain = NULL;
+	libcthreads_hazard_pointer_t *hazard_pointer               = NULL;
+	int result                                                 = 0;
+	int *value                                                 = NULL;
+
+	/* Initialize test
+	 */
+	result = libcthreads_hazard_pointer_domain_initialize(
+	          &hazard_pointer_domain,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_hazard_pointer_acquire(
+	          hazard_pointer_domain,
+	          &hazard_pointer,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	value = (int *) memory_allocate(
+	                 sizeof( int ) );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	*value = CTHREADS_TEST_HAZARD_POINTER_VALUE_MAGIC;
+
+	result = libcthreads_hazard_pointer_protect(
+	          hazard_pointer,
+	          (intptr_t **) &value,
+	          (intptr_t **) &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_hazard_pointer_domain_retire(
+	          hazard_pointer_domain,
+	          (intptr_t *) value,
+	          cthreads_test_hazard_pointer_value_free_function,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_hazard_pointer_domain_free(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test free of a hazard pointer domain with a hazard pointer in use
+	 */
+	cthreads_test_number_of_freed_values = 0;
+
+	result = libcthreads_hazard_pointer_domain_free(
+	          &hazard_pointer_domain,
+	          &error );
+
+	hazard_pointer = NULL;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "hazard_pointer_domain",
+	 hazard_pointer_domain );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_number_of_freed_values",
+	 cthreads_test_number_of_freed_values,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hazard_pointer != NULL )
+	{
+		libcthreads_hazard_pointer_release(
+		 &hazard_pointer,
+		 NULL );
+	}
+	if( hazard_pointer_domain != NULL )
+	{
+		libcthreads_hazard_pointer_domain_free(
+		 &hazard_pointer_domain,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_hazard_pointer_domain_retire function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_hazard_pointer_domain_retire(
+     void )
+{
+	libcerror_error_t *error                                   = NULL;
+	libcthreads_hazard_pointer_domain_t *hazard_pointer_domain = NULL;
+	libcthreads_hazard_pointer_t *hazard_pointer               = NULL;
+	int result                                                 = 0;
+	int *value                                                 = NULL;
+	int iterator                                               = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_hazard_pointer_domain_initialize(
+	          &hazard_pointer_domain,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_hazard_pointer_acquire(
+	          hazard_pointer_domain,
+	          &hazard_pointer,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	cthreads_test_number_of_freed_values = 0;
+
+	for( iterator = 0;
+	     iterator < 16;
+	     iterator++ )
+	{
+		value = (int *) memory_allocate(
+		                 sizeof( int ) );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "value",
+		 value );
+
+		*value = CTHREADS_TEST_HAZARD_POINTER_VALUE_MAGIC;
+
+		result = libcthreads_hazard_pointer_domain_retire(
+		          hazard_pointer_domain,
+		          (intptr_t *) value,
+		          cthreads_test_hazard_pointer_value_free_function,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcthreads_hazard_pointer_domain_reclaim(
+	          hazard_pointer_domain,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_number_of_freed_values",
+	 cthreads_test_number_of_freed_values,
+	 16 );
+
+	/* Test that retired values are reclaimed in batches
+	 */
+	cthreads_test_number_of_freed_values = 0;
+
+	for( iterator = 0;
+	     iterator < 256;
+	     iterator++ )
+	{
+		value = (int *) memory_allocate(
+		                 sizeof( int ) );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "value",
+		 value );
+
+		*value = CTHREADS_TEST_HAZARD_POINTER_VALUE_MAGIC;
+
+		result = libcthreads_hazard_pointer_domain_retire(
+		          hazard_pointer_domain,
+		          (intptr_t *) value,
+		          cthreads_test_hazard_pointer_value_free_function,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	CTHREADS_TEST_ASSERT_GREATER_THAN_INT(
+	 "cthreads_test_number_of_freed_values",
+	 cthreads_test_number_of_freed_values,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_hazard_pointer_domain_retire(
+	          NULL,
+	          (intptr_t *) &result,
+	          cthreads_test_hazard_pointer_value_free_function,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_hazard_pointer_domain_retire(
+	          hazard_pointer_domain,
+	          NULL,
+	          cthreads_test_hazard_pointer_value_free_function,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_hazard_pointer_domain_retire(
+	          hazard_pointer_domain,
+	          (intptr_t *) &result,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+
+	/* Test libcthreads_hazard_pointer_domain_retire with malloc failing
+	 */
+	cthreads_test_malloc_attempts_before_fail = 0;
+
+	result = libcthreads_hazard_pointer_domain_retire(
+	          hazard_pointer_domain,
+	          (intptr_t *) &result,
+	          cthreads_test_hazard_pointer_value_free_function,
+	          &error );
+
+	if( cthreads_test_malloc_attempts_before_fail != -1 )
+	{
+		cthreads_test_malloc_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libcthreads_hazard_pointer_release(
+	          &hazard_pointer,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_hazard_pointer_domain_free(
+	          &hazard_pointer_domain,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hazard_pointer != NULL )
+	{
+		libcthreads_hazard_pointer_release(
+		 &hazard_pointer,
+		 NULL );
+	}
+	if( hazard_pointer_domain != NULL )
+	{
+		libcthreads_hazard_pointer_domain_free(
+		 &hazard_pointer_domain,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_hazard_pointer_domain_reclaim function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_hazard_pointer_domain_reclaim(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libcthreads_thread_t *threads[ 4 ]           = { NULL, NULL, NULL, NULL };
+	libcthreads_hazard_pointer_t *hazard_pointer = NULL;
+	int number_of_mismatches[ 4 ]                = { 0, 0, 0, 0 };
+	int *protected_value                         = NULL;
+	int *value                                   = NULL;
+	int result                                   = 0;
+	int thread_index                             = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_hazard_pointer_domain_initialize(
+	          &cthreads_test_hazard_pointer_domain,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_hazard_pointer_acquire(
+	          cthreads_test_hazard_pointer_domain,
+	          &hazard_pointer,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a protected value is not freed
+	 */
+	cthreads_test_number_of_freed_values = 0;
+
+	value = (int *) memory_allocate(
+	                 sizeof( int ) );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	*value = CTHREADS_TEST_HAZARD_POINTER_VALUE_MAGIC;
+
+	result = libcthreads_hazard_pointer_protect(
+	          hazard_pointer,
+	          (intptr_t **) &value,
+	          (intptr_t **) &protected_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_hazard_pointer_domain_retire(
+	          cthreads_test_hazard_pointer_domain,
+	          (intptr_t *) value,
+	          cthreads_test_hazard_pointer_value_free_function,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_hazard_pointer_domain_reclaim(
+	          cthreads_test_hazard_pointer_domain,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_number_of_freed_values",
+	 cthreads_test_number_of_freed_values,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "*protected_value",
+	 *protected_value,
+	 CTHREADS_TEST_HAZARD_POINTER_VALUE_MAGIC );
+
+	result = libcthreads_hazard_pointer_clear(
+	          hazard_pointer,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_hazard_pointer_domain_reclaim(
+	          cthreads_test_hazard_pointer_domain,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_number_of_freed_values",
+	 cthreads_test_number_of_freed_values,
+	 1 );
+
+	result = libcthreads_hazard_pointer_release(
+	          &hazard_pointer,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	cthreads_test_shared_value = (int *) memory_allocate(
+	                              sizeof( int ) );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "cthreads_test_shared_value",
+	 cthreads_test_shared_value );
+
+	*cthreads_test_shared_value = CTHREADS_TEST_HAZARD_POINTER_VALUE_MAGIC;
+
+	cthreads_test_number_of_freed_values = 0;
+
+	/* Test readers that run concurrently with a writer that replaces and retires the value
+	 */
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          ( thread_index == 0 ) ? cthreads_test_hazard_pointer_write_callback_function : cthreads_test_hazard_pointer_read_callback_function,
+		          (void *) &( number_of_mismatches[ thread_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "number_of_mismatches[ thread_index ]",
+		 number_of_mismatches[ thread_index ],
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = libcthreads_hazard_pointer_domain_reclaim(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_hazard_pointer_domain_free(
+	          &cthreads_test_hazard_pointer_domain,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_number_of_freed_values",
+	 cthreads_test_number_of_freed_values,
+	 10000 );
+
+	memory_free(
+	 cthreads_test_shared_value );
+
+	cthreads_test_shared_value = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	if( hazard_pointer != NULL )
+	{
+		libcthreads_hazard_pointer_release(
+		 &hazard_pointer,
+		 NULL );
+	}
+	if( cthreads_test_hazard_pointer_domain != NULL )
+	{
+		libcthreads_hazard_pointer_domain_free(
+		 &cthreads_test_hazard_pointer_domain,
+		 NULL );
+	}
+	if( cthreads_test_shared_value != NULL )
+	{
+		memory_free(
+		 cthreads_test_shared_value );
+
+		cthreads_test_shared_value = NULL;
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_hazard_pointer_acquire function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_hazard_pointer_acquire(
+     void )
+{
+	libcerror_error_t *error                                   = NULL;
+	libcthreads_hazard_pointer_domain_t *hazard_pointer_domain = NULL;
+	libcthreads_hazard_pointer_t *hazard_pointer               = NULL;
+	int result                                                 = 0;
+	libcthreads_hazard_pointer_t *second_hazard_pointer        = NULL;
+
+	/* Initialize test
+	 */
+	result = libcthreads_hazard_pointer_domain_initialize(
+	          &hazard_pointer_domain,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_hazard_pointer_acquire(
+	          hazard_pointer_domain,
+	          &hazard_pointer,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "hazard_pointer",
+	 hazard_pointer );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_hazard_pointer_acquire(
+	          hazard_pointer_domain,
+	          &second_hazard_pointer,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "second_hazard_pointer",
+	 second_hazard_pointer );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a released hazard pointer is reused
+	 */
+	result = libcthreads_hazard_pointer_release(
+	          &second_hazard_pointer,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_hazard_pointer_acquire(
+	          hazard_pointer_domain,
+	          &second_hazard_pointer,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_hazard_pointer_release(
+	          &second_hazard_pointer,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_hazard_pointer_acquire(
+	          NULL,
+	          &hazard_pointer,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_hazard_pointer_acquire(
+	          hazard_pointer_domain,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_hazard_pointer_acquire(
+	          hazard_pointer_domain,
+	          &hazard_pointer,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_hazard_pointer_release(
+	          &hazard_pointer,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_hazard_pointer_domain_free(
+	          &hazard_pointer_domain,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_hazard_pointer != NULL )
+	{
+		libcthreads_hazard_pointer_release(
+		 &second_hazard_pointer,
+		 NULL );
+	}
+	if( hazard_pointer != NULL )
+	{
+		libcthreads_hazard_pointer_release(
+		 &hazard_pointer,
+		 NULL );
+	}
+	if( hazard_pointer_domain != NULL )
+	{
+		libcthreads_hazard_pointer_domain_free(
+		 &hazard_pointer_domain,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_hazard_pointer_release function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_hazard_pointer_release(
+     void )
+{
+	libcerror_error_t *error                                   = NULL;
+	libcthreads_hazard_pointer_domain_t *hazard_pointer_domain = NULL;
+	libcthreads_hazard_pointer_t *hazard_pointer               = NULL;
+	int result                                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_hazard_pointer_domain_initialize(
+	          &hazard_pointer_domain,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_hazard_pointer_acquire(
+	          hazard_pointer_domain,
+	          &hazard_pointer,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_hazard_pointer_release(
+	          &hazard_pointer,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "hazard_pointer",
+	 hazard_pointer );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_hazard_pointer_release(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_hazard_pointer_release(
+	          &hazard_pointer,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_hazard_pointer_domain_free(
+	          &hazard_pointer_domain,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hazard_pointer != NULL )
+	{
+		libcthreads_hazard_pointer_release(
+		 &hazard_pointer,
+		 NULL );
+	}
+	if( hazard_pointer_domain != NULL )
+	{
+		libcthreads_hazard_pointer_domain_free(
+		 &hazard_pointer_domain,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_hazard_pointer_protect function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_hazard_pointer_protect(
+     void )
+{
+	libcerror_error_t *error                                   = NULL;
+	libcthreads_hazard_pointer_domain_t *hazard_pointer_domain = NULL;
+	libcthreads_hazard_pointer_t *hazard_pointer               = NULL;
+	int result                                                 = 0;
+	int *protected_value                                       = NULL;
+	int *source                                                = NULL;
+
+	/* Initialize test
+	 */
+	result = libcthreads_hazard_pointer_domain_initialize(
+	          &hazard_pointer_domain,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_hazard_pointer_acquire(
+	          hazard_pointer_domain,
+	          &hazard_pointer,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	source = &result;
+
+	result = libcthreads_hazard_pointer_protect(
+	          hazard_pointer,
+	          (intptr_t **) &source,
+	          (intptr_t **) &protected_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "protected_value",
+	 (int) ( protected_value == &result ),
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_hazard_pointer_protect(
+	          NULL,
+	          (intptr_t **) &source,
+	          (intptr_t **) &protected_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_hazard_pointer_protect(
+	          hazard_pointer,
+	          NULL,
+	          (intptr_t **) &protected_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_hazard_pointer_protect(
+	          hazard_pointer,
+	          (intptr_t **) &source,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_hazard_pointer_release(
+	          &hazard_pointer,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_hazard_pointer_domain_free(
+	          &hazard_pointer_domain,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hazard_pointer != NULL )
+	{
+		libcthreads_hazard_pointer_release(
+		 &hazard_pointer,
+		 NULL );
+	}
+	if( hazard_pointer_domain != NULL )
+	{
+		libcthreads_hazard_pointer_domain_free(
+		 &hazard_pointer_domain,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_hazard_pointer_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_hazard_pointer_clear(
+     void )
+{
+	libcerror_error_t *error                                   = NULL;
+	libcthreads_hazard_pointer_domain_t *hazard_pointer_domain = NULL;
+	libcthreads_hazard_pointer_t *hazard_pointer               = NULL;
+	int result                                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_hazard_pointer_domain_initialize(
+	          &hazard_pointer_domain,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_hazard_pointer_acquire(
+	          hazard_pointer_domain,
+	          &hazard_pointer,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_hazard_pointer_clear(
+	          hazard_pointer,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_hazard_pointer_clear(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_hazard_pointer_release(
+	          &hazard_pointer,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_hazard_pointer_domain_free(
+	          &hazard_pointer_domain,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hazard_pointer != NULL )
+	{
+		libcthreads_hazard_pointer_release(
+		 &hazard_pointer,
+		 NULL );
+	}
+	if( hazard_pointer_domain != NULL )
+	{
+		libcthreads_hazard_pointer_domain_free(
+		 &hazard_pointer_domain,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argc )
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_hazard_pointer_domain_initialize",
+	 cthreads_test_hazard_pointer_domain_initialize );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_hazard_pointer_domain_free",
+	 cthreads_test_hazard_pointer_domain_free );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_hazard_pointer_domain_retire",
+	 cthreads_test_hazard_pointer_domain_retire );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_hazard_pointer_domain_reclaim",
+	 cthreads_test_hazard_pointer_domain_reclaim );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_hazard_pointer_acquire",
+	 cthreads_test_hazard_pointer_acquire );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_hazard_pointer_release",
+	 cthreads_test_hazard_pointer_release );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_hazard_pointer_protect",
+	 cthreads_test_hazard_pointer_protect );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_hazard_pointer_clear",
+	 cthreads_test_hazard_pointer_clear );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
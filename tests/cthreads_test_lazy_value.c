@@ -0,0 +1,527 @@
+/*
+ * Library lazy value type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cthreads_test_libcerror.h"
+#include "cthreads_test_libcthreads.h"
+#include "cthreads_test_macros.h"
+#include "cthreads_test_unused.h"
+
+libcthreads_lazy_value_t cthreads_test_lazy_value = LIBCTHREADS_LAZY_VALUE_INIT;
+int cthreads_test_number_of_initializations       = 0;
+int cthreads_test_value                           = 1;
+
+/* The value initialize function
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_lazy_value_initialize_function(
+     intptr_t **value,
+     void *arguments CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error CTHREADS_TEST_ATTRIBUTE_UNUSED )
+{
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( arguments )
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( error )
+
+	cthreads_test_number_of_initializations += 1;
+
+	*value = (intptr_t *) &cthreads_test_value;
+
+	return( 1 );
+}
+
+/* The value free function
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_lazy_value_free_function(
+     intptr_t **value,
+     libcerror_error_t **error CTHREADS_TEST_ATTRIBUTE_UNUSED )
+{
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( error )
+
+	*value = NULL;
+
+	return( 1 );
+}
+
+/* The thread callback function that retrieves the value
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_lazy_value_callback_function(
+     void *arguments )
+{
+	libcerror_error_t *error = NULL;
+	intptr_t **value         = NULL;
+	static char *function    = "cthreads_test_lazy_value_callback_function";
+	int result               = 0;
+
+	value = (intptr_t **) arguments;
+
+	result = libcthreads_lazy_value_get(
+	          &cthreads_test_lazy_value,
+	          &cthreads_test_lazy_value_initialize_function,
+	          NULL,
+	          value,
+	          &error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve lazy value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* Tests the libcthreads_lazy_value_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_lazy_value_initialize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libcthreads_lazy_value_t lazy_value = LIBCTHREADS_LAZY_VALUE_INIT;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libcthreads_lazy_value_initialize(
+	          &lazy_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_lazy_value_initialize(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_lazy_value_get function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_lazy_value_get(
+     void )
+{
+	libcthreads_thread_t *threads[ 4 ] = { NULL, NULL, NULL, NULL };
+	intptr_t *values[ 4 ]                = { NULL, NULL, NULL, NULL };
+	libcerror_error_t *error             = NULL;
+	libcthreads_lazy_value_t lazy_value  = LIBCTHREADS_LAZY_VALUE_INIT;
+	intptr_t *value                      = NULL;
+	int result                           = 0;
+	int thread_index                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libcthreads_lazy_value_get(
+	          &lazy_value,
+	          &cthreads_test_lazy_value_initialize_function,
+	          NULL,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INTPTR(
+	 "value",
+	 (intptr_t) value,
+	 (intptr_t) &cthreads_test_value );
+
+	result = libcthreads_lazy_value_get(
+	          &lazy_value,
+	          &cthreads_test_lazy_value_initialize_function,
+	          NULL,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_number_of_initializations",
+	 cthreads_test_number_of_initializations,
+	 1 );
+
+	/* Test threads that retrieve the value at the same time
+	 */
+	cthreads_test_number_of_initializations = 0;
+
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          cthreads_test_lazy_value_callback_function,
+		          (void *) &( values[ thread_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INTPTR(
+		 "values[ thread_index ]",
+		 (intptr_t) values[ thread_index ],
+		 (intptr_t) &cthreads_test_value );
+	}
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_number_of_initializations",
+	 cthreads_test_number_of_initializations,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_lazy_value_get(
+	          NULL,
+	          &cthreads_test_lazy_value_initialize_function,
+	          NULL,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_lazy_value_get(
+	          &lazy_value,
+	          &cthreads_test_lazy_value_initialize_function,
+	          NULL,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_lazy_value_initialize(
+	          &lazy_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_lazy_value_get(
+	          &lazy_value,
+	          NULL,
+	          NULL,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_lazy_value_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_lazy_value_clear(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libcthreads_lazy_value_t lazy_value = LIBCTHREADS_LAZY_VALUE_INIT;
+	intptr_t *value                     = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_lazy_value_get(
+	          &lazy_value,
+	          &cthreads_test_lazy_value_initialize_function,
+	          NULL,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_lazy_value_clear(
+	          &lazy_value,
+	          &cthreads_test_lazy_value_free_function,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	cthreads_test_number_of_initializations = 0;
+
+	result = libcthreads_lazy_value_get(
+	          &lazy_value,
+	          &cthreads_test_lazy_value_initialize_function,
+	          NULL,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INTPTR(
+	 "value",
+	 (intptr_t) value,
+	 (intptr_t) &cthreads_test_value );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_number_of_initializations",
+	 cthreads_test_number_of_initializations,
+	 1 );
+
+	result = libcthreads_lazy_value_clear(
+	          &lazy_value,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_lazy_value_clear(
+	          NULL,
+	          &cthreads_test_lazy_value_free_function,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argc )
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_lazy_value_initialize",
+	 cthreads_test_lazy_value_initialize );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_lazy_value_get",
+	 cthreads_test_lazy_value_get );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_lazy_value_clear",
+	 cthreads_test_lazy_value_clear );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
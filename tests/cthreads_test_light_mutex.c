@@ -0,0 +1,499 @@
+/*
+ * Library light mutex type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cthreads_test_libcerror.h"
+#include "cthreads_test_libcthreads.h"
+#include "cthreads_test_macros.h"
+#include "cthreads_test_unused.h"
+
+libcthreads_light_mutex_t cthreads_test_light_mutex = LIBCTHREADS_LIGHT_MUTEX_INIT;
+int cthreads_test_mutexed_value                     = 0;
+int cthreads_test_number_of_iterations              = 100000;
+
+/* The thread callback function
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_light_mutex_callback_function(
+     void *arguments CTHREADS_TEST_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "cthreads_test_light_mutex_callback_function";
+	int iterator             = 0;
+	int result               = 0;
+
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( arguments )
+
+	for( iterator = 0;
+	     iterator < cthreads_test_number_of_iterations;
+	     iterator++ )
+	{
+		result = libcthreads_light_mutex_grab(
+		          &cthreads_test_light_mutex,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab light mutex.",
+			 function );
+
+			goto on_error;
+		}
+		cthreads_test_mutexed_value += 1;
+
+		result = libcthreads_light_mutex_release(
+		          &cthreads_test_light_mutex,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release light mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* Tests the libcthreads_light_mutex_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_light_mutex_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libcthreads_light_mutex_t light_mutex = LIBCTHREADS_LIGHT_MUTEX_INIT;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	light_mutex = 1;
+
+	result = libcthreads_light_mutex_initialize(
+	          &light_mutex,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "light_mutex",
+	 (int) light_mutex,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_light_mutex_initialize(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_light_mutex_grab function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_light_mutex_grab(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libcthreads_light_mutex_t light_mutex = LIBCTHREADS_LIGHT_MUTEX_INIT;
+	libcthreads_thread_t *threads[ 4 ]    = { NULL, NULL, NULL, NULL };
+	int result                            = 0;
+	int thread_index                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libcthreads_light_mutex_grab(
+	          &light_mutex,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_light_mutex_release(
+	          &light_mutex,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test grab with multiple threads contending for the light mutex
+	 */
+	cthreads_test_mutexed_value = 0;
+
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          cthreads_test_light_mutex_callback_function,
+		          NULL,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_mutexed_value",
+	 cthreads_test_mutexed_value,
+	 4 * cthreads_test_number_of_iterations );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_light_mutex",
+	 (int) cthreads_test_light_mutex,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_light_mutex_grab(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_light_mutex_try_grab function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_light_mutex_try_grab(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libcthreads_light_mutex_t light_mutex = LIBCTHREADS_LIGHT_MUTEX_INIT;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	result = libcthreads_light_mutex_try_grab(
+	          &light_mutex,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test try grab of a grabbed light mutex
+	 */
+	result = libcthreads_light_mutex_try_grab(
+	          &light_mutex,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_light_mutex_release(
+	          &light_mutex,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_light_mutex_try_grab(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_light_mutex_release function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_light_mutex_release(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libcthreads_light_mutex_t light_mutex = LIBCTHREADS_LIGHT_MUTEX_INIT;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	result = libcthreads_light_mutex_grab(
+	          &light_mutex,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_light_mutex_release(
+	          &light_mutex,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_light_mutex_release(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test release of a light mutex that is not grabbed
+	 */
+	result = libcthreads_light_mutex_release(
+	          &light_mutex,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argc )
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_light_mutex_initialize",
+	 cthreads_test_light_mutex_initialize );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_light_mutex_grab",
+	 cthreads_test_light_mutex_grab );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_light_mutex_try_grab",
+	 cthreads_test_light_mutex_try_grab );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_light_mutex_release",
+	 cthreads_test_light_mutex_release );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -603,6 +603,172 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libcthreads_lock_initialize_in_place function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_lock_initialize_in_place(
+     void )
+{
+	libcthreads_lock_storage_t storage[ 4 ];
+	libcthreads_lock_t *locks[ 4 ] = { NULL, NULL, NULL, NULL };
+	libcerror_error_t *error       = NULL;
+	int index                      = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	for( index = 0;
+	     index < 4;
+	     index++ )
+	{
+		result = libcthreads_lock_initialize_in_place(
+		          &( storage[ index ] ),
+		          &( locks[ index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "locks[ index ]",
+		 locks[ index ] );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( index = 0;
+	     index < 4;
+	     index++ )
+	{
+		result = libcthreads_lock_grab(
+		          locks[ index ],
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcthreads_lock_release(
+		          locks[ index ],
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( index = 0;
+	     index < 4;
+	     index++ )
+	{
+		result = libcthreads_lock_free(
+		          &( locks[ index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "locks[ index ]",
+		 locks[ index ] );
+	}
+	/* Test error cases
+	 */
+	result = libcthreads_lock_initialize_in_place(
+	          NULL,
+	          &( locks[ 0 ] ),
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_lock_initialize_in_place(
+	          &( storage[ 0 ] ),
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	locks[ 0 ] = (libcthreads_lock_t *) 0x12345678UL;
+
+	result = libcthreads_lock_initialize_in_place(
+	          &( storage[ 0 ] ),
+	          &( locks[ 0 ] ),
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	locks[ 0 ] = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( index = 0;
+	     index < 4;
+	     index++ )
+	{
+		if( locks[ index ] != NULL )
+		{
+			libcthreads_lock_free(
+			 &( locks[ index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
 /* Tests the libcthreads_lock_free function
  * Returns 1 if successful or 0 if not
  */
@@ -1265,6 +1431,224 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libcthreads_lock_set_profile_name function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_lock_set_profile_name(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libcthreads_lock_t *lock = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_lock_initialize(
+	          &lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_lock_set_profile_name(
+	          lock,
+	          "cthreads_test_lock",
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_lock_set_profile_name(
+	          NULL,
+	          "cthreads_test_lock",
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_lock_set_profile_name(
+	          lock,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_lock_free(
+	          &lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( lock != NULL )
+	{
+		libcthreads_lock_free(
+		 &lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_lock_set_class_name function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_lock_set_class_name(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libcthreads_lock_t *lock = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_lock_initialize(
+	          &lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_lock_set_class_name(
+	          lock,
+	          "cthreads_test_lock_class",
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_lock_set_class_name(
+	          NULL,
+	          "cthreads_test_lock_class",
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_lock_set_class_name(
+	          lock,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_lock_free(
+	          &lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( lock != NULL )
+	{
+		libcthreads_lock_free(
+		 &lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -1284,6 +1668,10 @@ int main(
 	 "libcthreads_lock_initialize",
 	 cthreads_test_lock_initialize );
 
+	CTHREADS_TEST_RUN(
+	 "libcthreads_lock_initialize_in_place",
+	 cthreads_test_lock_initialize_in_place );
+
 	CTHREADS_TEST_RUN(
 	 "libcthreads_lock_free",
 	 cthreads_test_lock_free );
@@ -1296,6 +1684,14 @@ int main(
 	 "libcthreads_lock_release",
 	 cthreads_test_lock_release );
 
+	CTHREADS_TEST_RUN(
+	 "libcthreads_lock_set_profile_name",
+	 cthreads_test_lock_set_profile_name );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_lock_set_class_name",
+	 cthreads_test_lock_set_class_name );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -0,0 +1,1452 @@
+/*
+ * Library lock table type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cthreads_test_libcerror.h"
+#include "cthreads_test_libcthreads.h"
+#include "cthreads_test_macros.h"
+#include "cthreads_test_memory.h"
+#include "cthreads_test_unused.h"
+
+libcthreads_lock_table_t *cthreads_test_lock_table = NULL;
+
+uint64_t cthreads_test_lock_table_keys[ 4 ]          = { 3, 1, 4, 1 };
+uint64_t cthreads_test_lock_table_reversed_keys[ 4 ] = { 1, 4, 1, 3 };
+
+int cthreads_test_lock_table_value = 0;
+
+/* The thread callback function that grabs multiple keys of the lock table
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_lock_table_grab_by_keys_callback_function(
+     void *arguments )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "cthreads_test_lock_table_grab_by_keys_callback_function";
+	uint64_t *keys           = NULL;
+	int iterator             = 0;
+
+	keys = (uint64_t *) arguments;
+
+	for( iterator = 0;
+	     iterator < 1024;
+	     iterator++ )
+	{
+		if( libcthreads_lock_table_grab_by_keys(
+		     cthreads_test_lock_table,
+		     keys,
+		     4,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab keys.",
+			 function );
+
+			goto on_error;
+		}
+		cthreads_test_lock_table_value++;
+
+		if( libcthreads_lock_table_release_by_keys(
+		     cthreads_test_lock_table,
+		     keys,
+		     4,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release keys.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* Tests the libcthreads_lock_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_lock_table_initialize(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libcthreads_lock_table_t *lock_table = NULL;
+	int result                                     = 0;
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 2;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcthreads_lock_table_initialize(
+	          &lock_table,
+	          0,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "lock_table",
+	 lock_table );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_lock_table_free(
+	          &lock_table,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_lock_table_initialize(
+	          &lock_table,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "lock_table",
+	 lock_table );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_lock_table_free(
+	          &lock_table,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "lock_table",
+	 lock_table );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_lock_table_initialize(
+	          NULL,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	lock_table = (libcthreads_lock_table_t *) 0x12345678UL;
+
+	result = libcthreads_lock_table_initialize(
+	          &lock_table,
+	          4,
+	          &error );
+
+	lock_table = NULL;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_lock_table_initialize(
+	          &lock_table,
+	          -1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_lock_table_initialize(
+	          &lock_table,
+	          65537,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcthreads_lock_table_initialize with malloc failing
+		 */
+		cthreads_test_malloc_attempts_before_fail = test_number;
+
+		result = libcthreads_lock_table_initialize(
+		          &lock_table,
+		          4,
+		          &error );
+
+		if( cthreads_test_malloc_attempts_before_fail != -1 )
+		{
+			cthreads_test_malloc_attempts_before_fail = -1;
+
+			if( lock_table != NULL )
+			{
+				libcthreads_lock_table_free(
+				 &lock_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			CTHREADS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CTHREADS_TEST_ASSERT_IS_NULL(
+			 "lock_table",
+			 lock_table );
+
+			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcthreads_lock_table_initialize with memset failing
+		 */
+		cthreads_test_memset_attempts_before_fail = test_number;
+
+		result = libcthreads_lock_table_initialize(
+		          &lock_table,
+		          4,
+		          &error );
+
+		if( cthreads_test_memset_attempts_before_fail != -1 )
+		{
+			cthreads_test_memset_attempts_before_fail = -1;
+
+			if( lock_table != NULL )
+			{
+				libcthreads_lock_table_free(
+				 &lock_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			CTHREADS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CTHREADS_TEST_ASSERT_IS_NULL(
+			 "lock_table",
+			 lock_table );
+
+			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( lock_table != NULL )
+	{
+		libcthreads_lock_table_free(
+		 &lock_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_lock_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_lock_table_free(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libcthreads_lock_table_t *lock_table = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_lock_table_initialize(
+	          &lock_table,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_lock_table_free(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test free of a lock table with a grabbed lock
+	 */
+	result = libcthreads_lock_table_grab_by_key(
+	          lock_table,
+	          1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_lock_table_free(
+	          &lock_table,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "lock_table",
+	 lock_table );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( lock_table != NULL )
+	{
+		libcthreads_lock_table_free(
+		 &lock_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_lock_table_get_number_of_locks function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_lock_table_get_number_of_locks(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libcthreads_lock_table_t *lock_table = NULL;
+	int number_of_locks                  = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_lock_table_initialize(
+	          &lock_table,
+	          5,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_lock_table_get_number_of_locks(
+	          lock_table,
+	          &number_of_locks,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_locks",
+	 number_of_locks,
+	 8 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_lock_table_get_number_of_locks(
+	          NULL,
+	          &number_of_locks,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_lock_table_get_number_of_locks(
+	          lock_table,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_lock_table_free(
+	          &lock_table,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( lock_table != NULL )
+	{
+		libcthreads_lock_table_free(
+		 &lock_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_lock_table_grab_by_key function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_lock_table_grab_by_key(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libcthreads_lock_table_t *lock_table = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_lock_table_initialize(
+	          &lock_table,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_lock_table_grab_by_key(
+	          lock_table,
+	          1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_lock_table_try_grab_by_key(
+	          lock_table,
+	          1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_lock_table_release_by_key(
+	          lock_table,
+	          1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_lock_table_grab_by_key(
+	          NULL,
+	          1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_lock_table_free(
+	          &lock_table,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( lock_table != NULL )
+	{
+		libcthreads_lock_table_free(
+		 &lock_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_lock_table_try_grab_by_key function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_lock_table_try_grab_by_key(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libcthreads_lock_table_t *lock_table = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_lock_table_initialize(
+	          &lock_table,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_lock_table_try_grab_by_key(
+	          lock_table,
+	          1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_lock_table_try_grab_by_key(
+	          lock_table,
+	          1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_lock_table_release_by_key(
+	          lock_table,
+	          1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_lock_table_try_grab_by_key(
+	          NULL,
+	          1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_lock_table_free(
+	          &lock_table,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( lock_table != NULL )
+	{
+		libcthreads_lock_table_free(
+		 &lock_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_lock_table_release_by_key function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_lock_table_release_by_key(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libcthreads_lock_table_t *lock_table = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_lock_table_initialize(
+	          &lock_table,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_lock_table_grab_by_key(
+	          lock_table,
+	          1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_lock_table_release_by_key(
+	          lock_table,
+	          1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_lock_table_release_by_key(
+	          NULL,
+	          1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test release of a lock that is not grabbed
+	 */
+	result = libcthreads_lock_table_release_by_key(
+	          lock_table,
+	          1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_lock_table_free(
+	          &lock_table,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( lock_table != NULL )
+	{
+		libcthreads_lock_table_free(
+		 &lock_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_lock_table_grab_by_keys function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_lock_table_grab_by_keys(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libcthreads_thread_t *threads[ 4 ] = { NULL, NULL, NULL, NULL };
+	uint64_t *keys                     = NULL;
+	int key_index                      = 0;
+	int result                         = 0;
+	int thread_index                   = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_lock_table_initialize(
+	          &cthreads_test_lock_table,
+	          0,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_lock_table_grab_by_keys(
+	          cthreads_test_lock_table,
+	          cthreads_test_lock_table_keys,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( key_index = 0;
+	     key_index < 4;
+	     key_index++ )
+	{
+		result = libcthreads_lock_table_try_grab_by_key(
+		          cthreads_test_lock_table,
+		          cthreads_test_lock_table_keys[ key_index ],
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcthreads_lock_table_release_by_keys(
+	          cthreads_test_lock_table,
+	          cthreads_test_lock_table_keys,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_lock_table_grab_by_keys(
+	          cthreads_test_lock_table,
+	          cthreads_test_lock_table_keys,
+	          0,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test threads that grab the same keys in a different order at the same time
+	 */
+	cthreads_test_lock_table_value = 0;
+
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		if( ( thread_index % 2 ) == 0 )
+		{
+			keys = cthreads_test_lock_table_keys;
+		}
+		else
+		{
+			keys = cthreads_test_lock_table_reversed_keys;
+		}
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          cthreads_test_lock_table_grab_by_keys_callback_function,
+		          (void *) keys,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_lock_table_value",
+	 cthreads_test_lock_table_value,
+	 4 * 1024 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_lock_table_grab_by_keys(
+	          NULL,
+	          cthreads_test_lock_table_keys,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_lock_table_grab_by_keys(
+	          cthreads_test_lock_table,
+	          NULL,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_lock_table_grab_by_keys(
+	          cthreads_test_lock_table,
+	          cthreads_test_lock_table_keys,
+	          -1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_lock_table_free(
+	          &cthreads_test_lock_table,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	if( cthreads_test_lock_table != NULL )
+	{
+		libcthreads_lock_table_free(
+		 &cthreads_test_lock_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_lock_table_release_by_keys function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_lock_table_release_by_keys(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libcthreads_lock_table_t *lock_table = NULL;
+	int key_index                        = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_lock_table_initialize(
+	          &lock_table,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_lock_table_grab_by_keys(
+	          lock_table,
+	          cthreads_test_lock_table_keys,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_lock_table_release_by_keys(
+	          lock_table,
+	          cthreads_test_lock_table_reversed_keys,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( key_index = 0;
+	     key_index < 4;
+	     key_index++ )
+	{
+		result = libcthreads_lock_table_try_grab_by_key(
+		          lock_table,
+		          cthreads_test_lock_table_keys[ key_index ],
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcthreads_lock_table_release_by_key(
+		          lock_table,
+		          cthreads_test_lock_table_keys[ key_index ],
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libcthreads_lock_table_release_by_keys(
+	          NULL,
+	          cthreads_test_lock_table_keys,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_lock_table_release_by_keys(
+	          lock_table,
+	          NULL,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_lock_table_release_by_keys(
+	          lock_table,
+	          cthreads_test_lock_table_keys,
+	          -1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test release of locks that are not grabbed
+	 */
+	result = libcthreads_lock_table_release_by_keys(
+	          lock_table,
+	          cthreads_test_lock_table_keys,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_lock_table_free(
+	          &lock_table,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( lock_table != NULL )
+	{
+		libcthreads_lock_table_free(
+		 &lock_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argc )
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_lock_table_initialize",
+	 cthreads_test_lock_table_initialize );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_lock_table_free",
+	 cthreads_test_lock_table_free );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_lock_table_get_number_of_locks",
+	 cthreads_test_lock_table_get_number_of_locks );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_lock_table_grab_by_key",
+	 cthreads_test_lock_table_grab_by_key );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_lock_table_try_grab_by_key",
+	 cthreads_test_lock_table_try_grab_by_key );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_lock_table_release_by_key",
+	 cthreads_test_lock_table_release_by_key );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_lock_table_grab_by_keys",
+	 cthreads_test_lock_table_grab_by_keys );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_lock_table_release_by_keys",
+	 cthreads_test_lock_table_release_by_keys );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
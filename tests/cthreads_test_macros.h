@@ -60,14 +60,14 @@
 #define CTHREADS_TEST_ASSERT_EQUAL_INTPTR( name, value, expected_value ) \
 	if( value != expected_value ) \
 	{ \
-		fprintf( stdout, "%s:%d %s (0x%08x" PRIjx ") != 0x%08x" PRIjx "\n", __FILE__, __LINE__, name, value, expected_value ); \
+		fprintf( stdout, "%s:%d %s (0x%08" PRIjx ") != 0x%08" PRIjx "\n", __FILE__, __LINE__, name, (uintmax_t) value, (uintmax_t) expected_value ); \
 		goto on_error; \
 	}
 
 #define CTHREADS_TEST_ASSERT_NOT_EQUAL_INTPTR( name, value, expected_value ) \
 	if( value == expected_value ) \
 	{ \
-		fprintf( stdout, "%s:%d %s (0x%08x" PRIjx ") == 0x%08x" PRIjx "\n", __FILE__, __LINE__, name, value, expected_value ); \
+		fprintf( stdout, "%s:%d %s (0x%08" PRIjx ") == 0x%08" PRIjx "\n", __FILE__, __LINE__, name, (uintmax_t) value, (uintmax_t) expected_value ); \
 		goto on_error; \
 	}
 
@@ -0,0 +1,906 @@
+/*
+ * Library MCS lock type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cthreads_test_libcerror.h"
+#include "cthreads_test_libcthreads.h"
+#include "cthreads_test_macros.h"
+#include "cthreads_test_memory.h"
+#include "cthreads_test_unused.h"
+
+libcthreads_mcs_lock_t *cthreads_test_mcs_lock = NULL;
+int cthreads_test_locked_value                 = 0;
+int cthreads_test_number_of_iterations         = 100000;
+
+/* The thread callback function
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_mcs_lock_callback_function(
+     void *arguments CTHREADS_TEST_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error         = NULL;
+	libcthreads_mcs_lock_node_t node;
+	static char *function            = "cthreads_test_mcs_lock_callback_function";
+	int iterator                     = 0;
+	int result                       = 0;
+
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( arguments )
+
+	for( iterator = 0;
+	     iterator < cthreads_test_number_of_iterations;
+	     iterator++ )
+	{
+		result = libcthreads_mcs_lock_grab(
+		          cthreads_test_mcs_lock,
+		          &node,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab MCS lock.",
+			 function );
+
+			goto on_error;
+		}
+		cthreads_test_locked_value += 1;
+
+		result = libcthreads_mcs_lock_release(
+		          cthreads_test_mcs_lock,
+		          &node,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release MCS lock.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* Tests the libcthreads_mcs_lock_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_mcs_lock_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libcthreads_mcs_lock_t *mcs_lock = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 1;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcthreads_mcs_lock_initialize(
+	          &mcs_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "mcs_lock",
+	 mcs_lock );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_mcs_lock_free(
+	          &mcs_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "mcs_lock",
+	 mcs_lock );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_mcs_lock_initialize(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	mcs_lock = (libcthreads_mcs_lock_t *) 0x12345678UL;
+
+	result = libcthreads_mcs_lock_initialize(
+	          &mcs_lock,
+	          &error );
+
+	mcs_lock = NULL;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcthreads_mcs_lock_initialize with malloc failing
+		 */
+		cthreads_test_malloc_attempts_before_fail = test_number;
+
+		result = libcthreads_mcs_lock_initialize(
+		          &mcs_lock,
+		          &error );
+
+		if( cthreads_test_malloc_attempts_before_fail != -1 )
+		{
+			cthreads_test_malloc_attempts_before_fail = -1;
+
+			if( mcs_lock != NULL )
+			{
+				libcthreads_mcs_lock_free(
+				 &mcs_lock,
+				 NULL );
+			}
+		}
+		else
+		{
+			CTHREADS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CTHREADS_TEST_ASSERT_IS_NULL(
+			 "mcs_lock",
+			 mcs_lock );
+
+			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcthreads_mcs_lock_initialize with memset failing
+		 */
+		cthreads_test_memset_attempts_before_fail = test_number;
+
+		result = libcthreads_mcs_lock_initialize(
+		          &mcs_lock,
+		          &error );
+
+		if( cthreads_test_memset_attempts_before_fail != -1 )
+		{
+			cthreads_test_memset_attempts_before_fail = -1;
+
+			if( mcs_lock != NULL )
+			{
+				libcthreads_mcs_lock_free(
+				 &mcs_lock,
+				 NULL );
+			}
+		}
+		else
+		{
+			CTHREADS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CTHREADS_TEST_ASSERT_IS_NULL(
+			 "mcs_lock",
+			 mcs_lock );
+
+			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mcs_lock != NULL )
+	{
+		libcthreads_mcs_lock_free(
+		 &mcs_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_mcs_lock_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_mcs_lock_free(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libcthreads_mcs_lock_node_t node;
+	libcthreads_mcs_lock_t *mcs_lock = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_mcs_lock_initialize(
+	          &mcs_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_mcs_lock_free(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test free of a grabbed MCS lock
+	 */
+	result = libcthreads_mcs_lock_grab(
+	          mcs_lock,
+	          &node,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_mcs_lock_free(
+	          &mcs_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "mcs_lock",
+	 mcs_lock );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mcs_lock != NULL )
+	{
+		libcthreads_mcs_lock_free(
+		 &mcs_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_mcs_lock_grab function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_mcs_lock_grab(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libcthreads_mcs_lock_node_t node;
+	libcthreads_thread_t *threads[ 4 ] = { NULL, NULL, NULL, NULL };
+	int result                         = 0;
+	int thread_index                   = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_mcs_lock_initialize(
+	          &cthreads_test_mcs_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_mcs_lock_grab(
+	          cthreads_test_mcs_lock,
+	          &node,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_mcs_lock_release(
+	          cthreads_test_mcs_lock,
+	          &node,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test grab with multiple threads contending for the MCS lock
+	 */
+	cthreads_test_locked_value = 0;
+
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          cthreads_test_mcs_lock_callback_function,
+		          NULL,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_locked_value",
+	 cthreads_test_locked_value,
+	 4 * cthreads_test_number_of_iterations );
+
+	/* Test error cases
+	 */
+	result = libcthreads_mcs_lock_grab(
+	          NULL,
+	          &node,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_mcs_lock_grab(
+	          cthreads_test_mcs_lock,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_mcs_lock_free(
+	          &cthreads_test_mcs_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	if( cthreads_test_mcs_lock != NULL )
+	{
+		libcthreads_mcs_lock_free(
+		 &cthreads_test_mcs_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_mcs_lock_try_grab function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_mcs_lock_try_grab(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libcthreads_mcs_lock_node_t node;
+	libcthreads_mcs_lock_t *mcs_lock = NULL;
+	int result                       = 0;
+	libcthreads_mcs_lock_node_t other_node;
+
+	/* Initialize test
+	 */
+	result = libcthreads_mcs_lock_initialize(
+	          &mcs_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_mcs_lock_try_grab(
+	          mcs_lock,
+	          &node,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test try grab of a grabbed MCS lock
+	 */
+	result = libcthreads_mcs_lock_try_grab(
+	          mcs_lock,
+	          &other_node,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_mcs_lock_release(
+	          mcs_lock,
+	          &node,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_mcs_lock_try_grab(
+	          NULL,
+	          &node,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_mcs_lock_try_grab(
+	          mcs_lock,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_mcs_lock_free(
+	          &mcs_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mcs_lock != NULL )
+	{
+		libcthreads_mcs_lock_free(
+		 &mcs_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_mcs_lock_release function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_mcs_lock_release(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libcthreads_mcs_lock_node_t node;
+	libcthreads_mcs_lock_t *mcs_lock = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_mcs_lock_initialize(
+	          &mcs_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_mcs_lock_grab(
+	          mcs_lock,
+	          &node,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_mcs_lock_release(
+	          mcs_lock,
+	          &node,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_mcs_lock_release(
+	          NULL,
+	          &node,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_mcs_lock_release(
+	          mcs_lock,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test release of an MCS lock that is not grabbed
+	 */
+	result = libcthreads_mcs_lock_release(
+	          mcs_lock,
+	          &node,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_mcs_lock_free(
+	          &mcs_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mcs_lock != NULL )
+	{
+		libcthreads_mcs_lock_free(
+		 &mcs_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argc )
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_mcs_lock_initialize",
+	 cthreads_test_mcs_lock_initialize );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_mcs_lock_free",
+	 cthreads_test_mcs_lock_free );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_mcs_lock_grab",
+	 cthreads_test_mcs_lock_grab );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_mcs_lock_try_grab",
+	 cthreads_test_mcs_lock_try_grab );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_mcs_lock_release",
+	 cthreads_test_mcs_lock_release );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -362,6 +362,71 @@ on_error:
 	return( -1 );
 }
 
+/* The spin callback function
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_mutex_spin_callback_function(
+     void *arguments CTHREADS_TEST_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "cthreads_test_mutex_spin_callback_function";
+	int iterator             = 0;
+	int result               = 0;
+
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( arguments )
+
+	for( iterator = 0;
+	     iterator < 10000;
+	     iterator++ )
+	{
+		result = libcthreads_mutex_grab(
+		          cthreads_test_mutex,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		cthreads_test_mutexed_value += 1;
+
+		result = libcthreads_mutex_release(
+		          cthreads_test_mutex,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
 /* Tests the libcthreads_mutex_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -637,6 +702,172 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libcthreads_mutex_initialize_in_place function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_mutex_initialize_in_place(
+     void )
+{
+	libcthreads_mutex_storage_t storage[ 4 ];
+	libcthreads_mutex_t *mutexes[ 4 ] = { NULL, NULL, NULL, NULL };
+	libcerror_error_t *error          = NULL;
+	int index                         = 0;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	for( index = 0;
+	     index < 4;
+	     index++ )
+	{
+		result = libcthreads_mutex_initialize_in_place(
+		          &( storage[ index ] ),
+		          &( mutexes[ index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "mutexes[ index ]",
+		 mutexes[ index ] );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( index = 0;
+	     index < 4;
+	     index++ )
+	{
+		result = libcthreads_mutex_grab(
+		          mutexes[ index ],
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcthreads_mutex_release(
+		          mutexes[ index ],
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( index = 0;
+	     index < 4;
+	     index++ )
+	{
+		result = libcthreads_mutex_free(
+		          &( mutexes[ index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "mutexes[ index ]",
+		 mutexes[ index ] );
+	}
+	/* Test error cases
+	 */
+	result = libcthreads_mutex_initialize_in_place(
+	          NULL,
+	          &( mutexes[ 0 ] ),
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_mutex_initialize_in_place(
+	          &( storage[ 0 ] ),
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	mutexes[ 0 ] = (libcthreads_mutex_t *) 0x12345678UL;
+
+	result = libcthreads_mutex_initialize_in_place(
+	          &( storage[ 0 ] ),
+	          &( mutexes[ 0 ] ),
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	mutexes[ 0 ] = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( index = 0;
+	     index < 4;
+	     index++ )
+	{
+		if( mutexes[ index ] != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( mutexes[ index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
 /* Tests the libcthreads_mutex_free function
  * Returns 1 if successful or 0 if not
  */
@@ -1523,40 +1754,684 @@ on_error:
 	return( 0 );
 }
 
-/* The main program
+/* Tests the libcthreads_mutex_set_maximum_spin_count function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
-#endif
+int cthreads_test_mutex_set_maximum_spin_count(
+     void )
 {
-	CTHREADS_TEST_UNREFERENCED_PARAMETER( argc )
-	CTHREADS_TEST_UNREFERENCED_PARAMETER( argv )
+	libcerror_error_t *error           = NULL;
+	libcthreads_thread_t *threads[ 4 ] = { NULL, NULL, NULL, NULL };
+	uint64_t number_of_parks           = 0;
+	uint64_t number_of_spin_hits       = 0;
+	int result                         = 0;
+	int spin_count                     = 0;
+	int thread_index                   = 0;
 
-	CTHREADS_TEST_RUN(
-	 "libcthreads_mutex_initialize",
-	 cthreads_test_mutex_initialize );
+	/* Initialize test
+	 */
+	result = libcthreads_mutex_initialize(
+	          &cthreads_test_mutex,
+	          &error );
 
-	CTHREADS_TEST_RUN(
-	 "libcthreads_mutex_free",
-	 cthreads_test_mutex_free );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	CTHREADS_TEST_RUN(
-	 "libcthreads_mutex_grab",
-	 cthreads_test_mutex_grab );
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	CTHREADS_TEST_RUN(
-	 "libcthreads_mutex_try_grab",
-	 cthreads_test_mutex_try_grab );
+	/* Test regular cases
+	 */
+	result = libcthreads_mutex_set_maximum_spin_count(
+	          cthreads_test_mutex,
+	          100,
+	          &error );
 
-	CTHREADS_TEST_RUN(
-	 "libcthreads_mutex_release",
-	 cthreads_test_mutex_release );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test grab with multiple threads contending for the spinning mutex
+	 */
+	cthreads_test_mutexed_value = 0;
+
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          cthreads_test_mutex_spin_callback_function,
+		          NULL,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_mutexed_value",
+	 cthreads_test_mutexed_value,
+	 4 * 10000 );
+
+	result = libcthreads_mutex_get_spin_statistics(
+	          cthreads_test_mutex,
+	          &number_of_spin_hits,
+	          &number_of_parks,
+	          &spin_count,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Every grab of the threads and the statistics grab spun
+	 */
+	CTHREADS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_spin_hits + number_of_parks",
+	 number_of_spin_hits + number_of_parks,
+	 (uint64_t) ( 4 * 10000 ) + 1 );
+
+	CTHREADS_TEST_ASSERT_LESS_THAN_INT(
+	 "spin_count",
+	 spin_count,
+	 101 );
+
+	/* Test disabling spinning
+	 */
+	result = libcthreads_mutex_set_maximum_spin_count(
+	          cthreads_test_mutex,
+	          0,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_mutex_get_spin_statistics(
+	          cthreads_test_mutex,
+	          &number_of_spin_hits,
+	          &number_of_parks,
+	          &spin_count,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "spin_count",
+	 spin_count,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_mutex_set_maximum_spin_count(
+	          NULL,
+	          100,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_mutex_set_maximum_spin_count(
+	          cthreads_test_mutex,
+	          -1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_mutex_free(
+	          &cthreads_test_mutex,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	if( cthreads_test_mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &cthreads_test_mutex,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_mutex_get_spin_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_mutex_get_spin_statistics(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libcthreads_mutex_t *mutex   = NULL;
+	uint64_t number_of_parks     = 0;
+	uint64_t number_of_spin_hits = 0;
+	int result                   = 0;
+	int spin_count               = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_mutex_initialize(
+	          &mutex,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_mutex_get_spin_statistics(
+	          mutex,
+	          &number_of_spin_hits,
+	          &number_of_parks,
+	          &spin_count,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_spin_hits",
+	 number_of_spin_hits,
+	 (uint64_t) 0 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_parks",
+	 number_of_parks,
+	 (uint64_t) 0 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "spin_count",
+	 spin_count,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_mutex_get_spin_statistics(
+	          NULL,
+	          &number_of_spin_hits,
+	          &number_of_parks,
+	          &spin_count,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_mutex_get_spin_statistics(
+	          mutex,
+	          NULL,
+	          &number_of_parks,
+	          &spin_count,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_mutex_get_spin_statistics(
+	          mutex,
+	          &number_of_spin_hits,
+	          NULL,
+	          &spin_count,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_mutex_get_spin_statistics(
+	          mutex,
+	          &number_of_spin_hits,
+	          &number_of_parks,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_mutex_free(
+	          &mutex,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &mutex,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_mutex_set_profile_name function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_mutex_set_profile_name(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libcthreads_mutex_t *mutex = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_mutex_initialize(
+	          &mutex,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_mutex_set_profile_name(
+	          mutex,
+	          "cthreads_test_mutex",
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_mutex_set_profile_name(
+	          NULL,
+	          "cthreads_test_mutex",
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_mutex_set_profile_name(
+	          mutex,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_mutex_free(
+	          &mutex,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &mutex,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_mutex_set_class_name function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_mutex_set_class_name(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libcthreads_mutex_t *mutex = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_mutex_initialize(
+	          &mutex,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_mutex_set_class_name(
+	          mutex,
+	          "cthreads_test_mutex_class",
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_mutex_set_class_name(
+	          NULL,
+	          "cthreads_test_mutex_class",
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_mutex_set_class_name(
+	          mutex,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_mutex_free(
+	          &mutex,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &mutex,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argc )
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_mutex_initialize",
+	 cthreads_test_mutex_initialize );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_mutex_initialize_in_place",
+	 cthreads_test_mutex_initialize_in_place );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_mutex_free",
+	 cthreads_test_mutex_free );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_mutex_grab",
+	 cthreads_test_mutex_grab );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_mutex_try_grab",
+	 cthreads_test_mutex_try_grab );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_mutex_release",
+	 cthreads_test_mutex_release );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_mutex_set_maximum_spin_count",
+	 cthreads_test_mutex_set_maximum_spin_count );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_mutex_get_spin_statistics",
+	 cthreads_test_mutex_get_spin_statistics );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_mutex_set_profile_name",
+	 cthreads_test_mutex_set_profile_name );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_mutex_set_class_name",
+	 cthreads_test_mutex_set_class_name );
 
 	return( EXIT_SUCCESS );
 
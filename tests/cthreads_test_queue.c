@@ -206,11 +206,31 @@ int pthread_cond_wait(
 
 #endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
 
+/* The value used to test the queue that stores values by copy
+ */
+typedef struct cthreads_test_queue_value cthreads_test_queue_value_t;
+
+struct cthreads_test_queue_value
+{
+	/* The identifier
+	 */
+	uint64_t identifier;
+
+	/* The value
+	 */
+	uint64_t value;
+
+	/* Padding
+	 */
+	uint8_t padding[ 8 ];
+};
+
 libcthreads_queue_t *cthreads_test_queue = NULL;
 int cthreads_test_expected_queued_value  = 0;
 int cthreads_test_queued_value           = 0;
 int cthreads_test_number_of_iterations   = 497;
 int cthreads_test_number_of_values       = 32;
+size_t cthreads_test_maximum_weight      = 16;
 
 /* The value free function
  * Returns 1 if successful or -1 on error
@@ -396,261 +416,4783 @@ on_error:
 	return( -1 );
 }
 
-/* Tests the libcthreads_queue_initialize function
- * Returns 1 if successful or 0 if not
+/* The thread push with weight callback function
+ * Returns 1 if successful or -1 on error
  */
-int cthreads_test_queue_initialize(
-     void )
+int cthreads_test_queue_push_with_weight_callback_function(
+     int *queued_values )
 {
-	libcerror_error_t *error        = NULL;
-	libcthreads_queue_t *queue      = NULL;
-	int result                      = 0;
-
-#if defined( HAVE_CTHREADS_TEST_MEMORY )
-	int number_of_malloc_fail_tests = 5;
-	int number_of_memset_fail_tests = 2;
-	int test_number                 = 0;
-#endif
+	libcerror_error_t *error = NULL;
+	static char *function    = "cthreads_test_queue_push_with_weight_callback_function";
+	size_t current_weight    = 0;
+	int iterator             = 0;
 
-	/* Test regular cases
-	 */
-	result = libcthreads_queue_initialize(
-	          &queue,
-	          0,
-	          &error );
+	for( iterator = 0;
+	     iterator < cthreads_test_number_of_iterations;
+	     iterator++ )
+	{
+		queued_values[ iterator ] = ( 98 * iterator ) % 45;
 
-	CTHREADS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		if( libcthreads_queue_push_with_weight(
+		     cthreads_test_queue,
+		     (intptr_t *) &( queued_values[ iterator ] ),
+		     (size_t) ( iterator % 7 ) + 1,
+		     &error ) == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push value onto queue.",
+			 function );
 
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-	 "queue",
-	 queue );
+			goto on_error;
+		}
+		cthreads_test_expected_queued_value += queued_values[ iterator ];
 
-	CTHREADS_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		if( libcthreads_mutex_grab(
+		     ( (libcthreads_internal_queue_t *) cthreads_test_queue )->condition_mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab condition mutex.",
+			 function );
 
-	result = libcthreads_queue_free(
-	          &queue,
-	          NULL,
-	          &error );
+			goto on_error;
+		}
+		current_weight = ( (libcthreads_internal_queue_t *) cthreads_test_queue )->current_weight;
 
-	CTHREADS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		if( libcthreads_mutex_release(
+		     ( (libcthreads_internal_queue_t *) cthreads_test_queue )->condition_mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release condition mutex.",
+			 function );
 
-	CTHREADS_TEST_ASSERT_IS_NULL(
-	 "queue",
-	 queue );
+			goto on_error;
+		}
+		if( current_weight > cthreads_test_maximum_weight )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid current weight value out of bounds.",
+			 function );
 
-	CTHREADS_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+			goto on_error;
+		}
+	}
+	return( 1 );
 
-	/* Test error cases
-	 */
-	result = libcthreads_queue_initialize(
-	          NULL,
-	          0,
-	          &error );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
 
-	CTHREADS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
 
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+/* The thread pop value callback function
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_queue_pop_value_callback_function(
+     void *arguments CTHREADS_TEST_ATTRIBUTE_UNUSED )
+{
+	cthreads_test_queue_value_t queued_value;
 
-	libcerror_error_free(
-	 &error );
+	libcerror_error_t *error = NULL;
+	static char *function    = "cthreads_test_queue_pop_value_callback_function";
+	int iterator             = 0;
 
-	queue = (libcthreads_queue_t *) 0x12345678UL;
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( arguments )
 
-	result = libcthreads_queue_initialize(
-	          &queue,
-	          0,
-	          &error );
+	for( iterator = 0;
+	     iterator < cthreads_test_number_of_iterations;
+	     iterator++ )
+	{
+		if( libcthreads_queue_pop_value(
+		     cthreads_test_queue,
+		     (uint8_t *) &queued_value,
+		     sizeof( cthreads_test_queue_value_t ),
+		     &error ) == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to pop value off queue.",
+			 function );
 
-	queue = NULL;
+			goto on_error;
+		}
+		cthreads_test_queued_value += (int) queued_value.value;
+	}
+	return( 1 );
 
-	CTHREADS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
 
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
 
-	libcerror_error_free(
-	 &error );
+/* The thread push value callback function
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_queue_push_value_callback_function(
+     void *arguments CTHREADS_TEST_ATTRIBUTE_UNUSED )
+{
+	cthreads_test_queue_value_t queued_value;
 
-	result = libcthreads_queue_initialize(
-	          &queue,
-	          -1,
-	          &error );
+	libcerror_error_t *error = NULL;
+	static char *function    = "cthreads_test_queue_push_value_callback_function";
+	int iterator             = 0;
 
-	CTHREADS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( arguments )
 
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+	for( iterator = 0;
+	     iterator < cthreads_test_number_of_iterations;
+	     iterator++ )
+	{
+		queued_value.identifier = (uint64_t) iterator;
+		queued_value.value      = ( 98 * iterator ) % 45;
 
-	libcerror_error_free(
-	 &error );
+		if( libcthreads_queue_push_value(
+		     cthreads_test_queue,
+		     (uint8_t *) &queued_value,
+		     sizeof( cthreads_test_queue_value_t ),
+		     &error ) == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push value onto queue.",
+			 function );
 
-	result = libcthreads_queue_initialize(
-	          &queue,
-	          (int) SSIZE_MAX,
-	          &error );
+			goto on_error;
+		}
+		cthreads_test_expected_queued_value += (int) queued_value.value;
+	}
+	return( 1 );
 
-	CTHREADS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
 
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
 
-	libcerror_error_free(
-	 &error );
+/* The thread empty callback function
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_queue_empty_callback_function(
+     void *arguments CTHREADS_TEST_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "cthreads_test_queue_empty_callback_function";
 
-#if defined( HAVE_CTHREADS_TEST_MEMORY )
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( arguments )
 
-	for( test_number = 0;
-	     test_number < number_of_malloc_fail_tests;
-	     test_number++ )
+	if( libcthreads_queue_empty(
+	     cthreads_test_queue,
+	     &error ) != 1 )
 	{
-		/* Test libcthreads_queue_initialize with malloc failing
-		 */
-		cthreads_test_malloc_attempts_before_fail = test_number;
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to wait for queue to become empty.",
+		 function );
 
-		result = libcthreads_queue_initialize(
-		          &queue,
-		          0,
-		          &error );
+		goto on_error;
+	}
+	return( 1 );
 
-		if( cthreads_test_malloc_attempts_before_fail != -1 )
-		{
-			cthreads_test_malloc_attempts_before_fail = -1;
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
 
-			if( queue != NULL )
-			{
-				libcthreads_queue_free(
-				 &queue,
-				 NULL,
-				 NULL );
-			}
-		}
-		else
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* The thread push single value callback function
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_queue_push_single_value_callback_function(
+     int *queued_value )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "cthreads_test_queue_push_single_value_callback_function";
+
+	if( libcthreads_queue_push(
+	     cthreads_test_queue,
+	     (intptr_t *) queued_value,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push value onto queue.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* The thread pop single value callback function
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_queue_pop_single_value_callback_function(
+     void *arguments CTHREADS_TEST_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "cthreads_test_queue_pop_single_value_callback_function";
+	int *queued_value        = NULL;
+
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( arguments )
+
+	if( libcthreads_queue_pop(
+	     cthreads_test_queue,
+	     (intptr_t **) &queued_value,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to pop value off queue.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* Waits until the number of threads waiting on the empty condition of the queue reaches a specific value
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_queue_wait_for_empty_waiters(
+     int number_of_waiters )
+{
+	libcerror_error_t *error                     = NULL;
+	libcthreads_internal_queue_t *internal_queue = NULL;
+	static char *function                        = "cthreads_test_queue_wait_for_empty_waiters";
+	int number_of_empty_waiters                  = 0;
+
+	internal_queue = (libcthreads_internal_queue_t *) cthreads_test_queue;
+
+	while( number_of_empty_waiters < number_of_waiters )
+	{
+		if( libcthreads_mutex_grab(
+		     internal_queue->condition_mutex,
+		     &error ) != 1 )
 		{
-			CTHREADS_TEST_ASSERT_EQUAL_INT(
-			 "result",
-			 result,
-			 -1 );
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab condition mutex.",
+			 function );
 
-			CTHREADS_TEST_ASSERT_IS_NULL(
-			 "queue",
-			 queue );
+			goto on_error;
+		}
+		number_of_empty_waiters = internal_queue->number_of_empty_waiters;
 
-			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-			 "error",
-			 error );
+		if( libcthreads_mutex_release(
+		     internal_queue->condition_mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release condition mutex.",
+			 function );
 
-			libcerror_error_free(
-			 &error );
+			goto on_error;
 		}
 	}
-	for( test_number = 0;
-	     test_number < number_of_memset_fail_tests;
-	     test_number++ )
+	return( 1 );
+
+on_error:
+	if( error != NULL )
 	{
-		/* Test libcthreads_queue_initialize with memset failing
-		 */
-		cthreads_test_memset_attempts_before_fail = test_number;
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
 
-		result = libcthreads_queue_initialize(
-		          &queue,
-		          0,
-		          &error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
 
-		if( cthreads_test_memset_attempts_before_fail != -1 )
+/* Waits until the number of threads waiting on the full condition of the queue reaches a specific value
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_queue_wait_for_full_waiters(
+     int number_of_waiters )
+{
+	libcerror_error_t *error                     = NULL;
+	libcthreads_internal_queue_t *internal_queue = NULL;
+	static char *function                        = "cthreads_test_queue_wait_for_full_waiters";
+	int number_of_full_waiters                   = 0;
+
+	internal_queue = (libcthreads_internal_queue_t *) cthreads_test_queue;
+
+	while( number_of_full_waiters < number_of_waiters )
+	{
+		if( libcthreads_mutex_grab(
+		     internal_queue->condition_mutex,
+		     &error ) != 1 )
 		{
-			cthreads_test_memset_attempts_before_fail = -1;
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab condition mutex.",
+			 function );
 
-			if( queue != NULL )
-			{
-				libcthreads_queue_free(
-				 &queue,
-				 NULL,
-				 NULL );
-			}
+			goto on_error;
 		}
-		else
+		number_of_full_waiters = internal_queue->number_of_full_waiters;
+
+		if( libcthreads_mutex_release(
+		     internal_queue->condition_mutex,
+		     &error ) != 1 )
 		{
-			CTHREADS_TEST_ASSERT_EQUAL_INT(
-			 "result",
-			 result,
-			 -1 );
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release condition mutex.",
+			 function );
 
-			CTHREADS_TEST_ASSERT_IS_NULL(
-			 "queue",
-			 queue );
+			goto on_error;
+		}
+	}
+	return( 1 );
 
-			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-			 "error",
-			 error );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
 
-			libcerror_error_free(
-			 &error );
-		}
+		libcerror_error_free(
+		 &error );
 	}
-#endif /* defined( HAVE_CTHREADS_TEST_MEMORY ) */
+	return( -1 );
+}
+
+/* Tests the libcthreads_queue_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libcthreads_queue_t *queue      = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 6;
+	int number_of_memset_fail_tests = 3;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcthreads_queue_initialize(
+	          &queue,
+	          0,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "queue",
+	 queue );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_free(
+	          &queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "queue",
+	 queue );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_queue_initialize(
+	          NULL,
+	          0,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	queue = (libcthreads_queue_t *) 0x12345678UL;
+
+	result = libcthreads_queue_initialize(
+	          &queue,
+	          0,
+	          &error );
+
+	queue = NULL;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_initialize(
+	          &queue,
+	          -1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_initialize(
+	          &queue,
+	          (int) SSIZE_MAX,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcthreads_queue_initialize with malloc failing
+		 */
+		cthreads_test_malloc_attempts_before_fail = test_number;
+
+		result = libcthreads_queue_initialize(
+		          &queue,
+		          0,
+		          &error );
+
+		if( cthreads_test_malloc_attempts_before_fail != -1 )
+		{
+			cthreads_test_malloc_attempts_before_fail = -1;
+
+			if( queue != NULL )
+			{
+				libcthreads_queue_free(
+				 &queue,
+				 NULL,
+				 NULL );
+			}
+		}
+		else
+		{
+			CTHREADS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CTHREADS_TEST_ASSERT_IS_NULL(
+			 "queue",
+			 queue );
+
+			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcthreads_queue_initialize with memset failing
+		 */
+		cthreads_test_memset_attempts_before_fail = test_number;
+
+		result = libcthreads_queue_initialize(
+		          &queue,
+		          0,
+		          &error );
+
+		if( cthreads_test_memset_attempts_before_fail != -1 )
+		{
+			cthreads_test_memset_attempts_before_fail = -1;
+
+			if( queue != NULL )
+			{
+				libcthreads_queue_free(
+				 &queue,
+				 NULL,
+				 NULL );
+			}
+		}
+		else
+		{
+			CTHREADS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CTHREADS_TEST_ASSERT_IS_NULL(
+			 "queue",
+			 queue );
+
+			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &queue,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_queue_initialize_with_value_size function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_initialize_with_value_size(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libcthreads_queue_t *queue      = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 5;
+	int number_of_memset_fail_tests = 2;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcthreads_queue_initialize_with_value_size(
+	          &queue,
+	          10,
+	          sizeof( cthreads_test_queue_value_t ),
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "queue",
+	 queue );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "values data alignment",
+	 (int) ( (intptr_t) ( (libcthreads_internal_queue_t *) queue )->values_data % 64 ),
+	 0 );
+
+	result = libcthreads_queue_free(
+	          &queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "queue",
+	 queue );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_queue_initialize_with_value_size(
+	          NULL,
+	          10,
+	          sizeof( cthreads_test_queue_value_t ),
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	queue = (libcthreads_queue_t *) 0x12345678UL;
+
+	result = libcthreads_queue_initialize_with_value_size(
+	          &queue,
+	          10,
+	          sizeof( cthreads_test_queue_value_t ),
+	          &error );
+
+	queue = NULL;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_initialize_with_value_size(
+	          &queue,
+	          -1,
+	          sizeof( cthreads_test_queue_value_t ),
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_initialize_with_value_size(
+	          &queue,
+	          10,
+	          0,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_initialize_with_value_size(
+	          &queue,
+	          10,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_initialize_with_value_size(
+	          &queue,
+	          (int) SSIZE_MAX,
+	          sizeof( cthreads_test_queue_value_t ),
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcthreads_queue_initialize_with_value_size with malloc failing
+		 */
+		cthreads_test_malloc_attempts_before_fail = test_number;
+
+		result = libcthreads_queue_initialize_with_value_size(
+		          &queue,
+		          10,
+		          sizeof( cthreads_test_queue_value_t ),
+		          &error );
+
+		if( cthreads_test_malloc_attempts_before_fail != -1 )
+		{
+			cthreads_test_malloc_attempts_before_fail = -1;
+
+			if( queue != NULL )
+			{
+				libcthreads_queue_free(
+				 &queue,
+				 NULL,
+				 NULL );
+			}
+		}
+		else
+		{
+			CTHREADS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CTHREADS_TEST_ASSERT_IS_NULL(
+			 "queue",
+			 queue );
+
+			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcthreads_queue_initialize_with_value_size with memset failing
+		 */
+		cthreads_test_memset_attempts_before_fail = test_number;
+
+		result = libcthreads_queue_initialize_with_value_size(
+		          &queue,
+		          10,
+		          sizeof( cthreads_test_queue_value_t ),
+		          &error );
+
+		if( cthreads_test_memset_attempts_before_fail != -1 )
+		{
+			cthreads_test_memset_attempts_before_fail = -1;
+
+			if( queue != NULL )
+			{
+				libcthreads_queue_free(
+				 &queue,
+				 NULL,
+				 NULL );
+			}
+		}
+		else
+		{
+			CTHREADS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CTHREADS_TEST_ASSERT_IS_NULL(
+			 "queue",
+			 queue );
+
+			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &queue,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_queue_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_free(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libcthreads_queue_t *queue = NULL;
+	int queued_value1          = 1;
+	int queued_value2          = 2;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_queue_initialize(
+	          &queue,
+	          10,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "queue",
+	 queue );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_push(
+	          queue,
+	          (intptr_t *) &queued_value1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_push(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_queue_free(
+	          &queue,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &cthreads_test_queue_value_free_function,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "queue",
+	 queue );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_queue_free(
+	          NULL,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* TODO test with libcthreads_condition_free failing 2 times */
+	/* TODO test with libcthreads_mutex_free failing 1 time */
+
+	/* Initialize test
+	 */
+	result = libcthreads_queue_initialize(
+	          &queue,
+	          10,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "queue",
+	 queue );
+
+	result = libcthreads_queue_push(
+	          queue,
+	          (intptr_t *) &queued_value1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test libcthreads_queue_free with the free_value function returning -1
+	 */
+	result = libcthreads_queue_free(
+	          &queue,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &cthreads_test_queue_error_value_free_function,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "queue",
+	 queue );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &queue,
+		 NULL,
+		 NULL );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the cache line layout of the queue created by the libcthreads_queue_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_initialize_cache_line_layout(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libcthreads_internal_queue_t *internal_queue = NULL;
+	libcthreads_queue_t *queue                   = NULL;
+	int gap_size                                 = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_queue_initialize(
+	          &queue,
+	          10,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_queue = (libcthreads_internal_queue_t *) queue;
+
+	/* Test regular cases
+	 */
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "values_array alignment",
+	 (int) ( (intptr_t) internal_queue->values_array % LIBCTHREADS_CACHE_LINE_SIZE ),
+	 0 );
+
+	/* The shared state and the read-mostly state must not share a cache line
+	 */
+	gap_size = (int) ( (intptr_t) &( internal_queue->number_of_values ) - (intptr_t) &( internal_queue->number_of_wake_ups ) ) - (int) sizeof( libcthreads_striped_counter_t * );
+
+	CTHREADS_TEST_ASSERT_GREATER_THAN_INT(
+	 "gap_size",
+	 gap_size,
+	 LIBCTHREADS_CACHE_LINE_SIZE - 1 );
+
+	/* The consumer state and the shared state must not share a cache line
+	 */
+	gap_size = (int) ( (intptr_t) &( internal_queue->pop_index ) - (intptr_t) &( internal_queue->current_weight ) ) - (int) sizeof( size_t );
+
+	CTHREADS_TEST_ASSERT_GREATER_THAN_INT(
+	 "gap_size",
+	 gap_size,
+	 LIBCTHREADS_CACHE_LINE_SIZE - 1 );
+
+	/* The producer state and the consumer state must not share a cache line
+	 */
+	gap_size = (int) ( (intptr_t) &( internal_queue->push_index ) - (intptr_t) &( internal_queue->spin_wait ) ) - (int) sizeof( libcthreads_spin_wait_t );
+
+	CTHREADS_TEST_ASSERT_GREATER_THAN_INT(
+	 "gap_size",
+	 gap_size,
+	 LIBCTHREADS_CACHE_LINE_SIZE - 1 );
+
+	/* Clean up
+	 */
+	result = libcthreads_queue_free(
+	          &queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &queue,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_queue_set_maximum_weight function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_set_maximum_weight(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libcthreads_queue_t *queue = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_queue_initialize(
+	          &queue,
+	          10,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_queue_set_maximum_weight(
+	          queue,
+	          1024,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_SIZE(
+	 "maximum_weight",
+	 ( (libcthreads_internal_queue_t *) queue )->maximum_weight,
+	 (size_t) 1024 );
+
+	result = libcthreads_queue_set_maximum_weight(
+	          queue,
+	          0,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_queue_set_maximum_weight(
+	          NULL,
+	          1024,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK )
+
+	/* Test libcthreads_queue_set_maximum_weight with pthread_mutex_lock failing in libcthreads_mutex_grab
+	 */
+	cthreads_test_pthread_mutex_lock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_set_maximum_weight(
+	          queue,
+	          1024,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_lock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_lock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcthreads_queue_set_maximum_weight with pthread_cond_broadcast failing
+	 */
+	cthreads_test_pthread_cond_broadcast_attempts_before_fail = 0;
+
+	result = libcthreads_queue_set_maximum_weight(
+	          queue,
+	          1024,
+	          &error );
+
+	if( cthreads_test_pthread_cond_broadcast_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_cond_broadcast_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcthreads_queue_set_maximum_weight with pthread_mutex_unlock failing in libcthreads_mutex_release
+	 */
+	cthreads_test_pthread_mutex_unlock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_set_maximum_weight(
+	          queue,
+	          1024,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_unlock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Manually release the mutex otherwise libcthreads_queue_free will fail
+		 */
+		result = libcthreads_mutex_release(
+		          ( (libcthreads_internal_queue_t *) queue )->condition_mutex,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
+
+	/* Clean up
+	 */
+	result = libcthreads_queue_free(
+	          &queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &queue,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_queue_set_maximum_spin_count function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_set_maximum_spin_count(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libcthreads_queue_t *queue = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_queue_initialize(
+	          &queue,
+	          10,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_queue_set_maximum_spin_count(
+	          queue,
+	          1024,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "maximum_spin_count",
+	 ( (libcthreads_internal_queue_t *) queue )->spin_wait.maximum_spin_count,
+	 1024 );
+
+	result = libcthreads_queue_set_maximum_spin_count(
+	          queue,
+	          0,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_queue_set_maximum_spin_count(
+	          NULL,
+	          1024,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_set_maximum_spin_count(
+	          queue,
+	          -1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK )
+
+	/* Test libcthreads_queue_set_maximum_spin_count with pthread_mutex_lock failing in libcthreads_mutex_grab
+	 */
+	cthreads_test_pthread_mutex_lock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_set_maximum_spin_count(
+	          queue,
+	          1024,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_lock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_lock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcthreads_queue_set_maximum_spin_count with pthread_mutex_unlock failing in libcthreads_mutex_release
+	 */
+	cthreads_test_pthread_mutex_unlock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_set_maximum_spin_count(
+	          queue,
+	          1024,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_unlock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Manually release the mutex otherwise libcthreads_queue_free will fail
+		 */
+		result = libcthreads_mutex_release(
+		          ( (libcthreads_internal_queue_t *) queue )->condition_mutex,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
+
+	/* Clean up
+	 */
+	result = libcthreads_queue_free(
+	          &queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &queue,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_queue_get_wait_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_get_wait_statistics(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libcthreads_queue_t *queue   = NULL;
+	uint64_t number_of_parks     = 0;
+	uint64_t number_of_spin_hits = 0;
+	int result                   = 0;
+	int spin_count               = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_queue_initialize(
+	          &queue,
+	          10,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_queue_get_wait_statistics(
+	          queue,
+	          &number_of_spin_hits,
+	          &number_of_parks,
+	          &spin_count,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_spin_hits",
+	 number_of_spin_hits,
+	 (uint64_t) 0 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_parks",
+	 number_of_parks,
+	 (uint64_t) 0 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "spin_count",
+	 spin_count,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_queue_get_wait_statistics(
+	          NULL,
+	          &number_of_spin_hits,
+	          &number_of_parks,
+	          &spin_count,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_get_wait_statistics(
+	          queue,
+	          NULL,
+	          &number_of_parks,
+	          &spin_count,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_get_wait_statistics(
+	          queue,
+	          &number_of_spin_hits,
+	          NULL,
+	          &spin_count,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_get_wait_statistics(
+	          queue,
+	          &number_of_spin_hits,
+	          &number_of_parks,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_queue_free(
+	          &queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &queue,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_queue_get_notify_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_get_notify_statistics(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libcthreads_queue_t *queue       = NULL;
+	uint64_t number_of_notifications = 0;
+	uint64_t number_of_wake_ups      = 0;
+	int queued_value                 = 1;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_queue_initialize(
+	          &queue,
+	          10,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_queue_push(
+	          queue,
+	          (intptr_t *) &queued_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_get_notify_statistics(
+	          queue,
+	          &number_of_notifications,
+	          &number_of_wake_ups,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* No notification is needed since no consumer is waiting
+	 */
+	CTHREADS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_notifications",
+	 number_of_notifications,
+	 (uint64_t) 0 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_wake_ups",
+	 number_of_wake_ups,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_queue_get_notify_statistics(
+	          NULL,
+	          &number_of_notifications,
+	          &number_of_wake_ups,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_get_notify_statistics(
+	          queue,
+	          NULL,
+	          &number_of_wake_ups,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_get_notify_statistics(
+	          queue,
+	          &number_of_notifications,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_queue_free(
+	          &queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &queue,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_queue_empty function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_empty(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libcthreads_queue_t *queue = NULL;
+	intptr_t **values_array    = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_queue_initialize(
+	          &queue,
+	          10,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "queue",
+	 queue );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_queue_empty(
+	          queue,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_queue_empty(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	values_array = ( (libcthreads_internal_queue_t *) queue )->values_array;
+
+	( (libcthreads_internal_queue_t *) queue )->values_array = NULL;
+
+	result = libcthreads_queue_empty(
+	          queue,
+	          &error );
+
+	( (libcthreads_internal_queue_t *) queue )->values_array = values_array;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK )
+
+	/* Test libcthreads_queue_empty with pthread_mutex_lock failing in libcthreads_mutex_grab
+	 */
+	cthreads_test_pthread_mutex_lock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_empty(
+	          queue,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_lock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_lock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcthreads_queue_empty with pthread_cond_wait failing in libcthreads_condition_wait
+	 */
+	cthreads_test_pthread_cond_wait_attempts_before_fail = 0;
+
+	result = libcthreads_queue_empty(
+	          queue,
+	          &error );
+
+	if( cthreads_test_pthread_cond_wait_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_cond_wait_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcthreads_queue_empty with pthread_mutex_unlock failing in libcthreads_mutex_release
+	 */
+	cthreads_test_pthread_mutex_unlock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_empty(
+	          queue,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_unlock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Manually release the mutex otherwise libcthreads_queue_free will fail
+		 */
+		result = libcthreads_mutex_release(
+		          ( (libcthreads_internal_queue_t *) queue )->condition_mutex,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
+
+	/* Clean up
+	 */
+	result = libcthreads_queue_free(
+	          &queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &queue,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_queue_try_pop function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_try_pop(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libcthreads_queue_t *queue = NULL;
+	intptr_t *value            = NULL;
+	intptr_t **values_array    = NULL;
+	int queued_value1          = 1;
+	int queued_value2          = 2;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_queue_initialize(
+	          &queue,
+	          10,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "queue",
+	 queue );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_queue_try_pop(
+	          queue,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libcthreads_queue_push(
+	          queue,
+	          (intptr_t *) &queued_value1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_push(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_queue_try_pop(
+	          queue,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_queue_try_pop(
+	          NULL,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	values_array = ( (libcthreads_internal_queue_t *) queue )->values_array;
+
+	( (libcthreads_internal_queue_t *) queue )->values_array = NULL;
+
+	result = libcthreads_queue_try_pop(
+	          queue,
+	          &value,
+	          &error );
+
+	( (libcthreads_internal_queue_t *) queue )->values_array = values_array;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_try_pop(
+	          queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK )
+
+	/* Test libcthreads_queue_try_pop with pthread_mutex_lock failing in libcthreads_mutex_grab
+	 */
+	cthreads_test_pthread_mutex_lock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_try_pop(
+	          queue,
+	          &value,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_lock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_lock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcthreads_queue_try_pop with pthread_cond_broadcast failing
+	 */
+	cthreads_test_pthread_cond_broadcast_attempts_before_fail = 0;
+
+	result = libcthreads_queue_try_pop(
+	          queue,
+	          &value,
+	          &error );
+
+	if( cthreads_test_pthread_cond_broadcast_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_cond_broadcast_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcthreads_queue_try_pop with pthread_mutex_unlock failing in libcthreads_mutex_release
+	 */
+	cthreads_test_pthread_mutex_unlock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_try_pop(
+	          queue,
+	          &value,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_unlock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Manually release the mutex otherwise libcthreads_queue_free will fail
+		 */
+		result = libcthreads_mutex_release(
+		          ( (libcthreads_internal_queue_t *) queue )->condition_mutex,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
+
+	/* Clean up
+	 */
+	result = libcthreads_queue_free(
+	          &queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &queue,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_queue_pop function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_pop(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libcthreads_queue_t *queue = NULL;
+	intptr_t *value            = NULL;
+	intptr_t **values_array    = NULL;
+	int queued_value1          = 1;
+	int queued_value2          = 2;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_queue_initialize(
+	          &queue,
+	          10,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "queue",
+	 queue );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_push(
+	          queue,
+	          (intptr_t *) &queued_value1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_push(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Re-add the popped value
+	 */
+	result = libcthreads_queue_push(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_queue_pop(
+	          queue,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_queue_pop(
+	          NULL,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	values_array = ( (libcthreads_internal_queue_t *) queue )->values_array;
+
+	( (libcthreads_internal_queue_t *) queue )->values_array = NULL;
+
+	result = libcthreads_queue_pop(
+	          queue,
+	          &value,
+	          &error );
+
+	( (libcthreads_internal_queue_t *) queue )->values_array = values_array;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_pop(
+	          queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK )
+
+	/* Test libcthreads_queue_pop with pthread_mutex_lock failing in libcthreads_mutex_grab
+	 */
+	cthreads_test_pthread_mutex_lock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_pop(
+	          queue,
+	          &value,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_lock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_lock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcthreads_queue_pop with pthread_cond_wait failing in libcthreads_condition_wait
+	 */
+	cthreads_test_pthread_cond_wait_attempts_before_fail = 0;
+
+	result = libcthreads_queue_pop(
+	          queue,
+	          &value,
+	          &error );
+
+	if( cthreads_test_pthread_cond_wait_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_cond_wait_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Manually reset the empty condition otherwise the next call to libcthreads_queue_pop will stall.
+		 */
+		result = libcthreads_condition_signal(
+		          ( (libcthreads_internal_queue_t *) queue )->empty_condition,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Re-add the popped value
+	 */
+	result = libcthreads_queue_push(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test libcthreads_queue_pop with pthread_cond_broadcast failing
+	 */
+	cthreads_test_pthread_cond_broadcast_attempts_before_fail = 0;
+
+	result = libcthreads_queue_pop(
+	          queue,
+	          &value,
+	          &error );
+
+	if( cthreads_test_pthread_cond_broadcast_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_cond_broadcast_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Re-add the popped value
+	 */
+	result = libcthreads_queue_push(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test libcthreads_queue_pop with pthread_mutex_unlock failing in libcthreads_mutex_release
+	 */
+	cthreads_test_pthread_mutex_unlock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_pop(
+	          queue,
+	          &value,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_unlock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Manually release the mutex otherwise libcthreads_queue_free will fail
+		 */
+		result = libcthreads_mutex_release(
+		          ( (libcthreads_internal_queue_t *) queue )->condition_mutex,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
+
+	/* Clean up
+	 */
+	result = libcthreads_queue_free(
+	          &queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &queue,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_queue_try_push function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_try_push(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libcthreads_queue_t *queue     = NULL;
+	intptr_t **values_array        = NULL;
+	int allocated_number_of_values = 0;
+	int queued_value1              = 1;
+	int queued_value2              = 2;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_queue_initialize(
+	          &queue,
+	          10,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "queue",
+	 queue );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_push(
+	          queue,
+	          (intptr_t *) &queued_value1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_queue_try_push(
+	          queue,
+	          (intptr_t *) &queued_value1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	allocated_number_of_values = ( (libcthreads_internal_queue_t *) queue )->allocated_number_of_values;
+
+	( (libcthreads_internal_queue_t *) queue )->allocated_number_of_values = ( (libcthreads_internal_queue_t *) queue )->number_of_values;
+
+	result = libcthreads_queue_try_push(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	( (libcthreads_internal_queue_t *) queue )->allocated_number_of_values = allocated_number_of_values;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_queue_try_push(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_queue_try_push(
+	          NULL,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	values_array = ( (libcthreads_internal_queue_t *) queue )->values_array;
+
+	( (libcthreads_internal_queue_t *) queue )->values_array = NULL;
+
+	result = libcthreads_queue_try_push(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	( (libcthreads_internal_queue_t *) queue )->values_array = values_array;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_try_push(
+	          queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK )
+
+	/* Test libcthreads_queue_try_push with pthread_mutex_lock failing in libcthreads_mutex_grab
+	 */
+	cthreads_test_pthread_mutex_lock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_try_push(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_lock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_lock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcthreads_queue_try_push with pthread_cond_broadcast failing
+	 */
+	cthreads_test_pthread_cond_broadcast_attempts_before_fail = 0;
+
+	result = libcthreads_queue_try_push(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	if( cthreads_test_pthread_cond_broadcast_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_cond_broadcast_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcthreads_queue_try_push with pthread_mutex_unlock failing in libcthreads_mutex_release
+	 */
+	cthreads_test_pthread_mutex_unlock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_try_push(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_unlock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Manually release the mutex otherwise libcthreads_queue_free will fail
+		 */
+		result = libcthreads_mutex_release(
+		          ( (libcthreads_internal_queue_t *) queue )->condition_mutex,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
+
+	/* Clean up
+	 */
+	result = libcthreads_queue_free(
+	          &queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &queue,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_queue_push function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_push(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libcthreads_queue_t *queue = NULL;
+	intptr_t **values_array    = NULL;
+	int queued_value1          = 1;
+	int queued_value2          = 2;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_queue_initialize(
+	          &queue,
+	          10,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "queue",
+	 queue );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_push(
+	          queue,
+	          (intptr_t *) &queued_value1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_queue_push(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_queue_push(
+	          NULL,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	values_array = ( (libcthreads_internal_queue_t *) queue )->values_array;
+
+	( (libcthreads_internal_queue_t *) queue )->values_array = NULL;
+
+	result = libcthreads_queue_push(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	( (libcthreads_internal_queue_t *) queue )->values_array = values_array;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_push(
+	          queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK )
+
+	/* Test libcthreads_queue_push with pthread_mutex_lock failing in libcthreads_mutex_grab
+	 */
+	cthreads_test_pthread_mutex_lock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_push(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_lock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_lock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcthreads_queue_push with pthread_cond_wait failing in libcthreads_condition_wait
+	 */
+	cthreads_test_pthread_cond_wait_attempts_before_fail = 0;
+
+	result = libcthreads_queue_push(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	if( cthreads_test_pthread_cond_wait_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_cond_wait_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcthreads_queue_push with pthread_cond_broadcast failing
+	 */
+	cthreads_test_pthread_cond_broadcast_attempts_before_fail = 0;
+
+	result = libcthreads_queue_push(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	if( cthreads_test_pthread_cond_broadcast_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_cond_broadcast_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcthreads_queue_push with pthread_mutex_unlock failing in libcthreads_mutex_release
+	 */
+	cthreads_test_pthread_mutex_unlock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_push(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_unlock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Manually release the mutex otherwise libcthreads_queue_free will fail
+		 */
+		result = libcthreads_mutex_release(
+		          ( (libcthreads_internal_queue_t *) queue )->condition_mutex,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
+
+	/* Clean up
+	 */
+	result = libcthreads_queue_free(
+	          &queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &queue,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_queue_try_push_with_weight function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_try_push_with_weight(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libcthreads_queue_t *queue = NULL;
+	intptr_t *value            = NULL;
+	intptr_t **values_array    = NULL;
+	int queued_value1          = 1;
+	int queued_value2          = 2;
+	int queued_value3          = 3;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_queue_initialize(
+	          &queue,
+	          10,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_set_maximum_weight(
+	          queue,
+	          10,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_queue_try_push_with_weight(
+	          queue,
+	          (intptr_t *) &queued_value1,
+	          6,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_try_push_with_weight(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          6,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_try_push_with_weight(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_SIZE(
+	 "current_weight",
+	 ( (libcthreads_internal_queue_t *) queue )->current_weight,
+	 (size_t) 10 );
+
+	/* Test that a value without weight is not restricted by the maximum weight
+	 */
+	result = libcthreads_queue_try_push_with_weight(
+	          queue,
+	          (intptr_t *) &queued_value3,
+	          0,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_try_pop(
+	          queue,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_SIZE(
+	 "current_weight",
+	 ( (libcthreads_internal_queue_t *) queue )->current_weight,
+	 (size_t) 4 );
+
+	result = libcthreads_queue_try_pop(
+	          queue,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_SIZE(
+	 "current_weight",
+	 ( (libcthreads_internal_queue_t *) queue )->current_weight,
+	 (size_t) 0 );
+
+	result = libcthreads_queue_try_pop(
+	          queue,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a value that exceeds the maximum weight is pushed when the queue contains no weighted values
+	 */
+	result = libcthreads_queue_try_push_with_weight(
+	          queue,
+	          (intptr_t *) &queued_value1,
+	          20,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_try_push_with_weight(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_SIZE(
+	 "current_weight",
+	 ( (libcthreads_internal_queue_t *) queue )->current_weight,
+	 (size_t) 20 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_queue_try_push_with_weight(
+	          NULL,
+	          (intptr_t *) &queued_value1,
+	          1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	values_array = ( (libcthreads_internal_queue_t *) queue )->values_array;
+
+	( (libcthreads_internal_queue_t *) queue )->values_array = NULL;
+
+	result = libcthreads_queue_try_push_with_weight(
+	          queue,
+	          (intptr_t *) &queued_value1,
+	          1,
+	          &error );
+
+	( (libcthreads_internal_queue_t *) queue )->values_array = values_array;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_try_push_with_weight(
+	          queue,
+	          NULL,
+	          1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK )
+
+	/* Test libcthreads_queue_try_push_with_weight with pthread_mutex_lock failing in libcthreads_mutex_grab
+	 */
+	cthreads_test_pthread_mutex_lock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_try_push_with_weight(
+	          queue,
+	          (intptr_t *) &queued_value1,
+	          0,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_lock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_lock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcthreads_queue_try_push_with_weight with pthread_cond_broadcast failing
+	 */
+	cthreads_test_pthread_cond_broadcast_attempts_before_fail = 0;
+
+	result = libcthreads_queue_try_push_with_weight(
+	          queue,
+	          (intptr_t *) &queued_value1,
+	          0,
+	          &error );
+
+	if( cthreads_test_pthread_cond_broadcast_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_cond_broadcast_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcthreads_queue_try_push_with_weight with pthread_mutex_unlock failing in libcthreads_mutex_release
+	 */
+	cthreads_test_pthread_mutex_unlock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_try_push_with_weight(
+	          queue,
+	          (intptr_t *) &queued_value1,
+	          0,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_unlock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Manually release the mutex otherwise libcthreads_queue_free will fail
+		 */
+		result = libcthreads_mutex_release(
+		          ( (libcthreads_internal_queue_t *) queue )->condition_mutex,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
+
+	/* Clean up
+	 */
+	result = libcthreads_queue_free(
+	          &queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &queue,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_queue_push_with_weight function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_push_with_weight(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libcthreads_queue_t *queue = NULL;
+	intptr_t *value            = NULL;
+	intptr_t **values_array    = NULL;
+	int queued_value1          = 1;
+	int queued_value2          = 2;
+	int queued_value3          = 3;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_queue_initialize(
+	          &queue,
+	          10,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_set_maximum_weight(
+	          queue,
+	          16,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_queue_push_with_weight(
+	          queue,
+	          (intptr_t *) &queued_value3,
+	          8,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_push_with_weight(
+	          queue,
+	          (intptr_t *) &queued_value1,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_SIZE(
+	 "current_weight",
+	 ( (libcthreads_internal_queue_t *) queue )->current_weight,
+	 (size_t) 12 );
+
+	/* Test that the weights are retained when a value is pushed in sorted order
+	 */
+	result = libcthreads_queue_push_sorted(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
+	          LIBCTHREADS_SORT_FLAG_NON_UNIQUE_VALUES,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_pop(
+	          queue,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_SIZE(
+	 "current_weight",
+	 ( (libcthreads_internal_queue_t *) queue )->current_weight,
+	 (size_t) 4 );
+
+	result = libcthreads_queue_pop(
+	          queue,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_SIZE(
+	 "current_weight",
+	 ( (libcthreads_internal_queue_t *) queue )->current_weight,
+	 (size_t) 4 );
+
+	result = libcthreads_queue_pop(
+	          queue,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_SIZE(
+	 "current_weight",
+	 ( (libcthreads_internal_queue_t *) queue )->current_weight,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_queue_push_with_weight(
+	          NULL,
+	          (intptr_t *) &queued_value1,
+	          1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	values_array = ( (libcthreads_internal_queue_t *) queue )->values_array;
+
+	( (libcthreads_internal_queue_t *) queue )->values_array = NULL;
+
+	result = libcthreads_queue_push_with_weight(
+	          queue,
+	          (intptr_t *) &queued_value1,
+	          1,
+	          &error );
+
+	( (libcthreads_internal_queue_t *) queue )->values_array = values_array;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_push_with_weight(
+	          queue,
+	          NULL,
+	          1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK )
+
+	/* Test libcthreads_queue_push_with_weight with pthread_mutex_lock failing in libcthreads_mutex_grab
+	 */
+	cthreads_test_pthread_mutex_lock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_push_with_weight(
+	          queue,
+	          (intptr_t *) &queued_value1,
+	          0,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_lock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_lock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcthreads_queue_push_with_weight with pthread_cond_broadcast failing
+	 */
+	cthreads_test_pthread_cond_broadcast_attempts_before_fail = 0;
+
+	result = libcthreads_queue_push_with_weight(
+	          queue,
+	          (intptr_t *) &queued_value1,
+	          0,
+	          &error );
+
+	if( cthreads_test_pthread_cond_broadcast_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_cond_broadcast_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcthreads_queue_push_with_weight with pthread_mutex_unlock failing in libcthreads_mutex_release
+	 */
+	cthreads_test_pthread_mutex_unlock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_push_with_weight(
+	          queue,
+	          (intptr_t *) &queued_value1,
+	          0,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_unlock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Manually release the mutex otherwise libcthreads_queue_free will fail
+		 */
+		result = libcthreads_mutex_release(
+		          ( (libcthreads_internal_queue_t *) queue )->condition_mutex,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
+
+	/* Clean up
+	 */
+	result = libcthreads_queue_free(
+	          &queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &queue,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_queue_push_sorted function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_push_sorted(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libcthreads_queue_t *queue = NULL;
+	intptr_t **values_array    = NULL;
+	int queued_value1          = 1;
+	int queued_value2          = 2;
+	int queued_value3          = 3;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_queue_initialize(
+	          &queue,
+	          10,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "queue",
+	 queue );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_push(
+	          queue,
+	          (intptr_t *) &queued_value1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_queue_push_sorted(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
+	          0,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with unique value and LIBCTHREADS_SORT_FLAG_UNIQUE_VALUES set
+	 */
+	result = libcthreads_queue_push_sorted(
+	          queue,
+	          (intptr_t *) &queued_value3,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
+	          LIBCTHREADS_SORT_FLAG_UNIQUE_VALUES,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with duplicate value and LIBCTHREADS_SORT_FLAG_UNIQUE_VALUES set
+	 */
+	result = libcthreads_queue_push_sorted(
+	          queue,
+	          (intptr_t *) &queued_value3,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
+	          LIBCTHREADS_SORT_FLAG_UNIQUE_VALUES,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_queue_push_sorted(
+	          NULL,
+	          (intptr_t *) &queued_value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
+	          0,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	values_array = ( (libcthreads_internal_queue_t *) queue )->values_array;
+
+	( (libcthreads_internal_queue_t *) queue )->values_array = NULL;
+
+	result = libcthreads_queue_push_sorted(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
+	          0,
+	          &error );
+
+	( (libcthreads_internal_queue_t *) queue )->values_array = values_array;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_push_sorted(
+	          queue,
+	          NULL,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
+	          0,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_push_sorted(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          NULL,
+	          0,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_push_sorted(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
+	          0xff,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK )
+
+	/* Test libcthreads_queue_push_sorted with pthread_mutex_lock failing in libcthreads_mutex_grab
+	 */
+	cthreads_test_pthread_mutex_lock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_push_sorted(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
+	          0,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_lock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_lock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcthreads_queue_push_sorted with pthread_cond_wait failing in libcthreads_condition_wait
+	 */
+	cthreads_test_pthread_cond_wait_attempts_before_fail = 0;
+
+	result = libcthreads_queue_push_sorted(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
+	          0,
+	          &error );
+
+	if( cthreads_test_pthread_cond_wait_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_cond_wait_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcthreads_queue_push_sorted with pthread_cond_broadcast failing
+	 */
+	cthreads_test_pthread_cond_broadcast_attempts_before_fail = 0;
+
+	result = libcthreads_queue_push_sorted(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
+	          0,
+	          &error );
+
+	if( cthreads_test_pthread_cond_broadcast_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_cond_broadcast_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcthreads_queue_push_sorted with pthread_mutex_unlock failing in libcthreads_mutex_release
+	 */
+	cthreads_test_pthread_mutex_unlock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_push_sorted(
+	          queue,
+	          (intptr_t *) &queued_value2,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
+	          0,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_unlock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Manually release the mutex otherwise libcthreads_queue_free will fail
+		 */
+		result = libcthreads_mutex_release(
+		          ( (libcthreads_internal_queue_t *) queue )->condition_mutex,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
+
+	/* Clean up
+	 */
+	result = libcthreads_queue_free(
+	          &queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &queue,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_queue_push and libcthreads_queue_pop functions in separate threads
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_push_pop_threaded(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libcthreads_thread_t *pop_thread  = NULL;
+	libcthreads_thread_t *push_thread = NULL;
+	uint64_t number_of_notifications  = 0;
+	uint64_t number_of_wake_ups       = 0;
+	int *queued_values                = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	cthreads_test_expected_queued_value = 0;
+	cthreads_test_queued_value          = 0;
+
+	queued_values = (int *) memory_allocate(
+	                         sizeof( int ) * cthreads_test_number_of_iterations );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "queued_values",
+	 queued_values );
+
+	result = libcthreads_queue_initialize(
+	          &cthreads_test_queue,
+	          cthreads_test_number_of_values,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_create(
+	          &push_thread,
+	          NULL,
+	          (int (*)(void *)) &cthreads_test_queue_push_callback_function,
+	          queued_values,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_create(
+	          &pop_thread,
+	          NULL,
+	          (int (*)(void *)) &cthreads_test_queue_pop_callback_function,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_join(
+	          &pop_thread,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_join(
+	          &push_thread,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_get_notify_statistics(
+	          cthreads_test_queue,
+	          &number_of_notifications,
+	          &number_of_wake_ups,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Every push and pop notifies at most a single waiter
+	 */
+	CTHREADS_TEST_ASSERT_LESS_THAN_UINT64(
+	 "number_of_notifications",
+	 number_of_notifications,
+	 (uint64_t) ( 2 * cthreads_test_number_of_iterations ) + 1 );
+
+	CTHREADS_TEST_ASSERT_LESS_THAN_UINT64(
+	 "number_of_wake_ups",
+	 number_of_wake_ups,
+	 (uint64_t) ( 2 * cthreads_test_number_of_iterations ) + 1 );
+
+	result = libcthreads_queue_empty(
+	          cthreads_test_queue,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_free(
+	          &cthreads_test_queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 queued_values );
+
+	queued_values = NULL;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_queued_value",
+	 cthreads_test_queued_value,
+	 cthreads_test_expected_queued_value );
 
 	return( 1 );
 
 on_error:
 	if( error != NULL )
 	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
 		libcerror_error_free(
 		 &error );
 	}
-	if( queue != NULL )
+	if( pop_thread != NULL )
+	{
+		libcthreads_thread_join(
+		 &pop_thread,
+		 NULL );
+	}
+	if( push_thread != NULL )
+	{
+		libcthreads_thread_join(
+		 &push_thread,
+		 NULL );
+	}
+	if( cthreads_test_queue != NULL )
 	{
 		libcthreads_queue_free(
-		 &queue,
+		 &cthreads_test_queue,
 		 NULL,
 		 NULL );
 	}
+	if( queued_values != NULL )
+	{
+		memory_free(
+		 queued_values );
+	}
 	return( 0 );
 }
 
-/* Tests the libcthreads_queue_free function
+/* Tests the libcthreads_queue_push function while several consumers wait on the empty queue in separate threads
  * Returns 1 if successful or 0 if not
  */
-int cthreads_test_queue_free(
+int cthreads_test_queue_push_with_idle_waiters_threaded(
      void )
 {
-	libcerror_error_t *error   = NULL;
-	libcthreads_queue_t *queue = NULL;
-	int queued_value1          = 1;
-	int queued_value2          = 2;
-	int result                 = 0;
+	libcthreads_thread_t *pop_threads[ 4 ] = { NULL, NULL, NULL, NULL };
+	int queued_values[ 4 ]                 = { 1, 2, 3, 4 };
+
+	libcerror_error_t *error               = NULL;
+	uint64_t number_of_notifications       = 0;
+	uint64_t number_of_wake_ups            = 0;
+	int result                             = 0;
+	int thread_index                       = 0;
 
 	/* Initialize test
 	 */
 	result = libcthreads_queue_initialize(
-	          &queue,
-	          10,
+	          &cthreads_test_queue,
+	          4,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -658,47 +5200,79 @@ int cthreads_test_queue_free(
 	 result,
 	 1 );
 
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-	 "queue",
-	 queue );
-
 	CTHREADS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcthreads_queue_push(
-	          queue,
-	          (intptr_t *) &queued_value1,
-	          &error );
-
-	CTHREADS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_create(
+		          &( pop_threads[ thread_index ] ),
+		          NULL,
+		          &cthreads_test_queue_pop_single_value_callback_function,
+		          NULL,
+		          &error );
 
-	CTHREADS_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	result = libcthreads_queue_push(
-	          queue,
-	          (intptr_t *) &queued_value2,
-	          &error );
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = cthreads_test_queue_wait_for_empty_waiters(
+	          4 );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 1 );
 
-	CTHREADS_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	/* Test regular cases
 	 */
-	result = libcthreads_queue_free(
-	          &queue,
-	          (int (*)(intptr_t **, libcerror_error_t **)) &cthreads_test_queue_value_free_function,
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_queue_push(
+		          cthreads_test_queue,
+		          (intptr_t *) &( queued_values[ thread_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( pop_threads[ thread_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcthreads_queue_get_notify_statistics(
+	          cthreads_test_queue,
+	          &number_of_notifications,
+	          &number_of_wake_ups,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -706,41 +5280,116 @@ int cthreads_test_queue_free(
 	 result,
 	 1 );
 
-	CTHREADS_TEST_ASSERT_IS_NULL(
-	 "queue",
-	 queue );
-
 	CTHREADS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Every push wakes up a single idle consumer, waking up all of them
+	 * would make the consumers that find no value wait again
+	 */
+	CTHREADS_TEST_ASSERT_LESS_THAN_UINT64(
+	 "number_of_notifications",
+	 number_of_notifications,
+	 (uint64_t) 4 + 1 );
+
+	CTHREADS_TEST_ASSERT_LESS_THAN_UINT64(
+	 "number_of_wake_ups",
+	 number_of_wake_ups,
+	 (uint64_t) 4 + 1 );
+
+	/* Clean up
 	 */
 	result = libcthreads_queue_free(
-	          NULL,
+	          &cthreads_test_queue,
 	          NULL,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	CTHREADS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	return( 1 );
 
-	/* TODO test with libcthreads_condition_free failing 2 times */
-	/* TODO test with libcthreads_mutex_free failing 1 time */
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	if( cthreads_test_queue != NULL )
+	{
+		/* Wake up the consumers that still wait
+		 */
+		for( thread_index = 0;
+		     thread_index < 4;
+		     thread_index++ )
+		{
+			libcthreads_queue_try_push(
+			 cthreads_test_queue,
+			 (intptr_t *) &( queued_values[ thread_index ] ),
+			 NULL );
+		}
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		if( pop_threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( pop_threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	if( cthreads_test_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &cthreads_test_queue,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_queue_push and libcthreads_queue_pop functions in separate threads with spinning enabled
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_push_pop_spin_threaded(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libcthreads_thread_t *pop_thread  = NULL;
+	libcthreads_thread_t *push_thread = NULL;
+	uint64_t number_of_parks          = 0;
+	uint64_t number_of_spin_hits      = 0;
+	int *queued_values                = NULL;
+	int result                        = 0;
+	int spin_count                    = 0;
 
 	/* Initialize test
 	 */
+	cthreads_test_expected_queued_value = 0;
+	cthreads_test_queued_value          = 0;
+
+	queued_values = (int *) memory_allocate(
+	                         sizeof( int ) * cthreads_test_number_of_iterations );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "queued_values",
+	 queued_values );
+
 	result = libcthreads_queue_initialize(
-	          &queue,
-	          10,
+	          &cthreads_test_queue,
+	          cthreads_test_number_of_values,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -748,13 +5397,13 @@ int cthreads_test_queue_free(
 	 result,
 	 1 );
 
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-	 "queue",
-	 queue );
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	result = libcthreads_queue_push(
-	          queue,
-	          (intptr_t *) &queued_value1,
+	result = libcthreads_queue_set_maximum_spin_count(
+	          cthreads_test_queue,
+	          4096,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -762,63 +5411,44 @@ int cthreads_test_queue_free(
 	 result,
 	 1 );
 
-	/* Test libcthreads_queue_free with the free_value function returning -1
-	 */
-	result = libcthreads_queue_free(
-	          &queue,
-	          (int (*)(intptr_t **, libcerror_error_t **)) &cthreads_test_queue_error_value_free_function,
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_create(
+	          &push_thread,
+	          NULL,
+	          (int (*)(void *)) &cthreads_test_queue_push_callback_function,
+	          queued_values,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	CTHREADS_TEST_ASSERT_IS_NULL(
-	 "queue",
-	 queue );
-
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
+	result = libcthreads_thread_create(
+	          &pop_thread,
+	          NULL,
+	          (int (*)(void *)) &cthreads_test_queue_pop_callback_function,
+	          NULL,
+	          &error );
 
-on_error:
-	if( queue != NULL )
-	{
-		libcthreads_queue_free(
-		 &queue,
-		 NULL,
-		 NULL );
-	}
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-/* Tests the libcthreads_queue_empty function
- * Returns 1 if successful or 0 if not
- */
-int cthreads_test_queue_empty(
-     void )
-{
-	libcerror_error_t *error   = NULL;
-	libcthreads_queue_t *queue = NULL;
-	intptr_t **values_array    = NULL;
-	int result                 = 0;
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Initialize test
-	 */
-	result = libcthreads_queue_initialize(
-	          &queue,
-	          10,
+	result = libcthreads_thread_join(
+	          &pop_thread,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -826,18 +5456,12 @@ int cthreads_test_queue_empty(
 	 result,
 	 1 );
 
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-	 "queue",
-	 queue );
-
 	CTHREADS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libcthreads_queue_empty(
-	          queue,
+	result = libcthreads_thread_join(
+	          &push_thread,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -849,149 +5473,49 @@ int cthreads_test_queue_empty(
 	 "error",
 	 error );
 
-	/* TODO test libcthreads_queue_empty on filled queue without stalling */
-
-	/* Test error cases
-	 */
 	result = libcthreads_queue_empty(
-	          NULL,
+	          cthreads_test_queue,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	CTHREADS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	values_array = ( (libcthreads_internal_queue_t *) queue )->values_array;
-
-	( (libcthreads_internal_queue_t *) queue )->values_array = NULL;
-
-	result = libcthreads_queue_empty(
-	          queue,
+	result = libcthreads_queue_get_wait_statistics(
+	          cthreads_test_queue,
+	          &number_of_spin_hits,
+	          &number_of_parks,
+	          &spin_count,
 	          &error );
 
-	( (libcthreads_internal_queue_t *) queue )->values_array = values_array;
-
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	CTHREADS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-#if defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK )
-
-	/* Test libcthreads_queue_empty with pthread_mutex_lock failing in libcthreads_mutex_grab
-	 */
-	cthreads_test_pthread_mutex_lock_attempts_before_fail = 0;
-
-	result = libcthreads_queue_empty(
-	          queue,
-	          &error );
-
-	if( cthreads_test_pthread_mutex_lock_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_mutex_lock_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libcthreads_queue_empty with pthread_cond_wait failing in libcthreads_condition_wait
-	 */
-	cthreads_test_pthread_cond_wait_attempts_before_fail = 0;
-
-	result = libcthreads_queue_empty(
-	          queue,
-	          &error );
-
-	if( cthreads_test_pthread_cond_wait_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_cond_wait_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libcthreads_queue_empty with pthread_mutex_unlock failing in libcthreads_mutex_release
+	/* Every pop either is satisfied while spinning, parks or finds a value right away
 	 */
-	cthreads_test_pthread_mutex_unlock_attempts_before_fail = 0;
-
-	result = libcthreads_queue_empty(
-	          queue,
-	          &error );
-
-	if( cthreads_test_pthread_mutex_unlock_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_mutex_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
+	CTHREADS_TEST_ASSERT_LESS_THAN_UINT64(
+	 "number_of_spin_hits + number_of_parks",
+	 number_of_spin_hits + number_of_parks,
+	 (uint64_t) cthreads_test_number_of_iterations + 1 );
 
-		/* Manually release the mutex otherwise libcthreads_queue_free will fail
-		 */
-		result = libcthreads_mutex_release(
-		          ( (libcthreads_internal_queue_t *) queue )->condition_mutex,
-		          &error );
-
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
-
-		CTHREADS_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-#endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
+	CTHREADS_TEST_ASSERT_LESS_THAN_INT(
+	 "spin_count",
+	 spin_count,
+	 4096 + 1 );
 
-	/* Clean up
-	 */
 	result = libcthreads_queue_free(
-	          &queue,
+	          &cthreads_test_queue,
 	          NULL,
 	          &error );
 
@@ -1004,43 +5528,82 @@ int cthreads_test_queue_empty(
 	 "error",
 	 error );
 
+	memory_free(
+	 queued_values );
+
+	queued_values = NULL;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_queued_value",
+	 cthreads_test_queued_value,
+	 cthreads_test_expected_queued_value );
+
 	return( 1 );
 
 on_error:
 	if( error != NULL )
 	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
 		libcerror_error_free(
 		 &error );
 	}
-	if( queue != NULL )
+	if( pop_thread != NULL )
+	{
+		libcthreads_thread_join(
+		 &pop_thread,
+		 NULL );
+	}
+	if( push_thread != NULL )
+	{
+		libcthreads_thread_join(
+		 &push_thread,
+		 NULL );
+	}
+	if( cthreads_test_queue != NULL )
 	{
 		libcthreads_queue_free(
-		 &queue,
+		 &cthreads_test_queue,
 		 NULL,
 		 NULL );
 	}
+	if( queued_values != NULL )
+	{
+		memory_free(
+		 queued_values );
+	}
 	return( 0 );
 }
 
-/* Tests the libcthreads_queue_try_pop function
+/* Tests the libcthreads_queue_try_pop_value function
  * Returns 1 if successful or 0 if not
  */
-int cthreads_test_queue_try_pop(
+int cthreads_test_queue_try_pop_value(
      void )
 {
-	libcerror_error_t *error   = NULL;
-	libcthreads_queue_t *queue = NULL;
-	intptr_t *value            = NULL;
-	intptr_t **values_array    = NULL;
-	int queued_value1          = 1;
-	int queued_value2          = 2;
-	int result                 = 0;
+	cthreads_test_queue_value_t queued_value1;
+	cthreads_test_queue_value_t queued_value2;
+
+	libcerror_error_t *error           = NULL;
+	libcthreads_queue_t *pointer_queue = NULL;
+	libcthreads_queue_t *queue         = NULL;
+	uint8_t *values_data               = NULL;
+	int result                         = 0;
 
 	/* Initialize test
 	 */
-	result = libcthreads_queue_initialize(
+	queued_value1.identifier = 1;
+	queued_value1.value      = 0x12345678UL;
+
+	queued_value2.identifier = 2;
+	queued_value2.value      = 0x9abcdef0UL;
+
+	result = libcthreads_queue_initialize_with_value_size(
 	          &queue,
-	          10,
+	          2,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1048,35 +5611,28 @@ int cthreads_test_queue_try_pop(
 	 result,
 	 1 );
 
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-	 "queue",
-	 queue );
-
 	CTHREADS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libcthreads_queue_try_pop(
-	          queue,
-	          &value,
+	result = libcthreads_queue_initialize(
+	          &pointer_queue,
+	          2,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	CTHREADS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Initialize test
-	 */
-	result = libcthreads_queue_push(
+	result = libcthreads_queue_push_value(
 	          queue,
-	          (intptr_t *) &queued_value1,
+	          (uint8_t *) &queued_value1,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1088,9 +5644,12 @@ int cthreads_test_queue_try_pop(
 	 "error",
 	 error );
 
-	result = libcthreads_queue_push(
+	/* Test regular cases
+	 */
+	result = libcthreads_queue_try_pop_value(
 	          queue,
-	          (intptr_t *) &queued_value2,
+	          (uint8_t *) &queued_value2,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1102,21 +5661,26 @@ int cthreads_test_queue_try_pop(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libcthreads_queue_try_pop(
+	CTHREADS_TEST_ASSERT_EQUAL_UINT64(
+	 "queued_value2.identifier",
+	 queued_value2.identifier,
+	 (uint64_t) 1 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_UINT64(
+	 "queued_value2.value",
+	 queued_value2.value,
+	 (uint64_t) 0x12345678UL );
+
+	result = libcthreads_queue_try_pop_value(
 	          queue,
-	          &value,
+	          (uint8_t *) &queued_value2,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-	 "value",
-	 value );
+	 0 );
 
 	CTHREADS_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1124,9 +5688,10 @@ int cthreads_test_queue_try_pop(
 
 	/* Test error cases
 	 */
-	result = libcthreads_queue_try_pop(
+	result = libcthreads_queue_try_pop_value(
 	          NULL,
-	          &value,
+	          (uint8_t *) &queued_value2,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1141,16 +5706,17 @@ int cthreads_test_queue_try_pop(
 	libcerror_error_free(
 	 &error );
 
-	values_array = ( (libcthreads_internal_queue_t *) queue )->values_array;
+	values_data = ( (libcthreads_internal_queue_t *) queue )->values_data;
 
-	( (libcthreads_internal_queue_t *) queue )->values_array = NULL;
+	( (libcthreads_internal_queue_t *) queue )->values_data = NULL;
 
-	result = libcthreads_queue_try_pop(
+	result = libcthreads_queue_try_pop_value(
 	          queue,
-	          &value,
+	          (uint8_t *) &queued_value2,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
-	( (libcthreads_internal_queue_t *) queue )->values_array = values_array;
+	( (libcthreads_internal_queue_t *) queue )->values_data = values_data;
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1164,9 +5730,10 @@ int cthreads_test_queue_try_pop(
 	libcerror_error_free(
 	 &error );
 
-	result = libcthreads_queue_try_pop(
+	result = libcthreads_queue_try_pop_value(
 	          queue,
 	          NULL,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1181,108 +5748,75 @@ int cthreads_test_queue_try_pop(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK )
-
-	/* Test libcthreads_queue_try_pop with pthread_mutex_lock failing in libcthreads_mutex_grab
-	 */
-	cthreads_test_pthread_mutex_lock_attempts_before_fail = 0;
-
-	result = libcthreads_queue_try_pop(
+	result = libcthreads_queue_try_pop_value(
 	          queue,
-	          &value,
+	          (uint8_t *) &queued_value2,
+	          sizeof( cthreads_test_queue_value_t ) - 1,
 	          &error );
 
-	if( cthreads_test_pthread_mutex_lock_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_mutex_lock_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libcthreads_queue_try_pop with pthread_cond_broadcast failing
-	 */
-	cthreads_test_pthread_cond_broadcast_attempts_before_fail = 0;
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	result = libcthreads_queue_try_pop(
-	          queue,
-	          &value,
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_try_pop_value(
+	          pointer_queue,
+	          (uint8_t *) &queued_value2,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
-	if( cthreads_test_pthread_cond_broadcast_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_cond_broadcast_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libcthreads_queue_try_pop with pthread_mutex_unlock failing in libcthreads_mutex_release
-	 */
-	cthreads_test_pthread_mutex_unlock_attempts_before_fail = 0;
+	libcerror_error_free(
+	 &error );
 
 	result = libcthreads_queue_try_pop(
 	          queue,
-	          &value,
+	          (intptr_t **) &values_data,
 	          &error );
 
-	if( cthreads_test_pthread_mutex_unlock_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_mutex_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
+	libcerror_error_free(
+	 &error );
 
-		/* Manually release the mutex otherwise libcthreads_queue_free will fail
-		 */
-		result = libcthreads_mutex_release(
-		          ( (libcthreads_internal_queue_t *) queue )->condition_mutex,
-		          &error );
+	/* Clean up
+	 */
+	result = libcthreads_queue_free(
+	          &pointer_queue,
+	          NULL,
+	          &error );
 
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		CTHREADS_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-#endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Clean up
-	 */
 	result = libcthreads_queue_free(
 	          &queue,
 	          NULL,
@@ -1305,6 +5839,13 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( pointer_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &pointer_queue,
+		 NULL,
+		 NULL );
+	}
 	if( queue != NULL )
 	{
 		libcthreads_queue_free(
@@ -1315,43 +5856,33 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcthreads_queue_pop function
+/* Tests the libcthreads_queue_pop_value function
  * Returns 1 if successful or 0 if not
  */
-int cthreads_test_queue_pop(
+int cthreads_test_queue_pop_value(
      void )
 {
-	libcerror_error_t *error   = NULL;
-	libcthreads_queue_t *queue = NULL;
-	intptr_t *value            = NULL;
-	intptr_t **values_array    = NULL;
-	int queued_value1          = 1;
-	int queued_value2          = 2;
-	int result                 = 0;
+	cthreads_test_queue_value_t queued_value1;
+	cthreads_test_queue_value_t queued_value2;
+
+	libcerror_error_t *error           = NULL;
+	libcthreads_queue_t *pointer_queue = NULL;
+	libcthreads_queue_t *queue         = NULL;
+	uint8_t *values_data               = NULL;
+	int result                         = 0;
 
 	/* Initialize test
 	 */
-	result = libcthreads_queue_initialize(
-	          &queue,
-	          10,
-	          &error );
-
-	CTHREADS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-	 "queue",
-	 queue );
+	queued_value1.identifier = 1;
+	queued_value1.value      = 0x12345678UL;
 
-	CTHREADS_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	queued_value2.identifier = 2;
+	queued_value2.value      = 0x9abcdef0UL;
 
-	result = libcthreads_queue_push(
-	          queue,
-	          (intptr_t *) &queued_value1,
+	result = libcthreads_queue_initialize_with_value_size(
+	          &queue,
+	          2,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1363,9 +5894,9 @@ int cthreads_test_queue_pop(
 	 "error",
 	 error );
 
-	result = libcthreads_queue_push(
-	          queue,
-	          (intptr_t *) &queued_value2,
+	result = libcthreads_queue_initialize(
+	          &pointer_queue,
+	          2,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1377,11 +5908,10 @@ int cthreads_test_queue_pop(
 	 "error",
 	 error );
 
-	/* Re-add the popped value
-	 */
-	result = libcthreads_queue_push(
+	result = libcthreads_queue_push_value(
 	          queue,
-	          (intptr_t *) &queued_value2,
+	          (uint8_t *) &queued_value1,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1395,9 +5925,10 @@ int cthreads_test_queue_pop(
 
 	/* Test regular cases
 	 */
-	result = libcthreads_queue_pop(
+	result = libcthreads_queue_pop_value(
 	          queue,
-	          &value,
+	          (uint8_t *) &queued_value2,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1405,19 +5936,26 @@ int cthreads_test_queue_pop(
 	 result,
 	 1 );
 
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-	 "value",
-	 value );
-
 	CTHREADS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	CTHREADS_TEST_ASSERT_EQUAL_UINT64(
+	 "queued_value2.identifier",
+	 queued_value2.identifier,
+	 (uint64_t) 1 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_UINT64(
+	 "queued_value2.value",
+	 queued_value2.value,
+	 (uint64_t) 0x12345678UL );
+
 	/* Test error cases
 	 */
-	result = libcthreads_queue_pop(
+	result = libcthreads_queue_pop_value(
 	          NULL,
-	          &value,
+	          (uint8_t *) &queued_value2,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1432,16 +5970,17 @@ int cthreads_test_queue_pop(
 	libcerror_error_free(
 	 &error );
 
-	values_array = ( (libcthreads_internal_queue_t *) queue )->values_array;
+	values_data = ( (libcthreads_internal_queue_t *) queue )->values_data;
 
-	( (libcthreads_internal_queue_t *) queue )->values_array = NULL;
+	( (libcthreads_internal_queue_t *) queue )->values_data = NULL;
 
-	result = libcthreads_queue_pop(
+	result = libcthreads_queue_pop_value(
 	          queue,
-	          &value,
+	          (uint8_t *) &queued_value2,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
-	( (libcthreads_internal_queue_t *) queue )->values_array = values_array;
+	( (libcthreads_internal_queue_t *) queue )->values_data = values_data;
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1455,9 +5994,10 @@ int cthreads_test_queue_pop(
 	libcerror_error_free(
 	 &error );
 
-	result = libcthreads_queue_pop(
+	result = libcthreads_queue_pop_value(
 	          queue,
 	          NULL,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1469,185 +6009,78 @@ int cthreads_test_queue_pop(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-#if defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK )
-
-	/* Test libcthreads_queue_pop with pthread_mutex_lock failing in libcthreads_mutex_grab
-	 */
-	cthreads_test_pthread_mutex_lock_attempts_before_fail = 0;
-
-	result = libcthreads_queue_pop(
-	          queue,
-	          &value,
-	          &error );
-
-	if( cthreads_test_pthread_mutex_lock_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_mutex_lock_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libcthreads_queue_pop with pthread_cond_wait failing in libcthreads_condition_wait
-	 */
-	cthreads_test_pthread_cond_wait_attempts_before_fail = 0;
-
-	result = libcthreads_queue_pop(
-	          queue,
-	          &value,
-	          &error );
-
-	if( cthreads_test_pthread_cond_wait_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_cond_wait_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-
-		/* Manually reset the empty condition otherwise the next call to libcthreads_queue_pop will stall.
-		 */
-		result = libcthreads_condition_signal(
-		          ( (libcthreads_internal_queue_t *) queue )->empty_condition,
-		          &error );
-
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
-
-		CTHREADS_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-	/* Re-add the popped value
-	 */
-	result = libcthreads_queue_push(
-	          queue,
-	          (intptr_t *) &queued_value2,
-	          &error );
-
-	CTHREADS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CTHREADS_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Test libcthreads_queue_pop with pthread_cond_broadcast failing
-	 */
-	cthreads_test_pthread_cond_broadcast_attempts_before_fail = 0;
-
-	result = libcthreads_queue_pop(
-	          queue,
-	          &value,
-	          &error );
-
-	if( cthreads_test_pthread_cond_broadcast_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_cond_broadcast_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	libcerror_error_free(
+	 &error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Re-add the popped value
-	 */
-	result = libcthreads_queue_push(
+	result = libcthreads_queue_pop_value(
 	          queue,
-	          (intptr_t *) &queued_value2,
+	          (uint8_t *) &queued_value2,
+	          sizeof( cthreads_test_queue_value_t ) - 1,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CTHREADS_TEST_ASSERT_IS_NULL(
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test libcthreads_queue_pop with pthread_mutex_unlock failing in libcthreads_mutex_release
-	 */
-	cthreads_test_pthread_mutex_unlock_attempts_before_fail = 0;
+	libcerror_error_free(
+	 &error );
 
-	result = libcthreads_queue_pop(
-	          queue,
-	          &value,
+	result = libcthreads_queue_pop_value(
+	          pointer_queue,
+	          (uint8_t *) &queued_value2,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
-	if( cthreads_test_pthread_mutex_unlock_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_mutex_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
+	libcerror_error_free(
+	 &error );
 
-		/* Manually release the mutex otherwise libcthreads_queue_free will fail
-		 */
-		result = libcthreads_mutex_release(
-		          ( (libcthreads_internal_queue_t *) queue )->condition_mutex,
-		          &error );
+	result = libcthreads_queue_pop(
+	          queue,
+	          (intptr_t **) &values_data,
+	          &error );
 
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		CTHREADS_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-#endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
 	/* Clean up
 	 */
+	result = libcthreads_queue_free(
+	          &pointer_queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libcthreads_queue_free(
 	          &queue,
 	          NULL,
@@ -1670,6 +6103,13 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( pointer_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &pointer_queue,
+		 NULL,
+		 NULL );
+	}
 	if( queue != NULL )
 	{
 		libcthreads_queue_free(
@@ -1680,25 +6120,33 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcthreads_queue_try_push function
+/* Tests the libcthreads_queue_try_push_value function
  * Returns 1 if successful or 0 if not
  */
-int cthreads_test_queue_try_push(
+int cthreads_test_queue_try_push_value(
      void )
 {
-	libcerror_error_t *error       = NULL;
-	libcthreads_queue_t *queue     = NULL;
-	intptr_t **values_array        = NULL;
-	int allocated_number_of_values = 0;
-	int queued_value1              = 1;
-	int queued_value2              = 2;
-	int result                     = 0;
+	cthreads_test_queue_value_t queued_value1;
+	cthreads_test_queue_value_t queued_value2;
+
+	libcerror_error_t *error           = NULL;
+	libcthreads_queue_t *pointer_queue = NULL;
+	libcthreads_queue_t *queue         = NULL;
+	uint8_t *values_data               = NULL;
+	int result                         = 0;
 
 	/* Initialize test
 	 */
-	result = libcthreads_queue_initialize(
+	queued_value1.identifier = 1;
+	queued_value1.value      = 0x12345678UL;
+
+	queued_value2.identifier = 2;
+	queued_value2.value      = 0x9abcdef0UL;
+
+	result = libcthreads_queue_initialize_with_value_size(
 	          &queue,
-	          10,
+	          2,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1706,17 +6154,13 @@ int cthreads_test_queue_try_push(
 	 result,
 	 1 );
 
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-	 "queue",
-	 queue );
-
 	CTHREADS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcthreads_queue_push(
-	          queue,
-	          (intptr_t *) &queued_value1,
+	result = libcthreads_queue_initialize(
+	          &pointer_queue,
+	          2,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1730,9 +6174,10 @@ int cthreads_test_queue_try_push(
 
 	/* Test regular cases
 	 */
-	result = libcthreads_queue_try_push(
+	result = libcthreads_queue_try_push_value(
 	          queue,
-	          (intptr_t *) &queued_value1,
+	          (uint8_t *) &queued_value1,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1744,17 +6189,27 @@ int cthreads_test_queue_try_push(
 	 "error",
 	 error );
 
-	allocated_number_of_values = ( (libcthreads_internal_queue_t *) queue )->allocated_number_of_values;
+	result = libcthreads_queue_try_push_value(
+	          queue,
+	          (uint8_t *) &queued_value2,
+	          sizeof( cthreads_test_queue_value_t ),
+	          &error );
 
-	( (libcthreads_internal_queue_t *) queue )->allocated_number_of_values = ( (libcthreads_internal_queue_t *) queue )->number_of_values;
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	result = libcthreads_queue_try_push(
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_try_push_value(
 	          queue,
-	          (intptr_t *) &queued_value2,
+	          (uint8_t *) &queued_value1,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
-	( (libcthreads_internal_queue_t *) queue )->allocated_number_of_values = allocated_number_of_values;
-
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -1764,11 +6219,12 @@ int cthreads_test_queue_try_push(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libcthreads_queue_try_push(
+	queued_value1.value = 0;
+
+	result = libcthreads_queue_pop_value(
 	          queue,
-	          (intptr_t *) &queued_value2,
+	          (uint8_t *) &queued_value1,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1780,11 +6236,22 @@ int cthreads_test_queue_try_push(
 	 "error",
 	 error );
 
+	CTHREADS_TEST_ASSERT_EQUAL_UINT64(
+	 "queued_value1.identifier",
+	 queued_value1.identifier,
+	 (uint64_t) 1 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_UINT64(
+	 "queued_value1.value",
+	 queued_value1.value,
+	 (uint64_t) 0x12345678UL );
+
 	/* Test error cases
 	 */
-	result = libcthreads_queue_try_push(
+	result = libcthreads_queue_try_push_value(
 	          NULL,
-	          (intptr_t *) &queued_value2,
+	          (uint8_t *) &queued_value1,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1799,16 +6266,17 @@ int cthreads_test_queue_try_push(
 	libcerror_error_free(
 	 &error );
 
-	values_array = ( (libcthreads_internal_queue_t *) queue )->values_array;
+	values_data = ( (libcthreads_internal_queue_t *) queue )->values_data;
 
-	( (libcthreads_internal_queue_t *) queue )->values_array = NULL;
+	( (libcthreads_internal_queue_t *) queue )->values_data = NULL;
 
-	result = libcthreads_queue_try_push(
+	result = libcthreads_queue_try_push_value(
 	          queue,
-	          (intptr_t *) &queued_value2,
+	          (uint8_t *) &queued_value1,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
-	( (libcthreads_internal_queue_t *) queue )->values_array = values_array;
+	( (libcthreads_internal_queue_t *) queue )->values_data = values_data;
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1822,9 +6290,10 @@ int cthreads_test_queue_try_push(
 	libcerror_error_free(
 	 &error );
 
-	result = libcthreads_queue_try_push(
+	result = libcthreads_queue_try_push_value(
 	          queue,
 	          NULL,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1839,108 +6308,75 @@ int cthreads_test_queue_try_push(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK )
-
-	/* Test libcthreads_queue_try_push with pthread_mutex_lock failing in libcthreads_mutex_grab
-	 */
-	cthreads_test_pthread_mutex_lock_attempts_before_fail = 0;
-
-	result = libcthreads_queue_try_push(
+	result = libcthreads_queue_try_push_value(
 	          queue,
-	          (intptr_t *) &queued_value2,
+	          (uint8_t *) &queued_value1,
+	          sizeof( cthreads_test_queue_value_t ) - 1,
 	          &error );
 
-	if( cthreads_test_pthread_mutex_lock_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_mutex_lock_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libcthreads_queue_try_push with pthread_cond_broadcast failing
-	 */
-	cthreads_test_pthread_cond_broadcast_attempts_before_fail = 0;
+	libcerror_error_free(
+	 &error );
 
-	result = libcthreads_queue_try_push(
-	          queue,
-	          (intptr_t *) &queued_value2,
+	result = libcthreads_queue_try_push_value(
+	          pointer_queue,
+	          (uint8_t *) &queued_value1,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
-	if( cthreads_test_pthread_cond_broadcast_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_cond_broadcast_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libcthreads_queue_try_push with pthread_mutex_unlock failing in libcthreads_mutex_release
-	 */
-	cthreads_test_pthread_mutex_unlock_attempts_before_fail = 0;
+	libcerror_error_free(
+	 &error );
 
 	result = libcthreads_queue_try_push(
 	          queue,
-	          (intptr_t *) &queued_value2,
+	          (intptr_t *) &queued_value1,
 	          &error );
 
-	if( cthreads_test_pthread_mutex_unlock_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_mutex_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-
-		/* Manually release the mutex otherwise libcthreads_queue_free will fail
-		 */
-		result = libcthreads_mutex_release(
-		          ( (libcthreads_internal_queue_t *) queue )->condition_mutex,
-		          &error );
-
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		CTHREADS_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-#endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
 	/* Clean up
 	 */
+	result = libcthreads_queue_free(
+	          &pointer_queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libcthreads_queue_free(
 	          &queue,
 	          NULL,
@@ -1963,6 +6399,13 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( pointer_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &pointer_queue,
+		 NULL,
+		 NULL );
+	}
 	if( queue != NULL )
 	{
 		libcthreads_queue_free(
@@ -1973,24 +6416,33 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcthreads_queue_push function
+/* Tests the libcthreads_queue_push_value function
  * Returns 1 if successful or 0 if not
  */
-int cthreads_test_queue_push(
+int cthreads_test_queue_push_value(
      void )
 {
-	libcerror_error_t *error   = NULL;
-	libcthreads_queue_t *queue = NULL;
-	intptr_t **values_array    = NULL;
-	int queued_value1          = 1;
-	int queued_value2          = 2;
-	int result                 = 0;
+	cthreads_test_queue_value_t queued_value1;
+	cthreads_test_queue_value_t queued_value2;
+
+	libcerror_error_t *error           = NULL;
+	libcthreads_queue_t *pointer_queue = NULL;
+	libcthreads_queue_t *queue         = NULL;
+	uint8_t *values_data               = NULL;
+	int result                         = 0;
 
 	/* Initialize test
 	 */
-	result = libcthreads_queue_initialize(
+	queued_value1.identifier = 1;
+	queued_value1.value      = 0x12345678UL;
+
+	queued_value2.identifier = 2;
+	queued_value2.value      = 0x9abcdef0UL;
+
+	result = libcthreads_queue_initialize_with_value_size(
 	          &queue,
-	          10,
+	          2,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1998,17 +6450,13 @@ int cthreads_test_queue_push(
 	 result,
 	 1 );
 
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-	 "queue",
-	 queue );
-
 	CTHREADS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcthreads_queue_push(
-	          queue,
-	          (intptr_t *) &queued_value1,
+	result = libcthreads_queue_initialize(
+	          &pointer_queue,
+	          2,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -2022,9 +6470,42 @@ int cthreads_test_queue_push(
 
 	/* Test regular cases
 	 */
-	result = libcthreads_queue_push(
+	result = libcthreads_queue_push_value(
 	          queue,
-	          (intptr_t *) &queued_value2,
+	          (uint8_t *) &queued_value1,
+	          sizeof( cthreads_test_queue_value_t ),
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_push_value(
+	          queue,
+	          (uint8_t *) &queued_value2,
+	          sizeof( cthreads_test_queue_value_t ),
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	queued_value1.value = 0;
+
+	result = libcthreads_queue_pop_value(
+	          queue,
+	          (uint8_t *) &queued_value1,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -2036,11 +6517,22 @@ int cthreads_test_queue_push(
 	 "error",
 	 error );
 
+	CTHREADS_TEST_ASSERT_EQUAL_UINT64(
+	 "queued_value1.identifier",
+	 queued_value1.identifier,
+	 (uint64_t) 1 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_UINT64(
+	 "queued_value1.value",
+	 queued_value1.value,
+	 (uint64_t) 0x12345678UL );
+
 	/* Test error cases
 	 */
-	result = libcthreads_queue_push(
+	result = libcthreads_queue_push_value(
 	          NULL,
-	          (intptr_t *) &queued_value2,
+	          (uint8_t *) &queued_value1,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -2055,16 +6547,17 @@ int cthreads_test_queue_push(
 	libcerror_error_free(
 	 &error );
 
-	values_array = ( (libcthreads_internal_queue_t *) queue )->values_array;
+	values_data = ( (libcthreads_internal_queue_t *) queue )->values_data;
 
-	( (libcthreads_internal_queue_t *) queue )->values_array = NULL;
+	( (libcthreads_internal_queue_t *) queue )->values_data = NULL;
 
-	result = libcthreads_queue_push(
+	result = libcthreads_queue_push_value(
 	          queue,
-	          (intptr_t *) &queued_value2,
+	          (uint8_t *) &queued_value1,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
-	( (libcthreads_internal_queue_t *) queue )->values_array = values_array;
+	( (libcthreads_internal_queue_t *) queue )->values_data = values_data;
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -2078,9 +6571,10 @@ int cthreads_test_queue_push(
 	libcerror_error_free(
 	 &error );
 
-	result = libcthreads_queue_push(
+	result = libcthreads_queue_push_value(
 	          queue,
 	          NULL,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -2095,135 +6589,75 @@ int cthreads_test_queue_push(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK )
-
-	/* Test libcthreads_queue_push with pthread_mutex_lock failing in libcthreads_mutex_grab
-	 */
-	cthreads_test_pthread_mutex_lock_attempts_before_fail = 0;
-
-	result = libcthreads_queue_push(
+	result = libcthreads_queue_push_value(
 	          queue,
-	          (intptr_t *) &queued_value2,
+	          (uint8_t *) &queued_value1,
+	          sizeof( cthreads_test_queue_value_t ) - 1,
 	          &error );
 
-	if( cthreads_test_pthread_mutex_lock_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_mutex_lock_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libcthreads_queue_push with pthread_cond_wait failing in libcthreads_condition_wait
-	 */
-	cthreads_test_pthread_cond_wait_attempts_before_fail = 0;
+	libcerror_error_free(
+	 &error );
 
-	result = libcthreads_queue_push(
-	          queue,
-	          (intptr_t *) &queued_value2,
+	result = libcthreads_queue_push_value(
+	          pointer_queue,
+	          (uint8_t *) &queued_value1,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
-	if( cthreads_test_pthread_cond_wait_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_cond_wait_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libcthreads_queue_push with pthread_cond_broadcast failing
-	 */
-	cthreads_test_pthread_cond_broadcast_attempts_before_fail = 0;
+	libcerror_error_free(
+	 &error );
 
 	result = libcthreads_queue_push(
 	          queue,
-	          (intptr_t *) &queued_value2,
+	          (intptr_t *) &queued_value1,
 	          &error );
 
-	if( cthreads_test_pthread_cond_broadcast_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_cond_broadcast_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libcthreads_queue_push with pthread_mutex_unlock failing in libcthreads_mutex_release
-	 */
-	cthreads_test_pthread_mutex_unlock_attempts_before_fail = 0;
+	libcerror_error_free(
+	 &error );
 
-	result = libcthreads_queue_push(
-	          queue,
-	          (intptr_t *) &queued_value2,
+	/* Clean up
+	 */
+	result = libcthreads_queue_free(
+	          &pointer_queue,
+	          NULL,
 	          &error );
 
-	if( cthreads_test_pthread_mutex_unlock_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_mutex_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-
-		/* Manually release the mutex otherwise libcthreads_queue_free will fail
-		 */
-		result = libcthreads_mutex_release(
-		          ( (libcthreads_internal_queue_t *) queue )->condition_mutex,
-		          &error );
-
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		CTHREADS_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-#endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Clean up
-	 */
 	result = libcthreads_queue_free(
 	          &queue,
 	          NULL,
@@ -2246,6 +6680,13 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( pointer_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &pointer_queue,
+		 NULL,
+		 NULL );
+	}
 	if( queue != NULL )
 	{
 		libcthreads_queue_free(
@@ -2256,43 +6697,33 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcthreads_queue_push_sorted function
+/* Tests pushing values with a weight and popping values on a queue with threads
  * Returns 1 if successful or 0 if not
  */
-int cthreads_test_queue_push_sorted(
+int cthreads_test_queue_push_pop_with_weight_threaded(
      void )
 {
-	libcerror_error_t *error   = NULL;
-	libcthreads_queue_t *queue = NULL;
-	intptr_t **values_array    = NULL;
-	int queued_value1          = 1;
-	int queued_value2          = 2;
-	int queued_value3          = 3;
-	int result                 = 0;
+	libcerror_error_t *error          = NULL;
+	libcthreads_thread_t *pop_thread  = NULL;
+	libcthreads_thread_t *push_thread = NULL;
+	int *queued_values                = NULL;
+	int result                        = 0;
 
 	/* Initialize test
 	 */
-	result = libcthreads_queue_initialize(
-	          &queue,
-	          10,
-	          &error );
+	cthreads_test_expected_queued_value = 0;
+	cthreads_test_queued_value          = 0;
 
-	CTHREADS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	queued_values = (int *) memory_allocate(
+	                         sizeof( int ) * cthreads_test_number_of_iterations );
 
 	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-	 "queue",
-	 queue );
-
-	CTHREADS_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	 "queued_values",
+	 queued_values );
 
-	result = libcthreads_queue_push(
-	          queue,
-	          (intptr_t *) &queued_value1,
+	result = libcthreads_queue_initialize(
+	          &cthreads_test_queue,
+	          cthreads_test_number_of_values,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -2304,13 +6735,9 @@ int cthreads_test_queue_push_sorted(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libcthreads_queue_push_sorted(
-	          queue,
-	          (intptr_t *) &queued_value2,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
-	          0,
+	result = libcthreads_queue_set_maximum_weight(
+	          cthreads_test_queue,
+	          cthreads_test_maximum_weight,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -2322,13 +6749,11 @@ int cthreads_test_queue_push_sorted(
 	 "error",
 	 error );
 
-	/* Test with unique value and LIBCTHREADS_SORT_FLAG_UNIQUE_VALUES set
-	 */
-	result = libcthreads_queue_push_sorted(
-	          queue,
-	          (intptr_t *) &queued_value3,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
-	          LIBCTHREADS_SORT_FLAG_UNIQUE_VALUES,
+	result = libcthreads_thread_create(
+	          &push_thread,
+	          NULL,
+	          (int (*)(void *)) &cthreads_test_queue_push_with_weight_callback_function,
+	          queued_values,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -2340,266 +6765,228 @@ int cthreads_test_queue_push_sorted(
 	 "error",
 	 error );
 
-	/* Test with duplicate value and LIBCTHREADS_SORT_FLAG_UNIQUE_VALUES set
-	 */
-	result = libcthreads_queue_push_sorted(
-	          queue,
-	          (intptr_t *) &queued_value3,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
-	          LIBCTHREADS_SORT_FLAG_UNIQUE_VALUES,
+	result = libcthreads_thread_create(
+	          &pop_thread,
+	          NULL,
+	          (int (*)(void *)) &cthreads_test_queue_pop_callback_function,
+	          NULL,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	CTHREADS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcthreads_queue_push_sorted(
-	          NULL,
-	          (intptr_t *) &queued_value2,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
-	          0,
+	result = libcthreads_thread_join(
+	          &pop_thread,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	CTHREADS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	values_array = ( (libcthreads_internal_queue_t *) queue )->values_array;
-
-	( (libcthreads_internal_queue_t *) queue )->values_array = NULL;
-
-	result = libcthreads_queue_push_sorted(
-	          queue,
-	          (intptr_t *) &queued_value2,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
-	          0,
+	result = libcthreads_thread_join(
+	          &push_thread,
 	          &error );
 
-	( (libcthreads_internal_queue_t *) queue )->values_array = values_array;
-
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	CTHREADS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcthreads_queue_push_sorted(
-	          queue,
-	          NULL,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
-	          0,
+	result = libcthreads_queue_empty(
+	          cthreads_test_queue,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	CTHREADS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcthreads_queue_push_sorted(
-	          queue,
-	          (intptr_t *) &queued_value2,
+	result = libcthreads_queue_free(
+	          &cthreads_test_queue,
 	          NULL,
-	          0,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	CTHREADS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	memory_free(
+	 queued_values );
 
-	result = libcthreads_queue_push_sorted(
-	          queue,
-	          (intptr_t *) &queued_value2,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
-	          0xff,
-	          &error );
+	queued_values = NULL;
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-#if defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK )
+	 "cthreads_test_queued_value",
+	 cthreads_test_queued_value,
+	 cthreads_test_expected_queued_value );
 
-	/* Test libcthreads_queue_push_sorted with pthread_mutex_lock failing in libcthreads_mutex_grab
-	 */
-	cthreads_test_pthread_mutex_lock_attempts_before_fail = 0;
+	return( 1 );
 
-	result = libcthreads_queue_push_sorted(
-	          queue,
-	          (intptr_t *) &queued_value2,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
-	          0,
-	          &error );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
 
-	if( cthreads_test_pthread_mutex_lock_attempts_before_fail != -1 )
+		libcerror_error_free(
+		 &error );
+	}
+	if( pop_thread != NULL )
 	{
-		cthreads_test_pthread_mutex_lock_attempts_before_fail = -1;
+		libcthreads_thread_join(
+		 &pop_thread,
+		 NULL );
 	}
-	else
+	if( push_thread != NULL )
 	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+		libcthreads_thread_join(
+		 &push_thread,
+		 NULL );
+	}
+	if( cthreads_test_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &cthreads_test_queue,
+		 NULL,
+		 NULL );
+	}
+	if( queued_values != NULL )
+	{
+		memory_free(
+		 queued_values );
+	}
+	return( 0 );
+}
 
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+/* Tests pushing and popping values by copy on a queue with threads
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_push_pop_value_threaded(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libcthreads_thread_t *pop_thread  = NULL;
+	libcthreads_thread_t *push_thread = NULL;
+	int result                        = 0;
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libcthreads_queue_push_sorted with pthread_cond_wait failing in libcthreads_condition_wait
+	/* Initialize test
 	 */
-	cthreads_test_pthread_cond_wait_attempts_before_fail = 0;
+	cthreads_test_expected_queued_value = 0;
+	cthreads_test_queued_value          = 0;
 
-	result = libcthreads_queue_push_sorted(
-	          queue,
-	          (intptr_t *) &queued_value2,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
-	          0,
+	result = libcthreads_queue_initialize_with_value_size(
+	          &cthreads_test_queue,
+	          cthreads_test_number_of_values,
+	          sizeof( cthreads_test_queue_value_t ),
 	          &error );
 
-	if( cthreads_test_pthread_cond_wait_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_cond_wait_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libcthreads_queue_push_sorted with pthread_cond_broadcast failing
-	 */
-	cthreads_test_pthread_cond_broadcast_attempts_before_fail = 0;
+	result = libcthreads_thread_create(
+	          &push_thread,
+	          NULL,
+	          &cthreads_test_queue_push_value_callback_function,
+	          NULL,
+	          &error );
 
-	result = libcthreads_queue_push_sorted(
-	          queue,
-	          (intptr_t *) &queued_value2,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
-	          0,
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_create(
+	          &pop_thread,
+	          NULL,
+	          &cthreads_test_queue_pop_value_callback_function,
+	          NULL,
 	          &error );
 
-	if( cthreads_test_pthread_cond_broadcast_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_cond_broadcast_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libcthreads_queue_push_sorted with pthread_mutex_unlock failing in libcthreads_mutex_release
-	 */
-	cthreads_test_pthread_mutex_unlock_attempts_before_fail = 0;
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	result = libcthreads_queue_push_sorted(
-	          queue,
-	          (intptr_t *) &queued_value2,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &cthreads_test_queue_value_compare_function,
-	          0,
+	result = libcthreads_thread_join(
+	          &pop_thread,
 	          &error );
 
-	if( cthreads_test_pthread_mutex_unlock_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_mutex_unlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
+	result = libcthreads_thread_join(
+	          &push_thread,
+	          &error );
 
-		/* Manually release the mutex otherwise libcthreads_queue_free will fail
-		 */
-		result = libcthreads_mutex_release(
-		          ( (libcthreads_internal_queue_t *) queue )->condition_mutex,
-		          &error );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		CTHREADS_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-#endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
+	result = libcthreads_queue_empty(
+	          cthreads_test_queue,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Clean up
-	 */
 	result = libcthreads_queue_free(
-	          &queue,
+	          &cthreads_test_queue,
 	          NULL,
 	          &error );
 
@@ -2612,51 +6999,78 @@ int cthreads_test_queue_push_sorted(
 	 "error",
 	 error );
 
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_queued_value",
+	 cthreads_test_queued_value,
+	 cthreads_test_expected_queued_value );
+
 	return( 1 );
 
 on_error:
 	if( error != NULL )
 	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
 		libcerror_error_free(
 		 &error );
 	}
-	if( queue != NULL )
+	if( pop_thread != NULL )
+	{
+		libcthreads_thread_join(
+		 &pop_thread,
+		 NULL );
+	}
+	if( push_thread != NULL )
+	{
+		libcthreads_thread_join(
+		 &push_thread,
+		 NULL );
+	}
+	if( cthreads_test_queue != NULL )
 	{
 		libcthreads_queue_free(
-		 &queue,
+		 &cthreads_test_queue,
 		 NULL,
 		 NULL );
 	}
 	return( 0 );
 }
 
-/* Tests the libcthreads_queue_push and libcthreads_queue_pop functions in separate threads
+/* Tests the libcthreads_queue_empty function while a producer waits on the full queue in a separate thread
  * Returns 1 if successful or 0 if not
  */
-int cthreads_test_queue_push_pop_threaded(
+int cthreads_test_queue_empty_with_waiting_push_threaded(
      void )
 {
-	libcerror_error_t *error          = NULL;
-	libcthreads_thread_t *pop_thread  = NULL;
-	libcthreads_thread_t *push_thread = NULL;
-	int *queued_values                = NULL;
-	int result                        = 0;
+	int queued_values[ 2 ]             = { 1, 2 };
+
+	libcerror_error_t *error           = NULL;
+	libcthreads_thread_t *empty_thread = NULL;
+	libcthreads_thread_t *push_thread  = NULL;
+	int *queued_value                  = NULL;
+	int result                         = 0;
 
 	/* Initialize test
 	 */
-	cthreads_test_expected_queued_value = 0;
-	cthreads_test_queued_value          = 0;
+	result = libcthreads_queue_initialize(
+	          &cthreads_test_queue,
+	          1,
+	          &error );
 
-	queued_values = (int *) memory_allocate(
-	                         sizeof( int ) * cthreads_test_number_of_iterations );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-	 "queued_values",
-	 queued_values );
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	result = libcthreads_queue_initialize(
-	          &cthreads_test_queue,
-	          cthreads_test_number_of_values,
+	result = libcthreads_queue_push(
+	          cthreads_test_queue,
+	          (intptr_t *) &( queued_values[ 0 ] ),
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -2668,11 +7082,13 @@ int cthreads_test_queue_push_pop_threaded(
 	 "error",
 	 error );
 
+	/* Test regular cases
+	 */
 	result = libcthreads_thread_create(
-	          &push_thread,
+	          &empty_thread,
+	          NULL,
+	          &cthreads_test_queue_empty_callback_function,
 	          NULL,
-	          (int (*)(void *)) &cthreads_test_queue_push_callback_function,
-	          queued_values,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -2684,11 +7100,19 @@ int cthreads_test_queue_push_pop_threaded(
 	 "error",
 	 error );
 
+	result = cthreads_test_queue_wait_for_full_waiters(
+	          1 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
 	result = libcthreads_thread_create(
-	          &pop_thread,
-	          NULL,
-	          (int (*)(void *)) &cthreads_test_queue_pop_callback_function,
+	          &push_thread,
 	          NULL,
+	          (int (*)(void *)) &cthreads_test_queue_push_single_value_callback_function,
+	          &( queued_values[ 1 ] ),
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -2700,8 +7124,39 @@ int cthreads_test_queue_push_pop_threaded(
 	 "error",
 	 error );
 
-	result = libcthreads_thread_join(
-	          &pop_thread,
+	result = cthreads_test_queue_wait_for_full_waiters(
+	          2 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Both the thread emptying the queue and the producer wait on the full condition,
+	 * the pop must wake up the producer otherwise the next pop blocks indefinitely
+	 */
+	result = libcthreads_queue_pop(
+	          cthreads_test_queue,
+	          (intptr_t **) &queued_value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INTPTR(
+	 "queued_value",
+	 (intptr_t) queued_value,
+	 (intptr_t) &( queued_values[ 0 ] ) );
+
+	result = libcthreads_queue_pop(
+	          cthreads_test_queue,
+	          (intptr_t **) &queued_value,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -2713,6 +7168,11 @@ int cthreads_test_queue_push_pop_threaded(
 	 "error",
 	 error );
 
+	CTHREADS_TEST_ASSERT_EQUAL_INTPTR(
+	 "queued_value",
+	 (intptr_t) queued_value,
+	 (intptr_t) &( queued_values[ 1 ] ) );
+
 	result = libcthreads_thread_join(
 	          &push_thread,
 	          &error );
@@ -2726,8 +7186,8 @@ int cthreads_test_queue_push_pop_threaded(
 	 "error",
 	 error );
 
-	result = libcthreads_queue_empty(
-	          cthreads_test_queue,
+	result = libcthreads_thread_join(
+	          &empty_thread,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -2739,6 +7199,8 @@ int cthreads_test_queue_push_pop_threaded(
 	 "error",
 	 error );
 
+	/* Clean up
+	 */
 	result = libcthreads_queue_free(
 	          &cthreads_test_queue,
 	          NULL,
@@ -2753,16 +7215,6 @@ int cthreads_test_queue_push_pop_threaded(
 	 "error",
 	 error );
 
-	memory_free(
-	 queued_values );
-
-	queued_values = NULL;
-
-	CTHREADS_TEST_ASSERT_EQUAL_INT(
-	 "cthreads_test_queued_value",
-	 cthreads_test_queued_value,
-	 cthreads_test_expected_queued_value );
-
 	return( 1 );
 
 on_error:
@@ -2775,16 +7227,16 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( pop_thread != NULL )
+	if( push_thread != NULL )
 	{
 		libcthreads_thread_join(
-		 &pop_thread,
+		 &push_thread,
 		 NULL );
 	}
-	if( push_thread != NULL )
+	if( empty_thread != NULL )
 	{
 		libcthreads_thread_join(
-		 &push_thread,
+		 &empty_thread,
 		 NULL );
 	}
 	if( cthreads_test_queue != NULL )
@@ -2794,11 +7246,6 @@ on_error:
 		 NULL,
 		 NULL );
 	}
-	if( queued_values != NULL )
-	{
-		memory_free(
-		 queued_values );
-	}
 	return( 0 );
 }
 
@@ -2821,10 +7268,34 @@ int main(
 	 "libcthreads_queue_initialize",
 	 cthreads_test_queue_initialize );
 
+	CTHREADS_TEST_RUN(
+	 "libcthreads_queue_initialize",
+	 cthreads_test_queue_initialize_cache_line_layout );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_queue_initialize_with_value_size",
+	 cthreads_test_queue_initialize_with_value_size );
+
 	CTHREADS_TEST_RUN(
 	 "libcthreads_queue_free",
 	 cthreads_test_queue_free );
 
+	CTHREADS_TEST_RUN(
+	 "libcthreads_queue_set_maximum_weight",
+	 cthreads_test_queue_set_maximum_weight );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_queue_set_maximum_spin_count",
+	 cthreads_test_queue_set_maximum_spin_count );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_queue_get_wait_statistics",
+	 cthreads_test_queue_get_wait_statistics );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_queue_get_notify_statistics",
+	 cthreads_test_queue_get_notify_statistics );
+
 	CTHREADS_TEST_RUN(
 	 "libcthreads_queue_empty",
 	 cthreads_test_queue_empty );
@@ -2845,14 +7316,58 @@ int main(
 	 "libcthreads_queue_push",
 	 cthreads_test_queue_push );
 
+	CTHREADS_TEST_RUN(
+	 "libcthreads_queue_try_push_with_weight",
+	 cthreads_test_queue_try_push_with_weight );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_queue_push_with_weight",
+	 cthreads_test_queue_push_with_weight );
+
 	CTHREADS_TEST_RUN(
 	 "libcthreads_queue_push_sorted",
 	 cthreads_test_queue_push_sorted );
 
+	CTHREADS_TEST_RUN(
+	 "libcthreads_queue_try_pop_value",
+	 cthreads_test_queue_try_pop_value );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_queue_pop_value",
+	 cthreads_test_queue_pop_value );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_queue_try_push_value",
+	 cthreads_test_queue_try_push_value );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_queue_push_value",
+	 cthreads_test_queue_push_value );
+
 	CTHREADS_TEST_RUN(
 	 "cthreads_test_queue_push_pop_threaded",
 	 cthreads_test_queue_push_pop_threaded );
 
+	CTHREADS_TEST_RUN(
+	 "cthreads_test_queue_push_with_idle_waiters_threaded",
+	 cthreads_test_queue_push_with_idle_waiters_threaded );
+
+	CTHREADS_TEST_RUN(
+	 "cthreads_test_queue_push_pop_spin_threaded",
+	 cthreads_test_queue_push_pop_spin_threaded );
+
+	CTHREADS_TEST_RUN(
+	 "cthreads_test_queue_push_pop_with_weight_threaded",
+	 cthreads_test_queue_push_pop_with_weight_threaded );
+
+	CTHREADS_TEST_RUN(
+	 "cthreads_test_queue_push_pop_value_threaded",
+	 cthreads_test_queue_push_pop_value_threaded );
+
+	CTHREADS_TEST_RUN(
+	 "cthreads_test_queue_empty_with_waiting_push_threaded",
+	 cthreads_test_queue_empty_with_waiting_push_threaded );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -0,0 +1,2407 @@
+/*
+ * Library queue selector type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <errno.h>
+
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ )
+#define __USE_GNU
+#include <dlfcn.h>
+#undef __USE_GNU
+#endif
+
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( __clang__ ) && !defined( __CYGWIN__ )
+#define HAVE_CTHREADS_TEST_FUNCTION_HOOK	1
+#endif
+
+#include "cthreads_test_libcerror.h"
+#include "cthreads_test_libcthreads.h"
+#include "cthreads_test_macros.h"
+#include "cthreads_test_memory.h"
+#include "cthreads_test_unused.h"
+
+#include "../libcthreads/libcthreads_queue.h"
+#include "../libcthreads/libcthreads_queue_selector.h"
+
+#if defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK )
+
+static int (*cthreads_test_real_pthread_mutex_lock)(pthread_mutex_t *) = NULL;
+int cthreads_test_pthread_mutex_lock_attempts_before_fail              = -1;
+
+/* Custom pthread_mutex_lock for testing error cases
+ * Returns 0 if successful or an error value otherwise
+ */
+int pthread_mutex_lock(
+     pthread_mutex_t *mutex )
+{
+	int result = 0;
+
+	if( cthreads_test_real_pthread_mutex_lock == NULL )
+	{
+		cthreads_test_real_pthread_mutex_lock = dlsym(
+		                                         RTLD_NEXT,
+		                                         "pthread_mutex_lock" );
+
+		if( cthreads_test_real_pthread_mutex_lock == NULL )
+		{
+			return( EBUSY );
+		}
+	}
+	if( cthreads_test_pthread_mutex_lock_attempts_before_fail == 0 )
+	{
+		cthreads_test_pthread_mutex_lock_attempts_before_fail = -1;
+
+		return( EBUSY );
+	}
+	else if( cthreads_test_pthread_mutex_lock_attempts_before_fail > 0 )
+	{
+		cthreads_test_pthread_mutex_lock_attempts_before_fail--;
+	}
+	result = cthreads_test_real_pthread_mutex_lock(
+	          mutex );
+
+	return( result );
+}
+
+static int (*cthreads_test_real_pthread_mutex_unlock)(pthread_mutex_t *) = NULL;
+int cthreads_test_pthread_mutex_unlock_attempts_before_fail              = -1;
+
+/* Custom pthread_mutex_unlock for testing error cases
+ * Returns 0 if successful or an error value otherwise
+ */
+int pthread_mutex_unlock(
+     pthread_mutex_t *mutex )
+{
+	int result = 0;
+
+	if( cthreads_test_real_pthread_mutex_unlock == NULL )
+	{
+		cthreads_test_real_pthread_mutex_unlock = dlsym(
+		                                           RTLD_NEXT,
+		                                           "pthread_mutex_unlock" );
+
+		if( cthreads_test_real_pthread_mutex_unlock == NULL )
+		{
+			return( EBUSY );
+		}
+	}
+	if( cthreads_test_pthread_mutex_unlock_attempts_before_fail == 0 )
+	{
+		cthreads_test_pthread_mutex_unlock_attempts_before_fail = -1;
+
+		return( EBUSY );
+	}
+	else if( cthreads_test_pthread_mutex_unlock_attempts_before_fail > 0 )
+	{
+		cthreads_test_pthread_mutex_unlock_attempts_before_fail--;
+	}
+	result = cthreads_test_real_pthread_mutex_unlock(
+	          mutex );
+
+	return( result );
+}
+
+static int (*cthreads_test_real_pthread_cond_broadcast)(pthread_cond_t *) = NULL;
+int cthreads_test_pthread_cond_broadcast_attempts_before_fail             = -1;
+
+/* Custom pthread_cond_broadcast for testing error cases
+ * Returns 0 if successful or an error value otherwise
+ */
+int pthread_cond_broadcast(
+      pthread_cond_t *cond )
+{
+	int result = 0;
+
+	if( cthreads_test_real_pthread_cond_broadcast == NULL )
+	{
+		cthreads_test_real_pthread_cond_broadcast = dlsym(
+		                                             RTLD_NEXT,
+		                                             "pthread_cond_broadcast" );
+
+		if( cthreads_test_real_pthread_cond_broadcast == NULL )
+		{
+			return( EBUSY );
+		}
+	}
+	if( cthreads_test_pthread_cond_broadcast_attempts_before_fail == 0 )
+	{
+		cthreads_test_pthread_cond_broadcast_attempts_before_fail = -1;
+
+		return( EBUSY );
+	}
+	else if( cthreads_test_pthread_cond_broadcast_attempts_before_fail > 0 )
+	{
+		cthreads_test_pthread_cond_broadcast_attempts_before_fail--;
+	}
+	result = cthreads_test_real_pthread_cond_broadcast(
+	          cond );
+
+	return( result );
+}
+
+static int (*cthreads_test_real_pthread_cond_wait)(pthread_cond_t *, pthread_mutex_t *) = NULL;
+int cthreads_test_pthread_cond_wait_attempts_before_fail                                = -1;
+
+/* Custom pthread_cond_wait for testing error cases
+ * Returns 0 if successful or an error value otherwise
+ */
+int pthread_cond_wait(
+      pthread_cond_t *cond,
+      pthread_mutex_t *mutex )
+{
+	int result = 0;
+
+	if( cthreads_test_real_pthread_cond_wait == NULL )
+	{
+		cthreads_test_real_pthread_cond_wait = dlsym(
+		                                        RTLD_NEXT,
+		                                        "pthread_cond_wait" );
+
+		if( cthreads_test_real_pthread_cond_wait == NULL )
+		{
+			return( EBUSY );
+		}
+	}
+	if( cthreads_test_pthread_cond_wait_attempts_before_fail == 0 )
+	{
+		cthreads_test_pthread_cond_wait_attempts_before_fail = -1;
+
+		return( EBUSY );
+	}
+	else if( cthreads_test_pthread_cond_wait_attempts_before_fail > 0 )
+	{
+		cthreads_test_pthread_cond_wait_attempts_before_fail--;
+	}
+	result = cthreads_test_real_pthread_cond_wait(
+	          cond,
+	          mutex );
+
+	return( result );
+}
+
+#endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
+
+/* The producer of the threaded test
+ */
+typedef struct cthreads_test_queue_selector_producer cthreads_test_queue_selector_producer_t;
+
+struct cthreads_test_queue_selector_producer
+{
+	/* The queue
+	 */
+	libcthreads_queue_t *queue;
+
+	/* The queued values
+	 */
+	int *queued_values;
+
+	/* The sum of the queued values
+	 */
+	int expected_queued_value;
+};
+
+libcthreads_queue_selector_t *cthreads_test_queue_selector = NULL;
+int cthreads_test_queued_value                            = 0;
+int cthreads_test_number_of_iterations                    = 497;
+int cthreads_test_number_of_values                        = 32;
+
+/* The thread pop callback function
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_queue_selector_pop_callback_function(
+     void *arguments CTHREADS_TEST_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "cthreads_test_queue_selector_pop_callback_function";
+	int *queued_value        = NULL;
+	int iterator             = 0;
+	int queue_index          = 0;
+
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( arguments )
+
+	for( iterator = 0;
+	     iterator < ( 2 * cthreads_test_number_of_iterations );
+	     iterator++ )
+	{
+		if( libcthreads_queue_selector_pop(
+		     cthreads_test_queue_selector,
+		     &queue_index,
+		     (intptr_t **) &queued_value,
+		     &error ) == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to pop value off selector.",
+			 function );
+
+			goto on_error;
+		}
+		cthreads_test_queued_value += *queued_value;
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* The thread push callback function
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_queue_selector_push_callback_function(
+     cthreads_test_queue_selector_producer_t *producer )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "cthreads_test_queue_selector_push_callback_function";
+	int iterator             = 0;
+
+	for( iterator = 0;
+	     iterator < cthreads_test_number_of_iterations;
+	     iterator++ )
+	{
+		producer->queued_values[ iterator ] = ( 98 * iterator ) % 45;
+
+		if( libcthreads_queue_push(
+		     producer->queue,
+		     (intptr_t *) &( producer->queued_values[ iterator ] ),
+		     &error ) == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push value onto queue.",
+			 function );
+
+			goto on_error;
+		}
+		producer->expected_queued_value += producer->queued_values[ iterator ];
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* Tests the libcthreads_queue_selector_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_selector_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libcthreads_queue_selector_t *selector = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 3;
+	int number_of_memset_fail_tests        = 3;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcthreads_queue_selector_initialize(
+	          &selector,
+	          LIBCTHREADS_QUEUE_SELECTOR_FLAG_ROUND_ROBIN,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "selector",
+	 selector );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_selector_free(
+	          &selector,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "selector",
+	 selector );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_selector_initialize(
+	          &selector,
+	          LIBCTHREADS_QUEUE_SELECTOR_FLAG_PRIORITY,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_selector_free(
+	          &selector,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_queue_selector_initialize(
+	          NULL,
+	          0,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	selector = (libcthreads_queue_selector_t *) 0x12345678UL;
+
+	result = libcthreads_queue_selector_initialize(
+	          &selector,
+	          0,
+	          &error );
+
+	selector = NULL;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_selector_initialize(
+	          &selector,
+	          0xfe,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcthreads_queue_selector_initialize with malloc failing
+		 */
+		cthreads_test_malloc_attempts_before_fail = test_number;
+
+		result = libcthreads_queue_selector_initialize(
+		          &selector,
+		          0,
+		          &error );
+
+		if( cthreads_test_malloc_attempts_before_fail != -1 )
+		{
+			cthreads_test_malloc_attempts_before_fail = -1;
+
+			if( selector != NULL )
+			{
+				libcthreads_queue_selector_free(
+				 &selector,
+				 NULL );
+			}
+		}
+		else
+		{
+			CTHREADS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CTHREADS_TEST_ASSERT_IS_NULL(
+			 "selector",
+			 selector );
+
+			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcthreads_queue_selector_initialize with memset failing
+		 */
+		cthreads_test_memset_attempts_before_fail = test_number;
+
+		result = libcthreads_queue_selector_initialize(
+		          &selector,
+		          0,
+		          &error );
+
+		if( cthreads_test_memset_attempts_before_fail != -1 )
+		{
+			cthreads_test_memset_attempts_before_fail = -1;
+
+			if( selector != NULL )
+			{
+				libcthreads_queue_selector_free(
+				 &selector,
+				 NULL );
+			}
+		}
+		else
+		{
+			CTHREADS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CTHREADS_TEST_ASSERT_IS_NULL(
+			 "selector",
+			 selector );
+
+			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( selector != NULL )
+	{
+		libcthreads_queue_selector_free(
+		 &selector,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_queue_selector_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_selector_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcthreads_queue_selector_free(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_queue_selector_append_queue function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_selector_append_queue(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libcthreads_queue_selector_t *selector = NULL;
+	libcthreads_queue_t *queues[ 10 ];
+	libcthreads_queue_t *value_queue       = NULL;
+	int queue_index                        = 0;
+	int queue_index_value                  = 0;
+	int result                             = 0;
+
+	for( queue_index = 0;
+	     queue_index < 10;
+	     queue_index++ )
+	{
+		queues[ queue_index ] = NULL;
+	}
+	/* Initialize test
+	 */
+	result = libcthreads_queue_selector_initialize(
+	          &selector,
+	          LIBCTHREADS_QUEUE_SELECTOR_FLAG_ROUND_ROBIN,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_initialize_with_value_size(
+	          &value_queue,
+	          4,
+	          sizeof( int ),
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( queue_index = 0;
+	     queue_index < 10;
+	     queue_index++ )
+	{
+		result = libcthreads_queue_initialize(
+		          &( queues[ queue_index ] ),
+		          4,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcthreads_queue_selector_append_queue(
+		          selector,
+		          queues[ queue_index ],
+		          &queue_index_value,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "queue_index_value",
+		 queue_index_value,
+		 queue_index );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_queues",
+	 ( (libcthreads_internal_queue_selector_t *) selector )->number_of_queues,
+	 10 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_queue_selector_append_queue(
+	          NULL,
+	          queues[ 0 ],
+	          &queue_index,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_selector_append_queue(
+	          selector,
+	          NULL,
+	          &queue_index,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_selector_append_queue(
+	          selector,
+	          queues[ 0 ],
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_selector_append_queue(
+	          selector,
+	          queues[ 0 ],
+	          &queue_index,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_selector_append_queue(
+	          selector,
+	          value_queue,
+	          &queue_index,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK )
+
+	/* Test libcthreads_queue_selector_append_queue with pthread_mutex_lock failing
+	 */
+	cthreads_test_pthread_mutex_lock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_selector_append_queue(
+	          selector,
+	          queues[ 0 ],
+	          &queue_index,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_lock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_lock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
+
+	/* Test freeing a queue that is attached to the selector
+	 */
+	result = libcthreads_queue_free(
+	          &( queues[ 9 ] ),
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_queues",
+	 ( (libcthreads_internal_queue_selector_t *) selector )->number_of_queues,
+	 9 );
+
+	/* Clean up
+	 */
+	result = libcthreads_queue_selector_free(
+	          &selector,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "selector",
+	 ( (libcthreads_internal_queue_t *) queues[ 0 ] )->selector );
+
+	for( queue_index = 0;
+	     queue_index < 9;
+	     queue_index++ )
+	{
+		result = libcthreads_queue_free(
+		          &( queues[ queue_index ] ),
+		          NULL,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcthreads_queue_free(
+	          &value_queue,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( selector != NULL )
+	{
+		libcthreads_queue_selector_free(
+		 &selector,
+		 NULL );
+	}
+	for( queue_index = 0;
+	     queue_index < 10;
+	     queue_index++ )
+	{
+		if( queues[ queue_index ] != NULL )
+		{
+			libcthreads_queue_free(
+			 &queues[ queue_index ],
+			 NULL,
+			 NULL );
+		}
+	}
+	if( value_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &value_queue,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_queue_selector_try_pop function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_selector_try_pop(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libcthreads_queue_selector_t *selector = NULL;
+	libcthreads_queue_t *queue1            = NULL;
+	libcthreads_queue_t *queue2            = NULL;
+	intptr_t *value                        = NULL;
+	int queue_index                        = 0;
+	int queued_value1                      = 1;
+	int queued_value2                      = 2;
+	int queued_value3                      = 3;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_queue_selector_initialize(
+	          &selector,
+	          LIBCTHREADS_QUEUE_SELECTOR_FLAG_ROUND_ROBIN,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_initialize(
+	          &queue1,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_initialize(
+	          &queue2,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_selector_append_queue(
+	          selector,
+	          queue1,
+	          &queue_index,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_selector_append_queue(
+	          selector,
+	          queue2,
+	          &queue_index,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_queue_selector_try_pop(
+	          selector,
+	          &queue_index,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_push(
+	          queue1,
+	          (intptr_t *) &queued_value1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_push(
+	          queue1,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_push(
+	          queue2,
+	          (intptr_t *) &queued_value3,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_selector_try_pop(
+	          selector,
+	          &queue_index,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "queue_index",
+	 queue_index,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 *( (int *) value ),
+	 queued_value1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_selector_try_pop(
+	          selector,
+	          &queue_index,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "queue_index",
+	 queue_index,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 *( (int *) value ),
+	 queued_value3 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_selector_try_pop(
+	          selector,
+	          &queue_index,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "queue_index",
+	 queue_index,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 *( (int *) value ),
+	 queued_value2 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_selector_try_pop(
+	          selector,
+	          &queue_index,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libcthreads_queue_selector_free(
+	          &selector,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_free(
+	          &queue1,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_free(
+	          &queue2,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libcthreads_queue_selector_initialize(
+	          &selector,
+	          LIBCTHREADS_QUEUE_SELECTOR_FLAG_PRIORITY,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_initialize(
+	          &queue1,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_initialize(
+	          &queue2,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_selector_append_queue(
+	          selector,
+	          queue1,
+	          &queue_index,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_selector_append_queue(
+	          selector,
+	          queue2,
+	          &queue_index,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_queue_selector_try_pop(
+	          selector,
+	          &queue_index,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_push(
+	          queue1,
+	          (intptr_t *) &queued_value1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_push(
+	          queue1,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_push(
+	          queue2,
+	          (intptr_t *) &queued_value3,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_selector_try_pop(
+	          selector,
+	          &queue_index,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "queue_index",
+	 queue_index,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 *( (int *) value ),
+	 queued_value1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_selector_try_pop(
+	          selector,
+	          &queue_index,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "queue_index",
+	 queue_index,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 *( (int *) value ),
+	 queued_value2 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_selector_try_pop(
+	          selector,
+	          &queue_index,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "queue_index",
+	 queue_index,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 *( (int *) value ),
+	 queued_value3 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_selector_try_pop(
+	          selector,
+	          &queue_index,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libcthreads_queue_selector_free(
+	          &selector,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_free(
+	          &queue1,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_free(
+	          &queue2,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libcthreads_queue_selector_initialize(
+	          &selector,
+	          0,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_queue_selector_try_pop(
+	          NULL,
+	          &queue_index,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_selector_try_pop(
+	          selector,
+	          NULL,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_selector_try_pop(
+	          selector,
+	          &queue_index,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK )
+
+	/* Test libcthreads_queue_selector_try_pop with pthread_mutex_lock failing
+	 */
+	cthreads_test_pthread_mutex_lock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_selector_try_pop(
+	          selector,
+	          &queue_index,
+	          &value,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_lock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_lock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+
+	/* Test libcthreads_queue_selector_try_pop with pthread_mutex_unlock failing
+	 */
+	cthreads_test_pthread_mutex_unlock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_selector_try_pop(
+	          selector,
+	          &queue_index,
+	          &value,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_unlock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_unlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Manually release the mutex otherwise the selector cannot be freed
+		 */
+		result = libcthreads_mutex_release(
+		          ( (libcthreads_internal_queue_selector_t *) selector )->condition_mutex,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
+
+	/* Clean up
+	 */
+	result = libcthreads_queue_selector_free(
+	          &selector,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( selector != NULL )
+	{
+		libcthreads_queue_selector_free(
+		 &selector,
+		 NULL );
+	}
+	if( queue1 != NULL )
+	{
+		libcthreads_queue_free(
+		 &queue1,
+		 NULL,
+		 NULL );
+	}
+	if( queue2 != NULL )
+	{
+		libcthreads_queue_free(
+		 &queue2,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_queue_selector_pop function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_selector_pop(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libcthreads_queue_selector_t *selector = NULL;
+	libcthreads_queue_t *queue1            = NULL;
+	libcthreads_queue_t *queue2            = NULL;
+	intptr_t *value                        = NULL;
+	int queue_index                        = 0;
+	int queued_value1                      = 1;
+	int queued_value2                      = 2;
+	int queued_value3                      = 3;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_queue_selector_initialize(
+	          &selector,
+	          LIBCTHREADS_QUEUE_SELECTOR_FLAG_ROUND_ROBIN,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_initialize(
+	          &queue1,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_initialize(
+	          &queue2,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_selector_append_queue(
+	          selector,
+	          queue1,
+	          &queue_index,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_selector_append_queue(
+	          selector,
+	          queue2,
+	          &queue_index,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_push(
+	          queue1,
+	          (intptr_t *) &queued_value1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_push(
+	          queue1,
+	          (intptr_t *) &queued_value2,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_push(
+	          queue2,
+	          (intptr_t *) &queued_value3,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_queue_selector_pop(
+	          selector,
+	          &queue_index,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "queue_index",
+	 queue_index,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 *( (int *) value ),
+	 queued_value1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_selector_pop(
+	          selector,
+	          &queue_index,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "queue_index",
+	 queue_index,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 *( (int *) value ),
+	 queued_value3 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_selector_pop(
+	          selector,
+	          &queue_index,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "queue_index",
+	 queue_index,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 *( (int *) value ),
+	 queued_value2 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libcthreads_queue_selector_free(
+	          &selector,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_free(
+	          &queue1,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_queue_free(
+	          &queue2,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libcthreads_queue_selector_initialize(
+	          &selector,
+	          0,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_queue_selector_pop(
+	          NULL,
+	          &queue_index,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_selector_pop(
+	          selector,
+	          NULL,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_queue_selector_pop(
+	          selector,
+	          &queue_index,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK )
+
+	/* Test libcthreads_queue_selector_pop with pthread_mutex_lock failing
+	 */
+	cthreads_test_pthread_mutex_lock_attempts_before_fail = 0;
+
+	result = libcthreads_queue_selector_pop(
+	          selector,
+	          &queue_index,
+	          &value,
+	          &error );
+
+	if( cthreads_test_pthread_mutex_lock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_mutex_lock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+
+	/* Test libcthreads_queue_selector_pop with pthread_cond_wait failing
+	 */
+	cthreads_test_pthread_cond_wait_attempts_before_fail = 0;
+
+	result = libcthreads_queue_selector_pop(
+	          selector,
+	          &queue_index,
+	          &value,
+	          &error );
+
+	if( cthreads_test_pthread_cond_wait_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_cond_wait_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
+
+	/* Clean up
+	 */
+	result = libcthreads_queue_selector_free(
+	          &selector,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( selector != NULL )
+	{
+		libcthreads_queue_selector_free(
+		 &selector,
+		 NULL );
+	}
+	if( queue1 != NULL )
+	{
+		libcthreads_queue_free(
+		 &queue1,
+		 NULL,
+		 NULL );
+	}
+	if( queue2 != NULL )
+	{
+		libcthreads_queue_free(
+		 &queue2,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests pushing values onto multiple queues and popping them with a selector in separate threads
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_queue_selector_push_pop_threaded(
+     void )
+{
+	cthreads_test_queue_selector_producer_t producers[ 2 ];
+
+	libcerror_error_t *error             = NULL;
+	libcthreads_thread_t *pop_thread     = NULL;
+	libcthreads_thread_t *push_threads[ 2 ];
+	int producer_index                   = 0;
+	int queue_index                      = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	cthreads_test_queued_value = 0;
+
+	for( producer_index = 0;
+	     producer_index < 2;
+	     producer_index++ )
+	{
+		producers[ producer_index ].queue                 = NULL;
+		producers[ producer_index ].queued_values         = NULL;
+		producers[ producer_index ].expected_queued_value = 0;
+
+		push_threads[ producer_index ] = NULL;
+	}
+	result = libcthreads_queue_selector_initialize(
+	          &cthreads_test_queue_selector,
+	          0,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( producer_index = 0;
+	     producer_index < 2;
+	     producer_index++ )
+	{
+		producers[ producer_index ].queued_values = (int *) memory_allocate(
+		                                                     sizeof( int ) * cthreads_test_number_of_iterations );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "queued_values",
+		 producers[ producer_index ].queued_values );
+
+		result = libcthreads_queue_initialize(
+		          &( producers[ producer_index ].queue ),
+		          cthreads_test_number_of_values,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcthreads_queue_selector_append_queue(
+		          cthreads_test_queue_selector,
+		          producers[ producer_index ].queue,
+		          &queue_index,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcthreads_thread_create(
+	          &pop_thread,
+	          NULL,
+	          (int (*)(void *)) &cthreads_test_queue_selector_pop_callback_function,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( producer_index = 0;
+	     producer_index < 2;
+	     producer_index++ )
+	{
+		result = libcthreads_thread_create(
+		          &( push_threads[ producer_index ] ),
+		          NULL,
+		          (int (*)(void *)) &cthreads_test_queue_selector_push_callback_function,
+		          &( producers[ producer_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcthreads_thread_join(
+	          &pop_thread,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( producer_index = 0;
+	     producer_index < 2;
+	     producer_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( push_threads[ producer_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_queued_value",
+	 cthreads_test_queued_value,
+	 producers[ 0 ].expected_queued_value + producers[ 1 ].expected_queued_value );
+
+	/* Clean up
+	 */
+	result = libcthreads_queue_selector_free(
+	          &cthreads_test_queue_selector,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( producer_index = 0;
+	     producer_index < 2;
+	     producer_index++ )
+	{
+		result = libcthreads_queue_free(
+		          &( producers[ producer_index ].queue ),
+		          NULL,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		memory_free(
+		 producers[ producer_index ].queued_values );
+
+		producers[ producer_index ].queued_values = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	if( pop_thread != NULL )
+	{
+		libcthreads_thread_join(
+		 &pop_thread,
+		 NULL );
+	}
+	for( producer_index = 0;
+	     producer_index < 2;
+	     producer_index++ )
+	{
+		if( push_threads[ producer_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( push_threads[ producer_index ] ),
+			 NULL );
+		}
+	}
+	if( cthreads_test_queue_selector != NULL )
+	{
+		libcthreads_queue_selector_free(
+		 &cthreads_test_queue_selector,
+		 NULL );
+	}
+	for( producer_index = 0;
+	     producer_index < 2;
+	     producer_index++ )
+	{
+		if( producers[ producer_index ].queue != NULL )
+		{
+			libcthreads_queue_free(
+			 &producers[ producer_index ].queue,
+			 NULL,
+			 NULL );
+		}
+		if( producers[ producer_index ].queued_values != NULL )
+		{
+			memory_free(
+			 producers[ producer_index ].queued_values );
+		}
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argc )
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_queue_selector_initialize",
+	 cthreads_test_queue_selector_initialize );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_queue_selector_free",
+	 cthreads_test_queue_selector_free );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_queue_selector_append_queue",
+	 cthreads_test_queue_selector_append_queue );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_queue_selector_try_pop",
+	 cthreads_test_queue_selector_try_pop );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_queue_selector_pop",
+	 cthreads_test_queue_selector_pop );
+
+	CTHREADS_TEST_RUN(
+	 "cthreads_test_queue_selector_push_pop_threaded",
+	 cthreads_test_queue_selector_push_pop_threaded );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -484,6 +484,134 @@ on_error:
 	return( -1 );
 }
 
+/* The try grab for read thread callback function
+ * Stores the result of libcthreads_read_write_lock_try_grab_for_read in the arguments
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_read_write_lock_try_grab_for_read_callback_function(
+     void *arguments )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "cthreads_test_read_write_lock_try_grab_for_read_callback_function";
+	int *try_grab_result     = NULL;
+	int result               = 0;
+
+	try_grab_result = (int *) arguments;
+
+	result = libcthreads_read_write_lock_try_grab_for_read(
+	          cthreads_test_read_write_lock,
+	          &error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to try to grab read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+	*try_grab_result = result;
+
+	if( result == 1 )
+	{
+		result = libcthreads_read_write_lock_release_for_read(
+		          cthreads_test_read_write_lock,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* The try grab for write thread callback function
+ * Stores the result of libcthreads_read_write_lock_try_grab_for_write in the arguments
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_read_write_lock_try_grab_for_write_callback_function(
+     void *arguments )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "cthreads_test_read_write_lock_try_grab_for_write_callback_function";
+	int *try_grab_result     = NULL;
+	int result               = 0;
+
+	try_grab_result = (int *) arguments;
+
+	result = libcthreads_read_write_lock_try_grab_for_write(
+	          cthreads_test_read_write_lock,
+	          &error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to try to grab read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+	*try_grab_result = result;
+
+	if( result == 1 )
+	{
+		result = libcthreads_read_write_lock_release_for_write(
+		          cthreads_test_read_write_lock,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
 /* Tests the libcthreads_read_write_lock_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -760,6 +888,172 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libcthreads_read_write_lock_initialize_in_place function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_read_write_lock_initialize_in_place(
+     void )
+{
+	libcthreads_read_write_lock_storage_t storage[ 4 ];
+	libcthreads_read_write_lock_t *read_write_locks[ 4 ] = { NULL, NULL, NULL, NULL };
+	libcerror_error_t *error                             = NULL;
+	int index                                            = 0;
+	int result                                           = 0;
+
+	/* Test regular cases
+	 */
+	for( index = 0;
+	     index < 4;
+	     index++ )
+	{
+		result = libcthreads_read_write_lock_initialize_in_place(
+		          &( storage[ index ] ),
+		          &( read_write_locks[ index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "read_write_locks[ index ]",
+		 read_write_locks[ index ] );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( index = 0;
+	     index < 4;
+	     index++ )
+	{
+		result = libcthreads_read_write_lock_grab_for_write(
+		          read_write_locks[ index ],
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libcthreads_read_write_lock_release_for_write(
+		          read_write_locks[ index ],
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( index = 0;
+	     index < 4;
+	     index++ )
+	{
+		result = libcthreads_read_write_lock_free(
+		          &( read_write_locks[ index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "read_write_locks[ index ]",
+		 read_write_locks[ index ] );
+	}
+	/* Test error cases
+	 */
+	result = libcthreads_read_write_lock_initialize_in_place(
+	          NULL,
+	          &( read_write_locks[ 0 ] ),
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_read_write_lock_initialize_in_place(
+	          &( storage[ 0 ] ),
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_write_locks[ 0 ] = (libcthreads_read_write_lock_t *) 0x12345678UL;
+
+	result = libcthreads_read_write_lock_initialize_in_place(
+	          &( storage[ 0 ] ),
+	          &( read_write_locks[ 0 ] ),
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_write_locks[ 0 ] = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( index = 0;
+	     index < 4;
+	     index++ )
+	{
+		if( read_write_locks[ index ] != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( read_write_locks[ index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
 /* Tests the libcthreads_read_write_lock_free function
  * Returns 1 if successful or 0 if not
  */
@@ -1255,16 +1549,16 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcthreads_read_write_lock_grab_for_write function
+/* Tests the libcthreads_read_write_lock_try_grab_for_read function
  * Returns 1 if successful or 0 if not
  */
-int cthreads_test_read_write_lock_grab_for_write(
+int cthreads_test_read_write_lock_try_grab_for_read(
      void )
 {
-	libcerror_error_t *error      = NULL;
-	libcthreads_thread_t *thread1 = NULL;
-	libcthreads_thread_t *thread2 = NULL;
-	int result                    = 0;
+	libcerror_error_t *error     = NULL;
+	libcthreads_thread_t *thread = NULL;
+	int result                   = 0;
+	int try_grab_result          = 0;
 
 	/* Initialize test
 	 */
@@ -1281,10 +1575,13 @@ int cthreads_test_read_write_lock_grab_for_write(
 	 "error",
 	 error );
 
-	/* Test grab
+	/* Test try grab of an unlocked read/write lock
 	 */
-	result = libcthreads_read_write_lock_grab_for_write(
-	          cthreads_test_read_write_lock,
+	result = libcthreads_thread_create(
+	          &thread,
+	          NULL,
+	          cthreads_test_read_write_lock_try_grab_for_read_callback_function,
+	          (void *) &try_grab_result,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1296,13 +1593,8 @@ int cthreads_test_read_write_lock_grab_for_write(
 	 "error",
 	 error );
 
-	/* Initialize test
-	 */
-	result = libcthreads_thread_create(
-	          &thread1,
-	          NULL,
-	          cthreads_test_read_write_lock_grab_for_write_callback_function1,
-	          NULL,
+	result = libcthreads_thread_join(
+	          &thread,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1314,11 +1606,15 @@ int cthreads_test_read_write_lock_grab_for_write(
 	 "error",
 	 error );
 
-	result = libcthreads_thread_create(
-	          &thread2,
-	          NULL,
-	          cthreads_test_read_write_lock_grab_for_write_callback_function2,
-	          NULL,
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "try_grab_result",
+	 try_grab_result,
+	 1 );
+
+	/* Test try grab of a read/write lock that is grabbed for write
+	 */
+	result = libcthreads_read_write_lock_grab_for_write(
+	          cthreads_test_read_write_lock,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1330,13 +1626,12 @@ int cthreads_test_read_write_lock_grab_for_write(
 	 "error",
 	 error );
 
-	cthreads_test_locked_value = 46;
-
-	/* Test release
-	 */
-	result = libcthreads_read_write_lock_release_for_write(
-		  cthreads_test_read_write_lock,
-		  &error );
+	result = libcthreads_thread_create(
+	          &thread,
+	          NULL,
+	          cthreads_test_read_write_lock_try_grab_for_read_callback_function,
+	          (void *) &try_grab_result,
+	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1347,10 +1642,8 @@ int cthreads_test_read_write_lock_grab_for_write(
 	 "error",
 	 error );
 
-	/* Clean up
-	 */
 	result = libcthreads_thread_join(
-	          &thread2,
+	          &thread,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1362,8 +1655,13 @@ int cthreads_test_read_write_lock_grab_for_write(
 	 "error",
 	 error );
 
-	result = libcthreads_thread_join(
-	          &thread1,
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "try_grab_result",
+	 try_grab_result,
+	 0 );
+
+	result = libcthreads_read_write_lock_release_for_write(
+	          cthreads_test_read_write_lock,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -1375,14 +1673,371 @@ int cthreads_test_read_write_lock_grab_for_write(
 	 "error",
 	 error );
 
-	CTHREADS_TEST_ASSERT_EQUAL_INT(
-	 "cthreads_test_locked_value",
-	 cthreads_test_locked_value,
-	 46 + 19 + 38 );
-
 	/* Test error cases
 	 */
-	result = libcthreads_read_write_lock_grab_for_write(
+	result = libcthreads_read_write_lock_try_grab_for_read(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_read_write_lock_free(
+	          &cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cthreads_test_read_write_lock != NULL )
+	{
+		libcthreads_read_write_lock_free(
+		 &cthreads_test_read_write_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_read_write_lock_timed_grab_for_read function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_read_write_lock_timed_grab_for_read(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_read_write_lock_initialize(
+	          &cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test timed grab of an unlocked read/write lock
+	 */
+	result = libcthreads_read_write_lock_timed_grab_for_read(
+	          cthreads_test_read_write_lock,
+	          10,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_read_write_lock_timed_grab_for_read(
+	          cthreads_test_read_write_lock,
+	          0,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_read_write_lock_release_for_read(
+	          cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_read_write_lock_release_for_read(
+	          cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test timed grab of a read/write lock that is grabbed for upgradable reading
+	 */
+	result = libcthreads_read_write_lock_grab_for_upgradable_read(
+	          cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_read_write_lock_timed_grab_for_read(
+	          cthreads_test_read_write_lock,
+	          10,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_read_write_lock_release_for_read(
+	          cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_read_write_lock_release_for_upgradable_read(
+	          cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_read_write_lock_timed_grab_for_read(
+	          NULL,
+	          10,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_read_write_lock_free(
+	          &cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cthreads_test_read_write_lock != NULL )
+	{
+		libcthreads_read_write_lock_free(
+		 &cthreads_test_read_write_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+
+/* Tests the libcthreads_read_write_lock_grab_for_write function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_read_write_lock_grab_for_write(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libcthreads_thread_t *thread1 = NULL;
+	libcthreads_thread_t *thread2 = NULL;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_read_write_lock_initialize(
+	          &cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test grab
+	 */
+	result = libcthreads_read_write_lock_grab_for_write(
+	          cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libcthreads_thread_create(
+	          &thread1,
+	          NULL,
+	          cthreads_test_read_write_lock_grab_for_write_callback_function1,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_create(
+	          &thread2,
+	          NULL,
+	          cthreads_test_read_write_lock_grab_for_write_callback_function2,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	cthreads_test_locked_value = 46;
+
+	/* Test release
+	 */
+	result = libcthreads_read_write_lock_release_for_write(
+		  cthreads_test_read_write_lock,
+		  &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libcthreads_thread_join(
+	          &thread2,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_join(
+	          &thread1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_locked_value",
+	 cthreads_test_locked_value,
+	 46 + 19 + 38 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_read_write_lock_grab_for_write(
 	          NULL,
 	          &error );
 
@@ -1400,88 +2055,880 @@ int cthreads_test_read_write_lock_grab_for_write(
 
 #if defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK )
 
-	/* Test libcthreads_read_write_wrlock_grab with pthread_rwlock_wrlock returning EAGAIN
+	/* Test libcthreads_read_write_wrlock_grab with pthread_rwlock_wrlock returning EAGAIN
+	 */
+	cthreads_test_pthread_rwlock_wrlock_attempts_before_fail       = 0;
+	cthreads_test_real_pthread_rwlock_wrlock_function_return_value = EAGAIN;
+
+	result = libcthreads_read_write_lock_grab_for_write(
+	          cthreads_test_read_write_lock,
+	          &error );
+
+	if( cthreads_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcthreads_read_write_wrlock_grab with pthread_rwlock_wrlock returning EDEADLK
+	 */
+	cthreads_test_pthread_rwlock_wrlock_attempts_before_fail       = 0;
+	cthreads_test_real_pthread_rwlock_wrlock_function_return_value = EDEADLK;
+
+	result = libcthreads_read_write_lock_grab_for_write(
+	          cthreads_test_read_write_lock,
+	          &error );
+
+	if( cthreads_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcthreads_read_write_wrlock_grab with pthread_rwlock_wrlock returning EBUSY
+	 */
+	cthreads_test_pthread_rwlock_wrlock_attempts_before_fail       = 0;
+	cthreads_test_real_pthread_rwlock_wrlock_function_return_value = EBUSY;
+
+	result = libcthreads_read_write_lock_grab_for_write(
+	          cthreads_test_read_write_lock,
+	          &error );
+
+	if( cthreads_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
+	{
+		cthreads_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
+
+	/* Clean up
+	 */
+	result = libcthreads_read_write_lock_free(
+	          &cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread2 != NULL )
+	{
+		libcthreads_thread_join(
+		 &thread2,
+		 NULL );
+	}
+	if( thread1 != NULL )
+	{
+		libcthreads_thread_join(
+		 &thread1,
+		 NULL );
+	}
+	if( cthreads_test_read_write_lock != NULL )
+	{
+		libcthreads_read_write_lock_release_for_write(
+		 cthreads_test_read_write_lock,
+		 NULL );
+		libcthreads_read_write_lock_free(
+		 &cthreads_test_read_write_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_read_write_lock_try_grab_for_write function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_read_write_lock_try_grab_for_write(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libcthreads_thread_t *thread = NULL;
+	int result                   = 0;
+	int try_grab_result          = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_read_write_lock_initialize(
+	          &cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test try grab of an unlocked read/write lock
+	 */
+	result = libcthreads_thread_create(
+	          &thread,
+	          NULL,
+	          cthreads_test_read_write_lock_try_grab_for_write_callback_function,
+	          (void *) &try_grab_result,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_join(
+	          &thread,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "try_grab_result",
+	 try_grab_result,
+	 1 );
+
+	/* Test try grab of a read/write lock that is grabbed for read
+	 */
+	result = libcthreads_read_write_lock_grab_for_read(
+	          cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_create(
+	          &thread,
+	          NULL,
+	          cthreads_test_read_write_lock_try_grab_for_write_callback_function,
+	          (void *) &try_grab_result,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_join(
+	          &thread,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "try_grab_result",
+	 try_grab_result,
+	 0 );
+
+	result = libcthreads_read_write_lock_release_for_read(
+	          cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_read_write_lock_try_grab_for_write(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_read_write_lock_free(
+	          &cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cthreads_test_read_write_lock != NULL )
+	{
+		libcthreads_read_write_lock_free(
+		 &cthreads_test_read_write_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_read_write_lock_timed_grab_for_write function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_read_write_lock_timed_grab_for_write(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_read_write_lock_initialize(
+	          &cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test timed grab of an unlocked read/write lock
+	 */
+	result = libcthreads_read_write_lock_timed_grab_for_write(
+	          cthreads_test_read_write_lock,
+	          10,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test timed grab of a read/write lock that is grabbed for writing
+	 */
+	result = libcthreads_read_write_lock_timed_grab_for_write(
+	          cthreads_test_read_write_lock,
+	          0,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_read_write_lock_timed_grab_for_write(
+	          cthreads_test_read_write_lock,
+	          10,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_read_write_lock_release_for_write(
+	          cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_read_write_lock_timed_grab_for_write(
+	          NULL,
+	          10,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_read_write_lock_free(
+	          &cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cthreads_test_read_write_lock != NULL )
+	{
+		libcthreads_read_write_lock_free(
+		 &cthreads_test_read_write_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_read_write_lock_grab_for_upgradable_read function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_read_write_lock_grab_for_upgradable_read(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libcthreads_thread_t *thread = NULL;
+	int result                   = 0;
+	int try_grab_result          = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_read_write_lock_initialize(
+	          &cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test grab
+	 */
+	result = libcthreads_read_write_lock_grab_for_upgradable_read(
+	          cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that readers can grab the read/write lock and writers cannot
+	 */
+	result = libcthreads_thread_create(
+	          &thread,
+	          NULL,
+	          cthreads_test_read_write_lock_try_grab_for_read_callback_function,
+	          (void *) &try_grab_result,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_join(
+	          &thread,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "try_grab_result",
+	 try_grab_result,
+	 1 );
+
+	result = libcthreads_thread_create(
+	          &thread,
+	          NULL,
+	          cthreads_test_read_write_lock_try_grab_for_write_callback_function,
+	          (void *) &try_grab_result,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_join(
+	          &thread,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "try_grab_result",
+	 try_grab_result,
+	 0 );
+
+	/* Test release
 	 */
-	cthreads_test_pthread_rwlock_wrlock_attempts_before_fail       = 0;
-	cthreads_test_real_pthread_rwlock_wrlock_function_return_value = EAGAIN;
+	result = libcthreads_read_write_lock_release_for_upgradable_read(
+	          cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_create(
+	          &thread,
+	          NULL,
+	          cthreads_test_read_write_lock_try_grab_for_write_callback_function,
+	          (void *) &try_grab_result,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_join(
+	          &thread,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "try_grab_result",
+	 try_grab_result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_read_write_lock_grab_for_upgradable_read(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_read_write_lock_release_for_upgradable_read(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_read_write_lock_free(
+	          &cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cthreads_test_read_write_lock != NULL )
+	{
+		libcthreads_read_write_lock_free(
+		 &cthreads_test_read_write_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_read_write_lock_upgrade function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_read_write_lock_upgrade(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libcthreads_thread_t *thread = NULL;
+	int result                   = 0;
+	int try_grab_result          = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_read_write_lock_initialize(
+	          &cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test upgrade
+	 */
+	result = libcthreads_read_write_lock_grab_for_upgradable_read(
+	          cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_read_write_lock_upgrade(
+	          cthreads_test_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that readers and writers cannot grab the upgraded read/write lock
+	 */
+	result = libcthreads_thread_create(
+	          &thread,
+	          NULL,
+	          cthreads_test_read_write_lock_try_grab_for_read_callback_function,
+	          (void *) &try_grab_result,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_join(
+	          &thread,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "try_grab_result",
+	 try_grab_result,
+	 0 );
+
+	result = libcthreads_thread_create(
+	          &thread,
+	          NULL,
+	          cthreads_test_read_write_lock_try_grab_for_write_callback_function,
+	          (void *) &try_grab_result,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_join(
+	          &thread,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	result = libcthreads_read_write_lock_grab_for_write(
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "try_grab_result",
+	 try_grab_result,
+	 0 );
+
+	result = libcthreads_read_write_lock_release_for_write(
 	          cthreads_test_read_write_lock,
 	          &error );
 
-	if( cthreads_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libcthreads_read_write_wrlock_grab with pthread_rwlock_wrlock returning EDEADLK
-	 */
-	cthreads_test_pthread_rwlock_wrlock_attempts_before_fail       = 0;
-	cthreads_test_real_pthread_rwlock_wrlock_function_return_value = EDEADLK;
+	result = libcthreads_thread_create(
+	          &thread,
+	          NULL,
+	          cthreads_test_read_write_lock_try_grab_for_read_callback_function,
+	          (void *) &try_grab_result,
+	          &error );
 
-	result = libcthreads_read_write_lock_grab_for_write(
-	          cthreads_test_read_write_lock,
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_join(
+	          &thread,
 	          &error );
 
-	if( cthreads_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libcthreads_read_write_wrlock_grab with pthread_rwlock_wrlock returning EBUSY
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "try_grab_result",
+	 try_grab_result,
+	 1 );
+
+	/* Test error cases
 	 */
-	cthreads_test_pthread_rwlock_wrlock_attempts_before_fail       = 0;
-	cthreads_test_real_pthread_rwlock_wrlock_function_return_value = EBUSY;
+	result = libcthreads_read_write_lock_upgrade(
+	          NULL,
+	          &error );
 
-	result = libcthreads_read_write_lock_grab_for_write(
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test upgrade of a read/write lock that is not grabbed for upgradable reading
+	 */
+	result = libcthreads_read_write_lock_upgrade(
 	          cthreads_test_read_write_lock,
 	          &error );
 
-	if( cthreads_test_pthread_rwlock_wrlock_attempts_before_fail != -1 )
-	{
-		cthreads_test_pthread_rwlock_wrlock_attempts_before_fail = -1;
-	}
-	else
-	{
-		CTHREADS_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_CTHREADS_TEST_FUNCTION_HOOK ) */
+	libcerror_error_free(
+	 &error );
 
 	/* Clean up
 	 */
@@ -1503,30 +2950,11 @@ int cthreads_test_read_write_lock_grab_for_write(
 on_error:
 	if( error != NULL )
 	{
-		libcerror_error_backtrace_fprint(
-		 error,
-		 stdout );
-
 		libcerror_error_free(
 		 &error );
 	}
-	if( thread2 != NULL )
-	{
-		libcthreads_thread_join(
-		 &thread2,
-		 NULL );
-	}
-	if( thread1 != NULL )
-	{
-		libcthreads_thread_join(
-		 &thread1,
-		 NULL );
-	}
 	if( cthreads_test_read_write_lock != NULL )
 	{
-		libcthreads_read_write_lock_release_for_write(
-		 cthreads_test_read_write_lock,
-		 NULL );
 		libcthreads_read_write_lock_free(
 		 &cthreads_test_read_write_lock,
 		 NULL );
@@ -1746,6 +3174,115 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libcthreads_read_write_lock_set_profile_name function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_read_write_lock_set_profile_name(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libcthreads_read_write_lock_t *read_write_lock = NULL;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_read_write_lock_initialize(
+	          &read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_read_write_lock_set_profile_name(
+	          read_write_lock,
+	          "cthreads_test_read_write_lock",
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_read_write_lock_set_profile_name(
+	          NULL,
+	          "cthreads_test_read_write_lock",
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_read_write_lock_set_profile_name(
+	          read_write_lock,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_read_write_lock_free(
+	          &read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_write_lock != NULL )
+	{
+		libcthreads_read_write_lock_free(
+		 &read_write_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -1765,6 +3302,10 @@ int main(
 	 "libcthreads_read_write_lock_initialize",
 	 cthreads_test_read_write_lock_initialize );
 
+	CTHREADS_TEST_RUN(
+	 "libcthreads_read_write_lock_initialize_in_place",
+	 cthreads_test_read_write_lock_initialize_in_place );
+
 	CTHREADS_TEST_RUN(
 	 "libcthreads_read_write_lock_free",
 	 cthreads_test_read_write_lock_free );
@@ -1773,10 +3314,34 @@ int main(
 	 "libcthreads_read_write_lock_grab_for_read",
 	 cthreads_test_read_write_lock_grab_for_read );
 
+	CTHREADS_TEST_RUN(
+	 "libcthreads_read_write_lock_try_grab_for_read",
+	 cthreads_test_read_write_lock_try_grab_for_read );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_read_write_lock_timed_grab_for_read",
+	 cthreads_test_read_write_lock_timed_grab_for_read );
+
 	CTHREADS_TEST_RUN(
 	 "libcthreads_read_write_lock_grab_for_write",
 	 cthreads_test_read_write_lock_grab_for_write );
 
+	CTHREADS_TEST_RUN(
+	 "libcthreads_read_write_lock_try_grab_for_write",
+	 cthreads_test_read_write_lock_try_grab_for_write );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_read_write_lock_timed_grab_for_write",
+	 cthreads_test_read_write_lock_timed_grab_for_write );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_read_write_lock_grab_for_upgradable_read",
+	 cthreads_test_read_write_lock_grab_for_upgradable_read );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_read_write_lock_upgrade",
+	 cthreads_test_read_write_lock_upgrade );
+
 	CTHREADS_TEST_RUN(
 	 "libcthreads_read_write_lock_release_for_read",
 	 cthreads_test_read_write_lock_release_for_read );
@@ -1785,6 +3350,10 @@ int main(
 	 "libcthreads_read_write_lock_release_for_write",
 	 cthreads_test_read_write_lock_release_for_write );
 
+	CTHREADS_TEST_RUN(
+	 "libcthreads_read_write_lock_set_profile_name",
+	 cthreads_test_read_write_lock_set_profile_name );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -0,0 +1,1123 @@
+/*
+ * Library sequence lock type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cthreads_test_libcerror.h"
+#include "cthreads_test_libcthreads.h"
+#include "cthreads_test_macros.h"
+#include "cthreads_test_memory.h"
+#include "cthreads_test_unused.h"
+
+libcthreads_sequence_lock_t *cthreads_test_sequence_lock = NULL;
+volatile int cthreads_test_values[ 4 ]               = { 0, 0, 0, 0 };
+
+/* The writer thread callback function
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_sequence_lock_write_callback_function(
+     void *arguments CTHREADS_TEST_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "cthreads_test_sequence_lock_write_callback_function";
+	int iterator             = 0;
+	int result               = 0;
+	int value_index          = 0;
+
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( arguments )
+
+	for( iterator = 1;
+	     iterator <= 20000;
+	     iterator++ )
+	{
+		result = libcthreads_sequence_lock_grab_for_write(
+		          cthreads_test_sequence_lock,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab sequence lock for write.",
+			 function );
+
+			goto on_error;
+		}
+		for( value_index = 0;
+		     value_index < 4;
+		     value_index++ )
+		{
+			cthreads_test_values[ value_index ] = iterator;
+		}
+		result = libcthreads_sequence_lock_release_for_write(
+		          cthreads_test_sequence_lock,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release sequence lock for write.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* The reader thread callback function
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_sequence_lock_read_callback_function(
+     void *arguments )
+{
+	int values[ 4 ];
+
+	libcerror_error_t *error  = NULL;
+	static char *function     = "cthreads_test_sequence_lock_read_callback_function";
+	int *number_of_mismatches = NULL;
+	uint32_t sequence         = 0;
+	int iterator              = 0;
+	int result                = 0;
+	int value_index           = 0;
+
+	number_of_mismatches = (int *) arguments;
+
+	for( iterator = 0;
+	     iterator < 20000;
+	     iterator++ )
+	{
+		do
+		{
+			result = libcthreads_sequence_lock_begin_read(
+			          cthreads_test_sequence_lock,
+			          &sequence,
+			          &error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to begin sequence lock read.",
+				 function );
+
+				goto on_error;
+			}
+			for( value_index = 0;
+			     value_index < 4;
+			     value_index++ )
+			{
+				values[ value_index ] = cthreads_test_values[ value_index ];
+			}
+			result = libcthreads_sequence_lock_end_read(
+			          cthreads_test_sequence_lock,
+			          sequence,
+			          &error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to end sequence lock read.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		while( result == 0 );
+
+		for( value_index = 1;
+		     value_index < 4;
+		     value_index++ )
+		{
+			if( values[ value_index ] != values[ 0 ] )
+			{
+				*number_of_mismatches += 1;
+
+				break;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* Tests the libcthreads_sequence_lock_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_sequence_lock_initialize(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libcthreads_sequence_lock_t *sequence_lock = NULL;
+	int result                                 = 0;
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcthreads_sequence_lock_initialize(
+	          &sequence_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "sequence_lock",
+	 sequence_lock );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_sequence_lock_free(
+	          &sequence_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "sequence_lock",
+	 sequence_lock );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_sequence_lock_initialize(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sequence_lock = (libcthreads_sequence_lock_t *) 0x12345678UL;
+
+	result = libcthreads_sequence_lock_initialize(
+	          &sequence_lock,
+	          &error );
+
+	sequence_lock = NULL;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcthreads_sequence_lock_initialize with malloc failing
+		 */
+		cthreads_test_malloc_attempts_before_fail = test_number;
+
+		result = libcthreads_sequence_lock_initialize(
+		          &sequence_lock,
+		          &error );
+
+		if( cthreads_test_malloc_attempts_before_fail != -1 )
+		{
+			cthreads_test_malloc_attempts_before_fail = -1;
+
+			if( sequence_lock != NULL )
+			{
+				libcthreads_sequence_lock_free(
+				 &sequence_lock,
+				 NULL );
+			}
+		}
+		else
+		{
+			CTHREADS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CTHREADS_TEST_ASSERT_IS_NULL(
+			 "sequence_lock",
+			 sequence_lock );
+
+			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcthreads_sequence_lock_initialize with memset failing
+		 */
+		cthreads_test_memset_attempts_before_fail = test_number;
+
+		result = libcthreads_sequence_lock_initialize(
+		          &sequence_lock,
+		          &error );
+
+		if( cthreads_test_memset_attempts_before_fail != -1 )
+		{
+			cthreads_test_memset_attempts_before_fail = -1;
+
+			if( sequence_lock != NULL )
+			{
+				libcthreads_sequence_lock_free(
+				 &sequence_lock,
+				 NULL );
+			}
+		}
+		else
+		{
+			CTHREADS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CTHREADS_TEST_ASSERT_IS_NULL(
+			 "sequence_lock",
+			 sequence_lock );
+
+			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sequence_lock != NULL )
+	{
+		libcthreads_sequence_lock_free(
+		 &sequence_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_sequence_lock_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_sequence_lock_free(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libcthreads_sequence_lock_t *sequence_lock = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_sequence_lock_initialize(
+	          &sequence_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_sequence_lock_free(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test free of a sequence lock that is grabbed for write
+	 */
+	result = libcthreads_sequence_lock_grab_for_write(
+	          sequence_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_sequence_lock_free(
+	          &sequence_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "sequence_lock",
+	 sequence_lock );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sequence_lock != NULL )
+	{
+		libcthreads_sequence_lock_free(
+		 &sequence_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_sequence_lock_begin_read function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_sequence_lock_begin_read(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libcthreads_sequence_lock_t *sequence_lock = NULL;
+	int result                                 = 0;
+	uint32_t sequence                          = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_sequence_lock_initialize(
+	          &sequence_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_sequence_lock_begin_read(
+	          sequence_lock,
+	          &sequence,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_UINT32(
+	 "sequence",
+	 sequence,
+	 (uint32_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_sequence_lock_begin_read(
+	          NULL,
+	          &sequence,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_sequence_lock_begin_read(
+	          sequence_lock,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_sequence_lock_free(
+	          &sequence_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sequence_lock != NULL )
+	{
+		libcthreads_sequence_lock_free(
+		 &sequence_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_sequence_lock_end_read function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_sequence_lock_end_read(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libcthreads_thread_t *threads[ 4 ] = { NULL, NULL, NULL, NULL };
+	int number_of_mismatches[ 4 ]      = { 0, 0, 0, 0 };
+	uint32_t sequence                  = 0;
+	int result                         = 0;
+	int thread_index                   = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_sequence_lock_initialize(
+	          &cthreads_test_sequence_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_sequence_lock_begin_read(
+	          cthreads_test_sequence_lock,
+	          &sequence,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_sequence_lock_end_read(
+	          cthreads_test_sequence_lock,
+	          sequence,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a read section that is interrupted by a writer
+	 */
+	result = libcthreads_sequence_lock_begin_read(
+	          cthreads_test_sequence_lock,
+	          &sequence,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_sequence_lock_grab_for_write(
+	          cthreads_test_sequence_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_sequence_lock_release_for_write(
+	          cthreads_test_sequence_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_sequence_lock_end_read(
+	          cthreads_test_sequence_lock,
+	          sequence,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test readers that run concurrently with a writer
+	 */
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          ( thread_index == 0 ) ? cthreads_test_sequence_lock_write_callback_function : cthreads_test_sequence_lock_read_callback_function,
+		          (void *) &( number_of_mismatches[ thread_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "number_of_mismatches[ thread_index ]",
+		 number_of_mismatches[ thread_index ],
+		 0 );
+	}
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_values[ 0 ]",
+	 cthreads_test_values[ 0 ],
+	 20000 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_sequence_lock_end_read(
+	          NULL,
+	          sequence,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_sequence_lock_free(
+	          &cthreads_test_sequence_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	if( cthreads_test_sequence_lock != NULL )
+	{
+		libcthreads_sequence_lock_free(
+		 &cthreads_test_sequence_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_sequence_lock_grab_for_write function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_sequence_lock_grab_for_write(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libcthreads_sequence_lock_t *sequence_lock = NULL;
+	int result                                 = 0;
+	uint32_t sequence                          = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_sequence_lock_initialize(
+	          &sequence_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_sequence_lock_grab_for_write(
+	          sequence_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_sequence_lock_release_for_write(
+	          sequence_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_sequence_lock_begin_read(
+	          sequence_lock,
+	          &sequence,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_UINT32(
+	 "sequence",
+	 sequence,
+	 (uint32_t) 2 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_sequence_lock_grab_for_write(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_sequence_lock_free(
+	          &sequence_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sequence_lock != NULL )
+	{
+		libcthreads_sequence_lock_free(
+		 &sequence_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_sequence_lock_release_for_write function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_sequence_lock_release_for_write(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libcthreads_sequence_lock_t *sequence_lock = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_sequence_lock_initialize(
+	          &sequence_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_sequence_lock_grab_for_write(
+	          sequence_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_sequence_lock_release_for_write(
+	          sequence_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_sequence_lock_release_for_write(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test release of a sequence lock that is not grabbed for write
+	 */
+	result = libcthreads_sequence_lock_release_for_write(
+	          sequence_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_sequence_lock_free(
+	          &sequence_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sequence_lock != NULL )
+	{
+		libcthreads_sequence_lock_free(
+		 &sequence_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argc )
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_sequence_lock_initialize",
+	 cthreads_test_sequence_lock_initialize );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_sequence_lock_free",
+	 cthreads_test_sequence_lock_free );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_sequence_lock_begin_read",
+	 cthreads_test_sequence_lock_begin_read );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_sequence_lock_end_read",
+	 cthreads_test_sequence_lock_end_read );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_sequence_lock_grab_for_write",
+	 cthreads_test_sequence_lock_grab_for_write );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_sequence_lock_release_for_write",
+	 cthreads_test_sequence_lock_release_for_write );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1326 @@
+/*
+ * Library sharded read/write lock type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cthreads_test_libcerror.h"
+#include "cthreads_test_libcthreads.h"
+#include "cthreads_test_macros.h"
+#include "cthreads_test_memory.h"
+#include "cthreads_test_unused.h"
+
+libcthreads_sharded_read_write_lock_t *cthreads_test_sharded_read_write_lock = NULL;
+int cthreads_test_first_value                                                = 0;
+int cthreads_test_second_value                                               = 0;
+
+/* The reader thread callback function
+ * The arguments contain the number of mismatches seen by the reader
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_sharded_read_write_lock_read_callback_function(
+     void *arguments )
+{
+	libcerror_error_t *error  = NULL;
+	static char *function     = "cthreads_test_sharded_read_write_lock_read_callback_function";
+	int *number_of_mismatches = NULL;
+	int iterator              = 0;
+	int result                = 0;
+	int shard_index           = 0;
+
+	number_of_mismatches = (int *) arguments;
+
+	for( iterator = 0;
+	     iterator < 10000;
+	     iterator++ )
+	{
+		result = libcthreads_sharded_read_write_lock_grab_for_read(
+		          cthreads_test_sharded_read_write_lock,
+		          &shard_index,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab sharded read/write lock for read.",
+			 function );
+
+			goto on_error;
+		}
+		if( cthreads_test_first_value != cthreads_test_second_value )
+		{
+			*number_of_mismatches += 1;
+		}
+		result = libcthreads_sharded_read_write_lock_release_for_read(
+		          cthreads_test_sharded_read_write_lock,
+		          shard_index,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release sharded read/write lock for read.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* The writer thread callback function
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_sharded_read_write_lock_write_callback_function(
+     void *arguments CTHREADS_TEST_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "cthreads_test_sharded_read_write_lock_write_callback_function";
+	int iterator             = 0;
+	int result               = 0;
+
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( arguments )
+
+	for( iterator = 0;
+	     iterator < 1000;
+	     iterator++ )
+	{
+		result = libcthreads_sharded_read_write_lock_grab_for_write(
+		          cthreads_test_sharded_read_write_lock,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab sharded read/write lock for write.",
+			 function );
+
+			goto on_error;
+		}
+		cthreads_test_first_value  += 1;
+		cthreads_test_second_value += 1;
+
+		result = libcthreads_sharded_read_write_lock_release_for_write(
+		          cthreads_test_sharded_read_write_lock,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release sharded read/write lock for write.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* Tests the libcthreads_sharded_read_write_lock_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_sharded_read_write_lock_initialize(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libcthreads_sharded_read_write_lock_t *sharded_read_write_lock = NULL;
+	int result                                                     = 0;
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 2;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcthreads_sharded_read_write_lock_initialize(
+	          &sharded_read_write_lock,
+	          0,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "sharded_read_write_lock",
+	 sharded_read_write_lock );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_sharded_read_write_lock_free(
+	          &sharded_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_sharded_read_write_lock_initialize(
+	          &sharded_read_write_lock,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "sharded_read_write_lock",
+	 sharded_read_write_lock );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_sharded_read_write_lock_free(
+	          &sharded_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "sharded_read_write_lock",
+	 sharded_read_write_lock );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_sharded_read_write_lock_initialize(
+	          NULL,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sharded_read_write_lock = (libcthreads_sharded_read_write_lock_t *) 0x12345678UL;
+
+	result = libcthreads_sharded_read_write_lock_initialize(
+	          &sharded_read_write_lock,
+	          4,
+	          &error );
+
+	sharded_read_write_lock = NULL;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_sharded_read_write_lock_initialize(
+	          &sharded_read_write_lock,
+	          -1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_sharded_read_write_lock_initialize(
+	          &sharded_read_write_lock,
+	          1025,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcthreads_sharded_read_write_lock_initialize with malloc failing
+		 */
+		cthreads_test_malloc_attempts_before_fail = test_number;
+
+		result = libcthreads_sharded_read_write_lock_initialize(
+		          &sharded_read_write_lock,
+		          4,
+		          &error );
+
+		if( cthreads_test_malloc_attempts_before_fail != -1 )
+		{
+			cthreads_test_malloc_attempts_before_fail = -1;
+
+			if( sharded_read_write_lock != NULL )
+			{
+				libcthreads_sharded_read_write_lock_free(
+				 &sharded_read_write_lock,
+				 NULL );
+			}
+		}
+		else
+		{
+			CTHREADS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CTHREADS_TEST_ASSERT_IS_NULL(
+			 "sharded_read_write_lock",
+			 sharded_read_write_lock );
+
+			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcthreads_sharded_read_write_lock_initialize with memset failing
+		 */
+		cthreads_test_memset_attempts_before_fail = test_number;
+
+		result = libcthreads_sharded_read_write_lock_initialize(
+		          &sharded_read_write_lock,
+		          4,
+		          &error );
+
+		if( cthreads_test_memset_attempts_before_fail != -1 )
+		{
+			cthreads_test_memset_attempts_before_fail = -1;
+
+			if( sharded_read_write_lock != NULL )
+			{
+				libcthreads_sharded_read_write_lock_free(
+				 &sharded_read_write_lock,
+				 NULL );
+			}
+		}
+		else
+		{
+			CTHREADS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CTHREADS_TEST_ASSERT_IS_NULL(
+			 "sharded_read_write_lock",
+			 sharded_read_write_lock );
+
+			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sharded_read_write_lock != NULL )
+	{
+		libcthreads_sharded_read_write_lock_free(
+		 &sharded_read_write_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_sharded_read_write_lock_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_sharded_read_write_lock_free(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libcthreads_sharded_read_write_lock_t *sharded_read_write_lock = NULL;
+	int result                                                     = 0;
+	int shard_index                                                = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_sharded_read_write_lock_initialize(
+	          &sharded_read_write_lock,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_sharded_read_write_lock_free(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test free of a sharded read/write lock that is grabbed for read
+	 */
+	result = libcthreads_sharded_read_write_lock_grab_for_read(
+	          sharded_read_write_lock,
+	          &shard_index,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_sharded_read_write_lock_free(
+	          &sharded_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "sharded_read_write_lock",
+	 sharded_read_write_lock );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sharded_read_write_lock != NULL )
+	{
+		libcthreads_sharded_read_write_lock_free(
+		 &sharded_read_write_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_sharded_read_write_lock_get_number_of_shards function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_sharded_read_write_lock_get_number_of_shards(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libcthreads_sharded_read_write_lock_t *sharded_read_write_lock = NULL;
+	int result                                                     = 0;
+	int number_of_shards                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_sharded_read_write_lock_initialize(
+	          &sharded_read_write_lock,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_sharded_read_write_lock_get_number_of_shards(
+	          sharded_read_write_lock,
+	          &number_of_shards,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_shards",
+	 number_of_shards,
+	 4 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_sharded_read_write_lock_get_number_of_shards(
+	          NULL,
+	          &number_of_shards,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_sharded_read_write_lock_get_number_of_shards(
+	          sharded_read_write_lock,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_sharded_read_write_lock_free(
+	          &sharded_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sharded_read_write_lock != NULL )
+	{
+		libcthreads_sharded_read_write_lock_free(
+		 &sharded_read_write_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_sharded_read_write_lock_grab_for_read function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_sharded_read_write_lock_grab_for_read(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libcthreads_thread_t *threads[ 5 ] = { NULL, NULL, NULL, NULL, NULL };
+	int number_of_mismatches[ 5 ]      = { 0, 0, 0, 0, 0 };
+	int result                         = 0;
+	int shard_index                    = 0;
+	int thread_index                   = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_sharded_read_write_lock_initialize(
+	          &cthreads_test_sharded_read_write_lock,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_sharded_read_write_lock_grab_for_read(
+	          cthreads_test_sharded_read_write_lock,
+	          &shard_index,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_GREATER_THAN_INT(
+	 "shard_index",
+	 shard_index,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_LESS_THAN_INT(
+	 "shard_index",
+	 shard_index,
+	 4 );
+
+	result = libcthreads_sharded_read_write_lock_grab_for_read(
+	          cthreads_test_sharded_read_write_lock,
+	          &shard_index,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_sharded_read_write_lock_release_for_read(
+	          cthreads_test_sharded_read_write_lock,
+	          shard_index,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_sharded_read_write_lock_release_for_read(
+	          cthreads_test_sharded_read_write_lock,
+	          shard_index,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test readers that run concurrently with a writer
+	 */
+	for( thread_index = 0;
+	     thread_index < 5;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          ( thread_index == 0 ) ? cthreads_test_sharded_read_write_lock_write_callback_function : cthreads_test_sharded_read_write_lock_read_callback_function,
+		          (void *) &( number_of_mismatches[ thread_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < 5;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_first_value",
+	 cthreads_test_first_value,
+	 1000 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "cthreads_test_second_value",
+	 cthreads_test_second_value,
+	 1000 );
+
+	for( thread_index = 0;
+	     thread_index < 5;
+	     thread_index++ )
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "number_of_mismatches[ thread_index ]",
+		 number_of_mismatches[ thread_index ],
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = libcthreads_sharded_read_write_lock_grab_for_read(
+	          NULL,
+	          &shard_index,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_sharded_read_write_lock_grab_for_read(
+	          cthreads_test_sharded_read_write_lock,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_sharded_read_write_lock_free(
+	          &cthreads_test_sharded_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < 5;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	if( cthreads_test_sharded_read_write_lock != NULL )
+	{
+		libcthreads_sharded_read_write_lock_free(
+		 &cthreads_test_sharded_read_write_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_sharded_read_write_lock_release_for_read function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_sharded_read_write_lock_release_for_read(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libcthreads_sharded_read_write_lock_t *sharded_read_write_lock = NULL;
+	int result                                                     = 0;
+	int shard_index                                                = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_sharded_read_write_lock_initialize(
+	          &sharded_read_write_lock,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_sharded_read_write_lock_grab_for_read(
+	          sharded_read_write_lock,
+	          &shard_index,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_sharded_read_write_lock_release_for_read(
+	          sharded_read_write_lock,
+	          shard_index,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_sharded_read_write_lock_release_for_read(
+	          NULL,
+	          shard_index,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_sharded_read_write_lock_release_for_read(
+	          sharded_read_write_lock,
+	          -1,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_sharded_read_write_lock_release_for_read(
+	          sharded_read_write_lock,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test release of a shard that is not grabbed for read
+	 */
+	result = libcthreads_sharded_read_write_lock_release_for_read(
+	          sharded_read_write_lock,
+	          shard_index,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_sharded_read_write_lock_free(
+	          &sharded_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sharded_read_write_lock != NULL )
+	{
+		libcthreads_sharded_read_write_lock_free(
+		 &sharded_read_write_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_sharded_read_write_lock_grab_for_write function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_sharded_read_write_lock_grab_for_write(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libcthreads_sharded_read_write_lock_t *sharded_read_write_lock = NULL;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_sharded_read_write_lock_initialize(
+	          &sharded_read_write_lock,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_sharded_read_write_lock_grab_for_write(
+	          sharded_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_sharded_read_write_lock_release_for_write(
+	          sharded_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_sharded_read_write_lock_grab_for_write(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_sharded_read_write_lock_free(
+	          &sharded_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sharded_read_write_lock != NULL )
+	{
+		libcthreads_sharded_read_write_lock_free(
+		 &sharded_read_write_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_sharded_read_write_lock_release_for_write function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_sharded_read_write_lock_release_for_write(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libcthreads_sharded_read_write_lock_t *sharded_read_write_lock = NULL;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_sharded_read_write_lock_initialize(
+	          &sharded_read_write_lock,
+	          4,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_sharded_read_write_lock_grab_for_write(
+	          sharded_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_sharded_read_write_lock_release_for_write(
+	          sharded_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_sharded_read_write_lock_release_for_write(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test release of a sharded read/write lock that is not grabbed for write
+	 */
+	result = libcthreads_sharded_read_write_lock_release_for_write(
+	          sharded_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_sharded_read_write_lock_free(
+	          &sharded_read_write_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sharded_read_write_lock != NULL )
+	{
+		libcthreads_sharded_read_write_lock_free(
+		 &sharded_read_write_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argc )
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_sharded_read_write_lock_initialize",
+	 cthreads_test_sharded_read_write_lock_initialize );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_sharded_read_write_lock_free",
+	 cthreads_test_sharded_read_write_lock_free );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_sharded_read_write_lock_get_number_of_shards",
+	 cthreads_test_sharded_read_write_lock_get_number_of_shards );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_sharded_read_write_lock_grab_for_read",
+	 cthreads_test_sharded_read_write_lock_grab_for_read );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_sharded_read_write_lock_release_for_read",
+	 cthreads_test_sharded_read_write_lock_release_for_read );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_sharded_read_write_lock_grab_for_write",
+	 cthreads_test_sharded_read_write_lock_grab_for_write );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_sharded_read_write_lock_release_for_write",
+	 cthreads_test_sharded_read_write_lock_release_for_write );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
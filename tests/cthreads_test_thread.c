@@ -167,6 +167,21 @@ int cthreads_test_thread_error_callback_function(
 	return( -1 );
 }
 
+/* The thread callback function that counts down a latch
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_thread_latch_callback_function(
+     void *arguments )
+{
+	if( libcthreads_latch_count_down(
+	     (libcthreads_latch_t *) arguments,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Tests the libcthreads_thread_create function
  * Returns 1 if successful or 0 if not
  */
@@ -474,6 +489,163 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libcthreads_thread_create_detached function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_thread_create_detached(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libcthreads_latch_t *latch = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_latch_initialize(
+	          &latch,
+	          2,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_thread_create_detached(
+	          NULL,
+	          &cthreads_test_thread_latch_callback_function,
+	          (void *) latch,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_create_detached(
+	          NULL,
+	          &cthreads_test_thread_latch_callback_function,
+	          (void *) latch,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The detached threads cannot be joined, hence wait for their callback functions to run
+	 */
+	result = libcthreads_latch_wait(
+	          latch,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_thread_create_detached(
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+
+	/* Test libcthreads_thread_create_detached with malloc failing
+	 */
+	cthreads_test_malloc_attempts_before_fail = 0;
+
+	result = libcthreads_thread_create_detached(
+	          NULL,
+	          &cthreads_test_thread_callback_function,
+	          NULL,
+	          &error );
+
+	if( cthreads_test_malloc_attempts_before_fail != -1 )
+	{
+		cthreads_test_malloc_attempts_before_fail = -1;
+	}
+	else
+	{
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libcthreads_latch_free(
+	          &latch,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( latch != NULL )
+	{
+		libcthreads_latch_free(
+		 &latch,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libcthreads_thread_join function
  * Returns 1 if successful or 0 if not
  */
@@ -716,6 +888,10 @@ int main(
 	 "libcthreads_thread_create",
 	 cthreads_test_thread_create );
 
+	CTHREADS_TEST_RUN(
+	 "libcthreads_thread_create_detached",
+	 cthreads_test_thread_create_detached );
+
 	CTHREADS_TEST_RUN(
 	 "libcthreads_thread_join",
 	 cthreads_test_thread_join );
@@ -0,0 +1,817 @@
+/*
+ * Library thread local key type test program
+ *
+ * Copyright (C) 2012-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cthreads_test_libcerror.h"
+#include "cthreads_test_libcthreads.h"
+#include "cthreads_test_macros.h"
+#include "cthreads_test_memory.h"
+#include "cthreads_test_unused.h"
+
+libcthreads_thread_local_key_t *cthreads_test_thread_local_key = NULL;
+
+int cthreads_test_thread_local_key_values[ 4 ] = { 0, 0, 0, 0 };
+
+/* The destructor function of the thread local key values
+ */
+void cthreads_test_thread_local_key_destructor_function(
+      void *value )
+{
+	int *number_of_calls = NULL;
+
+	if( value != NULL )
+	{
+		number_of_calls = (int *) value;
+
+		*number_of_calls += 1;
+	}
+}
+
+/* The thread callback function that sets the thread local key value
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_thread_local_key_set_value_callback_function(
+     void *arguments )
+{
+	libcerror_error_t *error = NULL;
+	void *value              = NULL;
+	static char *function    = "cthreads_test_thread_local_key_set_value_callback_function";
+
+	if( libcthreads_thread_local_key_get_value(
+	     cthreads_test_thread_local_key,
+	     &value,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value.",
+		 function );
+
+		goto on_error;
+	}
+	if( value != NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid value already set.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_local_key_set_value(
+	     cthreads_test_thread_local_key,
+	     arguments,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_local_key_get_value(
+	     cthreads_test_thread_local_key,
+	     &value,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value.",
+		 function );
+
+		goto on_error;
+	}
+	if( value != arguments )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stdout );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* Tests the libcthreads_thread_local_key_create function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_thread_local_key_create(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libcthreads_thread_local_key_t *thread_local_key = NULL;
+	int result                                       = 0;
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcthreads_thread_local_key_create(
+	          &thread_local_key,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "thread_local_key",
+	 thread_local_key );
+
+	result = libcthreads_thread_local_key_delete(
+	          &thread_local_key,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_local_key_create(
+	          &thread_local_key,
+	          &cthreads_test_thread_local_key_destructor_function,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "thread_local_key",
+	 thread_local_key );
+
+	result = libcthreads_thread_local_key_delete(
+	          &thread_local_key,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "thread_local_key",
+	 thread_local_key );
+
+	/* Test error cases
+	 */
+	result = libcthreads_thread_local_key_create(
+	          NULL,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	thread_local_key = (libcthreads_thread_local_key_t *) 0x12345678UL;
+
+	result = libcthreads_thread_local_key_create(
+	          &thread_local_key,
+	          NULL,
+	          &error );
+
+	thread_local_key = NULL;
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CTHREADS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcthreads_thread_local_key_create with malloc failing
+		 */
+		cthreads_test_malloc_attempts_before_fail = test_number;
+
+		result = libcthreads_thread_local_key_create(
+		          &thread_local_key,
+		          NULL,
+		          &error );
+
+		if( cthreads_test_malloc_attempts_before_fail != -1 )
+		{
+			cthreads_test_malloc_attempts_before_fail = -1;
+
+			if( thread_local_key != NULL )
+			{
+				libcthreads_thread_local_key_delete(
+				 &thread_local_key,
+				 NULL );
+			}
+		}
+		else
+		{
+			CTHREADS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CTHREADS_TEST_ASSERT_IS_NULL(
+			 "thread_local_key",
+			 thread_local_key );
+
+			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcthreads_thread_local_key_create with memset failing
+		 */
+		cthreads_test_memset_attempts_before_fail = test_number;
+
+		result = libcthreads_thread_local_key_create(
+		          &thread_local_key,
+		          NULL,
+		          &error );
+
+		if( cthreads_test_memset_attempts_before_fail != -1 )
+		{
+			cthreads_test_memset_attempts_before_fail = -1;
+
+			if( thread_local_key != NULL )
+			{
+				libcthreads_thread_local_key_delete(
+				 &thread_local_key,
+				 NULL );
+			}
+		}
+		else
+		{
+			CTHREADS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CTHREADS_TEST_ASSERT_IS_NULL(
+			 "thread_local_key",
+			 thread_local_key );
+
+			CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CTHREADS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_local_key != NULL )
+	{
+		libcthreads_thread_local_key_delete(
+		 &thread_local_key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_thread_local_key_delete function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_thread_local_key_delete(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libcthreads_thread_local_key_t *thread_local_key = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_thread_local_key_create(
+	          &thread_local_key,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_thread_local_key_delete(
+	          &thread_local_key,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "thread_local_key",
+	 thread_local_key );
+
+	result = libcthreads_thread_local_key_delete(
+	          &thread_local_key,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_thread_local_key_delete(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_local_key != NULL )
+	{
+		libcthreads_thread_local_key_delete(
+		 &thread_local_key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_thread_local_key_get_value function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_thread_local_key_get_value(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libcthreads_thread_local_key_t *thread_local_key = NULL;
+	void *value                                      = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_thread_local_key_create(
+	          &thread_local_key,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_thread_local_key_get_value(
+	          thread_local_key,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "value",
+	 value );
+
+	result = libcthreads_thread_local_key_set_value(
+	          thread_local_key,
+	          (void *) &result,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_local_key_get_value(
+	          thread_local_key,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INTPTR(
+	 "value",
+	 (intptr_t) value,
+	 (intptr_t) &result );
+
+	result = libcthreads_thread_local_key_set_value(
+	          thread_local_key,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcthreads_thread_local_key_get_value(
+	          NULL,
+	          &value,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_thread_local_key_get_value(
+	          thread_local_key,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_thread_local_key_delete(
+	          &thread_local_key,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_local_key != NULL )
+	{
+		libcthreads_thread_local_key_delete(
+		 &thread_local_key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcthreads_thread_local_key_set_value function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_thread_local_key_set_value(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libcthreads_thread_t *threads[ 4 ] = { NULL, NULL, NULL, NULL };
+	int result                         = 0;
+	int thread_index                   = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_thread_local_key_create(
+	          &cthreads_test_thread_local_key,
+	          &cthreads_test_thread_local_key_destructor_function,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcthreads_thread_local_key_set_value(
+	          cthreads_test_thread_local_key,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test threads that set a value and call the destructor function on exit
+	 */
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		cthreads_test_thread_local_key_values[ thread_index ] = 0;
+
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          cthreads_test_thread_local_key_set_value_callback_function,
+		          (void *) &( cthreads_test_thread_local_key_values[ thread_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "number_of_calls",
+		 cthreads_test_thread_local_key_values[ thread_index ],
+		 1 );
+	}
+	/* Test error cases
+	 */
+	result = libcthreads_thread_local_key_set_value(
+	          NULL,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_thread_local_key_delete(
+	          &cthreads_test_thread_local_key,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	if( cthreads_test_thread_local_key != NULL )
+	{
+		libcthreads_thread_local_key_delete(
+		 &cthreads_test_thread_local_key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argc )
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_thread_local_key_create",
+	 cthreads_test_thread_local_key_create );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_thread_local_key_delete",
+	 cthreads_test_thread_local_key_delete );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_thread_local_key_get_value",
+	 cthreads_test_thread_local_key_get_value );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_thread_local_key_set_value",
+	 cthreads_test_thread_local_key_set_value );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
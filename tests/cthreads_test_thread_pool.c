@@ -34,6 +34,8 @@
 #include "cthreads_test_memory.h"
 #include "cthreads_test_unused.h"
 
+#include "../libcthreads/libcthreads_thread_pool.h"
+
 libcthreads_lock_t *cthreads_test_lock  = NULL;
 int cthreads_test_expected_queued_value = 0;
 int cthreads_test_queued_value          = 0;
@@ -111,6 +113,75 @@ on_error:
 	return( -1 );
 }
 
+#if !defined( WINAPI ) || ( WINVER < 0x0602 )
+
+/* Waits until the queue of the thread pool is empty and a specific number of workers wait on the empty condition
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_thread_pool_wait_for_idle_workers(
+     libcthreads_thread_pool_t *thread_pool,
+     int number_of_workers )
+{
+	libcerror_error_t *error                                 = NULL;
+	libcthreads_internal_thread_pool_t *internal_thread_pool = NULL;
+	static char *function                                    = "cthreads_test_thread_pool_wait_for_idle_workers";
+	int number_of_empty_waiters                              = 0;
+	int number_of_values                                     = 0;
+
+	internal_thread_pool = (libcthreads_internal_thread_pool_t *) thread_pool;
+
+	do
+	{
+		if( libcthreads_mutex_grab(
+		     internal_thread_pool->condition_mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab condition mutex.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_empty_waiters = internal_thread_pool->number_of_empty_waiters;
+		number_of_values        = internal_thread_pool->number_of_values;
+
+		if( libcthreads_mutex_release(
+		     internal_thread_pool->condition_mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release condition mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( ( number_of_values != 0 )
+	    || ( number_of_empty_waiters < number_of_workers ) );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+#endif /* !defined( WINAPI ) || ( WINVER < 0x0602 ) */
+
 /* Tests the libcthreads_thread_pool_create function
  * Returns 1 if successful or 0 if not
  */
@@ -360,6 +431,110 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the cache line layout of the thread pool created by the libcthreads_thread_pool_create function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_thread_pool_create_cache_line_layout(
+     void )
+{
+	libcerror_error_t *error                                 = NULL;
+	libcthreads_internal_thread_pool_t *internal_thread_pool = NULL;
+	libcthreads_thread_pool_t *thread_pool                   = NULL;
+	int gap_size                                             = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = libcthreads_thread_pool_create(
+	          &thread_pool,
+	          NULL,
+	          1,
+	          32,
+	          &cthreads_test_thread_pool_callback_function,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_thread_pool = (libcthreads_internal_thread_pool_t *) thread_pool;
+
+	/* Test regular cases
+	 */
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "values_array alignment",
+	 (int) ( (intptr_t) internal_thread_pool->values_array % LIBCTHREADS_CACHE_LINE_SIZE ),
+	 0 );
+
+	/* The shared state and the read-mostly state must not share a cache line
+	 */
+	gap_size = (int) ( (intptr_t) &( internal_thread_pool->number_of_values ) - (intptr_t) &( internal_thread_pool->status ) ) - (int) sizeof( uint8_t );
+
+	CTHREADS_TEST_ASSERT_GREATER_THAN_INT(
+	 "gap_size",
+	 gap_size,
+	 LIBCTHREADS_CACHE_LINE_SIZE - 1 );
+
+	/* The consumer state and the shared state must not share a cache line
+	 */
+	gap_size = (int) ( (intptr_t) &( internal_thread_pool->pop_index ) - (intptr_t) &( internal_thread_pool->current_weight ) ) - (int) sizeof( size_t );
+
+	CTHREADS_TEST_ASSERT_GREATER_THAN_INT(
+	 "gap_size",
+	 gap_size,
+	 LIBCTHREADS_CACHE_LINE_SIZE - 1 );
+
+	/* The producer state and the consumer state must not share a cache line
+	 */
+	gap_size = (int) ( (intptr_t) &( internal_thread_pool->push_index ) - (intptr_t) &( internal_thread_pool->spin_wait ) ) - (int) sizeof( libcthreads_spin_wait_t );
+
+	CTHREADS_TEST_ASSERT_GREATER_THAN_INT(
+	 "gap_size",
+	 gap_size,
+	 LIBCTHREADS_CACHE_LINE_SIZE - 1 );
+
+	/* Clean up
+	 */
+	result = libcthreads_thread_pool_join(
+	          &thread_pool,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests thread pool push
  * Returns 1 if successful or -1 on error
  */
@@ -526,19 +701,136 @@ on_error:
 	return( -1 );
 }
 
-/* Tests the libcthreads_thread_join function
- * Returns 1 if successful or 0 if not
+/* Tests thread pool push with weight
+ * Returns 1 if successful or -1 on error
  */
-int cthreads_test_thread_join(
+int cthreads_test_thread_pool_push_with_weight(
      void )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error          = NULL;
+	libcthreads_thread_t *thread_pool = NULL;
+	int *queued_values                = NULL;
+	int iterator                      = 0;
+	int result                        = 0;
+
+	cthreads_test_expected_queued_value = 0;
+	cthreads_test_queued_value          = 0;
+
+	queued_values = (int *) memory_allocate(
+	                         sizeof( int ) * cthreads_test_number_of_iterations );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "queued_values",
+	 queued_values );
+
+	result = libcthreads_lock_initialize(
+	          &cthreads_test_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "cthreads_test_lock",
+	 cthreads_test_lock );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_pool_create(
+	          &thread_pool,
+	          NULL,
+	          8,
+	          cthreads_test_number_of_values,
+	          &cthreads_test_thread_pool_callback_function,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_pool_set_maximum_weight(
+	          thread_pool,
+	          16,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( iterator = 0;
+	     iterator < cthreads_test_number_of_iterations;
+	     iterator++ )
+	{
+		queued_values[ iterator ] = ( 98 * iterator ) % 45;
+
+		/* Every 64th value exceeds the maximum weight
+		 */
+		result = libcthreads_thread_pool_push_with_weight(
+		          thread_pool,
+		          (intptr_t *) &( queued_values[ iterator ] ),
+		          ( ( iterator % 64 ) == 0 ) ? 32 : (size_t) ( iterator % 7 ) + 1,
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		cthreads_test_expected_queued_value += queued_values[ iterator ];
+	}
+	result = libcthreads_thread_pool_join(
+	          &thread_pool,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ( cthreads_test_queued_value == cthreads_test_expected_queued_value );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	/* Test error cases
 	 */
-	result = libcthreads_thread_join(
+	result = libcthreads_thread_pool_push_with_weight(
 	          NULL,
+	          (intptr_t *) &( queued_values[ 0 ] ),
+	          1,
 	          &error );
 
 	CTHREADS_TEST_ASSERT_EQUAL_INT(
@@ -553,35 +845,609 @@ int cthreads_test_thread_join(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
+	result = libcthreads_thread_pool_set_maximum_weight(
+	          NULL,
+	          16,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-/* The main program
- */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
-#endif
-{
-	CTHREADS_TEST_UNREFERENCED_PARAMETER( argc )
-	CTHREADS_TEST_UNREFERENCED_PARAMETER( argv )
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	CTHREADS_TEST_RUN(
-	 "libcthreads_thread_pool_create",
-	 cthreads_test_thread_pool_create );
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_lock_free(
+	          &cthreads_test_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "cthreads_test_lock",
+	 cthreads_test_lock );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 queued_values );
+
+	queued_values = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( cthreads_test_lock != NULL )
+	{
+		libcthreads_lock_release(
+		 cthreads_test_lock,
+		 NULL );
+		libcthreads_lock_free(
+		 &cthreads_test_lock,
+		 NULL );
+	}
+	if( queued_values != NULL )
+	{
+		memory_free(
+		 queued_values );
+	}
+	return( -1 );
+}
+
+/* Tests thread pool push with spinning consumers
+ * Returns 1 if successful or -1 on error
+ */
+int cthreads_test_thread_pool_push_with_spinning(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libcthreads_thread_t *thread_pool = NULL;
+	uint64_t number_of_notifications  = 0;
+	uint64_t number_of_parks          = 0;
+	uint64_t number_of_spin_hits      = 0;
+	uint64_t number_of_wake_ups       = 0;
+	int *queued_values                = NULL;
+	int iterator                      = 0;
+	int result                        = 0;
+	int spin_count                    = 0;
+
+	cthreads_test_expected_queued_value = 0;
+	cthreads_test_queued_value          = 0;
+
+	queued_values = (int *) memory_allocate(
+	                         sizeof( int ) * cthreads_test_number_of_iterations );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "queued_values",
+	 queued_values );
+
+	result = libcthreads_lock_initialize(
+	          &cthreads_test_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "cthreads_test_lock",
+	 cthreads_test_lock );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_pool_create(
+	          &thread_pool,
+	          NULL,
+	          8,
+	          cthreads_test_number_of_values,
+	          &cthreads_test_thread_pool_callback_function,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_pool_set_maximum_spin_count(
+	          thread_pool,
+	          4096,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( iterator = 0;
+	     iterator < cthreads_test_number_of_iterations;
+	     iterator++ )
+	{
+		queued_values[ iterator ] = ( 98 * iterator ) % 45;
+
+		result = libcthreads_thread_pool_push(
+		          thread_pool,
+		          (intptr_t *) &( queued_values[ iterator ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		cthreads_test_expected_queued_value += queued_values[ iterator ];
+	}
+	result = libcthreads_thread_pool_get_wait_statistics(
+	          thread_pool,
+	          &number_of_spin_hits,
+	          &number_of_parks,
+	          &spin_count,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CTHREADS_TEST_ASSERT_LESS_THAN_INT(
+	 "spin_count",
+	 spin_count,
+	 4096 + 1 );
+
+	result = libcthreads_thread_pool_get_notify_statistics(
+	          thread_pool,
+	          &number_of_notifications,
+	          &number_of_wake_ups,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Every push and pop notifies at most a single waiter
+	 */
+	CTHREADS_TEST_ASSERT_LESS_THAN_UINT64(
+	 "number_of_notifications",
+	 number_of_notifications,
+	 (uint64_t) ( 2 * cthreads_test_number_of_iterations ) + 1 );
+
+	result = libcthreads_thread_pool_join(
+	          &thread_pool,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "thread_pool",
+	 thread_pool );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ( cthreads_test_queued_value == cthreads_test_expected_queued_value );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libcthreads_thread_pool_set_maximum_spin_count(
+	          NULL,
+	          4096,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_thread_pool_get_wait_statistics(
+	          NULL,
+	          &number_of_spin_hits,
+	          &number_of_parks,
+	          &spin_count,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcthreads_thread_pool_get_notify_statistics(
+	          NULL,
+	          &number_of_notifications,
+	          &number_of_wake_ups,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcthreads_lock_free(
+	          &cthreads_test_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "cthreads_test_lock",
+	 cthreads_test_lock );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 queued_values );
+
+	queued_values = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( cthreads_test_lock != NULL )
+	{
+		libcthreads_lock_release(
+		 cthreads_test_lock,
+		 NULL );
+		libcthreads_lock_free(
+		 &cthreads_test_lock,
+		 NULL );
+	}
+	if( queued_values != NULL )
+	{
+		memory_free(
+		 queued_values );
+	}
+	return( -1 );
+}
+
+#if !defined( WINAPI ) || ( WINVER < 0x0602 )
+
+/* Tests thread pool push while all the workers are idle
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_thread_pool_push_with_idle_workers(
+     void )
+{
+	int queued_values[ 4 ]                 = { 1, 2, 3, 4 };
+
+	libcerror_error_t *error               = NULL;
+	libcthreads_thread_pool_t *thread_pool = NULL;
+	uint64_t number_of_notifications       = 0;
+	uint64_t number_of_wake_ups            = 0;
+	int iterator                           = 0;
+	int result                             = 0;
+
+	cthreads_test_expected_queued_value = 0;
+	cthreads_test_queued_value          = 0;
+
+	result = libcthreads_lock_initialize(
+	          &cthreads_test_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcthreads_thread_pool_create(
+	          &thread_pool,
+	          NULL,
+	          4,
+	          cthreads_test_number_of_values,
+	          &cthreads_test_thread_pool_callback_function,
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cthreads_test_thread_pool_wait_for_idle_workers(
+	          thread_pool,
+	          4 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	for( iterator = 0;
+	     iterator < 4;
+	     iterator++ )
+	{
+		result = libcthreads_thread_pool_push(
+		          thread_pool,
+		          (intptr_t *) &( queued_values[ iterator ] ),
+		          &error );
+
+		CTHREADS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CTHREADS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		cthreads_test_expected_queued_value += queued_values[ iterator ];
+	}
+	result = cthreads_test_thread_pool_wait_for_idle_workers(
+	          thread_pool,
+	          4 );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcthreads_thread_pool_get_notify_statistics(
+	          thread_pool,
+	          &number_of_notifications,
+	          &number_of_wake_ups,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Every push wakes up a single idle worker, waking up all of them
+	 * would make the workers that find no value wait again
+	 */
+	CTHREADS_TEST_ASSERT_LESS_THAN_UINT64(
+	 "number_of_notifications",
+	 number_of_notifications,
+	 (uint64_t) 4 + 1 );
+
+	CTHREADS_TEST_ASSERT_LESS_THAN_UINT64(
+	 "number_of_wake_ups",
+	 number_of_wake_ups,
+	 (uint64_t) 4 + 1 );
+
+	result = libcthreads_thread_pool_join(
+	          &thread_pool,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = ( cthreads_test_queued_value == cthreads_test_expected_queued_value );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Clean up
+	 */
+	result = libcthreads_lock_free(
+	          &cthreads_test_lock,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CTHREADS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( cthreads_test_lock != NULL )
+	{
+		libcthreads_lock_free(
+		 &cthreads_test_lock,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* !defined( WINAPI ) || ( WINVER < 0x0602 ) */
+
+/* Tests the libcthreads_thread_join function
+ * Returns 1 if successful or 0 if not
+ */
+int cthreads_test_thread_join(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcthreads_thread_join(
+	          NULL,
+	          &error );
+
+	CTHREADS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CTHREADS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CTHREADS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CTHREADS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argc )
+	CTHREADS_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_thread_pool_create",
+	 cthreads_test_thread_pool_create );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_thread_pool_create",
+	 cthreads_test_thread_pool_create_cache_line_layout );
 
 	CTHREADS_TEST_RUN(
 	 "libcthreads_thread_pool_join",
@@ -591,6 +1457,22 @@ int main(
 	 "libcthreads_thread_pool_push",
 	 cthreads_test_thread_pool_push );
 
+	CTHREADS_TEST_RUN(
+	 "libcthreads_thread_pool_push_with_weight",
+	 cthreads_test_thread_pool_push_with_weight );
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_thread_pool_push_with_spinning",
+	 cthreads_test_thread_pool_push_with_spinning );
+
+#if !defined( WINAPI ) || ( WINVER < 0x0602 )
+
+	CTHREADS_TEST_RUN(
+	 "libcthreads_thread_pool_push_with_idle_workers",
+	 cthreads_test_thread_pool_push_with_idle_workers );
+
+#endif /* !defined( WINAPI ) || ( WINVER < 0x0602 ) */
+
 	return( EXIT_SUCCESS );
 
 on_error:
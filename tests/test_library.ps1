@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "condition error lock mutex queue read_write_lock repeating_thread support thread thread_attributes thread_pool"
+$LibraryTests = "atomic barrier condition epoch error hazard_pointer latch lazy_value light_mutex lock lock_table mcs_lock mutex once profile queue queue_selector read_write_lock repeating_thread semaphore sequence_lock sharded_read_write_lock striped_counter support thread thread_attributes thread_local_key thread_pool validator"
 $LibraryTestsWithInput = ""
 $OptionSets = "" -split " "
 